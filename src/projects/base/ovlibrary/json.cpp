@@ -18,8 +18,8 @@ namespace ov
 
 	ov::String Json::Stringify(const ::Json::Value &value)
 	{
-		::Json::StreamWriterBuilder builder;
-		std::unique_ptr<::Json::StreamWriter> const writer(builder.newStreamWriter());
+		// StreamWriterBuilder 가 설정을 파싱하여 writer 를 생성하므로, thread 별로 생성하여 재사용함
+		static thread_local std::unique_ptr<::Json::StreamWriter> const writer(::Json::StreamWriterBuilder().newStreamWriter());
 
 		std::ostringstream stream;
 
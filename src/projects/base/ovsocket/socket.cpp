@@ -886,6 +886,16 @@ namespace ov
 		return true;
 	}
 
+	bool Socket::GetSrtStats(SRT_TRACEBSTATS *stats, bool clear) const
+	{
+		if((GetType() != SocketType::Srt) || (_state == SocketState::Closed))
+		{
+			return false;
+		}
+
+		return (::srt_bstats(_socket.GetSocket(), stats, clear ? 1 : 0) != SRT_ERROR);
+	}
+
 	SocketState Socket::GetState() const
 	{
 		return _state;
@@ -926,27 +936,8 @@ namespace ov
 					{
 						if(errno == EAGAIN)
 						{
-							// Wait for the send buffer
-							fd_set write_fds {};
-							FD_ZERO(&write_fds);
-							FD_SET(sock, &write_fds);
-
-							timeval tv {};
-							tv.tv_sec = 1;
-
-							int select_result = select(sock + 1, nullptr, &write_fds, nullptr, &tv);
-
-							if(select_result > 0)
-							{
-								// send buffer is available
-							}
-							else if(select_result == 0)
-							{
-								// timed out
-							}
-							else
+							if(WaitForSendBuffer(sock) == false)
 							{
-								logtw("[%p] [#%d] An error occurred while select(): %d (%s)", this, sock, select_result, ov::Error::CreateErrorFromErrno()->ToString().CStr());
 								break;
 							}
 
@@ -969,7 +960,7 @@ namespace ov
 
 			case SocketType::Srt:
 			{
-				SRT_MSGCTRL msgctrl {};
+				SRT_MSGCTRL msgctrl = srt_msgctrl_default;
 
 				// 10b == start of frame
 				//msgctrl.boundary = 2;
@@ -987,11 +978,20 @@ namespace ov
 
 					int sent = ::srt_sendmsg2(_socket.GetSocket(), reinterpret_cast<const char *>(data_to_send), to_send, &msgctrl);
 
-					if(sent == -1L)
+					if(sent == SRT_ERROR)
 					{
-						if(errno == EAGAIN)
+						if(srt_getlasterror(nullptr) == SRT_EASYNCSND)
 						{
-							continue;
+							// 송신 buffer가 가득 참 - 나머지 message를 보내지 않으면 수신측에서 frame을 복원할 수 없으므로 buffer가 빌 때 까지 대기
+							if(WaitForSrtSendBuffer(_socket.GetSocket(), SrtSendBufferTimeout))
+							{
+								continue;
+							}
+
+							// 상대방이 데이터를 가져가지 않음 - frame이 이미 깨졌으므로 실패로 처리
+							logtw("[%p] [#%d] Could not send data: send buffer is still full after %d ms (%zu bytes remained)", this, _socket.GetSocket(), SrtSendBufferTimeout, remained);
+
+							return -1L;
 						}
 
 						logtw("[%p] [#%d] Could not send data: %zd (%s)", this, _socket.GetSocket(), sent, ov::Error::CreateErrorFromSrt()->ToString().CStr());
@@ -1027,6 +1027,153 @@ namespace ov
 		return Send(data->GetData(), data->GetLength());
 	}
 
+	ssize_t Socket::Send(struct iovec *vectors, int count)
+	{
+		size_t length = 0L;
+
+		for(int index = 0; index < count; index++)
+		{
+			length += vectors[index].iov_len;
+		}
+
+		if(GetType() != SocketType::Tcp)
+		{
+			// 메시지 단위 소켓(UDP/SRT)은 버퍼별로 송신
+			size_t total_sent = 0L;
+
+			for(int index = 0; index < count; index++)
+			{
+				ssize_t sent = Send(vectors[index].iov_base, vectors[index].iov_len);
+
+				if(sent > 0L)
+				{
+					total_sent += sent;
+				}
+
+				if(sent != static_cast<ssize_t>(vectors[index].iov_len))
+				{
+					break;
+				}
+			}
+
+			return total_sent;
+		}
+
+		logtd("[%p] [#%d] Trying to send data %zu bytes (%d vectors)...", this, _socket.GetSocket(), length, count);
+
+		msghdr message {};
+		message.msg_iov = vectors;
+		message.msg_iovlen = static_cast<size_t>(count);
+
+		size_t total_sent = 0L;
+
+		while(total_sent < length)
+		{
+			int sock = _socket.GetSocket();
+			ssize_t sent = ::sendmsg(sock, &message, MSG_NOSIGNAL | (_is_nonblock ? MSG_DONTWAIT : 0));
+
+			if(sent == -1L)
+			{
+				if(errno == EAGAIN)
+				{
+					if(WaitForSendBuffer(sock) == false)
+					{
+						break;
+					}
+
+					continue;
+				}
+
+				logtw("[%p] [#%d] Could not send data: %zd (%s)", this, sock, sent, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+
+				break;
+			}
+
+			total_sent += sent;
+
+			// 송신된 버퍼 건너뜀
+			while((sent > 0L) && (message.msg_iovlen > 0))
+			{
+				auto vector = message.msg_iov;
+
+				if(static_cast<size_t>(sent) >= vector->iov_len)
+				{
+					sent -= vector->iov_len;
+
+					message.msg_iov++;
+					message.msg_iovlen--;
+				}
+				else
+				{
+					vector->iov_base = static_cast<uint8_t *>(vector->iov_base) + sent;
+					vector->iov_len -= sent;
+
+					sent = 0L;
+				}
+			}
+		}
+
+		logtd("[%p] [#%d] %zu bytes sent", this, _socket.GetSocket(), total_sent);
+
+		return total_sent;
+	}
+
+	bool Socket::WaitForSendBuffer(socket_t sock)
+	{
+		fd_set write_fds {};
+		FD_ZERO(&write_fds);
+		FD_SET(sock, &write_fds);
+
+		timeval tv {};
+		tv.tv_sec = 1;
+
+		int select_result = select(sock + 1, nullptr, &write_fds, nullptr, &tv);
+
+		if(select_result < 0)
+		{
+			logtw("[%p] [#%d] An error occurred while select(): %d (%s)", this, sock, select_result, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			return false;
+		}
+
+		// send buffer is available or timed out
+		return true;
+	}
+
+	bool Socket::WaitForSrtSendBuffer(SRTSOCKET sock, int timeout_msec)
+	{
+		int epoll = ::srt_epoll_create();
+
+		if(epoll == SRT_ERROR)
+		{
+			logtw("[%p] [#%d] Could not create epoll: %s", this, sock, ov::Error::CreateErrorFromSrt()->ToString().CStr());
+			return false;
+		}
+
+		int events = SRT_EPOLL_OUT | SRT_EPOLL_ERR;
+		bool result = false;
+
+		if(::srt_epoll_add_usock(epoll, sock, &events) != SRT_ERROR)
+		{
+			SRTSOCKET write_fds[1];
+			int write_count = OV_COUNTOF(write_fds);
+			SRTSOCKET error_fds[1];
+			int error_count = OV_COUNTOF(error_fds);
+
+			int wait_result = ::srt_epoll_wait(epoll, error_fds, &error_count, write_fds, &write_count, timeout_msec, nullptr, nullptr, nullptr, nullptr);
+
+			// SRT는 오류가 발생한 socket을 read/write 양쪽에 모두 보고하므로, read 목록에 있으면 오류로 간주
+			result = (wait_result > 0) && (write_count > 0) && (error_count == 0);
+		}
+		else
+		{
+			logtw("[%p] [#%d] Could not add socket to epoll: %s", this, sock, ov::Error::CreateErrorFromSrt()->ToString().CStr());
+		}
+
+		::srt_epoll_release(epoll);
+
+		return result;
+	}
+
 	ssize_t Socket::SendTo(const ov::SocketAddress &address, const void *data, size_t length)
 	{
 		//OV_ASSERT2(_socket.IsValid());
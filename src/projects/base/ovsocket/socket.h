@@ -12,6 +12,7 @@
 
 #include <sys/socket.h>
 #include <sys/epoll.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 
 #include <utility>
@@ -36,6 +37,9 @@ namespace ov
 
 	constexpr const int MaxSrtPacketSize = 1316;
 
+	// SRT 송신 버퍼가 가득 찼을 때 최대 대기 시간 (ms)
+	constexpr const int SrtSendBufferTimeout = 1000;
+
 	enum class SocketType : char
 	{
 		Unknown,
@@ -226,6 +230,9 @@ namespace ov
 
 		bool SetSockOpt(SRT_SOCKOPT option, const void *value, int value_length);
 
+		// SRT 전송 통계 (SRT 소켓이 아니거나 실패하면 false)
+		bool GetSrtStats(SRT_TRACEBSTATS *stats, bool clear = false) const;
+
 		// 현재 소켓의 접속 상태
 		SocketState GetState() const;
 
@@ -242,6 +249,9 @@ namespace ov
 		// 데이터 송신
 		virtual ssize_t Send(const void *data, size_t length);
 		virtual ssize_t Send(const std::shared_ptr<const Data> &data);
+		// 여러 버퍼를 한번에 송신(TCP: sendmsg, 그 외: 버퍼별로 Send)
+		// 송신한 만큼 vectors 의 내용이 변경됨
+		virtual ssize_t Send(struct iovec *vectors, int count);
 
 		virtual ssize_t SendTo(const ov::SocketAddress &address, const void *data, size_t length);
 		virtual ssize_t SendTo(const ov::SocketAddress &address, const std::shared_ptr<const Data> &data);
@@ -263,6 +273,11 @@ namespace ov
 	protected:
 		SocketWrapper AcceptClientInternal(SocketAddress *client);
 
+		// 송신 버퍼에 여유가 생길 때 까지 대기(최대 1초), select() 오류시 false
+		bool WaitForSendBuffer(socket_t sock);
+		// SRT 송신 버퍼에 여유가 생길 때 까지 대기(최대 timeout_msec), timeout 또는 오류시 false
+		bool WaitForSrtSendBuffer(SRTSOCKET sock, int timeout_msec);
+
 		// utility method
 		static String StringFromEpollEvent(const epoll_event *event);
 		static String StringFromEpollEvent(const epoll_event &event);
@@ -39,16 +39,22 @@ namespace pvd
 
 	std::shared_ptr<Stream> Application::GetStreamById(uint32_t stream_id)
 	{
-		if(_streams.find(stream_id) == _streams.end())
+		std::lock_guard<std::mutex> lock(_streams_guard);
+
+		auto item = _streams.find(stream_id);
+
+		if(item == _streams.end())
 		{
 			return nullptr;
 		}
 
-		return _streams[stream_id];
+		return item->second;
 	}
 
 	std::shared_ptr<Stream> Application::GetStreamByName(ov::String stream_name)
 	{
+		std::lock_guard<std::mutex> lock(_streams_guard);
+
 		for(auto const &x : _streams)
 		{
 			auto stream = x.second;
@@ -85,6 +91,7 @@ namespace pvd
 
 		MediaRouteApplicationConnector::CreateStream(stream);
 
+		std::lock_guard<std::mutex> lock(_streams_guard);
 		_streams[stream->GetId()] = stream;
 
 
@@ -95,14 +102,17 @@ namespace pvd
 	{
 		logtd("DeleteStream");
 
+		std::unique_lock<std::mutex> lock(_streams_guard);
+
 		if(_streams.find(stream->GetId()) == _streams.end())
 		{
 			return false;
 		}
 
-		MediaRouteApplicationConnector::DeleteStream(stream);
-
 		_streams.erase(stream->GetId());
+		lock.unlock();
+
+		MediaRouteApplicationConnector::DeleteStream(stream);
 
 		return true;
 	}
@@ -48,6 +48,8 @@ namespace pvd
 		~Application() override;
 
 		std::map<uint32_t, std::shared_ptr<Stream>> _streams;
+		// Provider의 여러 thread(예: RtmpServerWorker)에서 동시에 접근
+		std::mutex _streams_guard;
 
 	private:
 		std::mutex _queue_guard;
@@ -124,16 +124,17 @@ bool Application::OnSendAudioFrame(std::shared_ptr<StreamInfo> stream_info,
 bool Application::PushIncomingPacket(std::shared_ptr<SessionInfo> session_info,
                                      std::shared_ptr<const ov::Data> data)
 {
-	auto packet = std::make_unique<Application::IncomingPacket>(session_info, data);
-
-	// Mutex (This function may be called by IcePort thread)
-	std::unique_lock<std::mutex> lock(this->_incoming_packet_queue_guard);
-	_incoming_packet_queue.push(std::move(packet));
-	lock.unlock();
+	// Stream으로 보내서 Session의 송신을 담당하는 StreamWorker가 수신도 처리하게 한다.
+	// (Application thread를 거치지 않으며, 한 Session의 상태는 하나의 thread에서만 접근된다)
+	auto session = std::static_pointer_cast<Session>(session_info);
+	auto stream = session->GetStream();
 
-	_queue_event.Notify();
+	if(stream == nullptr)
+	{
+		return false;
+	}
 
-	return true;
+	return stream->PushIncomingPacket(std::move(session_info), std::move(data));
 }
 
 std::shared_ptr<Stream> Application::GetStream(uint32_t stream_id)
@@ -190,20 +191,6 @@ std::unique_ptr<Application::AudioStreamData> Application::PopAudioStreamData()
 	return data;
 }
 
-std::unique_ptr<Application::IncomingPacket> Application::PopIncomingPacket()
-{
-	std::unique_lock<std::mutex> lock(this->_incoming_packet_queue_guard);
-
-	if(_incoming_packet_queue.empty())
-	{
-		return nullptr;
-	}
-
-	// 데이터를 하나 꺼낸다.
-	auto packet = std::move(_incoming_packet_queue.front());
-	_incoming_packet_queue.pop();
-	return packet;
-}
 
 
 /*
@@ -212,8 +199,7 @@ std::unique_ptr<Application::IncomingPacket> Application::PopIncomingPacket()
  * 다음과 같은 동작을 수행한다.
  *
  * 1. Router로부터 전달받은 Video/Audio를 Stream에 전달
- * 2. Client로부터 전달받은 Packet을 Stream에 전달
- * 3. 모든 Stream과 Session이 상속받은 Module->Process()를 주기적으로 호출
+ * 2. 모든 Stream과 Session이 상속받은 Module->Process()를 주기적으로 호출
  *
  */
 void Application::WorkerThread()
@@ -254,13 +240,6 @@ void Application::WorkerThread()
 			               std::move(audio_data->_framgmentation_header));
 		}
 
-		// Check incoming packet is available
-		std::unique_ptr<IncomingPacket> packet = PopIncomingPacket();
-		if(packet)
-		{
-			OnPacketReceived(packet->_session_info, packet->_data);
-		}
-
 		//TODO: Queue에 입력된 Audio Sample을 처리한다.
 		//TODO: ApplicationModule을 호출한다.
 	}
@@ -306,11 +285,3 @@ void Application::SendAudioFrame(std::shared_ptr<StreamInfo> info,
 	                       std::move(codec_info),
 	                       std::move(fragmentation));
 }
-
-void Application::OnPacketReceived(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data)
-{
-	// Stream으로 갈 필요없이 바로 Session으로 간다.
-	// Stream은 Broad하게 전송할때만 필요하다.
-	auto session = std::static_pointer_cast<Session>(session_info);
-	session->OnPacketReceived(session_info, data);
-}
\ No newline at end of file
@@ -37,7 +37,7 @@ public:
 	                      std::unique_ptr<CodecSpecificInfo> codec_info,
 	                      std::unique_ptr<FragmentationHeader> fragmentation) override;
 
-	// 수신된 Network Packet을 Application에 넣고 처리를 기다린다.
+	// 수신된 Network Packet을 Session이 속한 StreamWorker에 넣고 처리를 기다린다.
 	bool PushIncomingPacket(std::shared_ptr<SessionInfo> session_info,
 	                        std::shared_ptr<const ov::Data> data);
 
@@ -65,8 +65,6 @@ protected:
 	                            std::unique_ptr<CodecSpecificInfo> codec_info,
 	                            std::unique_ptr<FragmentationHeader> fragmentation);
 
-	virtual void OnPacketReceived(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data);
-
 	std::map<uint32_t, std::shared_ptr<Stream>> _streams;
 
 private:
@@ -130,20 +128,6 @@ private:
 	};
 	std::unique_ptr<Application::AudioStreamData> PopAudioStreamData();
 
-	class IncomingPacket
-	{
-	public:
-		IncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data)
-		{
-			_session_info = std::move(session_info);
-			_data = std::move(data);
-		}
-
-		std::shared_ptr<SessionInfo> _session_info;
-		std::shared_ptr<const ov::Data> _data;
-	};
-	std::unique_ptr<Application::IncomingPacket> PopIncomingPacket();
-
 	bool _stop_thread_flag;
 	std::thread _worker_thread;
 	ov::Semaphore _queue_event;
@@ -154,9 +138,6 @@ private:
 	std::queue<std::unique_ptr<AudioStreamData>> _audio_stream_queue;
 	std::mutex _audio_stream_queue_guard;
 
-	std::queue<std::unique_ptr<IncomingPacket>> _incoming_packet_queue;
-	std::mutex _incoming_packet_queue_guard;
-
 	//std::queue<std::unique_ptr<AudioStreamData>>	_audio_stream_queue;
 
 };
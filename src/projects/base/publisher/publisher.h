@@ -17,6 +17,8 @@ enum class MonitroingCollectionType
     App,
     Origin,
     Host,
+    Segment,    // HLS/DASH Segment 보관 메모리(stream_name : publisher)
+    Relay,      // Relay client(edge)별 송신 통계(stream_name : client address)
 };
 
 struct MonitoringCollectionData
@@ -55,6 +57,10 @@ struct MonitoringCollectionData
             result = "org";
         else if(type == MonitroingCollectionType::Host)
             result = "host";
+        else if(type == MonitroingCollectionType::Segment)
+            result = "seg";
+        else if(type == MonitroingCollectionType::Relay)
+            result = "relay";
 
         return result;
     }
@@ -68,6 +74,19 @@ struct MonitoringCollectionData
     uint64_t edge_bitrate = 0;      // bps
     uint32_t p2p_connection = 0;    // count
     uint64_t p2p_bitrate = 0;       // bps
+    uint64_t segment_memory_budget = 0;     // byte(0 : unlimited)
+    uint64_t segment_memory_reserved = 0;   // byte
+    uint64_t segment_memory_used = 0;       // byte
+    uint32_t segment_count = 0;             // count
+    uint64_t segment_eviction_count = 0;    // count
+    uint64_t segment_drop_count = 0;        // count
+    uint64_t relay_sent_frames = 0;         // count
+    uint64_t relay_sent_bytes = 0;          // byte
+    uint64_t relay_dropped_frames = 0;      // count
+    uint64_t relay_dropped_bytes = 0;       // byte
+    uint64_t relay_queued_bytes = 0;        // byte
+    uint64_t relay_max_queued_bytes = 0;    // byte
+    double relay_rtt = 0.0;                 // ms
     std::chrono::system_clock::time_point check_time ; // (chrono)
 };
 
@@ -47,6 +47,18 @@ bool Session::Stop()
 	return true;
 }
 
+bool Session::SendOutgoingDataBatch(const std::vector<std::pair<uint32_t, std::shared_ptr<ov::Data>>> &packets)
+{
+	bool result = true;
+
+	for(const auto &packet : packets)
+	{
+		result = SendOutgoingData(packet.first, packet.second) && result;
+	}
+
+	return result;
+}
+
 Session::SessionState Session::GetState()
 {
 	return _state;
@@ -27,6 +27,8 @@ public:
 
 	// 패킷을 전송한다.
 	virtual bool SendOutgoingData(uint32_t packet_type, std::shared_ptr<ov::Data> packet) = 0;
+	// 여러 패킷을 한번에 전송한다. 기본 구현은 SendOutgoingData()를 반복 호출한다.
+	virtual bool SendOutgoingDataBatch(const std::vector<std::pair<uint32_t, std::shared_ptr<ov::Data>>> &packets);
 	// 상위 Layer에서 Packet을 수신받는다.
 	virtual void OnPacketReceived(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data) = 0;
 
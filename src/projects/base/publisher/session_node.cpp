@@ -51,6 +51,18 @@ bool SessionNode::Stop()
 	_session.reset();
 }
 
+bool SessionNode::SendDataBatch(SessionNodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	bool result = true;
+
+	for(const auto &data : data_list)
+	{
+		result = SendData(from_node, data) && result;
+	}
+
+	return result;
+}
+
 SessionNode::NodeState SessionNode::GetState()
 {
 	return _state;
@@ -96,24 +96,55 @@ void StreamWorker::SendPacket(uint32_t type, std::shared_ptr<ov::Data> packet)
 	_queue_event.Notify();
 }
 
-std::shared_ptr<StreamWorker::StreamPacket> StreamWorker::PopStreamPacket()
+void StreamWorker::PushIncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data)
 {
-	std::unique_lock<std::mutex> lock(_packet_queue_guard);
+	auto packet = std::make_unique<StreamWorker::IncomingPacket>(std::move(session_info), std::move(data));
+
+	// Mutex (This function may be called by IcePort thread)
+	std::unique_lock<std::mutex> lock(_incoming_packet_queue_guard);
+	_incoming_packet_queue.push(std::move(packet));
+	lock.unlock();
+
+	_queue_event.Notify();
+}
+
+bool StreamWorker::PopIncomingPackets(std::vector<std::unique_ptr<StreamWorker::IncomingPacket>> &packets)
+{
+	packets.clear();
 
-	if(_packet_queue.empty())
+	std::unique_lock<std::mutex> lock(_incoming_packet_queue_guard);
+
+	while(_incoming_packet_queue.empty() == false)
 	{
-		return nullptr;
+		packets.push_back(std::move(_incoming_packet_queue.front()));
+		_incoming_packet_queue.pop();
 	}
 
-	auto data = _packet_queue.front();
-	_packet_queue.pop();
+	return (packets.empty() == false);
+}
+
+bool StreamWorker::PopStreamPackets(std::vector<std::shared_ptr<StreamWorker::StreamPacket>> &packets)
+{
+	packets.clear();
+
+	std::unique_lock<std::mutex> lock(_packet_queue_guard);
 
-	return std::move(data);
+	while(_packet_queue.empty() == false)
+	{
+		packets.push_back(std::move(_packet_queue.front()));
+		_packet_queue.pop();
+	}
+
+	return (packets.empty() == false);
 }
 
 void StreamWorker::WorkerThread()
 {
 	std::unique_lock<std::mutex> session_lock(_session_map_guard, std::defer_lock);
+	std::vector<std::shared_ptr<StreamWorker::StreamPacket>> packets;
+	std::vector<std::pair<uint32_t, std::shared_ptr<ov::Data>>> session_packets;
+	std::vector<std::unique_ptr<StreamWorker::IncomingPacket>> incoming_packets;
+
 	// Queue Event를 기다린다.
 	while(!_stop_thread_flag)
 	{
@@ -121,9 +152,27 @@ void StreamWorker::WorkerThread()
 		// TODO: 향후 App 재시작 등의 기능을 위해 WaitFor(time) 기능을 구현한다.
 		_queue_event.Wait();
 
-		// Queue에서 패킷을 꺼낸다.
-		std::shared_ptr<StreamWorker::StreamPacket> packet = PopStreamPacket();
-		if(packet == nullptr)
+		// Network에서 받은 패킷(DTLS handshake, RTCP 등)을 먼저 처리한다.
+		// 송신과 같은 thread에서 처리하므로 Session의 DTLS/SRTP 상태를 다른 thread와 공유하지 않는다.
+		if(PopIncomingPackets(incoming_packets))
+		{
+			for(auto &incoming_packet : incoming_packets)
+			{
+				auto session = std::static_pointer_cast<Session>(incoming_packet->_session_info);
+
+				if(session->GetState() == Session::SessionState::Started)
+				{
+					session->OnPacketReceived(incoming_packet->_session_info, incoming_packet->_data);
+				}
+			}
+
+			incoming_packets.clear();
+		}
+
+		// Queue에 쌓인 패킷을 한번에 꺼내서 Session 별로 묶어서 보낸다.
+		// (SRTP 등 하위 Node에서 한 프레임의 패킷을 한번에 처리할 수 있도록 한다)
+		// 남은 Semaphore count는 빈 Queue를 만나서 continue 된다.
+		if(PopStreamPackets(packets) == false)
 		{
 			continue;
 		}
@@ -134,11 +183,21 @@ void StreamWorker::WorkerThread()
 		{
 			auto session = std::static_pointer_cast<Session>(x.second);
 
-			// Session will change data
-			std::shared_ptr<ov::Data> session_data = packet->_data->Clone();
-			session->SendOutgoingData(packet->_type, session_data);
+			session_packets.clear();
+			session_packets.reserve(packets.size());
+
+			for(auto const &packet : packets)
+			{
+				// Session will change data
+				session_packets.emplace_back(packet->_type, packet->_data->Clone());
+			}
+
+			session->SendOutgoingDataBatch(session_packets);
 		}
 		session_lock.unlock();
+
+		session_packets.clear();
+		packets.clear();
 	}
 }
 
@@ -245,6 +304,18 @@ const std::map<session_id_t, std::shared_ptr<Session>> &Stream::GetAllSessions()
 	return _sessions;
 }
 
+bool Stream::PushIncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data)
+{
+	if(_run_flag == false)
+	{
+		return false;
+	}
+
+	GetWorkerByStreamID(session_info->GetId()).PushIncomingPacket(std::move(session_info), std::move(data));
+
+	return true;
+}
+
 bool Stream::BroadcastPacket(uint32_t packet_type, std::shared_ptr<ov::Data> packet)
 {
 	// 모든 StreamWorker에 나눠준다.
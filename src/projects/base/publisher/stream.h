@@ -22,6 +22,8 @@ public:
 	std::shared_ptr<Session> GetSession(session_id_t id);
 
 	void SendPacket(uint32_t type, std::shared_ptr<ov::Data> packet);
+	// Session의 송신을 담당하는 Worker가 수신도 처리하도록 network에서 받은 패킷을 넣는다.
+	void PushIncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data);
 
 private:
 
@@ -45,11 +47,30 @@ private:
 		std::shared_ptr<ov::Data>   _data;
 	};
 
-	std::shared_ptr<StreamPacket> PopStreamPacket();
+	// Queue에 쌓인 패킷을 모두 꺼낸다. (보통 한 프레임을 구성하는 RTP 패킷들)
+	bool PopStreamPackets(std::vector<std::shared_ptr<StreamPacket>> &packets);
 
 	std::queue<std::shared_ptr<StreamPacket>>   _packet_queue;
 	std::mutex      _packet_queue_guard;
 
+	class IncomingPacket
+	{
+	public:
+		IncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data)
+		{
+			_session_info = std::move(session_info);
+			_data = std::move(data);
+		}
+
+		std::shared_ptr<SessionInfo> _session_info;
+		std::shared_ptr<const ov::Data> _data;
+	};
+
+	bool PopIncomingPackets(std::vector<std::unique_ptr<IncomingPacket>> &packets);
+
+	std::queue<std::unique_ptr<IncomingPacket>> _incoming_packet_queue;
+	std::mutex      _incoming_packet_queue_guard;
+
 	bool            _stop_thread_flag;
 	std::thread     _worker_thread;
 
@@ -68,6 +89,10 @@ public:
 	// Child call this function to delivery packet to all sessions
 	bool BroadcastPacket(uint32_t packet_type, std::shared_ptr<ov::Data> packet);
 
+	// Network에서 받은 패킷을 Session이 속한 StreamWorker로 전달한다.
+	// 한 Session의 송신/수신은 항상 같은 StreamWorker thread에서 처리된다.
+	bool PushIncomingPacket(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data);
+
 	// Child must implement this function for packetizing and call BroadcastPacket to delivery to all sessions.
 	virtual void SendVideoFrame(std::shared_ptr<MediaTrack> track,
 	                            std::unique_ptr<EncodedFrame> encoded_frame,
@@ -0,0 +1,7 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Shared helpers of the *_bench tools (not linked into OvenMediaEngine)
+LOCAL_TARGET := bench_common
+
+include $(BUILD_STATIC_LIBRARY)
@@ -0,0 +1,44 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "allocation_counter.h"
+
+#include <cstddef>
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+
+static thread_local uint64_t g_thread_allocation_count = 0;
+
+uint64_t GetThreadAllocationCount()
+{
+	return g_thread_allocation_count;
+}
+
+// operator new, strdup(), ... call the functions below
+extern "C" void *malloc(size_t size)
+{
+	g_thread_allocation_count++;
+
+	return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+	g_thread_allocation_count++;
+
+	return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, size_t size)
+{
+	g_thread_allocation_count++;
+
+	return __libc_realloc(pointer, size);
+}
@@ -0,0 +1,17 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstdint>
+
+// Replaces malloc() family (glibc) to count the allocations of the current thread.
+// ov::String allocates with malloc() instead of operator new, so operator new is not enough.
+// operator new of libstdc++ calls malloc(), so new/make_shared are counted as well.
+// Counted per thread, so the measuring threads do not contend with each other.
+uint64_t GetThreadAllocationCount();
@@ -41,6 +41,36 @@ namespace cfg
 			return _segment_duration;
 		}
 
+		// Publishes each segment in chunks while it is being written
+		bool IsLowLatency() const
+		{
+			return _low_latency;
+		}
+
+		// Duration of a chunk (millisecond)
+		int GetChunkDuration() const
+		{
+			return _chunk_duration;
+		}
+
+		// Memory budget of the segments of all streams (MB, 0: unlimited)
+		int GetMemoryBudget() const
+		{
+			return _memory_budget;
+		}
+
+		// Time shift window that the playlist exposes (second, 0: disabled)
+		int GetDvrWindow() const
+		{
+			return _dvr_window;
+		}
+
+		// Directory of the memory-mapped DVR files
+		ov::String GetDvrPath() const
+		{
+			return _dvr_path;
+		}
+
 		const std::vector<Url> &GetCrossDomains() const
 		{
 			return _cross_domain_list.GetUrls();
@@ -60,6 +90,11 @@ namespace cfg
 			RegisterValue<Optional>("TLS", &_tls);
 			RegisterValue<Optional>("SegmentCount", &_segment_count);
 			RegisterValue<Optional>("SegmentDuration", &_segment_duration);
+			RegisterValue<Optional>("LowLatency", &_low_latency);
+			RegisterValue<Optional>("ChunkDuration", &_chunk_duration);
+			RegisterValue<Optional>("MemoryBudget", &_memory_budget);
+			RegisterValue<Optional>("DvrWindow", &_dvr_window);
+			RegisterValue<Optional>("DvrPath", &_dvr_path);
 			RegisterValue<Optional>("CrossDomain", &_cross_domain_list);
 			RegisterValue<Optional>("CORS", &_cors_url_list);
 		}
@@ -68,6 +103,11 @@ namespace cfg
 		Tls _tls;
 		int _segment_count;
 		int _segment_duration;
+		bool _low_latency = false;
+		int _chunk_duration = 500;
+		int _memory_budget = 0;
+		int _dvr_window = 0;
+		ov::String _dvr_path = "/tmp";
 		Urls _cross_domain_list;
 		Urls _cors_url_list;
 	};
@@ -34,6 +34,20 @@ namespace cfg
             return _alias;
         }
 
+		// SRT latency of the relay connection (ms), 0 to use the default of SRT
+		// (SRT uses the larger of the latencies of both sides, so the edge decides the latency for its link)
+		int GetLatency() const
+		{
+			return _latency;
+		}
+
+		// SRT receive buffer size of the relay connection (KB), 0 to use the default of SRT
+		// (must hold at least latency * bitrate of all streams)
+		int GetReceiveBufferSize() const
+		{
+			return _receive_buffer_size;
+		}
+
 	protected:
 		void MakeParseList() const override
 		{
@@ -41,6 +55,8 @@ namespace cfg
 			RegisterValue<Optional>("Primary", &_primary);
 			RegisterValue<Optional>("Secondary", &_secondary);
             RegisterValue<Optional>("Alias", &_alias);
+			RegisterValue<Optional>("Latency", &_latency);
+			RegisterValue<Optional>("ReceiveBufferSize", &_receive_buffer_size);
 		}
 
 		OriginListen _listen;
@@ -48,5 +64,7 @@ namespace cfg
 		ov::String _primary;
 		ov::String _secondary;
         ov::String _alias;
+		int _latency = 0;
+		int _receive_buffer_size = 0;
 	};
 }
\ No newline at end of file
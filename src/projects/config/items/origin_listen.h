@@ -24,14 +24,38 @@ namespace cfg
 			return _port;
 		}
 
+		// Maximum bytes queued for each relay client (KB)
+		int GetSendQueueSize() const
+		{
+			return _send_queue_size;
+		}
+
+		// Maximum bytes of video frames queued for each stream of a relay client (KB)
+		int GetStreamWindowSize() const
+		{
+			return _stream_window_size;
+		}
+
+		// Replaces the ids of each packet header with a 1-byte context id
+		bool IsHeaderCompressionEnabled() const
+		{
+			return _header_compression;
+		}
+
 	protected:
 		void MakeParseList() const override
 		{
 			RegisterValue<Optional>("IP", &_ip);
 			RegisterValue<Optional>("Port", &_port);
+			RegisterValue<Optional>("SendQueueSize", &_send_queue_size);
+			RegisterValue<Optional>("StreamWindowSize", &_stream_window_size);
+			RegisterValue<Optional>("HeaderCompression", &_header_compression);
 		}
 
 		ov::String _ip = "*";
 		int _port = 9000;
+		int _send_queue_size = 4096;
+		int _stream_window_size = 1024;
+		bool _header_compression = true;
 	};
 }
\ No newline at end of file
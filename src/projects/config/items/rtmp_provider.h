@@ -30,6 +30,12 @@ namespace cfg
 			return _port;
 		}
 
+		// 0이면 CPU core 수 만큼 사용
+		int GetThreadCount() const
+		{
+			return _thread_count;
+		}
+
 		OverlapStreamProcessType GetOverlapStreamProcessType() const
 		{
 			return _overlap_stream_process == "refresh" ? OverlapStreamProcessType::Refresh : OverlapStreamProcessType::Reject;
@@ -42,9 +48,11 @@ namespace cfg
 
 			RegisterValue<Optional>("Port", &_port);
 			RegisterValue<Optional>("OverlapStreamProcess", &_overlap_stream_process);
+			RegisterValue<Optional>("ThreadCount", &_thread_count);
 		}
 
 		int _port = 1935;
 		ov::String _overlap_stream_process;
+		int _thread_count = 0;
 	};
 }
\ No newline at end of file
@@ -45,7 +45,7 @@ bool DtlsTransport::StartDTLS()
 				tls->SetVerify(SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT);
 
 				// SSL_CTX_set_tlsext_use_srtp() returns 1 on error, 0 on success
-				if(SSL_CTX_set_tlsext_use_srtp(context, "SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32"))
+				if(SSL_CTX_set_tlsext_use_srtp(context, DTLS_SRTP_PROTECTION_PROFILES))
 				{
 					logte("SSL_CTX_set_tlsext_use_srtp failed");
 					return false;
@@ -136,6 +136,8 @@ bool DtlsTransport::MakeSrtpKey()
 
 	auto crypto_suite = _tls.GetSelectedSrtpProfileId();
 
+	logtd("Selected SRTP protection profile: %lu", crypto_suite);
+
 	std::shared_ptr<ov::Data> server_key = std::make_shared<ov::Data>();
 	std::shared_ptr<ov::Data> client_key = std::make_shared<ov::Data>();
 
@@ -221,7 +223,7 @@ bool DtlsTransport::SendData(SessionNodeType from_node, const std::shared_ptr<ov
 }
 
 // 데이터를 lower에서 받는다. upper node로 보낸다.
-// IcePort -> Publisher ->[queue] Application {thread}-> Session -> DtlsTransport -> SRTP || SCTP
+// IcePort -> Publisher ->[queue] StreamWorker {thread}-> Session -> DtlsTransport -> SRTP || SCTP
 bool DtlsTransport::OnDataReceived(SessionNodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
 	// Node 시작 전에는 아무것도 하지 않는다.
@@ -11,11 +11,16 @@
 #define MAX_DTLS_PACKET_LEN                     2048
 #define MIN_RTP_PACKET_LEN                      12
 
+// DTLS-SRTP protection profiles in order of preference (the server's order wins).
+// AES-GCM is offered first because AEAD is far cheaper than AES-CM + HMAC-SHA1 on AES-NI hardware,
+// peers that don't support it fall back to the AES-CM suites.
+#define DTLS_SRTP_PROTECTION_PROFILES           "SRTP_AEAD_AES_128_GCM:SRTP_AES128_CM_SHA1_80:SRTP_AES128_CM_SHA1_32"
+
 class DtlsTransport : public SessionNode
 {
 public:
 	// Send : Srtp -> this -> Ice
-	// Recv : Ice -> {[Queue] -> Application -> Session} -> this -> Srtp
+	// Recv : Ice -> {[Queue] -> StreamWorker -> Session} -> this -> Srtp
 	explicit DtlsTransport(uint32_t id, std::shared_ptr<Session> session);
 	virtual ~DtlsTransport() = default;
 
@@ -36,7 +41,7 @@ public:
 	// Receive data from lower node, and send data to upper node.
 	bool OnDataReceived(SessionNodeType from_node, const std::shared_ptr<const ov::Data> &data);
 
-	// IcePort -> Publisher ->[queue] Application {thread}-> Session -> DtlsTransport -> SRTP -> RTP/RTCP
+	// IcePort -> Publisher ->[queue] StreamWorker {thread}-> Session -> DtlsTransport -> SRTP -> RTP/RTCP
 	// ICE에서는 STUN을 제외한 모든 패킷을 위로 올린다.
 	// DTLS에서는 패킷을 받으면 DTLS인 경우 패킷을 버퍼에 쌓고(_dtls_packet_buffer) SSL_read를 호출하여 읽어서
 	// 복호화를 한 후 다음 Layer로 전송한다.
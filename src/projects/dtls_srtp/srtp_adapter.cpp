@@ -39,6 +39,16 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 			srtp_crypto_policy_set_aes_cm_128_hmac_sha1_32(&policy.rtp);
 			srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtcp);
 			break;
+		// AEAD suites (RFC 7714) encrypt and authenticate in one pass, which is much cheaper
+		// than AES-CM + HMAC-SHA1 on CPUs with AES-NI/PCLMULQDQ
+		case SRTP_AEAD_AES_128_GCM:
+			srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtp);
+			srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtcp);
+			break;
+		case SRTP_AEAD_AES_256_GCM:
+			srtp_crypto_policy_set_aes_gcm_256_16_auth(&policy.rtp);
+			srtp_crypto_policy_set_aes_gcm_256_16_auth(&policy.rtcp);
+			break;
 		default:
 			logte("Failed to create srtp adapter. Unsupported crypto suite %d", crypto_suite);
 			return false;
@@ -73,6 +83,43 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 		return false;
 	}
 
+	return ProtectRtpInternal(data);
+}
+
+size_t SrtpAdapter::ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list, std::vector<size_t> *failed_indices)
+{
+	if(!_session)
+	{
+		if(failed_indices != nullptr)
+		{
+			for(size_t index = 0; index < data_list.size(); index++)
+			{
+				failed_indices->push_back(index);
+			}
+		}
+
+		return 0;
+	}
+
+	size_t protected_count = 0;
+
+	for(size_t index = 0; index < data_list.size(); index++)
+	{
+		if(ProtectRtpInternal(data_list[index]))
+		{
+			protected_count++;
+		}
+		else if(failed_indices != nullptr)
+		{
+			failed_indices->push_back(index);
+		}
+	}
+
+	return protected_count;
+}
+
+bool SrtpAdapter::ProtectRtpInternal(const std::shared_ptr<ov::Data> &data)
+{
 	// Protect를 하면 다음과 같은 사이즈가 필요하다. data의 Capacity가 충분해야 한다.
 	int need_len = static_cast<int>(data->GetLength()) + _rtp_auth_tag_len;
 
@@ -86,18 +133,18 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 	int out_len = static_cast<int>(data->GetLength());
 	data->SetLength(need_len);
 
-	// FOR DEBUG
-	auto byte_buffer = data->GetDataAs<uint8_t>();
-	uint8_t payload_type = byte_buffer[1] & 0x7F;
-	uint8_t red_payload_type = byte_buffer[12];
-	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
-
 	int err = srtp_protect(_session, buffer, &out_len);
 	if(err != srtp_err_status_ok)
 	{
+		// FOR DEBUG
+		auto byte_buffer = data->GetDataAs<uint8_t>();
+		uint8_t payload_type = byte_buffer[1] & 0x7F;
+		uint8_t red_payload_type = byte_buffer[12];
+		uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
+
 		logte("Failed to protect SRTP packet, err=%d, len=%d, seq=%u, payload_type=%d, red_payload_type=%d", err, out_len, seq, payload_type, red_payload_type);
 		return false;
 	}
 
 	return true;
-}
\ No newline at end of file
+}
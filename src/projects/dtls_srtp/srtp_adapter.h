@@ -19,12 +19,19 @@ public:
 	SrtpAdapter();
 	virtual ~SrtpAdapter();
 
+	// Supported suites: SRTP_AES128_CM_SHA1_80, SRTP_AES128_CM_SHA1_32,
+	// SRTP_AEAD_AES_128_GCM, SRTP_AEAD_AES_256_GCM
 	bool	SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shared_ptr<ov::Data> key);
 
 
 	bool	ProtectRtp(std::shared_ptr<ov::Data> data);
+	// Protects all packets of a frame in one call.
+	// Returns the number of packets that were protected successfully.
+	// The indices of the packets that could not be protected are appended to failed_indices (if not null).
+	size_t	ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list, std::vector<size_t> *failed_indices = nullptr);
 
 private:
+	bool	ProtectRtpInternal(const std::shared_ptr<ov::Data> &data);
 
 	srtp_ctx_t_* 	_session;
 	int 			_rtp_auth_tag_len;
@@ -36,7 +36,12 @@ bool SrtpTransport::SendData(SessionNodeType from_node, const std::shared_ptr<ov
 		return false;
 	}
 
-	_send_session->ProtectRtp(data);
+	if(_send_session->ProtectRtp(data) == false)
+	{
+		// 암호화되지 않은 패킷을 내보내면 안되므로 버린다.
+		_protect_failure_count++;
+		return false;
+	}
 
 	// DTLS로 보낸다.
 	auto node = GetLowerNode();
@@ -48,6 +53,70 @@ bool SrtpTransport::SendData(SessionNodeType from_node, const std::shared_ptr<ov
 	return node->SendData(GetNodeType(), data);
 }
 
+bool SrtpTransport::SendDataBatch(SessionNodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	// Node 시작 전에는 아무것도 하지 않는다.
+	if(GetState() != SessionNode::NodeState::Started)
+	{
+		logtd("SessionNode has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	if(!_send_session)
+	{
+		return false;
+	}
+
+	std::vector<size_t> failed_indices;
+
+	if(_send_session->ProtectRtp(data_list, &failed_indices) == data_list.size())
+	{
+		// DTLS로 보낸다.
+		auto node = GetLowerNode();
+		if(!node)
+		{
+			return false;
+		}
+
+		return node->SendDataBatch(GetNodeType(), data_list);
+	}
+
+	// 암호화에 실패한 패킷은 버리고 나머지만 보낸다.
+	_protect_failure_count += failed_indices.size();
+
+	logtw("%zu of %zu packets could not be protected and were dropped (total: %llu)",
+	      failed_indices.size(), data_list.size(), static_cast<unsigned long long>(_protect_failure_count.load()));
+
+	std::vector<std::shared_ptr<ov::Data>> protected_list;
+	protected_list.reserve(data_list.size() - failed_indices.size());
+
+	auto failed = failed_indices.begin();
+
+	for(size_t index = 0; index < data_list.size(); index++)
+	{
+		if((failed != failed_indices.end()) && (*failed == index))
+		{
+			++failed;
+			continue;
+		}
+
+		protected_list.push_back(data_list[index]);
+	}
+
+	if(protected_list.empty())
+	{
+		return false;
+	}
+
+	auto node = GetLowerNode();
+	if(!node)
+	{
+		return false;
+	}
+
+	return node->SendDataBatch(GetNodeType(), protected_list);
+}
+
 // 데이터를 lower(DTLS)에서 받는다. upper node(RTP_RTCP)로 보낸다.
 bool SrtpTransport::OnDataReceived(SessionNodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
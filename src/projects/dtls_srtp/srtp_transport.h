@@ -23,12 +23,22 @@ public:
 	bool SendData(SessionNodeType from_node, const std::shared_ptr<ov::Data> &data) override;
 	// 데이터를 lower에서 받는다. upper node로 보낸다.
 	bool OnDataReceived(SessionNodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
+	// 한 프레임의 패킷을 한번에 암호화 한 후 lower node로 보낸다.
+	bool SendDataBatch(SessionNodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list) override;
 
 
 	bool SetKeyMeterial(uint64_t crypto_suite,
 						std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
 
+	// 암호화에 실패하여 버린 패킷 수
+	uint64_t GetProtectFailureCount() const
+	{
+		return _protect_failure_count;
+	}
+
 private:
 	std::shared_ptr<SrtpAdapter>		_send_session;
 	std::shared_ptr<SrtpAdapter>		_recv_session;
+
+	std::atomic<uint64_t>				_protect_failure_count { 0 };
 };
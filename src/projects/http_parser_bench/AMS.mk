@@ -0,0 +1,20 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Measures the HTTP request header parser (CPU time and allocations per request)
+LOCAL_STATIC_LIBRARIES := \
+	http_server \
+	socket \
+	ovcrypto \
+	ovlibrary \
+	bench_common
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl \
+	`pkg-config --libs srt` \
+	`pkg-config --libs openssl`
+
+LOCAL_TARGET := HttpParserBench
+
+include $(BUILD_EXECUTABLE)
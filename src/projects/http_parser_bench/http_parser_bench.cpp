@@ -0,0 +1,331 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_parser_bench.h"
+#include <bench_common/allocation_counter.h>
+
+#include <time.h>
+
+#define OV_LOG_TAG                  "HttpParserBench"
+
+struct PlayerRequest
+{
+	const char *name;
+	size_t header_count;
+	const char *request;
+};
+
+// Requests captured from the players (host names and cookies are replaced)
+static const PlayerRequest g_player_requests[] = {
+	{
+		"hls.js", 17,
+		"GET /app/stream/segment_1234_hls.ts HTTP/1.1\r\n"
+		"Host: ome.example.com:8080\r\n"
+		"Connection: keep-alive\r\n"
+		"sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\", \"Not-A.Brand\";v=\"99\"\r\n"
+		"sec-ch-ua-mobile: ?0\r\n"
+		"User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+		"sec-ch-ua-platform: \"Windows\"\r\n"
+		"Accept: */*\r\n"
+		"Origin: https://player.example.com\r\n"
+		"Sec-Fetch-Site: same-site\r\n"
+		"Sec-Fetch-Mode: cors\r\n"
+		"Sec-Fetch-Dest: empty\r\n"
+		"Referer: https://player.example.com/live/stream\r\n"
+		"Accept-Encoding: gzip, deflate, br, zstd\r\n"
+		"Accept-Language: ko-KR,ko;q=0.9,en-US;q=0.8,en;q=0.7\r\n"
+		"Cookie: _ga=GA1.1.1234567890.1700000000; _ga_ABCDEF1234=GS1.1.1700000000.1.1.1700000100.0.0.0; session=8f2c1e0d5b7a4c3e9f1a2b3c4d5e6f70\r\n"
+		"Cache-Control: no-cache\r\n"
+		"Pragma: no-cache\r\n"
+		"\r\n"
+	},
+	{
+		"safari", 9,
+		"GET /app/stream/playlist.m3u8?token=c2VjcmV0LXRva2VuLXZhbHVl HTTP/1.1\r\n"
+		"Host: ome.example.com:8080\r\n"
+		"X-Playback-Session-Id: 6A1C9F7E-2B3D-4E5F-8A9B-0C1D2E3F4A5B\r\n"
+		"Accept: */*\r\n"
+		"User-Agent: AppleCoreMedia/1.0.0.21E236 (iPhone; U; CPU OS 17_4_1 like Mac OS X; ko_kr)\r\n"
+		"Accept-Language: ko-KR,ko;q=0.9\r\n"
+		"Referer: https://player.example.com/live/stream\r\n"
+		"Accept-Encoding: identity\r\n"
+		"Cookie: session=8f2c1e0d5b7a4c3e9f1a2b3c4d5e6f70\r\n"
+		"Connection: keep-alive\r\n"
+		"\r\n"
+	},
+	{
+		"dash.js", 22,
+		"GET /app/stream/chunk_video_1234.m4s HTTP/1.1\r\n"
+		"Host: ome.example.com:8080\r\n"
+		"Connection: keep-alive\r\n"
+		"sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\", \"Not-A.Brand\";v=\"99\"\r\n"
+		"DNT: 1\r\n"
+		"sec-ch-ua-mobile: ?0\r\n"
+		"User-Agent: Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+		"sec-ch-ua-platform: \"macOS\"\r\n"
+		"Accept: */*\r\n"
+		"Origin: https://player.example.com\r\n"
+		"Sec-Fetch-Site: same-site\r\n"
+		"Sec-Fetch-Mode: cors\r\n"
+		"Sec-Fetch-Dest: empty\r\n"
+		"Referer: https://player.example.com/live/stream?mode=dash\r\n"
+		"Accept-Encoding: gzip, deflate, br, zstd\r\n"
+		"Accept-Language: ko-KR,ko;q=0.9,en-US;q=0.8,en;q=0.7\r\n"
+		"Cookie: _ga=GA1.1.1234567890.1700000000; session=8f2c1e0d5b7a4c3e9f1a2b3c4d5e6f70\r\n"
+		"If-None-Match: \"5f1a2b3c-1d4e\"\r\n"
+		"If-Modified-Since: Tue, 14 May 2024 09:12:34 GMT\r\n"
+		"Range: bytes=0-\r\n"
+		"Priority: u=1, i\r\n"
+		"Cache-Control: no-cache\r\n"
+		"Pragma: no-cache\r\n"
+		"\r\n"
+	}
+};
+
+static double GetCpuTime()
+{
+	timespec time {};
+
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+	return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+HttpParserBench::HttpParserBench(const HttpParserBenchOptions &options)
+	: _options(options)
+{
+}
+
+const char *HttpParserBench::GetFormatName(HttpParserBenchFormat format)
+{
+	switch(format)
+	{
+		case HttpParserBenchFormat::Legacy:
+			return "legacy";
+
+		case HttpParserBenchFormat::Span:
+			return "span";
+	}
+
+	return "?";
+}
+
+void HttpParserBench::Prepare()
+{
+	_samples.clear();
+
+	for(const auto &player_request : g_player_requests)
+	{
+		Sample sample;
+
+		sample.name = player_request.name;
+		sample.header_count = player_request.header_count;
+
+		size_t length = ::strlen(player_request.request);
+		size_t read_size = (_options.read_size > 0) ? static_cast<size_t>(_options.read_size) : length;
+
+		for(size_t offset = 0; offset < length; offset += read_size)
+		{
+			sample.chunks.push_back(std::make_shared<ov::Data>(player_request.request + offset, std::min(read_size, length - offset)));
+		}
+
+		_samples.push_back(std::move(sample));
+	}
+}
+
+bool HttpParserBench::ParseLegacy(const Sample &sample, LegacyRequest *request)
+{
+	// HttpRequest::ProcessData()/ParseMessage()/ParseRequestLine()/ParseHeader() before the span parser
+	ov::String request_string;
+	bool is_header_found = false;
+
+	for(const auto &chunk : sample.chunks)
+	{
+		request_string.Append(chunk->GetDataAs<char>(), chunk->GetLength());
+
+		ssize_t newline_position = request_string.IndexOf("\r\n\r\n");
+
+		if(newline_position >= 0)
+		{
+			request_string.SetLength(newline_position);
+			is_header_found = true;
+			break;
+		}
+	}
+
+	if(is_header_found == false)
+	{
+		return false;
+	}
+
+	std::vector<ov::String> tokens = request_string.Split("\r\n");
+	const ov::String &line = tokens[0];
+
+	ssize_t first_space_index = line.IndexOf(' ');
+	ssize_t last_space_index = line.IndexOfRev(' ');
+
+	if((first_space_index < 0) || (last_space_index < 0) || (first_space_index == last_space_index))
+	{
+		return false;
+	}
+
+	request->method = line.Left(static_cast<size_t>(first_space_index));
+	request->request_target = line.Substring(first_space_index + 1, static_cast<size_t>(last_space_index - first_space_index - 1));
+	request->http_version = line.Substring(last_space_index + 1);
+
+	for(size_t index = 1; index < tokens.size(); index++)
+	{
+		const ov::String &header = tokens[index];
+		ssize_t colon_index = header.IndexOf(':');
+
+		if(colon_index == -1)
+		{
+			return false;
+		}
+
+		request->headers[header.Left(static_cast<size_t>(colon_index)).UpperCaseString()] = header.Substring(colon_index + 1).Trim();
+	}
+
+	// Lookups of SegmentStreamServer::ProcessRequest()
+	if(request->headers.find("Origin") != request->headers.end())
+	{
+		auto item = request->headers.find(ov::String("ORIGIN").UpperCaseString());
+
+		if(item == request->headers.end())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool HttpParserBench::ParseSpan(const Sample &sample, std::shared_ptr<HttpRequest> *request)
+{
+	*request = std::make_shared<HttpRequest>(nullptr, nullptr);
+
+	for(const auto &chunk : sample.chunks)
+	{
+		if((*request)->ProcessData(chunk) < 0L)
+		{
+			return false;
+		}
+
+		if((*request)->ParseStatus() == HttpStatusCode::OK)
+		{
+			break;
+		}
+	}
+
+	if((*request)->ParseStatus() != HttpStatusCode::OK)
+	{
+		return false;
+	}
+
+	// Lookups of SegmentStreamServer::ProcessRequest()
+	if((*request)->IsHeaderExists("Origin"))
+	{
+		if((*request)->GetHeader("ORIGIN").IsEmpty())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool HttpParserBench::Verify()
+{
+	bool result = true;
+
+	for(const auto &sample : _samples)
+	{
+		LegacyRequest legacy_request;
+		std::shared_ptr<HttpRequest> request;
+
+		if((ParseLegacy(sample, &legacy_request) == false) || (ParseSpan(sample, &request) == false))
+		{
+			logte("[%s] Could not parse the request", sample.name);
+			result = false;
+			continue;
+		}
+
+		auto headers = request->GetRequestHeader();
+
+		if((legacy_request.headers.size() != sample.header_count) || (headers.size() != sample.header_count))
+		{
+			logte("[%s] Header count mismatch: expected: %zu, legacy: %zu, span: %zu",
+			      sample.name, sample.header_count, legacy_request.headers.size(), headers.size());
+			result = false;
+		}
+
+		if((request->GetMethod() != HttpMethod::Get) || (legacy_request.method != "GET") ||
+		   (request->GetRequestTarget() != legacy_request.request_target) || (request->GetHttpVersion() != legacy_request.http_version))
+		{
+			logte("[%s] Request line mismatch: [%s %s] != [%s %s %s]", sample.name,
+			      request->GetRequestTarget().CStr(), request->GetHttpVersion().CStr(),
+			      legacy_request.method.CStr(), legacy_request.request_target.CStr(), legacy_request.http_version.CStr());
+			result = false;
+		}
+
+		for(const auto &header : legacy_request.headers)
+		{
+			ov::String value = request->GetHeader(header.first, "(none)");
+
+			if(value != header.second)
+			{
+				logte("[%s] Header mismatch: %s: [%s] != [%s]", sample.name, header.first.CStr(), value.CStr(), header.second.CStr());
+				result = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+void HttpParserBench::Run(HttpParserBenchFormat format, HttpParserBenchResult *result)
+{
+	*result = HttpParserBenchResult();
+
+	uint64_t start_allocation_count = GetThreadAllocationCount();
+	double start_time = GetCpuTime();
+
+	for(int iteration = 0; iteration < _options.iteration_count; iteration++)
+	{
+		for(const auto &sample : _samples)
+		{
+			bool parsed = false;
+
+			switch(format)
+			{
+				case HttpParserBenchFormat::Legacy:
+				{
+					LegacyRequest request;
+					parsed = ParseLegacy(sample, &request);
+					break;
+				}
+
+				case HttpParserBenchFormat::Span:
+				{
+					std::shared_ptr<HttpRequest> request;
+					parsed = ParseSpan(sample, &request);
+					break;
+				}
+			}
+
+			if(parsed)
+			{
+				result->request_count++;
+				result->header_count += sample.header_count;
+			}
+		}
+	}
+
+	result->seconds = GetCpuTime() - start_time;
+	result->allocation_count = GetThreadAllocationCount() - start_allocation_count;
+}
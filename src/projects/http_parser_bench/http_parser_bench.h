@@ -0,0 +1,83 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <http_server/http_request.h>
+
+struct HttpParserBenchOptions
+{
+	int iteration_count = 100000;
+	// Bytes per ProcessData() call (0: the whole request at once)
+	int read_size = 0;
+};
+
+enum class HttpParserBenchFormat
+{
+	// Split("\r\n") + UpperCaseString()/Trim() + std::map, used before the span parser
+	Legacy,
+	// HttpRequest::ProcessData()
+	Span
+};
+
+struct HttpParserBenchResult
+{
+	uint64_t request_count = 0;
+	uint64_t header_count = 0;
+	uint64_t allocation_count = 0;
+
+	double seconds = 0.0;
+};
+
+class HttpParserBench
+{
+public:
+	explicit HttpParserBench(const HttpParserBenchOptions &options);
+
+	static const char *GetFormatName(HttpParserBenchFormat format);
+
+	// Prepares the player requests
+	void Prepare();
+
+	size_t GetSampleCount() const
+	{
+		return _samples.size();
+	}
+
+	// Checks that both parsers produce the same request line and headers
+	bool Verify();
+
+	void Run(HttpParserBenchFormat format, HttpParserBenchResult *result);
+
+protected:
+	struct Sample
+	{
+		const char *name;
+		size_t header_count;
+		// Chunks of read_size bytes
+		std::vector<std::shared_ptr<const ov::Data>> chunks;
+	};
+
+	struct LegacyRequest
+	{
+		ov::String method;
+		ov::String request_target;
+		ov::String http_version;
+		std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> headers;
+	};
+
+	// Parses the request, and looks up the headers like the segment server does
+	bool ParseLegacy(const Sample &sample, LegacyRequest *request);
+	bool ParseSpan(const Sample &sample, std::shared_ptr<HttpRequest> *request);
+
+	HttpParserBenchOptions _options;
+	std::vector<Sample> _samples;
+};
@@ -0,0 +1,94 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+
+#include "http_parser_bench.h"
+
+#define OV_LOG_TAG                  "HttpParserBench"
+
+static void PrintUsage(const char *program)
+{
+	printf("Usage: %s [OPTION]...\n", program);
+	printf("    -l <count>    Iteration count (default: 100000)\n");
+	printf("    -s <bytes>    Bytes per read, 0 = whole request (default: 0)\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], HttpParserBenchOptions *options)
+{
+	constexpr const char *opt_string = "hl:s:";
+
+	while(true)
+	{
+		int name = getopt(argc, argv, opt_string);
+
+		switch(name)
+		{
+			case -1:
+				return true;
+
+			case 'l':
+				options->iteration_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 's':
+				options->read_size = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'h':
+			default:
+				PrintUsage(argv[0]);
+				return false;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	HttpParserBenchOptions options;
+
+	if(TryParseOption(argc, argv, &options) == false)
+	{
+		return 1;
+	}
+
+	// The parser logs every header in debug level
+	ov_log_set_level(OVLogLevelWarning);
+
+	HttpParserBench bench(options);
+
+	bench.Prepare();
+
+	if(bench.Verify() == false)
+	{
+		return 2;
+	}
+
+	printf("source : %zu player requests, %d iterations, %d bytes per read\n",
+	       bench.GetSampleCount(), options.iteration_count, options.read_size);
+	printf("%-8s %12s %12s %10s %12s %12s\n",
+	       "format", "requests", "headers", "cpu ms", "ns/request", "allocs/req");
+
+	for(auto format : { HttpParserBenchFormat::Legacy, HttpParserBenchFormat::Span })
+	{
+		HttpParserBenchResult result;
+
+		bench.Run(format, &result);
+
+		uint64_t request_count = std::max<uint64_t>(result.request_count, 1);
+
+		printf("%-8s %12" PRIu64 " %12" PRIu64 " %10.2f %12.1f %12.2f\n",
+		       HttpParserBench::GetFormatName(format),
+		       result.request_count, result.header_count,
+		       result.seconds * 1000.0,
+		       result.seconds * 1000000000.0 / request_count,
+		       static_cast<double>(result.allocation_count) / request_count);
+	}
+
+	return 0;
+}
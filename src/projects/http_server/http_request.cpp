@@ -12,6 +12,11 @@
 
 #include <algorithm>
 
+// 대부분의 request 헤더가 들어가는 크기
+static constexpr size_t HttpRequestHeaderReserveSize = 2048;
+// Player는 보통 15~25개의 헤더를 보냄
+static constexpr size_t HttpRequestHeaderFieldReserveCount = 32;
+
 HttpRequest::HttpRequest(const std::shared_ptr<HttpRequestInterceptor> &interceptor, std::shared_ptr<ov::ClientSocket> remote)
 	: _interceptor(interceptor),
 	  _remote(std::move(remote))
@@ -27,50 +32,62 @@ ssize_t HttpRequest::ProcessData(const std::shared_ptr<const ov::Data> &data)
 		return 0L;
 	}
 
-	const char NewLines[] = "\r\n\r\n";
-	// null문자 제외
-	const int NewLinesLength = OV_COUNTOF(NewLines) - 1;
-
-	ssize_t used_length = data->GetLength();
+	if(_request_string.GetCapacity() == 0)
+	{
+		// 대부분의 request 헤더는 이 크기 안에 들어오므로, 재할당 없이 한 번만 할당함
+		_request_string.SetCapacity(std::max(HttpRequestHeaderReserveSize, data->GetLength()));
+		_header_fields.reserve(HttpRequestHeaderFieldReserveCount);
+	}
 
-	// 헤더가 아직 파싱되지 않았으므로, 매 번 데이터가 들어올 때마다 헤더 파싱 시도
-	ssize_t previous_length = _request_string.GetLength();
+	size_t previous_length = _request_string.GetLength();
 
 	_request_string.Append(data->GetDataAs<char>(), data->GetLength());
-	ssize_t newline_position = _request_string.IndexOf(&(NewLines[0]));
 
-	if(newline_position >= 0)
+	// 헤더가 아직 파싱되지 않았으므로, 완성된 줄 단위로 파싱 (이전에 파싱한 줄은 다시 보지 않음)
+	while(_is_header_found == false)
 	{
-		// \r\n\r\n를 찾았다면, 파싱 시작
-		_request_string.SetLength(newline_position);
+		const char *buffer = _request_string.CStr();
+		size_t length = _request_string.GetLength();
 
-		// data 에서 사용한 데이터 수 = [\r\n\r\n 찾은 후 문자열의 길이] - [찾기 전 문자열의 길이] + [\r\n\r\n 길이]
-		used_length = _request_string.GetLength() - previous_length + NewLinesLength;
+		const char *line = buffer + _parsed_length;
+		const char *line_end = static_cast<const char *>(::memmem(line, length - _parsed_length, "\r\n", 2));
 
-		_is_header_found = true;
-		_parse_status = ParseMessage();
-
-		if(_parse_status == HttpStatusCode::OK)
+		if(line_end == nullptr)
 		{
-			// Content length와 같은 정보 계산
-			PostProcess();
+			// 아직 데이터가 덜 들어와서 줄을 파싱 할 수 없음
+			return data->GetLength();
 		}
-		else
+
+		size_t line_length = static_cast<size_t>(line_end - line);
+
+		_parse_status = ParseLine(_parsed_length, line_length);
+
+		if((_parse_status != HttpStatusCode::OK) && (_parse_status != HttpStatusCode::PartialContent))
 		{
 			// 파싱 도중 오류 발생
-			used_length = -1L;
+			return -1L;
 		}
+
+		_parsed_length += line_length + 2;
 	}
-	else
+
+	logtd("Headers found: %zu:", _header_fields.size());
+
+	for(const auto &field : _header_fields)
 	{
-		// 아직 데이터가 덜 들어와서 헤더를 파싱 할 수 없음
+		logtd("\t>> %.*s: %.*s",
+		      static_cast<int>(field.name_length), _request_string.CStr() + field.name_offset,
+		      static_cast<int>(field.value_length), _request_string.CStr() + field.value_offset);
 	}
 
-	// 사용한 데이터 길이 반환
-	return used_length;
+	// Content length와 같은 정보 계산
+	PostProcess();
+
+	// data 에서 사용한 데이터 수 = [\r\n\r\n 까지의 길이] - [data를 추가하기 전 문자열의 길이]
+	return static_cast<ssize_t>(_parsed_length - previous_length);
 }
 
-HttpStatusCode HttpRequest::ParseMessage()
+HttpStatusCode HttpRequest::ParseLine(size_t offset, size_t length)
 {
 	// RFC7230 - 3. Message Format
 	// HTTP-message   = start-line
@@ -80,74 +97,83 @@ HttpStatusCode HttpRequest::ParseMessage()
 
 	// RFC7230 - 3.1. Start Line
 	// start-line     = request-line / status-line
+	if(_is_request_line_parsed == false)
+	{
+		if(length == 0)
+		{
+			// RFC7230 - 3.5. Message Parsing Robustness
+			// a server that is expecting to receive and parse a request-line SHOULD ignore
+			// at least one empty line (CRLF) received prior to the request-line.
+			return HttpStatusCode::PartialContent;
+		}
 
-	// 줄바꿈 문자를 기준으로 tokenize
-	std::vector<ov::String> tokens = _request_string.Split("\r\n");
+		_is_request_line_parsed = true;
 
-	HttpStatusCode status_code;
+		auto status_code = ParseRequestLine(_request_string.CStr() + offset, length);
 
-	status_code = ParseRequestLine(tokens[0]);
-	tokens.erase(tokens.begin());
+		return (status_code == HttpStatusCode::OK) ? HttpStatusCode::PartialContent : status_code;
+	}
 
-	if(status_code == HttpStatusCode::OK)
+	if(length == 0)
 	{
-		for(const ov::String &token : tokens)
-		{
-			status_code = ParseHeader(token);
-
-			if(status_code != HttpStatusCode::OK)
-			{
-				break;
-			}
-		}
+		// 헤더의 끝 (CRLF)
+		_is_header_found = true;
+		return HttpStatusCode::OK;
 	}
 
-	logtd("Headers found: %ld:", _request_header.size());
+	auto status_code = ParseHeader(offset, length);
 
-	std::for_each(_request_header.begin(), _request_header.end(), [](const auto &pair) -> void
-	{
-		logtd("\t>> %s: %s", pair.first.CStr(), pair.second.CStr());
-	});
-
-	return status_code;
+	return (status_code == HttpStatusCode::OK) ? HttpStatusCode::PartialContent : status_code;
 }
 
-#define HTTP_COMPARE_METHOD(text, value_if_matches) \
-    if(method == text) \
-    { \
-        _method = value_if_matches; \
-    }
-
-HttpStatusCode HttpRequest::ParseRequestLine(const ov::String &line)
+HttpStatusCode HttpRequest::ParseRequestLine(const char *line, size_t length)
 {
 	// RFC7230 - 3.1.1. Request Line
 	// request-line   = method SP request-target SP HTTP-version CRLF
-	ssize_t first_space_index = line.IndexOf(' ');
-	ssize_t last_space_index = line.IndexOfRev(' ');
+	auto first_space = static_cast<const char *>(::memchr(line, ' ', length));
+	auto last_space = static_cast<const char *>(::memrchr(line, ' ', length));
 
-	if((first_space_index < 0) || (last_space_index < 0) || (first_space_index == last_space_index))
+	if((first_space == nullptr) || (first_space == last_space))
 	{
-		logtw("Invalid space index: first: %d, last: %d, line: %s", first_space_index, last_space_index, line.CStr());
+		logtw("Invalid request line: %.*s", static_cast<int>(length), line);
 		return HttpStatusCode::BadRequest;
 	}
 
-	_method = HttpMethod::Unknown;
-
 	// RFC7231 - 4. Request Methods
-	ov::String method = line.Left(static_cast<size_t>(first_space_index));
+	struct MethodName
+	{
+		const char *name;
+		size_t length;
+		HttpMethod method;
+	};
+
+	static const MethodName method_names[] = {
+		{ "GET", 3, HttpMethod::Get },
+		{ "HEAD", 4, HttpMethod::Head },
+		{ "POST", 4, HttpMethod::Post },
+		{ "PUT", 3, HttpMethod::Put },
+		{ "DELETE", 6, HttpMethod::Delete },
+		{ "CONNECT", 7, HttpMethod::Connect },
+		{ "OPTIONS", 7, HttpMethod::Options },
+		{ "TRACE", 5, HttpMethod::Trace }
+	};
+
+	size_t method_length = static_cast<size_t>(first_space - line);
 
-	HTTP_COMPARE_METHOD("GET", HttpMethod::Get);
-	HTTP_COMPARE_METHOD("HEAD", HttpMethod::Head);
-	HTTP_COMPARE_METHOD("POST", HttpMethod::Post);
-	HTTP_COMPARE_METHOD("PUT", HttpMethod::Put);
-	HTTP_COMPARE_METHOD("DELETE", HttpMethod::Delete);
-	HTTP_COMPARE_METHOD("CONNECT", HttpMethod::Connect);
-	HTTP_COMPARE_METHOD("OPTIONS", HttpMethod::Options);
-	HTTP_COMPARE_METHOD("TRACE", HttpMethod::Trace);
+	_method = HttpMethod::Unknown;
+
+	for(const auto &method_name : method_names)
+	{
+		if((method_name.length == method_length) && (::memcmp(method_name.name, line, method_length) == 0))
+		{
+			_method = method_name.method;
+			break;
+		}
+	}
 
 	if(_method == HttpMethod::Unknown)
 	{
-		logtw("Unknown method: %s", method.CStr());
+		logtw("Unknown method: %.*s", static_cast<int>(method_length), line);
 		return HttpStatusCode::MethodNotAllowed;
 	}
 
@@ -156,18 +182,18 @@ HttpStatusCode HttpRequest::ParseRequestLine(const ov::String &line)
 	//            / absolute-form
 	//            / authority-form
 	//            / asterisk-form
-	_request_target = line.Substring(first_space_index + 1, static_cast<size_t>(last_space_index - first_space_index - 1));
+	_request_target = ov::String(first_space + 1, static_cast<size_t>(last_space - first_space - 1));
 
 	// RFC7230 - 2.6. Protocol Versioning
 	// HTTP-version  = HTTP-name "/" DIGIT "." DIGIT
 	// HTTP-name     = %x48.54.54.50 ; "HTTP", case-sensitive
-	_http_version = line.Substring(last_space_index + 1);
+	_http_version = ov::String(last_space + 1, static_cast<size_t>((line + length) - last_space - 1));
 
-	logtd("Method: [%s], uri: [%s], version: [%s]", method.CStr(), _request_target.CStr(), _http_version.CStr());
+	logtd("Method: [%.*s], uri: [%s], version: [%s]", static_cast<int>(method_length), line, _request_target.CStr(), _http_version.CStr());
 	return HttpStatusCode::OK;
 }
 
-HttpStatusCode HttpRequest::ParseHeader(const ov::String &line)
+HttpStatusCode HttpRequest::ParseHeader(size_t offset, size_t length)
 {
 	// RFC7230 - 3.2.  Header Fields
 	// header-field   = field-name ":" OWS field-value OWS
@@ -192,25 +218,69 @@ HttpStatusCode HttpRequest::ParseHeader(const ov::String &line)
 	// the obs-fold rule) unless the message is intended for packaging
 	// within the message/http media type.
 
-	ssize_t colon_index = line.IndexOf(':');
+	const char *line = _request_string.CStr() + offset;
+	auto colon = static_cast<const char *>(::memchr(line, ':', length));
 
-	if(colon_index == -1)
+	if(colon == nullptr)
 	{
 		// 잘못된 헤더
-		logtw("Invalid header (could not find colon): %s", line.CStr());
+		logtw("Invalid header (could not find colon): %.*s", static_cast<int>(length), line);
 		return HttpStatusCode::BadRequest;
 	}
 
-	// 모든 헤더 이름은 대문자로 처리
-	ov::String field_name = line.Left(static_cast<size_t>(colon_index)).UpperCaseString();
 	// 처리를 용이하게 하기 위해 OWS(optional white space) 없앰
-	ov::String field_value = line.Substring(colon_index + 1).Trim();
+	const char *value = colon + 1;
+	const char *value_end = line + length;
 
-	_request_header[field_name] = field_value;
+	while((value < value_end) && ((*value == ' ') || (*value == '\t')))
+	{
+		value++;
+	}
+
+	while((value_end > value) && ((value_end[-1] == ' ') || (value_end[-1] == '\t')))
+	{
+		value_end--;
+	}
+
+	_header_fields.push_back(HeaderField {
+		offset,
+		static_cast<size_t>(colon - line),
+		offset + static_cast<size_t>(value - line),
+		static_cast<size_t>(value_end - value)
+	});
 
 	return HttpStatusCode::OK;
 }
 
+const HttpRequest::HeaderField *HttpRequest::FindHeader(const char *name, size_t length) const noexcept
+{
+	const char *buffer = _request_string.CStr();
+
+	// 같은 이름의 헤더가 여러 개면 마지막 값을 사용
+	for(auto field = _header_fields.rbegin(); field != _header_fields.rend(); ++field)
+	{
+		if((field->name_length == length) && (::strncasecmp(buffer + field->name_offset, name, length) == 0))
+		{
+			return &(*field);
+		}
+	}
+
+	return nullptr;
+}
+
+std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> HttpRequest::GetRequestHeader() const
+{
+	std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> headers;
+	const char *buffer = _request_string.CStr();
+
+	for(const auto &field : _header_fields)
+	{
+		headers[ov::String(buffer + field.name_offset, field.name_length)] = ov::String(buffer + field.value_offset, field.value_length);
+	}
+
+	return headers;
+}
+
 ov::String HttpRequest::GetHeader(const ov::String &key) const noexcept
 {
 	return GetHeader(key, "");
@@ -218,39 +288,43 @@ ov::String HttpRequest::GetHeader(const ov::String &key) const noexcept
 
 ov::String HttpRequest::GetHeader(const ov::String &key, ov::String default_value) const noexcept
 {
-	auto item = _request_header.find(key.UpperCaseString());
+	auto field = FindHeader(key.CStr(), key.GetLength());
 
-	if(item == _request_header.cend())
+	if(field == nullptr)
 	{
 		return std::move(default_value);
 	}
 
-	return item->second;
+	return ov::String(_request_string.CStr() + field->value_offset, field->value_length);
 }
 
 const bool HttpRequest::IsHeaderExists(const ov::String &key) const noexcept
 {
-	return _request_header.find(key) != _request_header.cend();
+	return FindHeader(key.CStr(), key.GetLength()) != nullptr;
 }
 
 void HttpRequest::PostProcess()
 {
-	switch(_method)
+	_content_length = 0L;
+
+	if(_method == HttpMethod::Get)
 	{
-		case HttpMethod::Get:
-			// http body가 없음
-			_content_length = 0L;
-			break;
+		// http body가 없음
+		return;
+	}
 
-		case HttpMethod::Post:
-			// http body가 있을 수도 있으므로 파싱 시도
-			_content_length = ov::Converter::ToInt64(GetHeader("CONTENT-LENGTH", "0"));
-			break;
+	// http body가 있을 수도 있으므로 파싱 시도
+	auto field = FindHeader("CONTENT-LENGTH", 14);
 
-		default:
-			// 나머지 헤더
-			_content_length = ov::Converter::ToInt64(GetHeader("CONTENT-LENGTH", "0"));
-			break;
+	if(field != nullptr)
+	{
+		const char *value = _request_string.CStr() + field->value_offset;
+
+		// 최대 18자리 (int64 범위 안)
+		for(size_t index = 0; (index < std::min<size_t>(field->value_length, 18)) && (value[index] >= '0') && (value[index] <= '9'); index++)
+		{
+			_content_length = (_content_length * 10) + (value[index] - '0');
+		}
 	}
 }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "http_datastructure.h"
+#include "http_router.h"
 #include "interceptors/http_request_interceptor.h"
 
 class HttpRequest : public ov::EnableSharedFromThis<HttpRequest>
@@ -77,11 +78,10 @@ public:
 		return _content_length;
 	}
 
-	const std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> &GetRequestHeader() const noexcept
-	{
-		return _request_header;
-	}
+	// 헤더는 수신 버퍼의 위치로만 저장되어 있으므로, 호출할 때마다 map을 새로 만듦
+	std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> GetRequestHeader() const;
 
+	// 헤더 이름은 대소문자를 구분하지 않음 (같은 이름의 헤더가 여러 개면 마지막 값을 사용)
 	ov::String GetHeader(const ov::String &key) const noexcept;
 	ov::String GetHeader(const ov::String &key, ov::String default_value) const noexcept;
 	const bool IsHeaderExists(const ov::String &key) const noexcept;
@@ -123,6 +123,31 @@ public:
 		_extra = std::move(extra);
 	}
 
+	// Segments captured by the route that matched the request target
+	const std::vector<HttpRouteCapture> &GetRouteCaptures() const
+	{
+		return _route_captures;
+	}
+
+	// Returns an empty value if the route has no capture named name
+	HttpRouteValue GetRouteValue(const char *name) const
+	{
+		for(const auto &capture : _route_captures)
+		{
+			if(*(capture.name) == name)
+			{
+				return capture.value;
+			}
+		}
+
+		return HttpRouteValue();
+	}
+
+	void SetRouteCaptures(std::vector<HttpRouteCapture> captures)
+	{
+		_route_captures = std::move(captures);
+	}
+
 	ov::String ToString() const;
 
 protected:
@@ -142,9 +167,20 @@ protected:
 		return _request_body;
 	}
 
-	HttpStatusCode ParseMessage();
-	HttpStatusCode ParseRequestLine(const ov::String &line);
-	HttpStatusCode ParseHeader(const ov::String &line);
+	// Position of a header field in _request_string
+	struct HeaderField
+	{
+		size_t name_offset;
+		size_t name_length;
+		size_t value_offset;
+		size_t value_length;
+	};
+
+	HttpStatusCode ParseLine(size_t offset, size_t length);
+	HttpStatusCode ParseRequestLine(const char *line, size_t length);
+	HttpStatusCode ParseHeader(size_t offset, size_t length);
+
+	const HeaderField *FindHeader(const char *name, size_t length) const noexcept;
 
 	void PostProcess();
 
@@ -161,9 +197,12 @@ protected:
 
 	// request 헤더
 	bool _is_header_found = false;
-	// 헤더 영역을 추출해내기 위해 임시로 사용되는 문자열 버퍼
+	bool _is_request_line_parsed = false;
+	// 헤더 영역을 받아두는 버퍼 (socket의 수신 버퍼는 재사용되므로 복사해둠)
 	ov::String _request_string;
-	std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> _request_header;
+	// _request_string에서 아직 파싱하지 않은 줄의 시작 위치
+	size_t _parsed_length = 0;
+	std::vector<HeaderField> _header_fields;
 
 	// 자주 사용하는 헤더 값은 미리 저장해놓음
 	ssize_t _content_length = 0L;
@@ -174,4 +213,7 @@ protected:
 	HttpResponse *_response = nullptr;
 
 	std::shared_ptr<void> _extra = nullptr;
+
+	// Refer to _request_target
+	std::vector<HttpRouteCapture> _route_captures;
 };
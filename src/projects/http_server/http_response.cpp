@@ -128,6 +128,101 @@ bool HttpResponse::Send(const std::shared_ptr<const ov::Data> &data)
 	return Send(data->GetData(), data->GetLength());
 }
 
+bool HttpResponse::Send(struct iovec *vectors, int count)
+{
+	OV_ASSERT2(_remote != nullptr);
+
+	if(_remote == nullptr)
+	{
+		return false;
+	}
+
+	if(_tls != nullptr)
+	{
+		// Each buffer is encrypted by ov::Tls::Write()
+		for(int index = 0; index < count; index++)
+		{
+			if(Send(vectors[index].iov_base, vectors[index].iov_len) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	size_t length = 0L;
+
+	for(int index = 0; index < count; index++)
+	{
+		length += vectors[index].iov_len;
+	}
+
+	ssize_t sent = _remote->Send(vectors, count);
+
+	return (sent >= 0) && (static_cast<size_t>(sent) == length);
+}
+
+bool HttpResponse::SendChunkedData(const void *data, size_t length)
+{
+	if(_is_chunked_transfer == false)
+	{
+		if(_is_header_sent)
+		{
+			logtw("Cannot send chunked data: Header is sent without Transfer-Encoding");
+			return false;
+		}
+
+		_response_header["Transfer-Encoding"] = "chunked";
+		_is_chunked_transfer = true;
+
+		if(SendHeaderIfNeeded() == false)
+		{
+			return false;
+		}
+	}
+
+	if(length == 0)
+	{
+		// A zero-length chunk means the end of the message body
+		return true;
+	}
+
+	// chunk = chunk-size CRLF chunk-data CRLF
+	// (sent together without copying the chunk data)
+	char chunk_size[20];
+	int chunk_size_length = ::snprintf(chunk_size, sizeof(chunk_size), "%zx\r\n", length);
+
+	struct iovec vectors[3] = {
+		{ .iov_base = chunk_size, .iov_len = static_cast<size_t>(chunk_size_length) },
+		{ .iov_base = const_cast<void *>(data), .iov_len = length },
+		{ .iov_base = const_cast<char *>("\r\n"), .iov_len = 2 }
+	};
+
+	return Send(vectors, 3);
+}
+
+bool HttpResponse::SendChunkedData(const std::shared_ptr<const ov::Data> &data)
+{
+	if(data == nullptr)
+	{
+		return false;
+	}
+
+	return SendChunkedData(data->GetData(), data->GetLength());
+}
+
+bool HttpResponse::SendChunkedEnd()
+{
+	if(_is_chunked_transfer == false)
+	{
+		return false;
+	}
+
+	// last-chunk CRLF (no trailer)
+	return Send("0\r\n\r\n", 5);
+}
+
 bool HttpResponse::SendHeaderIfNeeded()
 {
 	if(_is_header_sent)
@@ -54,6 +54,14 @@ public:
 
 	bool Send(const void *data, size_t length);
 	bool Send(const std::shared_ptr<const ov::Data> &data);
+	// Send multiple buffers with a single system call (the contents of vectors are changed)
+	bool Send(struct iovec *vectors, int count);
+
+	// RFC7230 - 4.1. Chunked Transfer Coding
+	// The header is sent with "Transfer-Encoding: chunked" on the first call, and the message body must be finished with SendChunkedEnd()
+	bool SendChunkedData(const void *data, size_t length);
+	bool SendChunkedData(const std::shared_ptr<const ov::Data> &data);
+	bool SendChunkedEnd();
 
 	bool Response();
 
@@ -101,6 +109,7 @@ protected:
 	ov::String _reason = StringFromHttpStatusCode(HttpStatusCode::OK);
 
 	bool _is_header_sent = false;
+	bool _is_chunked_transfer = false;
 
 	std::map<ov::String, ov::String> _response_header;
 
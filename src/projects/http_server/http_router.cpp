@@ -0,0 +1,310 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_router.h"
+#include "http_private.h"
+
+#include <algorithm>
+
+HttpRouter::HttpRouter() = default;
+HttpRouter::~HttpRouter() = default;
+
+bool HttpRouter::Node::IsSameSegment(const Node &node) const
+{
+	return (type == node.type) && (name == node.name) && (extension_name == node.extension_name) && (extensions == node.extensions);
+}
+
+bool HttpRouter::ParseSegment(const ov::String &segment, Node *node)
+{
+	if(segment.Get(0) != '{')
+	{
+		if(segment.IndexOf('{') >= 0)
+		{
+			// Captures must be the whole segment
+			return false;
+		}
+
+		node->type = SegmentType::Static;
+		node->name = segment;
+		return true;
+	}
+
+	if(segment.Get(segment.GetLength() - 1) != '}')
+	{
+		return false;
+	}
+
+	off_t name_end = segment.IndexOf('}');
+
+	if(name_end == static_cast<off_t>(segment.GetLength() - 1))
+	{
+		// {name}
+		node->type = SegmentType::Capture;
+		node->name = segment.Substring(1, name_end - 1);
+
+		return node->name.IsEmpty() == false;
+	}
+
+	// {name}.{ext} or {name}.{ext:value|value|...}
+	if((segment.Get(name_end + 1) != '.') || (segment.Get(name_end + 2) != '{'))
+	{
+		return false;
+	}
+
+	ov::String extension = segment.Substring(name_end + 3, segment.GetLength() - name_end - 4);
+	auto tokens = extension.Split(":");
+
+	if((tokens.size() == 0) || (tokens.size() > 2))
+	{
+		return false;
+	}
+
+	node->type = SegmentType::File;
+	node->name = segment.Substring(1, name_end - 1);
+	node->extension_name = tokens[0];
+
+	if(tokens.size() == 2)
+	{
+		node->extensions = tokens[1].Split("|");
+	}
+
+	return (node->name.IsEmpty() == false) && (node->extension_name.IsEmpty() == false);
+}
+
+bool HttpRouter::Register(HttpMethod method, const ov::String &pattern, const HttpRequestHandler &handler)
+{
+	if(handler == nullptr)
+	{
+		return false;
+	}
+
+	auto tokens = pattern.Split("/");
+	Node *node = &_root;
+	size_t depth = 0;
+	bool is_wildcard = false;
+
+	for(size_t index = 0; index < tokens.size(); index++)
+	{
+		const auto &token = tokens[index];
+
+		if(token.IsEmpty())
+		{
+			continue;
+		}
+
+		if(token == "*")
+		{
+			if(node != &_root)
+			{
+				logte("'*' is only allowed as the first segment: %s", pattern.CStr());
+				return false;
+			}
+
+			node = &_wildcard_root;
+			is_wildcard = true;
+			continue;
+		}
+
+		auto child = std::make_unique<Node>();
+
+		if(ParseSegment(token, child.get()) == false)
+		{
+			logte("Invalid segment [%s] in the pattern: %s", token.CStr(), pattern.CStr());
+			return false;
+		}
+
+		auto &children = node->children;
+
+		auto same_child = std::find_if(children.begin(), children.end(), [&child](const std::unique_ptr<Node> &item) -> bool
+		{
+			return item->IsSameSegment(*child);
+		});
+
+		if(same_child != children.end())
+		{
+			node = same_child->get();
+		}
+		else
+		{
+			// Keep the children sorted by the priority (static segments first)
+			auto position = std::upper_bound(children.begin(), children.end(), child->type, [](SegmentType type, const std::unique_ptr<Node> &item) -> bool
+			{
+				return type < item->type;
+			});
+
+			node = children.insert(position, std::move(child))->get();
+		}
+
+		depth++;
+	}
+
+	if(is_wildcard)
+	{
+		_wildcard_depths.insert(depth);
+	}
+
+	node->routes.push_back(HttpRoute { method, handler });
+
+	return true;
+}
+
+bool HttpRouter::SplitPath(const ov::String &target, HttpRouteValue *segments, size_t *segment_count)
+{
+	const char *current = target.CStr();
+	const char *end = current + target.GetLength();
+	size_t count = 0;
+
+	while(current < end)
+	{
+		const char *segment_end = current;
+
+		while((segment_end < end) && (*segment_end != '/') && (*segment_end != '?') && (*segment_end != '#'))
+		{
+			segment_end++;
+		}
+
+		if(segment_end > current)
+		{
+			if(count == HTTP_ROUTER_MAX_SEGMENTS)
+			{
+				return false;
+			}
+
+			segments[count] = HttpRouteValue(current, static_cast<size_t>(segment_end - current));
+			count++;
+		}
+
+		if((segment_end < end) && (*segment_end != '/'))
+		{
+			// Query string or fragment
+			break;
+		}
+
+		current = segment_end + 1;
+	}
+
+	*segment_count = count;
+
+	return true;
+}
+
+bool HttpRouter::MatchSegment(const Node &node, const HttpRouteValue &segment, std::vector<HttpRouteCapture> *captures)
+{
+	switch(node.type)
+	{
+		case SegmentType::Static:
+			return segment == node.name;
+
+		case SegmentType::Capture:
+			captures->push_back(HttpRouteCapture { &(node.name), segment });
+			return true;
+
+		case SegmentType::File:
+		{
+			auto dot = static_cast<const char *>(::memchr(segment.GetData(), '.', segment.GetLength()));
+
+			if(dot == nullptr)
+			{
+				return false;
+			}
+
+			size_t name_length = static_cast<size_t>(dot - segment.GetData());
+			HttpRouteValue extension(dot + 1, segment.GetLength() - name_length - 1);
+
+			if((name_length == 0) || extension.IsEmpty() || (::memchr(extension.GetData(), '.', extension.GetLength()) != nullptr))
+			{
+				return false;
+			}
+
+			if(node.extensions.empty() == false)
+			{
+				auto allowed = std::find_if(node.extensions.begin(), node.extensions.end(), [&extension](const ov::String &value) -> bool
+				{
+					return extension == value;
+				});
+
+				if(allowed == node.extensions.end())
+				{
+					return false;
+				}
+			}
+
+			captures->push_back(HttpRouteCapture { &(node.name), HttpRouteValue(segment.GetData(), name_length) });
+			captures->push_back(HttpRouteCapture { &(node.extension_name), extension });
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const std::vector<HttpRoute> *HttpRouter::MatchNode(const Node &node, const HttpRouteValue *segments, size_t segment_count, std::vector<HttpRouteCapture> *captures)
+{
+	if(segment_count == 0)
+	{
+		return node.routes.empty() ? nullptr : &(node.routes);
+	}
+
+	size_t capture_count = captures->size();
+
+	for(const auto &child : node.children)
+	{
+		if(MatchSegment(*child, segments[0], captures))
+		{
+			auto routes = MatchNode(*child, segments + 1, segment_count - 1, captures);
+
+			if(routes != nullptr)
+			{
+				return routes;
+			}
+		}
+
+		// Discard the captures of the unmatched branch
+		captures->resize(capture_count);
+	}
+
+	return nullptr;
+}
+
+const std::vector<HttpRoute> *HttpRouter::Match(const ov::String &target, std::vector<HttpRouteCapture> *captures) const
+{
+	HttpRouteValue segments[HTTP_ROUTER_MAX_SEGMENTS];
+	size_t segment_count = 0;
+
+	captures->clear();
+
+	if(SplitPath(target, segments, &segment_count) == false)
+	{
+		return nullptr;
+	}
+
+	auto routes = MatchNode(_root, segments, segment_count, captures);
+
+	if(routes != nullptr)
+	{
+		return routes;
+	}
+
+	// Longer patterns are more specific
+	for(auto depth = _wildcard_depths.rbegin(); depth != _wildcard_depths.rend(); ++depth)
+	{
+		if(*depth > segment_count)
+		{
+			continue;
+		}
+
+		routes = MatchNode(_wildcard_root, segments + (segment_count - *depth), *depth, captures);
+
+		if(routes != nullptr)
+		{
+			return routes;
+		}
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,165 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "http_datastructure.h"
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <base/ovlibrary/ovlibrary.h>
+
+// Requests that have more path segments than this are not routed
+#define HTTP_ROUTER_MAX_SEGMENTS        32
+
+// Part of the request target (not copied).
+// Valid while the request target is alive.
+class HttpRouteValue
+{
+public:
+	HttpRouteValue() = default;
+
+	HttpRouteValue(const char *data, size_t length)
+		: _data(data),
+		  _length(length)
+	{
+	}
+
+	const char *GetData() const noexcept
+	{
+		return _data;
+	}
+
+	size_t GetLength() const noexcept
+	{
+		return _length;
+	}
+
+	bool IsEmpty() const noexcept
+	{
+		return _length == 0;
+	}
+
+	bool IsEqual(const char *str, size_t length) const noexcept
+	{
+		return (_length == length) && ((length == 0) || (::memcmp(_data, str, length) == 0));
+	}
+
+	bool operator ==(const char *str) const noexcept
+	{
+		return IsEqual(str, ::strlen(str));
+	}
+
+	bool operator ==(const ov::String &str) const noexcept
+	{
+		return IsEqual(str.CStr(), str.GetLength());
+	}
+
+	template<typename T>
+	bool operator !=(const T &str) const noexcept
+	{
+		return (*this == str) == false;
+	}
+
+	ov::String ToString() const
+	{
+		return ov::String(_data, _length);
+	}
+
+protected:
+	const char *_data = nullptr;
+	size_t _length = 0;
+};
+
+struct HttpRouteCapture
+{
+	// Name of the capture in the pattern (owned by the router)
+	const ov::String *name;
+	HttpRouteValue value;
+};
+
+struct HttpRoute
+{
+	HttpMethod method;
+	HttpRequestHandler handler;
+};
+
+//--------------------------------------------------------------------
+// HttpRouter
+//--------------------------------------------------------------------
+// Compiled route table. The patterns are split into path segments and stored in a tree,
+// so a request target is matched by walking the tree once, without regex or copies.
+//
+// Pattern syntax (segments are separated by '/'):
+//
+//   stat                  The segment must be "stat"
+//   {name}                Captures a segment
+//   {name}.{ext}          Captures a segment that has exactly one '.' as name and ext
+//   {name}.{ext:ts|m4s}   Same as above, but the ext must be one of the listed values
+//   *                     Any number of leading segments (only allowed as the first segment)
+//
+// ex) "*/{app}/{stream}/{file}.{ext:m3u8|mpd}" matches "/any/prefix/app/stream/playlist.m3u8?key=value"
+//
+// Query string and fragment of the request target are ignored, and empty segments are skipped.
+// Static segments take precedence over captures, and full patterns take precedence over the patterns that start with '*'.
+class HttpRouter
+{
+public:
+	HttpRouter();
+	~HttpRouter();
+
+	bool Register(HttpMethod method, const ov::String &pattern, const HttpRequestHandler &handler);
+
+	/// Finds the routes that matches the request target
+	///
+	/// @param target request target
+	/// @param captures captured segments (refer to the target)
+	///
+	/// @return routes of the matched pattern (the method is not checked). nullptr if there is no pattern matched.
+	const std::vector<HttpRoute> *Match(const ov::String &target, std::vector<HttpRouteCapture> *captures) const;
+
+protected:
+	enum class SegmentType
+	{
+		// The order is the priority of the matching
+		Static,
+		File,
+		Capture
+	};
+
+	struct Node
+	{
+		SegmentType type = SegmentType::Static;
+
+		// Static: the segment, Capture/File: the name of the capture
+		ov::String name;
+		// File: the name of the extension capture, and the allowed extensions (all extensions are allowed if empty)
+		ov::String extension_name;
+		std::vector<ov::String> extensions;
+
+		std::vector<std::unique_ptr<Node>> children;
+		std::vector<HttpRoute> routes;
+
+		bool IsSameSegment(const Node &node) const;
+	};
+
+	static bool ParseSegment(const ov::String &segment, Node *node);
+	static bool SplitPath(const ov::String &target, HttpRouteValue *segments, size_t *segment_count);
+
+	static bool MatchSegment(const Node &node, const HttpRouteValue &segment, std::vector<HttpRouteCapture> *captures);
+	static const std::vector<HttpRoute> *MatchNode(const Node &node, const HttpRouteValue *segments, size_t segment_count, std::vector<HttpRouteCapture> *captures);
+
+	Node _root;
+
+	// Patterns that start with '*' (matched against the last segments of the request target)
+	Node _wildcard_root;
+	// Segment counts of the patterns under _wildcard_root
+	std::set<size_t> _wildcard_depths;
+};
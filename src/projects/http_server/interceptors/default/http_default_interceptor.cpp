@@ -14,21 +14,7 @@
 
 bool HttpDefaultInterceptor::Register(HttpMethod method, const ov::String &pattern, const HttpRequestHandler &handler)
 {
-	if(handler == nullptr)
-	{
-		return false;
-	}
-
-	_request_handler_list.push_back((RequestInfo){
-#if DEBUG
-		.pattern_string = pattern,
-#endif // DEBUG
-		.pattern = std::regex(pattern),
-		.method = method,
-		.handler = handler
-	});
-
-	return true;
+	return _router.Register(method, pattern, handler);
 }
 
 bool HttpDefaultInterceptor::IsInterceptorForRequest(const std::shared_ptr<const HttpRequest> &request, const std::shared_ptr<const HttpResponse> &response)
@@ -106,46 +92,37 @@ bool HttpDefaultInterceptor::OnHttpData(const std::shared_ptr<HttpRequest> &requ
 			logtd("HTTP message is parsed successfully");
 
 			// 처리할 수 있는 handler 찾음
-			int handler_count = 0;
+			std::vector<HttpRouteCapture> captures;
+			auto routes = _router.Match(request->GetRequestTarget(), &captures);
 
-			// 403 Method not allowed 처리 하기 위한 수단
-			bool regex_found = false;
-
-			for(auto &request_info : _request_handler_list)
+			if(routes == nullptr)
 			{
-#if DEBUG
-				logtd("Check if url [%s] is matches [%s]", request->GetRequestTarget().CStr(), request_info.pattern_string.CStr());
-#endif // DEBUG
+				// URL을 처리할 수 있는 handler를 아예 찾을 수 없음
+				logtd("No route found for url [%s]", request->GetRequestTarget().CStr());
+				response->SetStatusCode(HttpStatusCode::NotFound);
+				return false;
+			}
 
-				response->SetStatusCode(HttpStatusCode::OK);
+			request->SetRouteCaptures(std::move(captures));
 
-				if(std::regex_match(request->GetRequestTarget().CStr(), request_info.pattern))
-				{
-					// 일단 패턴에 일치하는 handler 찾음
-					regex_found = true;
+			int handler_count = 0;
 
-					// method가 일치하는지 확인
-					if(HTTP_CHECK_METHOD(request_info.method, request->GetMethod()))
-					{
-						handler_count++;
+			for(auto &route : *routes)
+			{
+				// method가 일치하는지 확인
+				if(HTTP_CHECK_METHOD(route.method, request->GetMethod()))
+				{
+					handler_count++;
 
-						request_info.handler(request, response);
-					}
+					response->SetStatusCode(HttpStatusCode::OK);
+					route.handler(request, response);
 				}
 			}
 
 			if(handler_count == 0)
 			{
-				if(regex_found)
-				{
-					// 패턴에 일치하는 handler는 찾았으나, 실제로 1의 handler도 실행이 안되었다면 Method not allowed임
-					response->SetStatusCode(HttpStatusCode::MethodNotAllowed);
-				}
-				else
-				{
-					// URL을 처리할 수 있는 handler를 아예 찾을 수 없음
-					response->SetStatusCode(HttpStatusCode::NotFound);
-				}
+				// 패턴에 일치하는 handler는 찾았으나, 실제로 1의 handler도 실행이 안되었다면 Method not allowed임
+				response->SetStatusCode(HttpStatusCode::MethodNotAllowed);
 			}
 			else
 			{
@@ -9,10 +9,9 @@
 #pragma once
 
 #include "../../http_datastructure.h"
+#include "../../http_router.h"
 #include "http_server/interceptors/http_request_interceptor.h"
 
-#include <regex>
-
 /// HTTP 기본 처리기
 class HttpDefaultInterceptor : public HttpRequestInterceptor
 {
@@ -20,7 +19,7 @@ public:
 	HttpDefaultInterceptor() = default;
 	~HttpDefaultInterceptor() = default;
 
-	// ECMAScript regex (http://www.cplusplus.com/reference/regex/ECMAScript)
+	// Route pattern (see HttpRouter)
 	// method + pattern을 처리하는 handler 등록
 	bool Register(HttpMethod method, const ov::String &pattern, const HttpRequestHandler &handler);
 
@@ -34,16 +33,6 @@ public:
 	void OnHttpClosed(const std::shared_ptr<HttpRequest> &request, const std::shared_ptr<HttpResponse> &response) override;
 
 protected:
-	struct RequestInfo
-	{
-#if DEBUG
-		ov::String pattern_string;
-#endif // DEBUG
-		std::regex pattern;
-		HttpMethod method;
-		HttpRequestHandler handler;
-	};
-
-	std::vector<RequestInfo> _request_handler_list;
+	HttpRouter _router;
 };
 
@@ -24,7 +24,10 @@ WebSocketClient::~WebSocketClient()
 {
 }
 
-ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSocketFrameOpcode opcode)
+// Frame header + extended payload length (up to 64 bits)
+#define WEB_SOCKET_MAX_FRAME_HEADER_SIZE (sizeof(WebSocketFrameHeader) + sizeof(uint64_t))
+
+size_t WebSocketClient::MakeFrameHeader(uint8_t *buffer, size_t payload_length, WebSocketFrameOpcode opcode)
 {
 	// RFC6455 - 5.2.  Base Framing Protocol
 	//
@@ -37,9 +40,9 @@ ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSo
 		.mask = false
 	};
 
-	size_t length = data->GetLength();
+	size_t length = payload_length;
 
-	if(length < 0x7D)
+	if(length <= 0x7D)
 	{
 		// frame-payload-length    = ( %x00-7D )
 		//                         / ( %x7E frame-payload-length-16 )
@@ -48,7 +51,7 @@ ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSo
 		//                         ; respectively
 		header.payload_length = static_cast<uint8_t>(length);
 	}
-	else if(length < 0xFFFF)
+	else if(length <= 0xFFFF)
 	{
 		// frame-payload-length-16 = %x0000-FFFF ; 16 bits in length
 		header.payload_length = 126;
@@ -60,24 +63,42 @@ ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSo
 		header.payload_length = 127;
 	}
 
-	_response->Send(&header);
+	size_t header_length = sizeof(header);
+
+	::memcpy(buffer, &header, sizeof(header));
 
 	if(header.payload_length == 126)
 	{
-		auto payload_length = ov::HostToNetwork16(static_cast<uint16_t>(length));
+		auto extended_length = ov::HostToNetwork16(static_cast<uint16_t>(length));
 
-		_response->Send(&payload_length);
+		::memcpy(buffer + header_length, &extended_length, sizeof(extended_length));
+		header_length += sizeof(extended_length);
 	}
 	else if(header.payload_length == 127)
 	{
-		auto payload_length = ov::HostToNetwork64(static_cast<uint64_t>(length));
+		auto extended_length = ov::HostToNetwork64(static_cast<uint64_t>(length));
 
-		_response->Send(&payload_length);
+		::memcpy(buffer + header_length, &extended_length, sizeof(extended_length));
+		header_length += sizeof(extended_length);
 	}
 
-	logtd("Trying to send data\n%s", data->Dump(32).CStr());
+	return header_length;
+}
+
+ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSocketFrameOpcode opcode)
+{
+	uint8_t header[WEB_SOCKET_MAX_FRAME_HEADER_SIZE];
+	size_t header_length = MakeFrameHeader(header, data->GetLength(), opcode);
+
+	logtd("Trying to send data: %zu bytes", data->GetLength());
+
+	// Sends the header and the payload together (without copying the payload)
+	struct iovec vectors[2] = {
+		{ .iov_base = header, .iov_len = header_length },
+		{ .iov_base = const_cast<void *>(data->GetData()), .iov_len = data->GetLength() }
+	};
 
-	return _response->Send(data) ? data->GetLength() : -1;
+	return _response->Send(vectors, 2) ? data->GetLength() : -1;
 }
 
 ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data)
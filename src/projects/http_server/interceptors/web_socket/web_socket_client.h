@@ -42,6 +42,9 @@ public:
 	void Close();
 
 protected:
+	// Writes the frame header (without masking key) to the buffer, and returns the length of the header
+	static size_t MakeFrameHeader(uint8_t *buffer, size_t payload_length, WebSocketFrameOpcode opcode);
+
 	std::shared_ptr<ov::ClientSocket> _remote;
 
 	std::shared_ptr<HttpRequest> _request;
@@ -11,6 +11,11 @@
 
 #include <algorithm>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define WEB_SOCKET_UNMASK_SIMD 1
+#endif
+
 WebSocketFrame::WebSocketFrame()
 	: _remained_length(0L),
 	  _total_length(0L),
@@ -74,28 +79,7 @@ ssize_t WebSocketFrame::Process(const std::shared_ptr<const ov::Data> &data)
 		// masking 처리
 		if(_header.mask)
 		{
-			size_t payload_length = _payload->GetLength();
-
-			// 빠른 처리를 위해 8의 배수로 처리함 (mask가 있을 경우, 데이터 할당 시 이미 8의 배수로 할당해놓음)
-
-			// masking은 반드시 4byte여야 함
-			OV_ASSERT2(sizeof(_frame_masking_key) == 4);
-
-			uint64_t mask = static_cast<uint64_t>(_frame_masking_key) << (sizeof(_frame_masking_key) * 8) | static_cast<uint64_t>(_frame_masking_key);
-
-			// 8의 배수로 만듦
-			size_t count = ((payload_length + 7L) / 8L);
-			_payload->SetLength(static_cast<size_t>(count * 8L));
-
-			auto current = _payload->GetWritableDataAs<uint64_t>();
-
-			for(int index = 0; index < count; index++)
-			{
-				*current ^= mask;
-				current++;
-			}
-
-			_payload->SetLength(payload_length);
+			Unmask(_payload->GetWritableDataAs<uint8_t>(), _payload->GetLength(), _frame_masking_key);
 		}
 
 		logtd("The frame is finished: %s", ToString().CStr());
@@ -217,9 +201,7 @@ ssize_t WebSocketFrame::ProcessHeader(ov::ByteStream &stream)
 			_remained_length = _total_length;
 	}
 
-	// masking을 해야한다면, 나중에 속도 최적화를 위해 8의 배수로 masking을 처리하는데, 이 때 버퍼 재할당이 일어나지 않도록 8의 배수로 미리 맞춰놓음
-	ssize_t total_length = _header.mask ? (_total_length / 8L) * 8L : _total_length;
-	_payload = std::make_shared<ov::Data>(total_length);
+	_payload = std::make_shared<ov::Data>(_total_length);
 
 	if(_header.mask)
 	{
@@ -235,6 +217,66 @@ ssize_t WebSocketFrame::ProcessHeader(ov::ByteStream &stream)
 	return stream.GetOffset() - before_offset;
 }
 
+#if WEB_SOCKET_UNMASK_SIMD
+__attribute__((target("avx2"))) static size_t UnmaskAvx2(uint8_t *payload, size_t length, uint32_t masking_key)
+{
+	__m256i mask = _mm256_set1_epi32(static_cast<int>(masking_key));
+	size_t offset = 0L;
+
+	for(; offset + 32L <= length; offset += 32L)
+	{
+		auto current = reinterpret_cast<__m256i *>(payload + offset);
+
+		_mm256_storeu_si256(current, _mm256_xor_si256(_mm256_loadu_si256(current), mask));
+	}
+
+	return offset;
+}
+#endif
+
+void WebSocketFrame::Unmask(uint8_t *payload, size_t length, uint32_t masking_key)
+{
+	// 4의 배수 단위로 처리하므로 masking key 의 위치가 유지됨
+	size_t offset = 0L;
+
+#if WEB_SOCKET_UNMASK_SIMD
+	static const bool is_avx2_supported = __builtin_cpu_supports("avx2");
+
+	if(is_avx2_supported)
+	{
+		offset = UnmaskAvx2(payload, length, masking_key);
+	}
+
+	__m128i mask = _mm_set1_epi32(static_cast<int>(masking_key));
+
+	for(; offset + 16L <= length; offset += 16L)
+	{
+		auto current = reinterpret_cast<__m128i *>(payload + offset);
+
+		_mm_storeu_si128(current, _mm_xor_si128(_mm_loadu_si128(current), mask));
+	}
+#else
+	uint64_t mask = static_cast<uint64_t>(masking_key) << 32 | static_cast<uint64_t>(masking_key);
+
+	for(; offset + 8L <= length; offset += 8L)
+	{
+		uint64_t value;
+
+		::memcpy(&value, payload + offset, sizeof(value));
+		value ^= mask;
+		::memcpy(payload + offset, &value, sizeof(value));
+	}
+#endif
+
+	// 나머지
+	auto mask_bytes = reinterpret_cast<const uint8_t *>(&masking_key);
+
+	for(; offset < length; offset++)
+	{
+		payload[offset] ^= mask_bytes[offset % 4];
+	}
+}
+
 ov::String WebSocketFrame::ToString() const
 {
 	return ov::String::FormatString(
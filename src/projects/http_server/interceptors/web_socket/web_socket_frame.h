@@ -46,6 +46,10 @@ public:
 
 	ov::String ToString() const;
 
+	// RFC6455 - 5.3. Client-to-Server Masking
+	// masking_key: 4 bytes in network order as read from the frame
+	static void Unmask(uint8_t *payload, size_t length, uint32_t masking_key);
+
 protected:
 	ssize_t ProcessHeader(ov::ByteStream &stream);
 
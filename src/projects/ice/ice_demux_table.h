@@ -0,0 +1,143 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovsocket/ovsocket.h>
+
+#include <memory>
+#include <vector>
+
+// Remote address of a datagram packed into a fixed-size key.
+// Local address, local port and protocol are the same for every packet of an IcePort,
+// so the remote address and port are enough to identify the 5-tuple.
+struct IceDemuxKey
+{
+	IceDemuxKey() = default;
+
+	explicit IceDemuxKey(const ov::SocketAddress &address)
+	{
+		switch(address.GetFamily())
+		{
+			case ov::SocketFamily::Inet:
+				// Stored as IPv4-mapped IPv6 address (::ffff:a.b.c.d)
+				words[1] = (0xFFFFULL << 32) | address.AddrInForIPv4()->s_addr;
+				break;
+
+			case ov::SocketFamily::Inet6:
+				::memcpy(&(words[0]), address.AddrInForIPv6(), sizeof(in6_addr));
+				break;
+
+			default:
+				break;
+		}
+
+		words[2] = (static_cast<uint64_t>(address.GetFamily()) << 16) | address.Port();
+	}
+
+	bool operator ==(const IceDemuxKey &key) const
+	{
+		return (words[0] == key.words[0]) && (words[1] == key.words[1]) && (words[2] == key.words[2]);
+	}
+
+	uint64_t Hash() const
+	{
+		// splitmix64 finalizer over the folded words
+		uint64_t hash = words[0] ^ (words[1] * 0x9E3779B97F4A7C15ULL) ^ (words[2] << 1);
+
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+
+		return hash ^ (hash >> 31);
+	}
+
+	// [0], [1]: IPv6 address (or IPv4-mapped IPv6 address)
+	// [2]: family << 16 | port
+	uint64_t words[3] = { 0, 0, 0 };
+};
+
+// Open addressing (linear probing) hash table to find the connection information of the remote address.
+//
+// The table is never modified after it is built. IcePort builds a new table whenever a session is
+// added/removed and publishes it with std::atomic_store(), so the receive path only needs
+// std::atomic_load() and never contends with the writers.
+template<typename Tvalue>
+class IceDemuxTable
+{
+public:
+	// Keep the load factor <= 0.5 so that probe sequences stay short
+	explicit IceDemuxTable(size_t count)
+	{
+		size_t capacity = 16;
+
+		while(capacity < (count * 2))
+		{
+			capacity <<= 1;
+		}
+
+		_entries.resize(capacity);
+		_mask = capacity - 1;
+	}
+
+	// Must be called only while building the table (before it is published)
+	void Insert(const IceDemuxKey &key, const std::shared_ptr<Tvalue> &value)
+	{
+		size_t index = key.Hash() & _mask;
+
+		while(_entries[index].value != nullptr)
+		{
+			if(_entries[index].key == key)
+			{
+				break;
+			}
+
+			index = (index + 1) & _mask;
+		}
+
+		if(_entries[index].value == nullptr)
+		{
+			_count++;
+		}
+
+		_entries[index].key = key;
+		_entries[index].value = value;
+	}
+
+	std::shared_ptr<Tvalue> Find(const IceDemuxKey &key) const
+	{
+		size_t index = key.Hash() & _mask;
+
+		while(_entries[index].value != nullptr)
+		{
+			if(_entries[index].key == key)
+			{
+				return _entries[index].value;
+			}
+
+			index = (index + 1) & _mask;
+		}
+
+		return nullptr;
+	}
+
+	size_t GetCount() const
+	{
+		return _count;
+	}
+
+protected:
+	struct Entry
+	{
+		IceDemuxKey key;
+		std::shared_ptr<Tvalue> value;
+	};
+
+	std::vector<Entry> _entries;
+	size_t _mask = 0;
+	size_t _count = 0;
+};
@@ -16,13 +16,20 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+// CheckTimedoutItem()이 호출되는 주기 (ms)
+#define ICE_PORT_CHECK_TIMEDOUT_INTERVAL        1000
+// Binding timeout(30초)보다 크게 잡아서, 갱신되지 않은 항목은 한 바퀴 안에 만료 처리되도록 함
+#define ICE_PORT_EXPIRE_WHEEL_SIZE              32
+
 IcePort::IcePort()
 {
+	_expire_wheel.resize(ICE_PORT_EXPIRE_WHEEL_SIZE);
+
 	_timer.Push([this](void *paramter) -> bool
 	            {
 		            CheckTimedoutItem();
 		            return true;
-	            }, nullptr, 1000, true);
+	            }, nullptr, ICE_PORT_CHECK_TIMEDOUT_INTERVAL, true);
 	_timer.Start();
 }
 
@@ -130,10 +137,11 @@ bool IcePort::RemoveObservers()
 	return true;
 }
 
-void IcePort::AddSession(const std::shared_ptr<SessionInfo> &session_info, std::shared_ptr<SessionDescription> offer_sdp, std::shared_ptr<SessionDescription> peer_sdp)
+void IcePort::AddSession(const std::shared_ptr<IcePortObserver> &observer, const std::shared_ptr<SessionInfo> &session_info, std::shared_ptr<SessionDescription> offer_sdp, std::shared_ptr<SessionDescription> peer_sdp)
 {
 	const ov::String &local_ufrag = offer_sdp->GetIceUfrag();
 	const ov::String &remote_ufrag = peer_sdp->GetIceUfrag();
+	std::shared_ptr<IcePortInfo> info;
 
 	{
 		std::lock_guard<std::mutex> lock_guard(_user_mapping_table_mutex);
@@ -149,9 +157,10 @@ void IcePort::AddSession(const std::shared_ptr<SessionInfo> &session_info, std::
 		logtd("Trying to add session: %d (ufrag: %s:%s)...", session_id, local_ufrag.CStr(), remote_ufrag.CStr());
 
 		// 나중에 STUN Binding request를 대비하여 관련 정보들을 넣어놓음
-		std::shared_ptr<IcePortInfo> info = std::make_shared<IcePortInfo>();
+		info = std::make_shared<IcePortInfo>();
 
 		info->session_info = session_info;
+		info->observer = observer;
 		info->offer_sdp = offer_sdp;
 		info->peer_sdp = peer_sdp;
 		info->remote = nullptr;
@@ -161,9 +170,11 @@ void IcePort::AddSession(const std::shared_ptr<SessionInfo> &session_info, std::
 		info->UpdateBindingTime();
 
 		_user_mapping_table[local_ufrag] = info;
+
+		ScheduleExpiration(info);
 	}
 
-	SetIceState(_user_mapping_table[local_ufrag], IcePortConnectionState::New);
+	SetIceState(info, IcePortConnectionState::New);
 }
 
 bool IcePort::RemoveSession(const session_id_t session_id)
@@ -186,6 +197,8 @@ bool IcePort::RemoveSession(const session_id_t session_id)
 
 		_session_table.erase(item);
 		_ice_port_info.erase(ice_port_info->address);
+
+		UpdateDemuxTable();
 	}
 
 	{
@@ -297,18 +310,9 @@ void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov
 	{
 		logtd("Not Stun packet. Passing data to observer...");
 
-		std::shared_ptr<IcePortInfo> ice_port_info;
-
-		{
-			std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
-
-			auto item = _ice_port_info.find(address);
-
-			if(item != _ice_port_info.end())
-			{
-				ice_port_info = item->second;
-			}
-		}
+		// lock 없이 snapshot에서 찾음
+		auto demux_table = std::atomic_load(&_demux_table);
+		std::shared_ptr<IcePortInfo> ice_port_info = (demux_table != nullptr) ? demux_table->Find(IceDemuxKey(address)) : nullptr;
 
 		if(ice_port_info == nullptr)
 		{
@@ -320,8 +324,10 @@ void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov
 
 		// TODO: 이걸 IcePort에서 할 것이 아니라 PhysicalPort에서 하는 것이 좋아보임
 
-		// observer들에게 알림
-		for(auto &observer : _observers)
+		// 세션을 등록한 observer에게만 알림
+		auto &observer = ice_port_info->observer;
+
+		if(observer != nullptr)
 		{
 			logtd("Trying to callback OnDataReceived() to %p...", observer.get());
 			observer->OnDataReceived(*this, ice_port_info->session_info, data);
@@ -337,24 +343,44 @@ void IcePort::CheckTimedoutItem()
 	{
 		std::lock_guard<std::mutex> lock_guard(_user_mapping_table_mutex);
 
-		for(auto item = _user_mapping_table.begin(); item != _user_mapping_table.end();)
+		// 이번 tick에 해당하는 slot만 검사함
+		_expire_wheel_index = (_expire_wheel_index + 1) % _expire_wheel.size();
+
+		auto slot = std::move(_expire_wheel[_expire_wheel_index]);
+		_expire_wheel[_expire_wheel_index].clear();
+
+		for(auto &info : slot)
 		{
-			if(item->second->IsExpired())
+			auto item = _user_mapping_table.find(info->offer_sdp->GetIceUfrag());
+
+			if((item == _user_mapping_table.end()) || (item->second != info))
 			{
-				logtd("Client %s(session id: %d) is expired", item->second->address.ToString().CStr(), item->second->session_info->GetId());
-				SetIceState(item->second, IcePortConnectionState::Disconnected);
+				// 이미 삭제된 세션
+				continue;
+			}
 
-				delete_list.push_back(item->second);
+			if(info->IsExpired())
+			{
+				logtd("Client %s(session id: %d) is expired", info->address.ToString().CStr(), info->session_info->GetId());
+				SetIceState(info, IcePortConnectionState::Disconnected);
+
+				delete_list.push_back(info);
 
-				item = _user_mapping_table.erase(item);
+				_user_mapping_table.erase(item);
 			}
 			else
 			{
-				++item;
+				// Binding 시간이 갱신되었으므로 다시 예약함
+				ScheduleExpiration(info);
 			}
 		}
 	}
 
+	if(delete_list.empty())
+	{
+		return;
+	}
+
 	{
 		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
 
@@ -363,9 +389,35 @@ void IcePort::CheckTimedoutItem()
 			_session_table.erase(deleted_ice_port->session_info->GetId());
 			_ice_port_info.erase(deleted_ice_port->address);
 		}
+
+		UpdateDemuxTable();
 	}
 }
 
+void IcePort::ScheduleExpiration(const std::shared_ptr<IcePortInfo> &info)
+{
+	auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(info->expire_time - std::chrono::system_clock::now()).count();
+
+	// 최소 다음 tick, 최대 한 바퀴 이내 (그 이상 남은 경우에는 해당 slot에서 다시 예약됨)
+	int64_t ticks = (remaining + ICE_PORT_CHECK_TIMEDOUT_INTERVAL - 1) / ICE_PORT_CHECK_TIMEDOUT_INTERVAL;
+	ticks = std::max<int64_t>(ticks, 1);
+	ticks = std::min<int64_t>(ticks, _expire_wheel.size() - 1);
+
+	_expire_wheel[(_expire_wheel_index + ticks) % _expire_wheel.size()].push_back(info);
+}
+
+void IcePort::UpdateDemuxTable()
+{
+	auto demux_table = std::make_shared<IceDemuxTable<IcePortInfo>>(_ice_port_info.size());
+
+	for(auto &item : _ice_port_info)
+	{
+		demux_table->Insert(IceDemuxKey(item.first), item.second);
+	}
+
+	std::atomic_store(&_demux_table, std::shared_ptr<const IceDemuxTable<IcePortInfo>>(demux_table));
+}
+
 bool IcePort::ProcessBindingRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const StunMessage &request_message)
 {
 	// Binding Request
@@ -424,6 +476,8 @@ bool IcePort::ProcessBindingRequest(const std::shared_ptr<ov::Socket> &remote, c
 
 			_ice_port_info.erase(ice_port_info->address);
 			_session_table.erase(ice_port_info->session_info->GetId());
+
+			UpdateDemuxTable();
 		}
 
 		return false;
@@ -479,6 +533,8 @@ bool IcePort::SendBindingResponse(const std::shared_ptr<ov::Socket> &remote, con
 		{
 			_ice_port_info[address] = info;
 			_session_table[info->session_info->GetId()] = info;
+
+			UpdateDemuxTable();
 		}
 		else
 		{
@@ -563,22 +619,15 @@ bool IcePort::ProcessBindingResponse(const std::shared_ptr<ov::Socket> &remote,
 {
 	// TODO: state가 checking 상태인지 확인
 
-	std::shared_ptr<IcePortInfo> ice_port_info;
+	auto demux_table = std::atomic_load(&_demux_table);
+	std::shared_ptr<IcePortInfo> ice_port_info = (demux_table != nullptr) ? demux_table->Find(IceDemuxKey(address)) : nullptr;
 
+	if(ice_port_info == nullptr)
 	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
-
-		auto item = _ice_port_info.find(address);
-
-		if(item == _ice_port_info.end())
-		{
-			// 포트 정보가 없음
-			// 이전 단계에서 관련 정보가 저장되어 있어야 함
-			logtw("Could not find client information");
-			return false;
-		}
-
-		ice_port_info = item->second;
+		// 포트 정보가 없음
+		// 이전 단계에서 관련 정보가 저장되어 있어야 함
+		logtw("Could not find client information");
+		return false;
 	}
 
 	// SDP의 password로 무결성 검사를 한 뒤
@@ -607,8 +656,10 @@ void IcePort::SetIceState(std::shared_ptr<IcePortInfo> &info, IcePortConnectionS
 {
 	info->state = state;
 
-	auto func = std::bind(&IcePortObserver::OnStateChanged, std::placeholders::_1, std::ref(*this), std::ref(info->session_info), state);
-	std::for_each(_observers.begin(), _observers.end(), func);
+	if(info->observer != nullptr)
+	{
+		info->observer->OnStateChanged(*this, info->session_info, state);
+	}
 }
 
 // STUN 오류를 반환함
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ice_port_observer.h"
+#include "ice_demux_table.h"
 #include "stun/stun_message.h"
 
 #include <vector>
@@ -26,6 +27,8 @@ protected:
 	{
 		// client에 연결되어 있는 세션 정보
 		std::shared_ptr<SessionInfo> session_info;
+		// 이 세션의 패킷/상태 변경을 전달받을 observer (모든 observer에게 broadcast 하지 않음)
+		std::shared_ptr<IcePortObserver> observer;
 
 		std::shared_ptr<SessionDescription> offer_sdp;
 		std::shared_ptr<SessionDescription> peer_sdp;
@@ -91,7 +94,7 @@ public:
 		return (_observers.size() > 0);
 	}
 
-	void AddSession(const std::shared_ptr<SessionInfo> &session_info, std::shared_ptr<SessionDescription> offer_sdp, std::shared_ptr<SessionDescription> peer_sdp);
+	void AddSession(const std::shared_ptr<IcePortObserver> &observer, const std::shared_ptr<SessionInfo> &session_info, std::shared_ptr<SessionDescription> offer_sdp, std::shared_ptr<SessionDescription> peer_sdp);
 	bool RemoveSession(const session_id_t session_id);
 	bool RemoveSession(const std::shared_ptr<SessionInfo> &session_info);
 
@@ -117,6 +120,10 @@ protected:
 
 private:
 	void CheckTimedoutItem();
+	// _user_mapping_table_mutex must be locked
+	void ScheduleExpiration(const std::shared_ptr<IcePortInfo> &info);
+	// _ice_port_info_mutex must be locked
+	void UpdateDemuxTable();
 
 	// STUN nego order:
 	// (State: New)
@@ -143,6 +150,12 @@ private:
 	std::map<const ov::String, std::shared_ptr<IcePortInfo>> _user_mapping_table;
 	std::mutex _user_mapping_table_mutex;
 
+	// _user_mapping_table의 만료 검사를 위한 timing wheel (slot 하나가 CheckTimedoutItem() 1회에 해당)
+	// 매 tick마다 현재 slot에 있는 항목만 검사하고, 아직 만료되지 않은 항목은 다시 scheduling 한다.
+	// _user_mapping_table_mutex로 보호됨
+	std::vector<std::vector<std::shared_ptr<IcePortInfo>>> _expire_wheel;
+	size_t _expire_wheel_index = 0;
+
 	// STUN nego가 완료되면 생성되는 mapping table
 
 	// 상대방의 ip:port로 IcePortInfo를 바로 찾을 수 있게 함
@@ -150,6 +163,9 @@ private:
 	// value: IcePortInfo
 	std::mutex _ice_port_info_mutex;
 	std::map<ov::SocketAddress, std::shared_ptr<IcePortInfo>> _ice_port_info;
+	// 수신 경로에서 사용하는 _ice_port_info의 snapshot
+	// _ice_port_info가 변경될 때마다 새로 만들어서 std::atomic_store()로 교체하므로, 읽을 때는 lock이 필요 없음
+	std::shared_ptr<const IceDemuxTable<IcePortInfo>> _demux_table;
 	// session_id로 IcePortInfo를 바로 찾을 수 있게 함
 	std::map<session_id_t, std::shared_ptr<IcePortInfo>> _session_table;
 
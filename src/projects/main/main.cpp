@@ -179,7 +179,7 @@ int main(int argc, char *argv[])
 
 		// Monitoring Server
 		monitoring_server = std::make_shared<MonitoringServer>();
-		monitoring_server->Start(ov::SocketAddress(host.GetMonitoringPort()), providers, publishers);
+		monitoring_server->Start(ov::SocketAddress(host.GetMonitoringPort()), providers, publishers, router);
 
 	}
 
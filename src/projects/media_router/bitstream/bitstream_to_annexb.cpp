@@ -15,6 +15,11 @@
 
 #define OV_LOG_TAG "BitstreamToAnnexB"
 
+// FLV VideoTagHeader: frame_type/codec_id(1) + AVCPacketType(1) + CompositionTime(3)
+#define FLV_VIDEO_HEADER_SIZE       5
+// AVCC NALU length (lengthSizeMinusOne = 3) == AnnexB start code 크기
+#define AVC_NAL_LENGTH_SIZE         4
+
 BitstreamToAnnexB::BitstreamToAnnexB()
 {
 }
@@ -55,7 +60,6 @@ void BitstreamToAnnexB::convert_to(MediaPacket *packet)
 	}
 
 	uint8_t start_code[4] = { 0x00, 0x00, 0x00, 0x01 };
-	auto pbuf_length = static_cast<uint32_t>(data->GetLength());
 
 	// Convert [FLV] to [Video data]
 	// Refrence: Video File Format Specification, Version 10 (https://wwwimages2.adobe.com/content/dam/acom/en/devnet/flv/video_file_format_spec_v10.pdf)
@@ -149,12 +153,17 @@ void BitstreamToAnnexB::convert_to(MediaPacket *packet)
 			p += pictureParameterSetLength;
 		}
 
+		// 이후 key frame 앞에 그대로 붙일 수 있도록 start code + SPS + start code + PPS 를 한번만 만들어 둠
+		_sps_pps_annexb.clear();
+		_sps_pps_annexb.insert(_sps_pps_annexb.end(), start_code, start_code + 4);
+		_sps_pps_annexb.insert(_sps_pps_annexb.end(), _sps.begin(), _sps.end());
+		_sps_pps_annexb.insert(_sps_pps_annexb.end(), start_code, start_code + 4);
+		_sps_pps_annexb.insert(_sps_pps_annexb.end(), _pps.begin(), _pps.end());
+
 		data->Clear();
-		data->Append(start_code, 4);
-		data->Append(_sps.data(), _sps.size());
+		data->Append(_sps_pps_annexb.data(), _sps_pps_annexb.size());
 
-		data->Append(start_code, 4);
-		data->Append(_pps.data(), _pps.size());
+		SetSpsPpsFragmentation(packet->_frag_hdr.get());
 
 		logtd("sps/pps packet size : %d", data->GetLength());
 	}
@@ -202,77 +211,147 @@ void BitstreamToAnnexB::convert_to(MediaPacket *packet)
 		22 – 23	Reserved		non-VCL	non-VCL	VCL
 		24 – 31	Unspecified		non-VCL	non-VCL	non-VCL
 		*/
-	else if(frame_type == 1 && avc_packet_type == 1)
+	else if(frame_type == 1 && avc_packet_type == 2)
 	{
-		const uint8_t *p = pbuf + 5;
+		// logtd("frame_type(%d), avc_packet_type(%d)", frame_type, avc_packet_type);
+		data->Clear();
+		data->Append(start_code, 4);
+	}
+	else
+	{
+		ConvertNalUnits(packet);
+	}
+}
+
+//====================================================================================================
+// ConvertNalUnits
+// - [FLV header(5)] ([length(4)] NALU) ([length(4)] NALU) ... 를 복사 없이 AnnexB 로 변환
+//   length(4) 와 start code(00 00 00 01) 의 크기가 같으므로 그 자리에서 덮어쓰고, FLV header 는 Subdata() 로 제외
+// - 같은 loop 에서 FragmentationHeader (start code 이후 NALU 의 offset/length) 를 채움
+// - SPS 없이 IDR 만 있는 key frame 은 sequence header 에서 만들어 둔 SPS/PPS 를 앞에 붙임
+//   (transcoder 의 출력과 같이 key frame 이 SPS + PPS + IDR 구성이 되도록 하여 packetyzer/decoder 가 바로 사용 가능)
+//====================================================================================================
+void BitstreamToAnnexB::ConvertNalUnits(MediaPacket *packet)
+{
+	auto &data = packet->GetData();
+	auto fragmentation = packet->_frag_hdr.get();
 
-		auto tmp_buf = std::make_shared<MediaFrame>();
+	size_t length = data->GetLength();
 
-		while(1)
+	// Packet 을 만들 때 복사된 데이터이므로 다른 곳에서 참조하지 않는 한 GetWritableData() 에서 복사가 일어나지 않음
+	auto buffer = data->GetWritableDataAs<uint8_t>();
+
+	if((buffer == nullptr) || (length < FLV_VIDEO_HEADER_SIZE))
+	{
+		logtw("Invalid video data length: %zu", length);
+		return;
+	}
+
+	size_t offset = FLV_VIDEO_HEADER_SIZE;
+	size_t fragment_count = 0;
+	bool has_sps = false;
+	bool has_idr = false;
+
+	while((length - offset) >= AVC_NAL_LENGTH_SIZE)
+	{
+		uint32_t nal_length = static_cast<uint32_t>(buffer[offset] << 24 |
+		                                            buffer[offset + 1] << 16 |
+		                                            buffer[offset + 2] << 8 |
+		                                            buffer[offset + 3]);
+
+		if(nal_length > (length - offset - AVC_NAL_LENGTH_SIZE))
 		{
-			int32_t nal_length = static_cast<int32_t>(static_cast<uint8_t>(*(p)) << 24 |
-			                                          static_cast<uint8_t>(*(p + 1)) << 16 |
-			                                          static_cast<uint8_t>(*(p + 2)) << 8 |
-			                                          static_cast<uint8_t>(*(p + 3)));
+			// 남은 데이터보다 큰 NALU 는 버리고, 앞에서 변환한 NALU 까지만 전달
+			logtw("Invalid NAL unit length: %u (remained: %zu)", nal_length, length - offset - AVC_NAL_LENGTH_SIZE);
+			break;
+		}
+
+		// length 32bit -> start code
+		buffer[offset] = 0x00;
+		buffer[offset + 1] = 0x00;
+		buffer[offset + 2] = 0x00;
+		buffer[offset + 3] = 0x01;
 
-			// skip length 32bit
-			p += 4;
+		offset += AVC_NAL_LENGTH_SIZE;
 
-			// logtd("nal_unit_type : %s", Nalu2Str( (AvcNaluType)((*p) & 0x1F) ).c_str());
+		if(nal_length > 0)
+		{
+			auto nal_type = static_cast<AvcNaluType>(buffer[offset] & 0x1F);
 
-			tmp_buf->AppendBuffer(start_code, 4);
-			tmp_buf->AppendBuffer(p, nal_length);
+			// logtd("nal_unit_type : %s", Nalu2Str(nal_type).c_str());
 
-			p += nal_length;
-			if((p - pbuf) >= pbuf_length)
-			{
-				break;
-			}
+			has_sps = has_sps || (nal_type == AvcNaluTypeSPS);
+			has_idr = has_idr || (nal_type == AvcNaluTypeIDR);
 		}
 
-		data->Clear();
-		data->Append(tmp_buf->GetBuffer(), tmp_buf->GetBufferSize());
+		if(fragment_count < MAX_FRAG_COUNT)
+		{
+			// FLV header 를 제외한 위치 기준
+			fragmentation->fragmentation_offset[fragment_count] = offset - FLV_VIDEO_HEADER_SIZE;
+			fragmentation->fragmentation_length[fragment_count] = nal_length;
+		}
+		fragment_count++;
+
+		offset += nal_length;
 	}
-	else if(frame_type == 1 && avc_packet_type == 2)
+
+	size_t frame_length = offset - FLV_VIDEO_HEADER_SIZE;
+	bool insert_sps_pps = has_idr && (has_sps == false) && (_sps_pps_annexb.empty() == false);
+
+	if(insert_sps_pps)
 	{
-		// logtd("frame_type(%d), avc_packet_type(%d)", frame_type, avc_packet_type);
-		data->Clear();
-		data->Append(start_code, 4);
+		// key frame 에서만 1회 복사 (SPS/PPS + frame)
+		auto frame = std::make_shared<ov::Data>(_sps_pps_annexb.size() + frame_length);
+
+		frame->Append(_sps_pps_annexb.data(), _sps_pps_annexb.size());
+		frame->Append(buffer + FLV_VIDEO_HEADER_SIZE, frame_length);
+
+		data = frame;
 	}
-		// intra-frame
 	else
 	{
-		const uint8_t *p = pbuf + 5;
+		data = data->Subdata(FLV_VIDEO_HEADER_SIZE, frame_length);
+	}
 
-		auto tmp_buf = std::make_shared<MediaFrame>();
+	fragmentation->fragmentation_vector_size = 0;
 
-		while(1)
+	if(insert_sps_pps)
+	{
+		if((fragment_count + 2) > MAX_FRAG_COUNT)
 		{
-			int32_t nal_length = static_cast<int32_t>(static_cast<uint8_t>(*(p)) << 24 |
-			                                          static_cast<uint8_t>(*(p + 1)) << 16 |
-			                                          static_cast<uint8_t>(*(p + 2)) << 8 |
-			                                          static_cast<uint8_t>(*(p + 3)));
-
-			// logte("nal_lengh = %d, pbuf_length = %d", nal_length, pbuf_length);
+			return;
+		}
 
-			// skip length 32bit
-			p += 4;
+		// SPS/PPS 만큼 뒤로 이동
+		for(size_t index = fragment_count; index > 0; index--)
+		{
+			fragmentation->fragmentation_offset[index + 1] = fragmentation->fragmentation_offset[index - 1] + _sps_pps_annexb.size();
+			fragmentation->fragmentation_length[index + 1] = fragmentation->fragmentation_length[index - 1];
+		}
 
-			// logtd("nal_unit_type : %s", Nalu2Str( (AvcNaluType)((*p) & 0x1F) ).c_str());
+		SetSpsPpsFragmentation(fragmentation);
+		fragmentation->fragmentation_vector_size = static_cast<uint16_t>(fragment_count + 2);
+	}
+	else if(fragment_count <= MAX_FRAG_COUNT)
+	{
+		fragmentation->fragmentation_vector_size = static_cast<uint16_t>(fragment_count);
+	}
 
-			tmp_buf->AppendBuffer(start_code, 4);
-			tmp_buf->AppendBuffer(p, nal_length);
+	// MAX_FRAG_COUNT 를 넘는 경우 FragmentationHeader 는 비워둠 (RTP packetizer 에서는 AnnexB 를 직접 나누어야 함)
+}
 
-			p += nal_length;
-			if((p - pbuf) >= pbuf_length)
-			{
-				break;
-			}
-		}
+//====================================================================================================
+// SetSpsPpsFragmentation
+// - _sps_pps_annexb 의 SPS/PPS 위치를 첫 2개 fragment 로 설정
+//====================================================================================================
+void BitstreamToAnnexB::SetSpsPpsFragmentation(FragmentationHeader *fragmentation)
+{
+	fragmentation->fragmentation_offset[0] = AVC_NAL_LENGTH_SIZE;
+	fragmentation->fragmentation_length[0] = _sps.size();
+	fragmentation->fragmentation_offset[1] = AVC_NAL_LENGTH_SIZE + _sps.size() + AVC_NAL_LENGTH_SIZE;
+	fragmentation->fragmentation_length[1] = _pps.size();
 
-		data->Clear();
-		data->Append(tmp_buf->GetBuffer(), tmp_buf->GetBufferSize());
-	}
+	fragmentation->fragmentation_vector_size = 2;
 }
 
 std::string BitstreamToAnnexB::Nalu2Str(AvcNaluType nalu_type)
@@ -72,9 +72,13 @@ public:
                                         uint8_t &avc_level);
 
 private:
+	void ConvertNalUnits(MediaPacket *packet);
+	void SetSpsPpsFragmentation(FragmentationHeader *fragmentation);
 
 	std::vector<uint8_t> 	_sps;
 	std::vector<uint8_t> 	_pps;
+	// start code + SPS + start code + PPS
+	std::vector<uint8_t> 	_sps_pps_annexb;
 };
 
 
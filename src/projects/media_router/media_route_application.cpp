@@ -337,15 +337,20 @@ bool MediaRouteApplication::OnReceiveBuffer(
 	}
 
 	// 스트림 ID에 해당하는 스트림을 탐색
+	// (여러 Provider thread에서 동시에 호출되고, 스트림 생성/삭제와도 겹칠 수 있음)
+	std::unique_lock<std::mutex> lock(_mutex);
 	auto stream_bucket = _streams.find(stream_info->GetId());
 	if(stream_bucket == _streams.end())
 	{
+		lock.unlock();
 		logte("cannot find stream from router. appication(%s), stream(%s)", _application_info.GetName().CStr(), stream_info->GetName().CStr());
 
 		return false;
 	}
 
 	auto stream = stream_bucket->second;
+	lock.unlock();
+
 	if(stream == nullptr)
 	{
 		logte("invalid stream bucket");
@@ -120,6 +120,17 @@ public:
 		return _relay_client;
 	}
 
+	// Live/LiveEdge application이 아니면 nullptr
+	std::shared_ptr<RelayServer> GetRelayServer()
+	{
+		return _relay_server;
+	}
+
+	const info::Application &GetApplicationInfo() const
+	{
+		return _application_info;
+	}
+
 	enum
 	{
 		BUFFFER_INDICATOR_UNIQUEID_GC = 0
@@ -129,6 +129,18 @@ std::shared_ptr<MediaRouteApplication> MediaRouter::GetRouteApplicationById(info
 	return obj->second;
 }
 
+std::vector<std::shared_ptr<MediaRouteApplication>> MediaRouter::GetRouteApplications()
+{
+	std::vector<std::shared_ptr<MediaRouteApplication>> route_apps;
+
+	for(const auto &route_app : _route_apps)
+	{
+		route_apps.push_back(route_app.second);
+	}
+
+	return route_apps;
+}
+
 // Connector의 Application이 생성되면 라우터에 등록함
 bool MediaRouter::RegisterConnectorApp(
 	const info::Application *application_info,
@@ -51,6 +51,7 @@ public:
 
 	//  Application Name으로 RouteApplication을 찾음
 	std::shared_ptr<MediaRouteApplication> GetRouteApplicationById(info::application_id_t application_id);
+	std::vector<std::shared_ptr<MediaRouteApplication>> GetRouteApplications();
 
 private:
 	std::map<info::application_id_t, std::shared_ptr<MediaRouteApplication>> _route_apps;
@@ -9,6 +9,7 @@
 
 #include "monitoring_server.h"
 #include "monitoring_interceptor.h"
+#include "../relay/relay_server.h"
 #include <sstream>
 #include <iomanip>
 
@@ -39,6 +40,7 @@ ov::String GetCurrentIso8601Time()
 bool MonitoringServer::Start(const ov::SocketAddress &address,
                              const std::vector<std::shared_ptr<pvd::Provider>> &providers,
                              const std::vector<std::shared_ptr<Publisher>> &publishers,
+                             const std::shared_ptr<MediaRouter> &router,
                              const std::shared_ptr<Certificate> &certificate)
 {
     if (_http_server != nullptr) {
@@ -61,8 +63,8 @@ bool MonitoringServer::Start(const ov::SocketAddress &address,
 
     auto monitoring_interceptor = std::make_shared<MonitoringInterceptor>();
 
-    // app_name/stream_name/file_name.ext?param=value
-    ov::String regular_expression = "(([^ #?]*)/([^ #?]*)/)?(stat)[?]?([^ #]*)#?([^ ]*)?";
+    // ..../stat?param=value
+    ov::String route_pattern = "*/stat";
 
     auto process_func = std::bind(&MonitoringServer::ProcessRequest,
                                     this,
@@ -70,13 +72,14 @@ bool MonitoringServer::Start(const ov::SocketAddress &address,
                                     std::placeholders::_2);
 
     std::static_pointer_cast<HttpDefaultInterceptor>(monitoring_interceptor)->Register(HttpMethod::Get,
-                                                                                    regular_expression,
+                                                                                    route_pattern,
                                                                                     process_func);
 
     _http_server->AddInterceptor(std::static_pointer_cast<HttpRequestInterceptor>(monitoring_interceptor));
 
     _providers.assign(providers.begin(), providers.end());
     _publishers.assign(publishers.begin(), publishers.end());
+    _router = router;
 
     logtd("Monitoring Server Start - provider(%u) publisher(%u)", _providers.size(), _publishers.size());
 
@@ -195,6 +198,16 @@ void MonitoringServer::ProcessRequest(const std::shared_ptr<HttpRequest> &reques
 // ex)
 //      211.222.238.223,live,stream2,100,80,20,1000000,80000000,20000000,100000000,2019-03-25T09:58:58+00:00
 //      211.222.238.223,live,stream3,120,100,20,1000000,100000000,20000000,120000000,2019-03-25T09:58:58+00:00
+//
+// - segment memory(HLS/DASH publisher)
+// seg,{org},{app},{publisher},{budget},{reserved},{used},{segment_count},{eviction_count},{drop_count},{datetime}
+// ex)
+//      seg,211.222.238.223,live,HLS,536870912,412090368,371458203,180,12,0,2019-03-25T09:58:58+00:00
+//
+// - relay(origin -> edge client)
+// relay,{org},{app},{client},{sent_frames},{sent_bytes},{dropped_frames},{dropped_bytes},{queued_bytes},{max_queued_bytes},{rtt_ms},{datetime}
+// ex)
+//      relay,211.222.238.223,live,10.0.0.5:45012,183025,912304512,0,0,4096,2097152,1.52,2019-03-25T09:58:58+00:00
 //====================================================================================================
 #define COLLECTION_DATA_SEPARATOR (',')
 #define COLLECTION_DATA_LINE_END ("\n")
@@ -210,6 +223,8 @@ void MonitoringServer::StateRequest(const std::shared_ptr<HttpResponse> &respons
             std::make_shared<MonitoringCollectionData>(MonitroingCollectionType::Host);// host(total)
 
     std::vector<std::shared_ptr<MonitoringCollectionData>> collections;
+    std::vector<std::shared_ptr<MonitoringCollectionData>> segment_collections;
+    std::vector<std::shared_ptr<MonitoringCollectionData>> relay_collections;
 
     // stream sum
     for (const auto &publisher : _publishers)
@@ -217,9 +232,19 @@ void MonitoringServer::StateRequest(const std::shared_ptr<HttpResponse> &respons
         publisher->GetMonitoringCollectionData(collections);
     }
 
+    // relay(합산 하지 않음)
+    GetRelayCollectionData(relay_collections);
+
     // stream/app/origin/host sum
     for (const auto &collection : collections)
     {
+        // segment memory(합산 하지 않음)
+        if(collection->type == MonitroingCollectionType::Segment)
+        {
+            segment_collections.push_back(collection);
+            continue;
+        }
+
         // stream collection sum
         // app collection sum
         auto stream_item = stream_sum.find(std::pair<ov::String, ov::String>(collection->app_name, collection->stream_name));
@@ -324,6 +349,39 @@ void MonitoringServer::StateRequest(const std::shared_ptr<HttpResponse> &respons
         << GetCurrentIso8601Time().CStr()    << COLLECTION_DATA_LINE_END;
     }
 
+    for(const auto &collection : segment_collections)
+    {
+        string_stream
+        << collection->type_string.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->origin_name.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->app_name.CStr()              << COLLECTION_DATA_SEPARATOR
+        << collection->stream_name.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->segment_memory_budget        << COLLECTION_DATA_SEPARATOR
+        << collection->segment_memory_reserved      << COLLECTION_DATA_SEPARATOR
+        << collection->segment_memory_used          << COLLECTION_DATA_SEPARATOR
+        << collection->segment_count                << COLLECTION_DATA_SEPARATOR
+        << collection->segment_eviction_count       << COLLECTION_DATA_SEPARATOR
+        << collection->segment_drop_count           << COLLECTION_DATA_SEPARATOR
+        << GetCurrentIso8601Time().CStr()           << COLLECTION_DATA_LINE_END;
+    }
+
+    for(const auto &collection : relay_collections)
+    {
+        string_stream
+        << collection->type_string.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->origin_name.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->app_name.CStr()              << COLLECTION_DATA_SEPARATOR
+        << collection->stream_name.CStr()           << COLLECTION_DATA_SEPARATOR
+        << collection->relay_sent_frames            << COLLECTION_DATA_SEPARATOR
+        << collection->relay_sent_bytes             << COLLECTION_DATA_SEPARATOR
+        << collection->relay_dropped_frames         << COLLECTION_DATA_SEPARATOR
+        << collection->relay_dropped_bytes          << COLLECTION_DATA_SEPARATOR
+        << collection->relay_queued_bytes           << COLLECTION_DATA_SEPARATOR
+        << collection->relay_max_queued_bytes       << COLLECTION_DATA_SEPARATOR
+        << collection->relay_rtt                    << COLLECTION_DATA_SEPARATOR
+        << GetCurrentIso8601Time().CStr()           << COLLECTION_DATA_LINE_END;
+    }
+
     ov::String data = string_stream.str().c_str();
 
     response->AppendString(data);
@@ -332,4 +390,44 @@ void MonitoringServer::StateRequest(const std::shared_ptr<HttpResponse> &respons
     {
         logte("State Response Fail");
     }
+}
+
+//====================================================================================================
+// GetRelayCollectionData
+// - relay server(origin)에 등록된 client 별 송신 통계
+//====================================================================================================
+void MonitoringServer::GetRelayCollectionData(std::vector<std::shared_ptr<MonitoringCollectionData>> &collections)
+{
+    if(_router == nullptr)
+        return;
+
+    for(const auto &route_app : _router->GetRouteApplications())
+    {
+        auto relay_server = route_app->GetRelayServer();
+
+        if(relay_server == nullptr)
+            continue;
+
+        const auto &application_info = route_app->GetApplicationInfo();
+
+        for(const auto &client_stats : relay_server->GetClientStats())
+        {
+            const auto &send_queue = client_stats.second.send_queue;
+            auto collection = std::make_shared<MonitoringCollectionData>(MonitroingCollectionType::Relay,
+                                                                         application_info.GetOrigin().GetAlias(),
+                                                                         application_info.GetName(),
+                                                                         client_stats.first);
+
+            collection->relay_sent_frames = send_queue.sent_frames;
+            collection->relay_sent_bytes = send_queue.sent_bytes;
+            collection->relay_dropped_frames = send_queue.dropped_frames;
+            collection->relay_dropped_bytes = send_queue.dropped_bytes;
+            collection->relay_queued_bytes = send_queue.queued_bytes;
+            collection->relay_max_queued_bytes = send_queue.max_queued_bytes;
+            collection->relay_rtt = client_stats.second.transport.rtt_ms;
+            collection->check_time = std::chrono::system_clock::now();
+
+            collections.push_back(collection);
+        }
+    }
 }
\ No newline at end of file
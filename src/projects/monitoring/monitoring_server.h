@@ -19,6 +19,7 @@
 #include "../base/provider/provider.h"
 #include "../base/publisher/publisher.h"
 #include "../base/ovlibrary/string.h"
+#include "../media_router/media_router.h"
 
 //====================================================================================================
 // MonitoringServer
@@ -34,6 +35,7 @@ public :
     bool Start(const ov::SocketAddress &address,
                const std::vector<std::shared_ptr<pvd::Provider>> &providers,
                 const std::vector<std::shared_ptr<Publisher>> &publishers,
+                const std::shared_ptr<MediaRouter> &router,
                 const std::shared_ptr<Certificate> &certificate = nullptr);
 
     bool Stop();
@@ -47,10 +49,12 @@ protected:
 
     void ProcessRequest(const std::shared_ptr<HttpRequest> &request, const std::shared_ptr<HttpResponse> &response);
     void StateRequest(const std::shared_ptr<HttpResponse> &response);
+    void GetRelayCollectionData(std::vector<std::shared_ptr<MonitoringCollectionData>> &collections);
 
 protected :
     std::shared_ptr<HttpServer> _http_server;
     std::vector<std::shared_ptr<pvd::Provider>> _providers;
     std::vector<std::shared_ptr<Publisher>> _publishers;
+    std::shared_ptr<MediaRouter> _router;
 
 };
@@ -50,9 +50,15 @@ void RelayClient::Start(const ov::String &application)
 
 			while(_stop == false)
 			{
-				if((_client_socket.GetState() == ov::SocketState::Closed) && (_client_socket.Create(ov::SocketType::Srt) == false))
+				if(_client_socket.GetState() == ov::SocketState::Closed)
 				{
-					return;
+					if(_client_socket.Create(ov::SocketType::Srt) == false)
+					{
+						return;
+					}
+
+					// Must be set before connecting
+					SetSrtOptions();
 				}
 
 				// Switch between primary and secondary server
@@ -100,8 +106,15 @@ void RelayClient::Start(const ov::String &application)
 
 				logti("Trying to request register for application [%s]...", application.CStr());
 
+				// Discard the incomplete frame of the previous connection
+				_parser.Reset();
+				_message_writer.Reset();
+
 				Register(application);
 
+				ov::StopWatch stats_timer;
+				stats_timer.Start();
+
 				while(true)
 				{
 					// read from server
@@ -111,46 +124,94 @@ void RelayClient::Start(const ov::String &application)
 					{
 						logte("An error occurred while receive data: %s", error->ToString().CStr());
 
+						PrintStats(address);
+
 						// reconnect
 						_client_socket.Close();
 						break;
 					}
 
-					RelayPacket packet(data.get());
+					if(stats_timer.Elapsed() >= RELAY_CLIENT_STATS_INTERVAL)
+					{
+						PrintStats(address);
+						stats_timer.Start();
+					}
 
-					switch(packet.GetType())
+					if(_parser.Parse(data.get(), std::bind(&RelayClient::HandleFrame, this, std::placeholders::_1)) == false)
 					{
-						case RelayPacketType::Register:
-							OV_ASSERT2("RelayClient cannot handle Register packet");
-							break;
+						logtw("Invalid data received from origin server");
+					}
+				}
+			}
+		});
+}
+
+void RelayClient::SetSrtOptions()
+{
+	int latency = _origin_info.GetLatency();
+	int receive_buffer_size = _origin_info.GetReceiveBufferSize() * 1024;
+
+	if(latency > 0)
+	{
+		// The origin uses this latency too (the larger of the latencies of both sides is used)
+		_client_socket.SetSockOpt(SRTO_LATENCY, latency);
+	}
 
-						case RelayPacketType::CreateStream:
-							HandleCreateStream(packet);
-							break;
+	if(receive_buffer_size > 0)
+	{
+		// The flight flag size limits the receive buffer (in packets)
+		int flight_flag_size = std::max(receive_buffer_size / ov::MaxSrtPacketSize, RELAY_SRT_DEFAULT_FLIGHT_FLAG_SIZE);
 
-						case RelayPacketType::DeleteStream:
-							HandleDeleteStream(packet);
-							break;
+		_client_socket.SetSockOpt(SRTO_FC, flight_flag_size);
+		_client_socket.SetSockOpt(SRTO_RCVBUF, receive_buffer_size);
+	}
 
-						case RelayPacketType::Packet:
-							// 데이터 처리
-							HandleData(packet);
-							break;
+	logtd("SRT options - latency: %d ms, receive buffer: %d bytes (0: default)", latency, receive_buffer_size);
+}
 
-						case RelayPacketType::Error:
-							// There was a problem
+void RelayClient::PrintStats(const ov::SocketAddress &address)
+{
+	RelayTransportStats stats;
 
-							// reconnect
-							_client_socket.Close();
-							break;
+	if(stats.Update(_client_socket))
+	{
+		logti("Relay stats of %s - %s, discarded: %" PRIu64 " frames, lost: %" PRIu64 " messages",
+		      address.ToString().CStr(), stats.ToString().CStr(), _parser.GetDiscardedFrameCount(), _parser.GetLostMessageCount());
+	}
+}
 
-						default:
-							logtw("Unknown packet type: %d", packet.GetType());
-							break;
-					}
-				}
-			}
-		});
+void RelayClient::HandleFrame(const RelayFrame &frame)
+{
+	switch(frame.type)
+	{
+		case RelayPacketType::Register:
+			OV_ASSERT2("RelayClient cannot handle Register packet");
+			break;
+
+		case RelayPacketType::CreateStream:
+			HandleCreateStream(frame);
+			break;
+
+		case RelayPacketType::DeleteStream:
+			HandleDeleteStream(frame);
+			break;
+
+		case RelayPacketType::Packet:
+			// 데이터 처리
+			HandleData(frame);
+			break;
+
+		case RelayPacketType::Error:
+			// There was a problem
+
+			// reconnect (next Recv() will fail)
+			_client_socket.Close();
+			break;
+
+		default:
+			logtw("Unknown packet type: %d", frame.type);
+			break;
+	}
 }
 
 std::shared_ptr<RelayClient::RelayStreamInfo> RelayClient::GetStreamInfo(info::stream_id_t stream_id, bool create_info, bool *created, bool delete_info)
@@ -193,9 +254,9 @@ std::shared_ptr<RelayClient::RelayStreamInfo> RelayClient::GetStreamInfo(info::s
 	return relay_info;
 }
 
-void RelayClient::HandleCreateStream(const RelayPacket &packet)
+void RelayClient::HandleCreateStream(const RelayFrame &frame)
 {
-	ov::String deserialize = ov::String(static_cast<const char *>(packet.GetData()), packet.GetDataSize());
+	ov::String deserialize = ov::String(frame.data->GetDataAs<char>(), frame.data->GetLength());
 
 	if(deserialize.IsEmpty())
 	{
@@ -228,7 +289,7 @@ void RelayClient::HandleCreateStream(const RelayPacket &packet)
 			// stream name
 			first = false;
 
-			info::stream_id_t stream_id = packet.GetStreamId();
+			info::stream_id_t stream_id = frame.stream_id;
 
 			bool is_created;
 
@@ -294,10 +355,6 @@ void RelayClient::HandleCreateStream(const RelayPacket &packet)
 			track->SetLastFrameTime(ov::Converter::ToInt64(info[index++]));
 
 			stream_info->AddTrack(track);
-
-			auto transaction = std::make_shared<Transaction>();
-
-			relay_info->transactions[track->GetId()] = transaction;
 		}
 	}
 
@@ -307,14 +364,14 @@ void RelayClient::HandleCreateStream(const RelayPacket &packet)
 
 		logtd("A stream is created: %s/%s (%u/%u)",
 		      _application_info.GetName().CStr(), stream_info->GetName().CStr(),
-		      packet.GetApplicationId(), stream_info->GetId()
+		      frame.application_id, stream_info->GetId()
 		);
 	}
 }
 
-void RelayClient::HandleDeleteStream(const RelayPacket &packet)
+void RelayClient::HandleDeleteStream(const RelayFrame &frame)
 {
-	info::stream_id_t stream_id = packet.GetStreamId();
+	info::stream_id_t stream_id = frame.stream_id;
 
 	auto relay_info = GetStreamInfo(stream_id, false, nullptr, true);
 
@@ -328,15 +385,15 @@ void RelayClient::HandleDeleteStream(const RelayPacket &packet)
 
 	logtd("A stream is deleted: %s/%s (%u/%u)",
 	      _application_info.GetName().CStr(), stream->GetName().CStr(),
-	      packet.GetApplicationId(), stream->GetId()
+	      frame.application_id, stream->GetId()
 	);
 
 	MediaRouteApplicationConnector::DeleteStream(stream);
 }
 
-void RelayClient::HandleData(const RelayPacket &packet)
+void RelayClient::HandleData(const RelayFrame &frame)
 {
-	auto relay_info = GetStreamInfo(packet.GetStreamId());
+	auto relay_info = GetStreamInfo(frame.stream_id);
 
 	if(relay_info == nullptr)
 	{
@@ -345,113 +402,67 @@ void RelayClient::HandleData(const RelayPacket &packet)
 		return;
 	}
 
-	uint32_t track_id = packet.GetTrackId();
-	auto transaction_info = relay_info->transactions.find(track_id);
-
-	if(transaction_info == relay_info->transactions.end())
+	if(relay_info->stream_info->GetTrack(frame.track_id) == nullptr)
 	{
 		// The stream is parsing in HandleCreateStream()
 		return;
 	}
 
-	std::shared_ptr<Transaction> transaction = transaction_info->second;
-
-	auto &data = transaction->data;
-	bool is_different_packet = false;
-
-	if(packet.GetTransactionId() != transaction->transaction_id)
-	{
-		// another packet is arrived
-		is_different_packet = true;
-	}
-	else
+	if((frame.data == nullptr) || (frame.data->GetLength() == 0))
 	{
-		data.Append(packet.GetData(), packet.GetDataSize());
+		return;
 	}
 
-	if(packet.IsEnd() || is_different_packet)
+	// send to media router
+	auto stream_list = _media_route_application->GetStreams();
+	auto stream = stream_list[frame.stream_id];
+
+	if(stream == nullptr)
 	{
-		// send to media router
-		auto stream_list = _media_route_application->GetStreams();
-		auto stream = stream_list[packet.GetStreamId()];
+		OV_ASSERT2(stream != nullptr);
+		return;
+	}
 
-		if(stream != nullptr)
-		{
-			if(data.GetLength() > 0)
-			{
-				auto media_packet = std::make_unique<MediaPacket>(
-					static_cast<common::MediaType>(transaction->media_type),
-					transaction->track_id,
-					data.GetData(),
-					data.GetLength(),
-					transaction->last_pts,
-					static_cast<MediaPacketFlag>(transaction->flags)
-				);
-
-				::memcpy(media_packet->_frag_hdr.get(), packet.GetFragmentHeader(), sizeof(FragmentationHeader));
-
-				_media_route_application->OnReceiveBuffer(this->GetSharedPtr(), stream->GetStreamInfo(), std::move(media_packet));
-			}
-		}
-		else
-		{
-			OV_ASSERT2(stream != nullptr);
-		}
+	// A frame contains the whole packet, so copy only once from the received data
+	auto media_packet = std::make_unique<MediaPacket>(
+		static_cast<common::MediaType>(frame.media_type),
+		frame.track_id,
+		frame.data->GetData(),
+		frame.data->GetLength(),
+		frame.pts,
+		static_cast<MediaPacketFlag>(frame.flags)
+	);
 
-		// clear the data
-		data.Clear();
-	}
+	*(media_packet->_frag_hdr) = frame.fragmentation;
 
-	if(is_different_packet)
-	{
-		transaction->transaction_id = packet.GetTransactionId();
-		transaction->media_type = packet.GetMediaType();
-		transaction->last_pts = packet.GetPts();
-		transaction->track_id = packet.GetTrackId();
-		data.Append(packet.GetData(), packet.GetDataSize());
-		transaction->flags = packet.GetFlags();
-	}
+	_media_route_application->OnReceiveBuffer(this->GetSharedPtr(), stream->GetStreamInfo(), std::move(media_packet));
 }
 
 void RelayClient::Register(const ov::String &identifier)
 {
-	RelayPacket packet(RelayPacketType::Register);
+	RelayFrame frame(RelayPacketType::Register);
 
-	packet.SetData(identifier.CStr(), static_cast<uint16_t>(identifier.GetLength()));
+	frame.data = identifier.ToData(false);
 
-	SendPacket(packet);
+	SendFrame(frame);
 }
 
-void RelayClient::SendPacket(const RelayPacket &packet)
+void RelayClient::SendFrame(const RelayFrame &frame)
 {
-	// TODO: make transaction id
-	if(packet.GetTransactionId() == 0)
-	{
-		RelayPacket new_packet = packet;
-
-		new_packet.SetTransactionId(ov::Random::GenerateUInt32());
+	auto data = frame.Serialize();
 
-		_client_socket.Send(&new_packet, sizeof(new_packet));
-	}
-	else
+	if(data != nullptr)
 	{
-		_client_socket.Send(&packet, sizeof(packet));
+		_message_writer.Send(&_client_socket, data.get());
 	}
 }
 
-void RelayClient::SendPacket(RelayPacketType type, info::application_id_t application_id, info::stream_id_t stream_id, const MediaPacket &packet)
-{
-	RelayPacket relay_packet(type);
-
-	relay_packet.SetApplicationId(ov::HostToBE32(application_id));
-	relay_packet.SetStreamId(ov::HostToBE32(stream_id));
-
-	SendPacket(relay_packet);
-}
-
 void RelayClient::Stop()
 {
-	_stop = false;
+	_stop = true;
+
+	// Wakes up the connection thread waiting for the data
+	_client_socket.Close();
 
 	if(_connection.joinable())
 	{
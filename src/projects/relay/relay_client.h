@@ -9,6 +9,7 @@
 #pragma once
 
 #include "relay_datastructure.h"
+#include "relay_transport_stats.h"
 
 #include <utility>
 
@@ -20,6 +21,10 @@
 #include <media_router/media_route_application.h>
 
 #define RELAY_DEFAULT_PORT                              9000
+// Interval of logging the statistics of the relay connection (ms)
+#define RELAY_CLIENT_STATS_INTERVAL                     (60 * 1000)
+// Default SRTO_FC of SRT (packets)
+#define RELAY_SRT_DEFAULT_FLIGHT_FLAG_SIZE              25600
 
 class RelayClient : public MediaRouteApplicationConnector
 {
@@ -34,8 +39,7 @@ public:
 	void Start(const ov::String &application);
 	void Stop();
 
-	void SendPacket(const RelayPacket &packet);
-	void SendPacket(RelayPacketType type, info::application_id_t application_id, info::stream_id_t stream_id, const MediaPacket &packet);
+	void SendFrame(const RelayFrame &frame);
 
 	void Register(const ov::String &identifier);
 
@@ -49,29 +53,20 @@ public:
 	//--------------------------------------------------------------------
 
 protected:
-	struct Transaction
-	{
-		uint32_t transaction_id = 0xFFFFFFFF;
-		int8_t media_type;
-		uint64_t last_pts;
-		uint32_t track_id;
-		ov::Data data;
-		uint8_t flags;
-	};
-
 	struct RelayStreamInfo
 	{
 		std::shared_ptr<StreamInfo> stream_info;
-
-		// [key: track_id, value: transaction data]
-		std::map<uint32_t, std::shared_ptr<Transaction>> transactions;
 	};
 
 	std::shared_ptr<RelayStreamInfo> GetStreamInfo(info::stream_id_t stream_id, bool create_info = false, bool *created = nullptr, bool delete_info = false);
 
-	void HandleCreateStream(const RelayPacket &packet);
-	void HandleDeleteStream(const RelayPacket &packet);
-	void HandleData(const RelayPacket &packet);
+	void SetSrtOptions();
+	void PrintStats(const ov::SocketAddress &address);
+
+	void HandleFrame(const RelayFrame &frame);
+	void HandleCreateStream(const RelayFrame &frame);
+	void HandleDeleteStream(const RelayFrame &frame);
+	void HandleData(const RelayFrame &frame);
 
 	MediaRouteApplication *_media_route_application;
 
@@ -79,9 +74,13 @@ protected:
 
 	const cfg::Origin _origin_info;
 	ov::Socket _client_socket;
+	// Frames are split into SRT messages by RelayMessageWriter
+	RelayFrameParser _parser { true };
+	RelayMessageWriter _message_writer { ov::MaxSrtPacketSize };
 
 	std::thread _connection;
-	bool _stop = true;
+	// Read by the connection thread
+	volatile bool _stop = true;
 
 	std::mutex _stream_list_mutex;
 	std::map<info::stream_id_t, std::shared_ptr<RelayStreamInfo>> _stream_list;
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_context_table.h"
+#include "relay_private.h"
+
+#include <base/media_route/media_buffer.h>
+
+const RelayContext *RelayContextTable::Update(const RelayFrame &frame, bool *need_to_define)
+{
+	auto key = std::make_pair(frame.stream_id, frame.track_id);
+	auto context_iter = _context_list.find(key);
+
+	if(context_iter == _context_list.end())
+	{
+		size_t context_id = 0;
+
+		while((context_id < RelayMaxContextCount) && _is_context_id_used[context_id])
+		{
+			context_id++;
+		}
+
+		if(context_id == RelayMaxContextCount)
+		{
+			// Too many tracks, this track is sent with the full header
+			*need_to_define = false;
+			return nullptr;
+		}
+
+		_is_context_id_used[context_id] = true;
+
+		ContextInfo context_info;
+
+		context_info.context.id = static_cast<uint8_t>(context_id);
+		context_info.context.application_id = frame.application_id;
+		context_info.context.stream_id = frame.stream_id;
+		context_info.context.media_type = frame.media_type;
+		context_info.context.track_id = frame.track_id;
+
+		context_iter = _context_list.emplace(key, context_info).first;
+		*need_to_define = true;
+	}
+	else
+	{
+		auto &context_info = context_iter->second;
+
+		context_info.frame_count++;
+
+		*need_to_define =
+			// The client can start parsing from the key frame after the DefineContext frame is lost
+			((frame.media_type == static_cast<int8_t>(common::MediaType::Video)) && (frame.flags == static_cast<uint8_t>(MediaPacketFlag::Key))) ||
+			(context_info.frame_count >= RELAY_CONTEXT_REFRESH_INTERVAL) ||
+			// pts is out of range of the pts offset
+			(context_info.context.IsMatched(frame) == false);
+	}
+
+	auto &context_info = context_iter->second;
+
+	if(*need_to_define)
+	{
+		auto &generation = _context_generations[context_info.context.id];
+
+		// The packets of the previous definition cannot be parsed with this base pts (and vice versa)
+		generation++;
+
+		context_info.context.generation = generation;
+		context_info.context.base_pts = frame.pts;
+		context_info.frame_count = 0;
+	}
+
+	return &(context_info.context);
+}
+
+const RelayContext *RelayContextTable::Find(const RelayFrame &frame) const
+{
+	auto context_iter = _context_list.find(std::make_pair(frame.stream_id, frame.track_id));
+
+	if(context_iter == _context_list.end())
+	{
+		return nullptr;
+	}
+
+	return &(context_iter->second.context);
+}
+
+std::vector<const RelayContext *> RelayContextTable::GetContexts(uint32_t stream_id) const
+{
+	std::vector<const RelayContext *> contexts;
+
+	for(auto &context_iter : _context_list)
+	{
+		if(context_iter.first.first == stream_id)
+		{
+			contexts.push_back(&(context_iter.second.context));
+		}
+	}
+
+	return contexts;
+}
+
+void RelayContextTable::Delete(uint32_t stream_id)
+{
+	for(auto context_iter = _context_list.begin(); context_iter != _context_list.end();)
+	{
+		if(context_iter->first.first == stream_id)
+		{
+			_is_context_id_used[context_iter->second.context.id] = false;
+			context_iter = _context_list.erase(context_iter);
+		}
+		else
+		{
+			++context_iter;
+		}
+	}
+}
@@ -0,0 +1,51 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "relay_datastructure.h"
+
+#include <map>
+#include <vector>
+
+// A header context is defined again after this number of packets, and on every video key frame
+// (the packets of a context cannot be parsed until the context is defined again if the DefineContext frame is lost).
+// Every definition has a new generation, so the packets are not parsed with the base pts of a previous definition.
+#define RELAY_CONTEXT_REFRESH_INTERVAL                  100
+
+//--------------------------------------------------------------------
+// RelayContextTable
+//--------------------------------------------------------------------
+// Header contexts of the sender (one context per track, up to RelayMaxContextCount contexts).
+// The contexts are shared by all clients, so a frame is serialized only once for every client.
+// This class is not thread-safe.
+class RelayContextTable
+{
+public:
+	// Returns the context of the track, or nullptr if there is no available context id.
+	// need_to_define is set to true if a DefineContext frame must be sent before the frame
+	const RelayContext *Update(const RelayFrame &frame, bool *need_to_define);
+	const RelayContext *Find(const RelayFrame &frame) const;
+
+	std::vector<const RelayContext *> GetContexts(uint32_t stream_id) const;
+	void Delete(uint32_t stream_id);
+
+protected:
+	struct ContextInfo
+	{
+		RelayContext context;
+		// Packets sent since the context is defined
+		uint32_t frame_count = 0;
+	};
+
+	// [key: (stream id, track id)]
+	std::map<std::pair<uint32_t, uint32_t>, ContextInfo> _context_list;
+	bool _is_context_id_used[RelayMaxContextCount] = {};
+	// Last generation of each context id (kept when the context id is reused by another track)
+	uint8_t _context_generations[RelayMaxContextCount] = {};
+};
@@ -0,0 +1,482 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_datastructure.h"
+#include "relay_private.h"
+
+#include <algorithm>
+
+#include <base/media_route/media_type.h>
+
+bool RelayFrame::IsCompactable() const
+{
+	return (type == RelayPacketType::Packet) &&
+	       (media_type == static_cast<int8_t>(common::MediaType::Audio)) &&
+	       (fragmentation.fragmentation_vector_size == 0) &&
+	       (track_id <= UINT8_MAX);
+}
+
+bool RelayContext::IsMatched(const RelayFrame &frame) const
+{
+	return (frame.type == RelayPacketType::Packet) &&
+	       (frame.application_id == application_id) && (frame.stream_id == stream_id) &&
+	       (frame.media_type == media_type) && (frame.track_id == track_id) &&
+	       (frame.pts >= base_pts) && ((frame.pts - base_pts) <= UINT32_MAX);
+}
+
+RelayFrame RelayFrame::FromContext(const RelayContext &context)
+{
+	RelayFrame frame(RelayPacketType::DefineContext);
+
+	frame.application_id = context.application_id;
+	frame.stream_id = context.stream_id;
+	frame.media_type = context.media_type;
+	frame.track_id = context.track_id;
+	frame.pts = context.base_pts;
+
+	uint8_t data[] = { context.id, context.generation };
+	frame.data = std::make_shared<ov::Data>(data, sizeof(data));
+
+	return frame;
+}
+
+bool RelayFrame::Serialize(ov::Data *output, bool use_compact_header, const RelayContext *context) const
+{
+	bool use_context = (context != nullptr) && context->IsMatched(*this);
+	bool is_compact = (use_context == false) && use_compact_header && IsCompactable();
+	size_t fragment_count = is_compact ? 0 : fragmentation.fragmentation_vector_size;
+	size_t data_length = (data != nullptr) ? data->GetLength() : 0;
+
+	if(fragment_count > MAX_FRAG_COUNT)
+	{
+		OV_ASSERT(fragment_count <= MAX_FRAG_COUNT, "Invalid fragment count: %zu", fragment_count);
+		return false;
+	}
+
+	size_t header_length;
+
+	if(use_context)
+	{
+		header_length = sizeof(RelayContextPacketHeader) + sizeof(RelayFragment) * fragment_count;
+	}
+	else if(is_compact)
+	{
+		header_length = sizeof(RelayCompactPacketHeader);
+	}
+	else
+	{
+		header_length = sizeof(RelayPacketHeader) + sizeof(RelayFragment) * fragment_count;
+	}
+
+	size_t frame_length = header_length + data_length;
+
+	if(frame_length > RelayFrameMaxLength)
+	{
+		logte("Frame is too large: %zu bytes (max: %u)", frame_length, RelayFrameMaxLength);
+		return false;
+	}
+
+	// Write the header and data in a single allocation
+	if(output->Reserve(output->GetLength() + sizeof(RelayFrameHeader) + frame_length) == false)
+	{
+		return false;
+	}
+
+	ov::ByteStream stream(output);
+	stream.SetOffset(output->GetLength());
+
+	stream.WriteBE16(RelayFrameMagic);
+	stream.Write8(static_cast<uint8_t>(type));
+	stream.Write8(static_cast<uint8_t>(use_context ? RelayFrameFlag::Context : (is_compact ? RelayFrameFlag::Compact : RelayFrameFlag::None)));
+	stream.WriteBE32(static_cast<uint32_t>(frame_length));
+
+	if(use_context)
+	{
+		stream.Write8(context->id);
+		stream.Write8(context->generation);
+		stream.WriteBE32(static_cast<uint32_t>(pts - context->base_pts));
+		stream.Write8(flags);
+		stream.Write8(static_cast<uint8_t>(fragment_count));
+	}
+	else if(is_compact)
+	{
+		stream.WriteBE32(stream_id);
+		stream.Write8(static_cast<uint8_t>(track_id));
+		stream.WriteBE64(pts);
+		stream.Write8(flags);
+	}
+	else
+	{
+		stream.WriteBE32(application_id);
+		stream.WriteBE32(stream_id);
+		stream.Write8(static_cast<uint8_t>(media_type));
+		stream.WriteBE32(track_id);
+		stream.WriteBE64(pts);
+		stream.Write8(flags);
+		stream.Write8(static_cast<uint8_t>(fragment_count));
+	}
+
+	for(size_t index = 0; index < fragment_count; index++)
+	{
+		stream.WriteBE32(static_cast<uint32_t>(fragmentation.fragmentation_offset[index]));
+		stream.WriteBE32(static_cast<uint32_t>(fragmentation.fragmentation_length[index]));
+	}
+
+	if(data_length > 0)
+	{
+		stream.Write(data->GetData(), data_length);
+	}
+
+	return true;
+}
+
+std::shared_ptr<ov::Data> RelayFrame::Serialize(bool use_compact_header, const RelayContext *context) const
+{
+	auto output = std::make_shared<ov::Data>();
+
+	if(Serialize(output.get(), use_compact_header, context))
+	{
+		return output;
+	}
+
+	return nullptr;
+}
+
+bool RelayMessageWriter::Write(const ov::Data *data, const MessageCallback &callback)
+{
+	auto buffer = data->GetDataAs<uint8_t>();
+	size_t length = data->GetLength();
+	size_t max_payload_length = _message.size() - sizeof(RelayMessageHeader);
+	uint8_t *message = _message.data();
+
+	for(size_t offset = 0; offset < length; offset += max_payload_length)
+	{
+		size_t payload_length = std::min(length - offset, max_payload_length);
+		uint16_t sequence = _sequence++;
+
+		message[0] = static_cast<uint8_t>(sequence >> 8);
+		message[1] = static_cast<uint8_t>(sequence & 0xFF);
+		message[2] = static_cast<uint8_t>((offset == 0) ? RelayMessageFlag::FrameStart : RelayMessageFlag::None);
+		::memcpy(message + sizeof(RelayMessageHeader), buffer + offset, payload_length);
+
+		if(callback(message, sizeof(RelayMessageHeader) + payload_length) == false)
+		{
+			// The sequence is consumed, so the receiver regards the rest of the data as lost
+			return false;
+		}
+	}
+
+	return true;
+}
+
+ssize_t RelayMessageWriter::Send(ov::Socket *socket, const ov::Data *data)
+{
+	bool result = Write(data, [socket](const void *message, size_t length) -> bool
+	{
+		return (socket->Send(message, length) == static_cast<ssize_t>(length));
+	});
+
+	return result ? static_cast<ssize_t>(data->GetLength()) : -1L;
+}
+
+bool RelayFrameParser::Parse(const ov::Data *data, const FrameCallback &callback)
+{
+	bool is_valid = true;
+	auto buffer = data->GetDataAs<uint8_t>();
+	size_t length = data->GetLength();
+
+	if(_is_message_mode && (ParseMessageHeader(&buffer, &length, &is_valid) == false))
+	{
+		return is_valid;
+	}
+
+	if(_buffer.GetLength() == 0)
+	{
+		// Parse directly from the received data, and keep only the incomplete frame
+		size_t processed = Parse(buffer, length, callback, &is_valid);
+
+		if(processed < length)
+		{
+			_buffer.Append(buffer + processed, length - processed);
+		}
+	}
+	else
+	{
+		_buffer.Append(buffer, length);
+
+		size_t processed = Parse(_buffer.GetDataAs<uint8_t>(), _buffer.GetLength(), callback, &is_valid);
+
+		if(processed > 0)
+		{
+			_buffer.Erase(0, processed);
+		}
+	}
+
+	return is_valid;
+}
+
+void RelayFrameParser::Reset()
+{
+	_buffer.Clear();
+	_discarded_frame_count = 0;
+	_is_sequence_valid = false;
+	_lost_message_count = 0;
+
+	for(auto &is_defined : _is_context_defined)
+	{
+		is_defined = false;
+	}
+}
+
+bool RelayFrameParser::ParseMessageHeader(const uint8_t **data, size_t *length, bool *is_valid)
+{
+	if(*length < sizeof(RelayMessageHeader))
+	{
+		*is_valid = false;
+		return false;
+	}
+
+	RelayMessageHeader header {};
+	::memcpy(&header, *data, sizeof(header));
+
+	uint16_t sequence = ov::BE16ToHost(header.sequence);
+	bool is_frame_start = (header.flags & static_cast<uint8_t>(RelayMessageFlag::FrameStart));
+
+	*data += sizeof(RelayMessageHeader);
+	*length -= sizeof(RelayMessageHeader);
+
+	bool is_lost = _is_sequence_valid && (sequence != _next_sequence);
+
+	if(is_lost)
+	{
+		_lost_message_count += static_cast<uint16_t>(sequence - _next_sequence);
+	}
+
+	_is_sequence_valid = true;
+	_next_sequence = static_cast<uint16_t>(sequence + 1);
+
+	if(_buffer.GetLength() > 0)
+	{
+		if(is_lost || is_frame_start)
+		{
+			// The rest of the incomplete frame is lost
+			logtw("A message is lost, discarding incomplete frame (%zu bytes)", _buffer.GetLength());
+
+			_buffer.Clear();
+			_discarded_frame_count++;
+			*is_valid = false;
+		}
+	}
+
+	if((_buffer.GetLength() == 0) && (is_frame_start == false))
+	{
+		// The first message of this frame is lost (the frame is already discarded)
+		*is_valid = false;
+		return false;
+	}
+
+	return true;
+}
+
+size_t RelayFrameParser::Parse(const uint8_t *data, size_t length, const FrameCallback &callback, bool *is_valid)
+{
+	size_t offset = 0;
+
+	while((length - offset) >= sizeof(RelayFrameHeader))
+	{
+		RelayFrameHeader header {};
+		::memcpy(&header, data + offset, sizeof(header));
+
+		header.magic = ov::BE16ToHost(header.magic);
+		header.length = ov::BE32ToHost(header.length);
+
+		if((header.magic != RelayFrameMagic) || (header.length > RelayFrameMaxLength))
+		{
+			*is_valid = false;
+
+			if(_is_message_mode)
+			{
+				// A frame starts at the beginning of a message, or right after the previous frame.
+				// Discard the rest of this message, since the payload may contain the magic
+				offset = length;
+				break;
+			}
+
+			// Find the next frame
+			offset++;
+			continue;
+		}
+
+		if((length - offset - sizeof(RelayFrameHeader)) < header.length)
+		{
+			// Need more data
+			break;
+		}
+
+		const uint8_t *body = data + offset + sizeof(RelayFrameHeader);
+		RelayFrame frame(header.type);
+
+		switch(ParseFrame(&header, body, &frame))
+		{
+			case ParseResult::Parsed:
+				callback(frame);
+				break;
+
+			case ParseResult::Skipped:
+				break;
+
+			case ParseResult::Invalid:
+				logtw("Invalid frame received (type: %d, flags: %d, length: %u)", header.type, header.flags, header.length);
+				*is_valid = false;
+				break;
+		}
+
+		offset += sizeof(RelayFrameHeader) + header.length;
+	}
+
+	return offset;
+}
+
+RelayFrameParser::ParseResult RelayFrameParser::ParseFrame(const RelayFrameHeader *header, const uint8_t *body, RelayFrame *frame)
+{
+	ov::Data body_data(body, header->length, true);
+	ov::ByteStream stream(&body_data);
+	uint8_t fragment_count = 0;
+
+	if(header->flags & static_cast<uint8_t>(RelayFrameFlag::Context))
+	{
+		if(stream.IsRemained(sizeof(RelayContextPacketHeader)) == false)
+		{
+			return ParseResult::Invalid;
+		}
+
+		uint8_t context_id = stream.Read8();
+		uint8_t generation = stream.Read8();
+		uint32_t pts_offset = stream.ReadBE32();
+
+		frame->flags = stream.Read8();
+		fragment_count = stream.Read8();
+
+		if(_is_context_defined[context_id] == false)
+		{
+			logtd("Packet of undefined context %u is discarded", context_id);
+			_discarded_frame_count++;
+			return ParseResult::Skipped;
+		}
+
+		const RelayContext &context = _contexts[context_id];
+
+		if(context.generation != generation)
+		{
+			// The DefineContext frame of this generation is lost (the base pts is unknown)
+			logtd("Packet of context %u is discarded (generation: %u, expected: %u)", context_id, generation, context.generation);
+			_discarded_frame_count++;
+			return ParseResult::Skipped;
+		}
+
+		frame->application_id = context.application_id;
+		frame->stream_id = context.stream_id;
+		frame->media_type = context.media_type;
+		frame->track_id = context.track_id;
+		frame->pts = context.base_pts + pts_offset;
+	}
+	else if(header->flags & static_cast<uint8_t>(RelayFrameFlag::Compact))
+	{
+		if(stream.IsRemained(sizeof(RelayCompactPacketHeader)) == false)
+		{
+			return ParseResult::Invalid;
+		}
+
+		frame->media_type = static_cast<int8_t>(common::MediaType::Audio);
+		frame->stream_id = stream.ReadBE32();
+		frame->track_id = stream.Read8();
+		frame->pts = stream.ReadBE64();
+		frame->flags = stream.Read8();
+	}
+	else
+	{
+		if(stream.IsRemained(sizeof(RelayPacketHeader)) == false)
+		{
+			return ParseResult::Invalid;
+		}
+
+		frame->application_id = stream.ReadBE32();
+		frame->stream_id = stream.ReadBE32();
+		frame->media_type = static_cast<int8_t>(stream.Read8());
+		frame->track_id = stream.ReadBE32();
+		frame->pts = stream.ReadBE64();
+		frame->flags = stream.Read8();
+		fragment_count = stream.Read8();
+	}
+
+	if((fragment_count > MAX_FRAG_COUNT) || (stream.IsRemained(sizeof(RelayFragment) * fragment_count) == false))
+	{
+		return ParseResult::Invalid;
+	}
+
+	for(uint8_t index = 0; index < fragment_count; index++)
+	{
+		frame->fragmentation.fragmentation_offset[index] = stream.ReadBE32();
+		frame->fragmentation.fragmentation_length[index] = stream.ReadBE32();
+	}
+
+	frame->fragmentation.fragmentation_vector_size = fragment_count;
+
+	// Refers to the received data (valid only during the callback)
+	frame->data = std::make_shared<ov::Data>(body + stream.GetOffset(), stream.Remained(), true);
+
+	switch(frame->type)
+	{
+		case RelayPacketType::DefineContext:
+			if(frame->data->GetLength() != (sizeof(RelayContext::id) + sizeof(RelayContext::generation)))
+			{
+				return ParseResult::Invalid;
+			}
+
+			DefineContext(*frame);
+			return ParseResult::Skipped;
+
+		case RelayPacketType::DeleteStream:
+			// The contexts of the stream will not be used anymore
+			DeleteContexts(frame->application_id, frame->stream_id);
+			break;
+
+		default:
+			break;
+	}
+
+	return ParseResult::Parsed;
+}
+
+void RelayFrameParser::DefineContext(const RelayFrame &frame)
+{
+	auto data = frame.data->GetDataAs<uint8_t>();
+	uint8_t context_id = data[0];
+	RelayContext &context = _contexts[context_id];
+
+	context.id = context_id;
+	context.generation = data[1];
+	context.application_id = frame.application_id;
+	context.stream_id = frame.stream_id;
+	context.media_type = frame.media_type;
+	context.track_id = frame.track_id;
+	context.base_pts = frame.pts;
+
+	_is_context_defined[context_id] = true;
+}
+
+void RelayFrameParser::DeleteContexts(uint32_t application_id, uint32_t stream_id)
+{
+	for(size_t index = 0; index < RelayMaxContextCount; index++)
+	{
+		if(_is_context_defined[index] && (_contexts[index].application_id == application_id) && (_contexts[index].stream_id == stream_id))
+		{
+			_is_context_defined[index] = false;
+		}
+	}
+}
@@ -9,9 +9,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <vector>
 
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket.h>
 
 enum class RelayPacketType : uint8_t
 {
@@ -19,200 +22,281 @@ enum class RelayPacketType : uint8_t
 	CreateStream,
 	DeleteStream,
 	Packet,
-	Error
+	Error,
+	// Defines a header context (the ids of a track) used by the following packets
+	DefineContext
 };
 
-constexpr const int RelayPacketDataSize = 1200;
+// Every frame starts with "OV" (used to find the next frame when invalid data is received)
+constexpr const uint16_t RelayFrameMagic = 0x4F56;
+// Frames larger than this are treated as invalid data
+constexpr const uint32_t RelayFrameMaxLength = 16 * 1024 * 1024;
 
+enum class RelayFrameFlag : uint8_t
+{
+	None = 0x00,
+	// RelayCompactPacketHeader is used instead of RelayPacketHeader
+	Compact = 0x01,
+	// RelayContextPacketHeader is used instead of RelayPacketHeader
+	Context = 0x02
+};
+
+// Maximum number of header contexts of a connection
+constexpr const size_t RelayMaxContextCount = 256;
+
+enum class RelayMessageFlag : uint8_t
+{
+	None = 0x00,
+	// The message starts with a RelayFrameHeader (the first message of a frame)
+	FrameStart = 0x01
+};
+
+// Wire format (all values are big endian)
+//
+// Frames are split into SRT messages, and each message starts with a RelayMessageHeader:
+// [RelayMessageHeader] [the data of the frames (ov::MaxSrtPacketSize - sizeof(RelayMessageHeader) bytes at most)]
+// The sequence is increased by 1 for every message of the connection, so the receiver can detect a lost message,
+// even if it is the last (short) message of a frame followed by the first message of the next frame.
+//
+// [RelayFrameHeader]
+// None:    [RelayPacketHeader] [RelayFragment * fragment_count] [data]
+// Compact: [RelayCompactPacketHeader] [data]
+// Context: [RelayContextPacketHeader] [RelayFragment * fragment_count] [data]
+//
+// DefineContext frames use RelayPacketHeader (pts is the base pts of the context),
+// and the data is the context id (1 byte) and the generation of the context (1 byte).
+// A context is valid until it is defined again, or the stream is deleted.
+// The generation is changed whenever the context is defined again (the base pts is changed),
+// so the packets sent after a lost DefineContext frame are not parsed with the previous base pts.
 #pragma pack(push, 1)
-struct RelayPacket
+struct RelayMessageHeader
 {
-	explicit RelayPacket(RelayPacketType type)
-	{
-		this->type = type;
-	}
+	uint16_t sequence;
+	// RelayMessageFlag
+	uint8_t flags;
+};
 
-	explicit RelayPacket(const ov::Data *data)
-	{
-		if(data->GetLength() == sizeof(RelayPacket))
-		{
-			::memcpy(this, data->GetData(), sizeof(RelayPacket));
-
-			if(GetDataSize() > RelayPacketDataSize)
-			{
-				OV_ASSERT(GetDataSize() <= RelayPacketDataSize, "Data size %d exceedes %d", GetDataSize(), RelayPacketDataSize);
-				_data_size = ov::HostToBE16(RelayPacketDataSize);
-			}
-		}
-		else
-		{
-			OV_ASSERT(data->GetLength() == sizeof(RelayPacket), "Invalid data size: %zu, expected: %zu", data->GetLength(), sizeof(RelayPacket));
-		}
-	}
+struct RelayFrameHeader
+{
+	uint16_t magic;
+	RelayPacketType type;
+	// RelayFrameFlag
+	uint8_t flags;
+	// Length of the frame, excluding this header
+	uint32_t length;
+};
 
-	RelayPacketType GetType() const
-	{
-		return type;
-	}
+struct RelayPacketHeader
+{
+	// info::application_id_t
+	uint32_t application_id;
+	// info::stream_id_t
+	uint32_t stream_id;
+	// common::MediaType
+	int8_t media_type;
+	uint32_t track_id;
+	uint64_t pts;
+	// MediaPacketFlag
+	uint8_t flags;
+	uint8_t fragment_count;
+};
 
-	void SetTransactionId(uint32_t transaction_id)
-	{
-		_transaction_id = ov::HostToBE32(transaction_id);
-	}
+struct RelayFragment
+{
+	uint32_t offset;
+	uint32_t length;
+};
 
-	uint32_t GetTransactionId() const
-	{
-		return ov::BE32ToHost(_transaction_id);
-	}
+// Audio frames without fragmentation information (media_type is always Audio)
+struct RelayCompactPacketHeader
+{
+	uint32_t stream_id;
+	uint8_t track_id;
+	uint64_t pts;
+	uint8_t flags;
+};
 
-	void SetApplicationId(uint32_t app_id)
-	{
-		_application_id = ov::HostToBE32(app_id);
-	}
+// Packets of a track defined by a DefineContext frame (8 bytes instead of 23 bytes)
+struct RelayContextPacketHeader
+{
+	uint8_t context_id;
+	// Must be the same as the generation of the last DefineContext frame of the context
+	uint8_t generation;
+	// pts - base pts of the context
+	uint32_t pts_offset;
+	uint8_t flags;
+	uint8_t fragment_count;
+};
+#pragma pack(pop)
 
-	uint32_t GetApplicationId() const
-	{
-		return ov::BE32ToHost(_application_id);
-	}
+struct RelayFrame;
 
-	void SetStreamId(uint32_t stream_id)
-	{
-		_stream_id = ov::HostToBE32(stream_id);
-	}
+//--------------------------------------------------------------------
+// RelayContext
+//--------------------------------------------------------------------
+// The ids of a track that are replaced with the context id in RelayContextPacketHeader
+struct RelayContext
+{
+	// Returns true if the frame can be sent using this context
+	bool IsMatched(const RelayFrame &frame) const;
+
+	uint8_t id = 0;
+	// Changed whenever the context is defined again
+	uint8_t generation = 0;
+
+	uint32_t application_id = 0;
+	uint32_t stream_id = 0;
+	int8_t media_type = 0;
+	uint32_t track_id = 0;
+	uint64_t base_pts = 0;
+};
 
-	uint32_t GetStreamId() const
+//--------------------------------------------------------------------
+// RelayFrame
+//--------------------------------------------------------------------
+// A whole MediaPacket (or control message) is carried in one variable-length frame
+struct RelayFrame
+{
+	explicit RelayFrame(RelayPacketType type = RelayPacketType::Packet)
+		: type(type)
 	{
-		return ov::BE32ToHost(_stream_id);
 	}
 
-	void SetMediaType(int8_t media_type)
-	{
-		_media_type = media_type;
-	}
+	// Returns true if this frame can be sent using RelayCompactPacketHeader
+	bool IsCompactable() const;
 
-	int8_t GetMediaType() const
-	{
-		return _media_type;
-	}
+	// Serializes this frame and appends it to the output
+	// If the context is specified and matched, RelayContextPacketHeader is used
+	bool Serialize(ov::Data *output, bool use_compact_header = true, const RelayContext *context = nullptr) const;
+	std::shared_ptr<ov::Data> Serialize(bool use_compact_header = true, const RelayContext *context = nullptr) const;
 
-	void SetTrackId(uint32_t track_id)
-	{
-		_track_id = ov::HostToBE32(track_id);
-	}
+	// Makes a DefineContext frame of the context
+	static RelayFrame FromContext(const RelayContext &context);
 
-	uint32_t GetTrackId() const
-	{
-		return ov::BE32ToHost(_track_id);
-	}
+	RelayPacketType type;
 
-	void SetPts(uint64_t pts)
-	{
-		_pts = ov::HostToBE64(pts);
-	}
+	uint32_t application_id = 0;
+	uint32_t stream_id = 0;
+	int8_t media_type = 0;
+	uint32_t track_id = 0;
+	uint64_t pts = 0;
+	uint8_t flags = 0;
 
-	uint64_t GetPts() const
-	{
-		return ov::BE64ToHost(_pts);
-	}
+	FragmentationHeader fragmentation;
 
-	void SetFlags(uint8_t flags)
-	{
-		_flags = flags;
-	}
+	// The data received by RelayFrameParser is only valid during the callback
+	std::shared_ptr<const ov::Data> data;
+};
 
-	uint8_t GetFlags() const
-	{
-		return _flags;
-	}
+//--------------------------------------------------------------------
+// RelayMessageWriter
+//--------------------------------------------------------------------
+// Splits the serialized frames into messages of message_size, and prepends a RelayMessageHeader to each message.
+// The data of each Write() call must start with a frame, and a message never contains the data of two Write() calls.
+// The sequence of a message that could not be sent is not reused, so the receiver discards the incomplete frame.
+class RelayMessageWriter
+{
+public:
+	// @return false if the message could not be sent (the rest of the data is not sent)
+	typedef std::function<bool(const void *message, size_t length)> MessageCallback;
 
-	void SetFragmentHeader(const FragmentationHeader *header)
+	explicit RelayMessageWriter(size_t message_size)
+		: _message(message_size)
 	{
-		::memcpy(&_frag_header, header, sizeof(_frag_header));
+		OV_ASSERT2(message_size > sizeof(RelayMessageHeader));
 	}
 
-	const FragmentationHeader *GetFragmentHeader() const
-	{
-		return &_frag_header;
-	}
+	// @return false if a message could not be sent
+	bool Write(const ov::Data *data, const MessageCallback &callback);
 
-	void SetData(const void *data, uint16_t length)
-	{
-		if(length <= RelayPacketDataSize)
-		{
-			::memcpy(_data, data, length);
-			_data_size = ov::HostToBE16(length);
-		}
-		else
-		{
-			OV_ASSERT2(length <= RelayPacketDataSize);
-		}
-	}
+	// Sends each message using the socket
+	// @return the length of the data if all messages are sent, -1 otherwise
+	ssize_t Send(ov::Socket *socket, const ov::Data *data);
 
-	const void *GetData() const
+	void Reset()
 	{
-		return _data;
+		_sequence = 0;
 	}
 
-	void *GetData()
-	{
-		return _data;
-	}
+protected:
+	// SRT sends a message at once, so the header and the data are copied into this buffer
+	std::vector<uint8_t> _message;
+	uint16_t _sequence = 0;
+};
 
-	void SetDataSize(uint16_t data_size)
-	{
-		_data_size = ov::HostToBE16(data_size);
-	}
+//--------------------------------------------------------------------
+// RelayFrameParser
+//--------------------------------------------------------------------
+// Reassembles frames from the received data.
+// Only incomplete frames are buffered (complete frames refer to the received data without copying)
+//
+// If is_message_mode is true, each Parse() call is regarded as one message written by RelayMessageWriter
+// (message-oriented transport, SRT). If a message is lost (the sequence is not continuous),
+// or an incomplete frame is followed by the first message of another frame, the incomplete frame is discarded
+// instead of being delivered with the data of the next frame.
+// Messages that continue a discarded frame are discarded until the first message of the next frame.
+//
+// DefineContext frames are consumed by the parser, and the packets using RelayContextPacketHeader are delivered
+// with the ids of the context. Packets of an undefined context, or of another generation of the context
+// (the DefineContext frame was lost), are discarded until the context is defined again.
+class RelayFrameParser
+{
+public:
+	typedef std::function<void(const RelayFrame &frame)> FrameCallback;
 
-	const uint16_t GetDataSize() const
+	explicit RelayFrameParser(bool is_message_mode = false)
+		: _is_message_mode(is_message_mode)
 	{
-		return ov::BE16ToHost(_data_size);
 	}
 
-	void SetStart(bool start)
-	{
-		_start_indicator = static_cast<uint8_t>(start ? 1 : 0);
-	}
+	// @return false if invalid data is found (that data is skipped up to the next frame)
+	bool Parse(const ov::Data *data, const FrameCallback &callback);
+
+	void Reset();
 
-	void SetEnd(bool end)
+	// Number of the frames that could not be delivered due to the message loss
+	// (incomplete frames, and packets of undefined/outdated contexts)
+	uint64_t GetDiscardedFrameCount() const
 	{
-		_end_indicator = static_cast<uint8_t>(end ? 1 : 0);
+		return _discarded_frame_count;
 	}
 
-	bool IsEnd() const
+	// Number of the messages that are not received (message mode only)
+	uint64_t GetLostMessageCount() const
 	{
-		return (_end_indicator == 1);
+		return _lost_message_count;
 	}
 
 protected:
-	// TODO(dimiden): The endian between the RelayServer and the RelayClient must match
-	// (Currently, it uses little endian)
+	// Strips the RelayMessageHeader, and discards the incomplete frame if a message is lost
+	// @return false if the message must be discarded
+	bool ParseMessageHeader(const uint8_t **data, size_t *length, bool *is_valid);
 
-	// arbitrary number to distinguish different packets
-	uint32_t _transaction_id = 0;
-	// 1 if this packet indicates start of packet, 0 otherwise
-	uint8_t _start_indicator = 0;
-	// 1 if this packet indicates end of packet, 0 otherwise
-	uint8_t _end_indicator = 0;
+	// @return the number of bytes processed
+	size_t Parse(const uint8_t *data, size_t length, const FrameCallback &callback, bool *is_valid);
 
-	RelayPacketType type = RelayPacketType::Packet;
+	enum class ParseResult
+	{
+		Parsed,
+		// Consumed by the parser, or cannot be delivered (undefined context)
+		Skipped,
+		Invalid
+	};
 
-	// info::application_id_t
-	uint32_t _application_id = 0;
-	// info::stream_id_t
-	uint32_t _stream_id = 0;
+	ParseResult ParseFrame(const RelayFrameHeader *header, const uint8_t *body, RelayFrame *frame);
+	void DefineContext(const RelayFrame &frame);
+	void DeleteContexts(uint32_t application_id, uint32_t stream_id);
 
-	// common::MediaType
-	int8_t _media_type = 0;
-	uint32_t _track_id = 0;
-	uint64_t _pts = 0;
-	// MediaPacketFlag
-	uint8_t _flags = 0;
+	bool _is_message_mode;
+	ov::Data _buffer;
 
-	FragmentationHeader _frag_header;
+	// false until the first message is received
+	bool _is_sequence_valid = false;
+	uint16_t _next_sequence = 0;
+	uint64_t _lost_message_count = 0;
 
-	uint16_t _data_size = 0;
-	uint8_t _data[RelayPacketDataSize] = {};
-};
+	bool _is_context_defined[RelayMaxContextCount] = {};
+	RelayContext _contexts[RelayMaxContextCount];
 
-static_assert(sizeof(RelayPacket) < 1316, "sizeof(RelayPacket) must be less than 1316");
-#pragma pack(pop)
+	uint64_t _discarded_frame_count = 0;
+};
@@ -0,0 +1,395 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_send_queue.h"
+#include "relay_private.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <base/media_route/media_buffer.h>
+
+RelaySendQueue::RelaySendQueue(const std::shared_ptr<ov::Socket> &remote, size_t max_queue_bytes, size_t max_stream_bytes)
+	: _remote(remote),
+	  _max_queue_bytes(max_queue_bytes),
+	  _max_stream_bytes(max_stream_bytes)
+{
+}
+
+RelaySendQueue::~RelaySendQueue()
+{
+	Stop();
+}
+
+bool RelaySendQueue::Start()
+{
+	if(_stop == false)
+	{
+		return true;
+	}
+
+	_stop = false;
+
+	try
+	{
+		_thread = std::thread(&RelaySendQueue::SenderThread, this);
+	}
+	catch(const std::system_error &e)
+	{
+		_stop = true;
+		logte("Could not start sender thread for %s", _remote->ToString().CStr());
+		return false;
+	}
+
+	return true;
+}
+
+void RelaySendQueue::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+		if(_stop)
+		{
+			return;
+		}
+
+		_stop = true;
+	}
+
+	_queue_condition.notify_all();
+
+	if(_thread.joinable())
+	{
+		_thread.join();
+	}
+
+	std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+	_queue.clear();
+	_queued_audio_frames = 0;
+	_queued_key_frames = 0;
+	_stream_states.clear();
+	_stats.queued_frames = 0;
+	_stats.queued_bytes = 0;
+}
+
+void RelaySendQueue::Push(const RelayFrame &frame, const std::shared_ptr<const ov::Data> &data)
+{
+	ItemType type = ItemType::Control;
+	size_t length = data->GetLength();
+
+	if(frame.type == RelayPacketType::Packet)
+	{
+		// Frames other than video (audio, data, ...) do not depend on the previous frames
+		type = (frame.media_type == static_cast<int8_t>(common::MediaType::Video)) ? ItemType::Video : ItemType::Audio;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+		if(_stop)
+		{
+			return;
+		}
+
+		bool is_key_frame = (type == ItemType::Video) && (frame.flags == static_cast<uint8_t>(MediaPacketFlag::Key));
+
+		if(type == ItemType::Video)
+		{
+			auto &state = _stream_states[frame.stream_id];
+
+			if(state.is_waiting_key_frame)
+			{
+				if(is_key_frame == false)
+				{
+					_stats.dropped_frames++;
+					_stats.dropped_bytes += length;
+					return;
+				}
+
+				state.is_waiting_key_frame = false;
+			}
+
+			if((state.queued_video_bytes + length) > _max_stream_bytes)
+			{
+				_stats.window_overflow_count++;
+
+				// Only this stream is affected
+				DropVideoFrames(frame.stream_id);
+
+				logtw("Window of stream %u to %s is full, dropping video frames until the next key frame (window overflow: %" PRIu64 ", dropped: %" PRIu64 " frames/%" PRIu64 " bytes)",
+				      frame.stream_id, _remote->ToString().CStr(),
+				      _stats.window_overflow_count, _stats.dropped_frames, _stats.dropped_bytes);
+
+				if(is_key_frame == false)
+				{
+					state.is_waiting_key_frame = true;
+
+					_stats.dropped_frames++;
+					_stats.dropped_bytes += length;
+					return;
+				}
+			}
+		}
+
+		if((type != ItemType::Control) && ((_stats.queued_bytes + length) > _max_queue_bytes))
+		{
+			_stats.overflow_count++;
+
+			DropMediaFrames();
+
+			logtw("Send queue of %s is full, dropping media frames until the next key frame (overflow: %" PRIu64 ", dropped: %" PRIu64 " frames/%" PRIu64 " bytes, sent: %" PRIu64 " frames/%" PRIu64 " bytes)",
+			      _remote->ToString().CStr(),
+			      _stats.overflow_count, _stats.dropped_frames, _stats.dropped_bytes, _stats.sent_frames, _stats.sent_bytes);
+
+			if(type == ItemType::Video)
+			{
+				auto &state = _stream_states[frame.stream_id];
+
+				if(is_key_frame == false)
+				{
+					state.is_waiting_key_frame = true;
+
+					_stats.dropped_frames++;
+					_stats.dropped_bytes += length;
+					return;
+				}
+
+				// Start the new GOP with this frame
+				state.is_waiting_key_frame = false;
+			}
+		}
+
+		_queue.push_back(Item { data, frame.stream_id, type, is_key_frame });
+
+		_stats.queued_frames++;
+		_stats.queued_bytes += length;
+		_stats.max_queued_bytes = std::max(_stats.max_queued_bytes, _stats.queued_bytes);
+
+		switch(type)
+		{
+			case ItemType::Video:
+				_stream_states[frame.stream_id].queued_video_bytes += length;
+
+				if(is_key_frame)
+				{
+					_queued_key_frames++;
+				}
+				break;
+
+			case ItemType::Audio:
+				_queued_audio_frames++;
+				break;
+
+			case ItemType::Control:
+				if(frame.type == RelayPacketType::DeleteStream)
+				{
+					// The frames of the stream that are still queued are handled without the state
+					_stream_states.erase(frame.stream_id);
+				}
+				break;
+		}
+	}
+
+	_queue_condition.notify_one();
+}
+
+std::deque<RelaySendQueue::Item>::iterator RelaySendQueue::RemoveItem(std::deque<Item>::iterator item)
+{
+	size_t length = item->data->GetLength();
+
+	_stats.queued_frames--;
+	_stats.queued_bytes -= length;
+
+	switch(item->type)
+	{
+		case ItemType::Video:
+		{
+			auto state = _stream_states.find(item->stream_id);
+
+			if(state != _stream_states.end())
+			{
+				state->second.queued_video_bytes -= length;
+			}
+
+			if(item->is_key_frame)
+			{
+				_queued_key_frames--;
+			}
+
+			break;
+		}
+
+		case ItemType::Audio:
+			_queued_audio_frames--;
+			break;
+
+		case ItemType::Control:
+			break;
+	}
+
+	return _queue.erase(item);
+}
+
+void RelaySendQueue::DropMediaFrames()
+{
+	for(auto item = _queue.begin(); item != _queue.end();)
+	{
+		if(item->type == ItemType::Control)
+		{
+			++item;
+			continue;
+		}
+
+		if(item->type == ItemType::Video)
+		{
+			auto state = _stream_states.find(item->stream_id);
+
+			if(state != _stream_states.end())
+			{
+				// The rest of the GOP cannot be decoded
+				state->second.is_waiting_key_frame = true;
+			}
+		}
+
+		_stats.dropped_frames++;
+		_stats.dropped_bytes += item->data->GetLength();
+
+		item = RemoveItem(item);
+	}
+}
+
+void RelaySendQueue::DropVideoFrames(uint32_t stream_id)
+{
+	for(auto item = _queue.begin(); item != _queue.end();)
+	{
+		if((item->type != ItemType::Video) || (item->stream_id != stream_id))
+		{
+			++item;
+			continue;
+		}
+
+		_stats.dropped_frames++;
+		_stats.dropped_bytes += item->data->GetLength();
+
+		item = RemoveItem(item);
+	}
+}
+
+std::deque<RelaySendQueue::Item>::iterator RelaySendQueue::NextItem()
+{
+	if((_queued_audio_frames == 0) && (_queued_key_frames == 0))
+	{
+		return _queue.begin();
+	}
+
+	auto key_frame = _queue.end();
+	// Streams that have a queued video frame before the current item
+	std::vector<uint32_t> video_streams;
+
+	for(auto item = _queue.begin(); item != _queue.end(); ++item)
+	{
+		if(item->type == ItemType::Control)
+		{
+			// Control frames must be sent in order (ex: CreateStream must be sent before the packets of the stream)
+			break;
+		}
+
+		if(item->type == ItemType::Audio)
+		{
+			return item;
+		}
+
+		if(key_frame != _queue.end())
+		{
+			// Looking for an audio frame only
+			continue;
+		}
+
+		bool has_previous_frame = (std::find(video_streams.begin(), video_streams.end(), item->stream_id) != video_streams.end());
+
+		if(has_previous_frame)
+		{
+			// The frames of a stream must be sent in order
+			continue;
+		}
+
+		if(item->is_key_frame)
+		{
+			key_frame = item;
+
+			if(_queued_audio_frames == 0)
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		video_streams.push_back(item->stream_id);
+	}
+
+	return (key_frame != _queue.end()) ? key_frame : _queue.begin();
+}
+
+RelaySendQueueStats RelaySendQueue::GetStats()
+{
+	std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+	return _stats;
+}
+
+void RelaySendQueue::SenderThread()
+{
+	while(true)
+	{
+		Item item;
+
+		{
+			std::unique_lock<std::mutex> lock(_queue_mutex);
+
+			_queue_condition.wait(lock, [this]() -> bool
+			{
+				return _stop || (_queue.empty() == false);
+			});
+
+			if(_stop)
+			{
+				break;
+			}
+
+			auto next_item = NextItem();
+
+			if(next_item != _queue.begin())
+			{
+				_stats.prioritized_frames++;
+			}
+
+			item = *next_item;
+			RemoveItem(next_item);
+		}
+
+		// Only this thread waits for the socket
+		ssize_t sent = _message_writer.Send(_remote.get(), item.data.get());
+
+		std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+		if(sent > 0)
+		{
+			_stats.sent_frames++;
+			_stats.sent_bytes += static_cast<uint64_t>(sent);
+		}
+		else if(sent < 0)
+		{
+			// The frame could not be sent (the send buffer of SRT was not available within the timeout, etc.)
+			_stats.dropped_frames++;
+			_stats.dropped_bytes += item.data->GetLength();
+		}
+	}
+}
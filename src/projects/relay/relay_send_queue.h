@@ -0,0 +1,137 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "relay_datastructure.h"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <thread>
+
+#include <base/ovsocket/socket.h>
+
+struct RelaySendQueueStats
+{
+	// Frames/bytes passed to the socket
+	uint64_t sent_frames = 0;
+	uint64_t sent_bytes = 0;
+
+	// Frames/bytes dropped due to the queue overflow (including frames dropped while waiting for a key frame)
+	uint64_t dropped_frames = 0;
+	uint64_t dropped_bytes = 0;
+	// Number of the queue overflows
+	uint64_t overflow_count = 0;
+	// Number of the stream window overflows
+	uint64_t window_overflow_count = 0;
+	// Number of audio/key frames sent ahead of the queued video frames
+	uint64_t prioritized_frames = 0;
+
+	size_t queued_frames = 0;
+	size_t queued_bytes = 0;
+	size_t max_queued_bytes = 0;
+};
+
+//--------------------------------------------------------------------
+// RelaySendQueue
+//--------------------------------------------------------------------
+// Outbound queue of a relay client (edge).
+// Frames are pushed from the MediaRouter thread and sent by a dedicated sender thread,
+// so a slow edge does not block the other edges or the routing of other streams.
+//
+// All streams of an application share one connection, so the queue prevents a stream from blocking the others:
+//
+// - Each stream has a window of max_stream_bytes for the queued video frames.
+//   If the window is exceeded, the queued video frames of that stream are dropped,
+//   and the video frames of that stream are dropped until the next key frame (GOP boundary).
+//   Key frames start a new GOP, so they are never dropped by the window.
+// - Audio frames are sent ahead of the queued video frames (but never ahead of the control frames),
+//   since they are small and a gap is more noticeable.
+// - Video key frames are sent ahead of the queued video frames of the other streams
+//   (but never ahead of the control frames, audio frames, or the queued video frames of the same stream),
+//   since the edge cannot decode the stream until the key frame arrives.
+//
+// When the queued bytes exceed max_queue_bytes, all queued media frames are dropped,
+// and the video frames of those streams are dropped until the next key frame.
+// Control frames (CreateStream, DeleteStream, ...) are never dropped.
+class RelaySendQueue
+{
+public:
+	RelaySendQueue(const std::shared_ptr<ov::Socket> &remote, size_t max_queue_bytes, size_t max_stream_bytes);
+	~RelaySendQueue();
+
+	bool Start();
+	void Stop();
+
+	// data is the serialized frame (shared with other queues)
+	void Push(const RelayFrame &frame, const std::shared_ptr<const ov::Data> &data);
+
+	RelaySendQueueStats GetStats();
+
+	const std::shared_ptr<ov::Socket> &GetRemote() const
+	{
+		return _remote;
+	}
+
+protected:
+	enum class ItemType
+	{
+		Control,
+		Audio,
+		Video
+	};
+
+	struct Item
+	{
+		std::shared_ptr<const ov::Data> data;
+		uint32_t stream_id;
+		ItemType type;
+		bool is_key_frame;
+	};
+
+	struct StreamState
+	{
+		// Bytes of the queued video frames (compared with _max_stream_bytes)
+		size_t queued_video_bytes = 0;
+		// The video frames are dropped until the next key frame
+		bool is_waiting_key_frame = false;
+	};
+
+	// Must be called with _queue_mutex locked
+	// Drops all queued media frames (queue overflow)
+	void DropMediaFrames();
+	// Drops the queued video frames of the stream (window overflow)
+	void DropVideoFrames(uint32_t stream_id);
+	std::deque<Item>::iterator RemoveItem(std::deque<Item>::iterator item);
+	// Returns the first frame, except that the following frames before the first control frame are sent first:
+	// 1. The first audio frame
+	// 2. The first video key frame that has no queued video frame of the same stream before it
+	std::deque<Item>::iterator NextItem();
+
+	void SenderThread();
+
+	std::shared_ptr<ov::Socket> _remote;
+	// Used only by the sender thread
+	RelayMessageWriter _message_writer { ov::MaxSrtPacketSize };
+	size_t _max_queue_bytes;
+	size_t _max_stream_bytes;
+
+	std::mutex _queue_mutex;
+	std::condition_variable _queue_condition;
+	std::deque<Item> _queue;
+	size_t _queued_audio_frames = 0;
+	size_t _queued_key_frames = 0;
+
+	std::map<uint32_t, StreamState> _stream_states;
+
+	RelaySendQueueStats _stats;
+
+	bool _stop = true;
+	std::thread _thread;
+};
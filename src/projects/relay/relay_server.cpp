@@ -10,6 +10,8 @@
 
 #include "relay_private.h"
 
+#include <algorithm>
+
 #include <media_router/media_router.h>
 #include <base/media_route/media_route_application_interface.h>
 #include <base/media_route/media_buffer.h>
@@ -59,6 +61,15 @@ RelayServer::~RelayServer()
 	{
 		_server_port->RemoveObserver(this);
 	}
+
+	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+
+	for(auto &client : _client_list)
+	{
+		client.second.send_queue->Stop();
+	}
+
+	_client_list.clear();
 }
 
 void RelayServer::SendStream(const std::shared_ptr<ov::Socket> &remote, const std::shared_ptr<StreamInfo> &stream_info)
@@ -93,17 +104,19 @@ void RelayServer::SendStream(const std::shared_ptr<ov::Socket> &remote, const st
 	      serialize.CStr()
 	);
 
-	RelayPacket response(RelayPacketType::CreateStream);
+	RelayFrame frame(RelayPacketType::CreateStream);
+
+	frame.data = serialize.ToData(false);
 
 	if(remote != nullptr)
 	{
 		// send to specific relay client
-		Send(remote, stream_info->GetId(), response, serialize.ToData().get());
+		Send(remote, stream_info->GetId(), frame);
 	}
 	else
 	{
 		// broadcast
-		Send(stream_info->GetId(), response, serialize.ToData().get());
+		Send(stream_info->GetId(), frame);
 	}
 }
 
@@ -122,7 +135,16 @@ bool RelayServer::OnDeleteStream(std::shared_ptr<StreamInfo> info)
 	// Notify to relay client
 	logtd("Stream is deleted: %u, %s", info->GetId(), info->GetName().CStr());
 
-	Send(info->GetId(), RelayPacket(RelayPacketType::DeleteStream), nullptr);
+	{
+		std::lock_guard<std::mutex> lock_guard(_gop_cache_mutex);
+
+		_gop_cache_list.erase(info->GetId());
+		_context_table.Delete(info->GetId());
+	}
+
+	RelayFrame frame(RelayPacketType::DeleteStream);
+
+	Send(info->GetId(), frame);
 
 	return true;
 }
@@ -140,24 +162,59 @@ bool RelayServer::OnSendAudioFrame(std::shared_ptr<StreamInfo> stream, std::shar
 void RelayServer::OnConnected(const std::shared_ptr<ov::Socket> &remote)
 {
 	logti("New RelayClient is connected: %s", remote->ToString().CStr());
+
+	ClientInfo client_info;
+
+	auto &relay = _application_info.GetRelay();
+
+	client_info.send_queue = std::make_shared<RelaySendQueue>(remote,
+	                                                          static_cast<size_t>(relay.GetSendQueueSize()) * 1024,
+	                                                          static_cast<size_t>(relay.GetStreamWindowSize()) * 1024);
+	client_info.send_queue->Start();
+
+	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+
+	_client_list[remote.get()] = client_info;
 }
 
 void RelayServer::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data)
 {
 	logtd("Data received from %s: %zu bytes", remote->ToString().CStr(), data->GetLength());
 
-	RelayPacket packet(data.get());
+	std::shared_ptr<RelayFrameParser> parser;
 
-	switch(packet.GetType())
 	{
-		case RelayPacketType::Register:
-			HandleRegister(remote, packet);
-			break;
+		std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+
+		auto info_iter = _client_list.find(remote.get());
+
+		if(info_iter == _client_list.end())
+		{
+			// ClientInfo is created in OnConnected()
+			logtw("Data received from unknown client: %s", remote->ToString().CStr());
+			return;
+		}
 
-		default:
-			OV_ASSERT2(false);
-			logte("Invalid packet received from client: %d", packet.GetType());
-			break;
+		parser = info_iter->second.parser;
+	}
+
+	bool is_valid = parser->Parse(data.get(), [&](const RelayFrame &frame) -> void
+	{
+		switch(frame.type)
+		{
+			case RelayPacketType::Register:
+				HandleRegister(remote, frame);
+				break;
+
+			default:
+				logte("Invalid packet received from client: %d", frame.type);
+				break;
+		}
+	});
+
+	if(is_valid == false)
+	{
+		logtw("Invalid data received from %s", remote->ToString().CStr());
 	}
 }
 
@@ -165,21 +222,51 @@ void RelayServer::OnDisconnected(const std::shared_ptr<ov::Socket> &remote, Phys
 {
 	logti("RelayClient is disconnected: %s (reason: %d)", remote->ToString().CStr(), reason);
 
-	// remove from _client_list
-	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+	std::shared_ptr<RelaySendQueue> send_queue;
 
-	auto info_iter = _client_list.find(remote.get());
+	{
+		// remove from _client_list
+		std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
 
-	if(info_iter != _client_list.end())
+		auto info_iter = _client_list.find(remote.get());
+
+		if(info_iter != _client_list.end())
+		{
+			send_queue = info_iter->second.send_queue;
+			_client_list.erase(info_iter);
+		}
+	}
+
+	RelayTransportStats transport_stats;
+
+	if(transport_stats.Update(*remote))
 	{
-		_client_list.erase(info_iter);
+		logti("Transport stats of %s - %s", remote->ToString().CStr(), transport_stats.ToString().CStr());
+	}
+
+	if(send_queue != nullptr)
+	{
+		// Wait for the sender thread outside of the lock
+		send_queue->Stop();
+
+		auto stats = send_queue->GetStats();
+
+		logti("Relay stats of %s - sent: %" PRIu64 " frames/%" PRIu64 " bytes, dropped: %" PRIu64 " frames/%" PRIu64 " bytes, overflow: %" PRIu64 ", window overflow: %" PRIu64 ", prioritized: %" PRIu64 " frames, max queued: %zu bytes",
+		      remote->ToString().CStr(),
+		      stats.sent_frames, stats.sent_bytes, stats.dropped_frames, stats.dropped_bytes, stats.overflow_count, stats.window_overflow_count, stats.prioritized_frames, stats.max_queued_bytes);
 	}
 }
 
-void RelayServer::HandleRegister(const std::shared_ptr<ov::Socket> &remote, const RelayPacket &packet)
+void RelayServer::HandleRegister(const std::shared_ptr<ov::Socket> &remote, const RelayFrame &frame)
 {
 	// The relay client wants to be registered on this server for the application
-	ov::String app_name(reinterpret_cast<const char *>(packet.GetData()), packet.GetDataSize());
+	ov::String app_name;
+
+	if(frame.data != nullptr)
+	{
+		app_name = ov::String(frame.data->GetDataAs<char>(), frame.data->GetLength());
+	}
+
 	if(_application_info.GetName() != app_name)
 	{
 		// Cannot handle that application
@@ -188,18 +275,30 @@ void RelayServer::HandleRegister(const std::shared_ptr<ov::Socket> &remote, cons
 		// TODO(dimiden): If multiple RelayServers use the same PhysicalPort, data from other servers can come in here
 		// This situation is not assumed at this time, and packet probe function should be added afterward
 
-		RelayPacket response(RelayPacketType::Error);
-		remote->Send(&response, sizeof(response));
+		RelayFrame response(RelayPacketType::Error);
+		Send(remote, 0, response);
 
 		return;
 	}
 
 	logtd("Registering a relay client %s for application: %s", remote->ToString().CStr(), _application_info.GetName().CStr());
 
+	// Block SendMediaPacket() until the streams and the GOP cache are queued
+	std::lock_guard<std::mutex> gop_cache_lock_guard(_gop_cache_mutex);
+
 	{
 		std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
 
-		_client_list[remote.get()] = ClientInfo();
+		auto info_iter = _client_list.find(remote.get());
+
+		if(info_iter == _client_list.end())
+		{
+			// Disconnected while the Register frame was being handled
+			logtw("Relay client %s is disconnected before registration", remote->ToString().CStr());
+			return;
+		}
+
+		info_iter->second.registered = true;
 	}
 
 	// Send streams to the relay client
@@ -215,139 +314,231 @@ void RelayServer::HandleRegister(const std::shared_ptr<ov::Socket> &remote, cons
 		const auto &stream_info = stream_iter.second->GetStreamInfo();
 
 		SendStream(remote, stream_info);
+
+		// The contexts must be defined before the cached packets
+		SendContexts(remote, stream_info->GetId());
+
+		// The client can start from the last key frame instead of waiting for the next one
+		SendGopCache(remote, stream_info->GetId());
 	}
 }
 
-void RelayServer::Send(info::stream_id_t stream_id, const RelayPacket &base_packet, const ov::Data *data)
+void RelayServer::Send(info::stream_id_t stream_id, RelayFrame &frame, const RelayContext *context)
 {
+	frame.application_id = _application_info.GetId();
+	frame.stream_id = stream_id;
+
+	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+
 	if(_client_list.empty())
 	{
 		// There is no client to send
 		return;
 	}
 
-	uint32_t transaction_id = _transaction_id++;
+	// Serialize only once, and send the same data to every client
+	// (the sender thread of each client splits the data into SRT messages)
+	auto data = frame.Serialize(true, context);
+
+	if(data == nullptr)
+	{
+		return;
+	}
 
-	RelayPacket packet = base_packet;
+	for(auto &client : _client_list)
+	{
+		if(client.second.registered)
+		{
+			client.second.send_queue->Push(frame, data);
+		}
+	}
+}
 
-	packet.SetApplicationId(_application_info.GetId());
-	packet.SetStreamId(stream_id);
-	packet.SetTransactionId(transaction_id);
+void RelayServer::Send(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id, RelayFrame &frame, const RelayContext *context)
+{
+	frame.application_id = _application_info.GetId();
+	frame.stream_id = stream_id;
 
-	packet.SetStart(true);
+	auto data = frame.Serialize(true, context);
 
-	if(data != nullptr)
+	if(data == nullptr)
 	{
-		ov::ByteStream stream(data);
+		return;
+	}
 
-		while(stream.Remained() > 0)
-		{
-			size_t read_bytes = stream.Read(static_cast<uint8_t *>(packet.GetData()), RelayPacketDataSize);
-			packet.SetDataSize(static_cast<uint16_t>(read_bytes));
+	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
 
-			if(stream.Remained() == 0)
-			{
-				packet.SetEnd(true);
-			}
+	auto info_iter = _client_list.find(remote.get());
 
-			{
-				std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+	if(info_iter != _client_list.end())
+	{
+		// Keep the order with the frames in the queue
+		info_iter->second.send_queue->Push(frame, data);
+	}
+}
 
-				for(auto &client : _client_list)
-				{
-					client.first->Send(&packet, sizeof(packet));
-				}
-			}
+std::map<ov::String, RelayServer::ClientStats> RelayServer::GetClientStats()
+{
+	std::map<ov::String, ClientStats> client_stats;
 
-			packet.SetStart(false);
-		}
-	}
-	else
+	std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+
+	for(auto &client : _client_list)
 	{
-		packet.SetEnd(true);
+		auto remote_address = client.first->GetRemoteAddress();
+		auto &stats = client_stats[(remote_address != nullptr) ? remote_address->ToString() : client.first->ToString()];
 
-		{
-			std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
+		stats.send_queue = client.second.send_queue->GetStats();
+		stats.transport.Update(*(client.first));
+	}
 
-			for(auto &client : _client_list)
+	return client_stats;
+}
+
+void RelayServer::SendMediaPacket(const std::shared_ptr<MediaRouteStream> &media_stream, const MediaPacket *packet)
+{
+	auto stream_info = media_stream->GetStreamInfo();
+
+	RelayFrame frame(RelayPacketType::Packet);
+
+	frame.application_id = _application_info.GetId();
+	frame.stream_id = stream_info->GetId();
+	frame.media_type = static_cast<int8_t>(packet->GetMediaType());
+	frame.track_id = static_cast<uint32_t>(packet->GetTrackId());
+	frame.pts = static_cast<uint64_t>(packet->GetPts());
+	frame.flags = static_cast<uint8_t>(packet->GetFlags());
+	frame.fragmentation = *(packet->_frag_hdr);
+	frame.data = packet->GetData();
+
+	std::lock_guard<std::mutex> lock_guard(_gop_cache_mutex);
+
+	Send(stream_info->GetId(), frame, UpdateContext(frame));
+
+	// Keep the packet even if there is no client, for clients that will connect later
+	CacheFrame(frame);
+}
+
+void RelayServer::CacheFrame(const RelayFrame &frame)
+{
+	auto &cache = _gop_cache_list[frame.stream_id];
+	bool is_video = (frame.media_type == static_cast<int8_t>(common::MediaType::Video));
+
+	if(is_video && (frame.flags == static_cast<uint8_t>(MediaPacketFlag::Key)))
+	{
+		// Start a new GOP of this track (the GOPs of the other video tracks are kept)
+		auto new_end = std::remove_if(cache.frames.begin(), cache.frames.end(), [&](const RelayFrame &cached_frame) -> bool
+		{
+			if((cached_frame.media_type == frame.media_type) && (cached_frame.track_id == frame.track_id))
 			{
-				client.first->Send(&packet, sizeof(packet));
+				cache.bytes -= (cached_frame.data != nullptr) ? cached_frame.data->GetLength() : 0;
+				return true;
 			}
+
+			return false;
+		});
+
+		cache.frames.erase(new_end, cache.frames.end());
+
+		// The other frames older than the first cached video frame are not needed
+		auto first_video = std::find_if(cache.frames.begin(), cache.frames.end(), [](const RelayFrame &cached_frame) -> bool
+		{
+			return cached_frame.media_type == static_cast<int8_t>(common::MediaType::Video);
+		});
+
+		for(auto cached_frame = cache.frames.begin(); cached_frame != first_video; ++cached_frame)
+		{
+			cache.bytes -= (cached_frame->data != nullptr) ? cached_frame->data->GetLength() : 0;
 		}
-	}
-}
 
-void RelayServer::Send(info::stream_id_t stream_id, const RelayPacket &base_packet, const void *data, uint16_t data_size)
-{
-	if(_client_list.empty())
+		cache.frames.erase(cache.frames.begin(), first_video);
+		cache.key_frame_tracks.insert(frame.track_id);
+	}
+	else if(is_video ? (cache.key_frame_tracks.count(frame.track_id) == 0) : cache.key_frame_tracks.empty())
 	{
+		// Cannot be decoded without the key frame of the track (audio-only streams are not cached)
 		return;
 	}
 
-	auto data_to_send = ov::Data(data, data_size, true);
+	size_t length = (frame.data != nullptr) ? frame.data->GetLength() : 0;
+
+	if((cache.bytes + length) > RELAY_GOP_CACHE_MAX_BYTES)
+	{
+		logtw("GOP of stream %u exceeds %d bytes, GOP cache is disabled until the next key frame of each track", frame.stream_id, RELAY_GOP_CACHE_MAX_BYTES);
 
-	Send(stream_id, base_packet, &data_to_send);
+		cache.frames.clear();
+		cache.bytes = 0;
+		cache.key_frame_tracks.clear();
+
+		return;
+	}
+
+	cache.frames.push_back(frame);
+	cache.bytes += length;
 }
 
-void RelayServer::Send(const std::shared_ptr<ov::Socket> &socket, info::stream_id_t stream_id, const RelayPacket &base_packet, const ov::Data *data)
+void RelayServer::SendGopCache(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id)
 {
-	uint32_t transaction_id = _transaction_id++;
-
-	RelayPacket packet = base_packet;
+	auto cache = _gop_cache_list.find(stream_id);
 
-	packet.SetApplicationId(_application_info.GetId());
-	packet.SetStreamId(stream_id);
-	packet.SetTransactionId(transaction_id);
+	if((cache == _gop_cache_list.end()) || cache->second.frames.empty())
+	{
+		return;
+	}
 
-	packet.SetStart(true);
+	logtd("Sending %zu cached packets (%zu bytes) of stream %u to %s",
+	      cache->second.frames.size(), cache->second.bytes, stream_id, remote->ToString().CStr());
 
-	if(data != nullptr)
+	for(auto &frame : cache->second.frames)
 	{
-		// separate the data to multiple packets
-		ov::ByteStream stream(data);
+		// application_id and stream_id are already set
+		// (the frames older than the base pts of the context are sent with the full header)
+		auto data = frame.Serialize(true, _context_table.Find(frame));
 
-		while(stream.Remained() > 0)
+		if(data == nullptr)
 		{
-			size_t read_bytes = stream.Read(static_cast<uint8_t *>(packet.GetData()), RelayPacketDataSize);
-			packet.SetDataSize(static_cast<uint16_t>(read_bytes));
+			continue;
+		}
 
-			if(stream.Remained() == 0)
-			{
-				packet.SetEnd(true);
-			}
+		std::lock_guard<std::mutex> lock_guard(_client_list_mutex);
 
-			socket->Send(&packet, sizeof(packet));
+		auto info_iter = _client_list.find(remote.get());
 
-			packet.SetStart(false);
+		if(info_iter == _client_list.end())
+		{
+			// Disconnected
+			return;
 		}
-	}
-	else
-	{
-		packet.SetEnd(true);
 
-		socket->Send(&packet, sizeof(packet));
+		info_iter->second.send_queue->Push(frame, data);
 	}
 }
 
-void RelayServer::SendMediaPacket(const std::shared_ptr<MediaRouteStream> &media_stream, const MediaPacket *packet)
+const RelayContext *RelayServer::UpdateContext(const RelayFrame &frame)
 {
-	if(_client_list.empty())
+	if(_application_info.GetRelay().IsHeaderCompressionEnabled() == false)
 	{
-		// Nothing to do
-		return;
+		return nullptr;
 	}
 
-	auto stream_info = media_stream->GetStreamInfo();
-	auto media_track = stream_info->GetTrack(packet->GetTrackId());
+	bool need_to_define;
+	auto context = _context_table.Update(frame, &need_to_define);
 
-	RelayPacket relay_packet(RelayPacketType::Packet);
+	if(need_to_define)
+	{
+		RelayFrame context_frame = RelayFrame::FromContext(*context);
 
-	relay_packet.SetFragmentHeader(packet->_frag_hdr.get());
+		Send(frame.stream_id, context_frame);
+	}
 
-	relay_packet.SetMediaType(static_cast<int8_t>(packet->GetMediaType()));
-	relay_packet.SetTrackId(static_cast<uint32_t>(packet->GetTrackId()));
-	relay_packet.SetPts(static_cast<uint64_t>(packet->GetPts()));
-	relay_packet.SetFlags(static_cast<uint8_t>(packet->GetFlags()));
+	return context;
+}
 
-	Send(stream_info->GetId(), relay_packet, packet->GetData().get());
+void RelayServer::SendContexts(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id)
+{
+	for(auto context : _context_table.GetContexts(stream_id))
+	{
+		RelayFrame context_frame = RelayFrame::FromContext(*context);
+
+		Send(remote, stream_id, context_frame);
+	}
 }
@@ -9,6 +9,11 @@
 #pragma once
 
 #include "relay_datastructure.h"
+#include "relay_send_queue.h"
+#include "relay_context_table.h"
+#include "relay_transport_stats.h"
+
+#include <set>
 
 #include <base/ovsocket/socket.h>
 #include <base/application/application.h>
@@ -16,6 +21,9 @@
 #include <base/media_route/media_route_application_interface.h>
 #include <base/media_route/media_route_application_observer.h>
 
+// Maximum bytes of the GOP cache for each stream (the cache is disabled until the next key frame if exceeded)
+#define RELAY_GOP_CACHE_MAX_BYTES                       (32 * 1024 * 1024)
+
 class MediaRouteStream;
 
 class RelayServer : public PhysicalPortObserver, public MediaRouteApplicationObserver
@@ -24,18 +32,57 @@ public:
 	explicit RelayServer(MediaRouteApplicationInterface *media_route_application, const info::Application &application_info);
 	~RelayServer() override;
 
-	void Send(info::stream_id_t stream_id, const RelayPacket &base_packet, const ov::Data *data);
-	void Send(info::stream_id_t stream_id, const RelayPacket &base_packet, const void *data, uint16_t data_size);
-	void Send(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id, const RelayPacket &base_packet, const ov::Data *data);
+	// Serializes the frame once and pushes it to the send queue of all registered clients
+	void Send(info::stream_id_t stream_id, RelayFrame &frame, const RelayContext *context = nullptr);
+	void Send(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id, RelayFrame &frame, const RelayContext *context = nullptr);
 	void SendMediaPacket(const std::shared_ptr<MediaRouteStream> &media_stream, const MediaPacket *packet);
 
+	struct ClientStats
+	{
+		RelaySendQueueStats send_queue;
+		// Not updated if the statistics are not available
+		RelayTransportStats transport;
+	};
+
+	// [key: client address]
+	std::map<ov::String, ClientStats> GetClientStats();
+
 protected:
 	struct ClientInfo
 	{
+		// true after the client is registered for this application
+		bool registered = false;
+
+		std::shared_ptr<RelayFrameParser> parser = std::make_shared<RelayFrameParser>(true);
+
+		// Frames are sent by the sender thread of each client, so a slow client does not block the MediaRouter
+		std::shared_ptr<RelaySendQueue> send_queue;
+	};
+
+	// Packets of a stream since the last key frame of each video track
+	// (a stream can have several video tracks, ex: the renditions of the transcoder).
+	// The frames of a video track start with its key frame, and the other frames (audio, ...) start
+	// with the first cached video frame, so every track of the replayed stream can be decoded immediately.
+	// Refers to the data of MediaPacket (not copied), and serialized only when replayed
+	struct GopCache
+	{
+		std::vector<RelayFrame> frames;
+		size_t bytes = 0;
+		// The video tracks of which GOP is cached
+		std::set<uint32_t> key_frame_tracks;
 	};
 
 	void SendStream(const std::shared_ptr<ov::Socket> &remote, const std::shared_ptr<StreamInfo> &stream_info);
 
+	// Must be called with _gop_cache_mutex locked
+	// Returns the context of the track (defines the context if needed), or nullptr if the header compression is not available
+	const RelayContext *UpdateContext(const RelayFrame &frame);
+	void SendContexts(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id);
+
+	// Must be called with _gop_cache_mutex locked
+	void CacheFrame(const RelayFrame &frame);
+	void SendGopCache(const std::shared_ptr<ov::Socket> &remote, info::stream_id_t stream_id);
+
 	//--------------------------------------------------------------------
 	// Implementation of MediaRouteApplicationObserver
 	//--------------------------------------------------------------------
@@ -59,7 +106,7 @@ protected:
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
-	void HandleRegister(const std::shared_ptr<ov::Socket> &remote, const RelayPacket &packet);
+	void HandleRegister(const std::shared_ptr<ov::Socket> &remote, const RelayFrame &frame);
 
 	MediaRouteApplicationInterface *_media_route_application;
 
@@ -70,5 +117,12 @@ protected:
 	std::mutex _client_list_mutex;
 	std::map<ov::Socket *, ClientInfo> _client_list;
 
-	uint32_t _transaction_id = 0;
+	// Also held while sending media packets and registering a client,
+	// so the replayed packets are not mixed with the live packets
+	// (lock order: _gop_cache_mutex -> _client_list_mutex)
+	std::mutex _gop_cache_mutex;
+	std::map<info::stream_id_t, GopCache> _gop_cache_list;
+
+	// Header contexts shared by all clients (protected by _gop_cache_mutex)
+	RelayContextTable _context_table;
 };
\ No newline at end of file
@@ -0,0 +1,46 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_transport_stats.h"
+
+bool RelayTransportStats::Update(const ov::Socket &socket)
+{
+	SRT_TRACEBSTATS stats {};
+
+	if(socket.GetSrtStats(&stats) == false)
+	{
+		return false;
+	}
+
+	rtt_ms = stats.msRTT;
+	bandwidth_mbps = stats.mbpsBandwidth;
+
+	sent_packets = static_cast<uint64_t>(stats.pktSentTotal);
+	received_packets = static_cast<uint64_t>(stats.pktRecvTotal);
+
+	send_lost_packets = static_cast<uint64_t>(stats.pktSndLossTotal);
+	receive_lost_packets = static_cast<uint64_t>(stats.pktRcvLossTotal);
+	retransmitted_packets = static_cast<uint64_t>(stats.pktRetransTotal);
+
+	send_dropped_packets = static_cast<uint64_t>(stats.pktSndDropTotal);
+	receive_dropped_packets = static_cast<uint64_t>(stats.pktRcvDropTotal);
+
+	return true;
+}
+
+ov::String RelayTransportStats::ToString() const
+{
+	return ov::String::FormatString(
+		"rtt: %.1f ms, bandwidth: %.1f Mbps, "
+		"sent: %" PRIu64 " (lost: %" PRIu64 ", retransmitted: %" PRIu64 ", dropped: %" PRIu64 "), "
+		"received: %" PRIu64 " (lost: %" PRIu64 ", dropped: %" PRIu64 ") packets",
+		rtt_ms, bandwidth_mbps,
+		sent_packets, send_lost_packets, retransmitted_packets, send_dropped_packets,
+		received_packets, receive_lost_packets, receive_dropped_packets
+	);
+}
@@ -0,0 +1,39 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket.h>
+
+//--------------------------------------------------------------------
+// RelayTransportStats
+//--------------------------------------------------------------------
+// Loss/retransmission statistics of a relay connection (SRT)
+struct RelayTransportStats
+{
+	// Returns false if the statistics are not available (closed socket)
+	bool Update(const ov::Socket &socket);
+
+	ov::String ToString() const;
+
+	double rtt_ms = 0.0;
+	double bandwidth_mbps = 0.0;
+
+	uint64_t sent_packets = 0;
+	uint64_t received_packets = 0;
+
+	// Packets reported as lost (by the receiver) or detected as lost
+	uint64_t send_lost_packets = 0;
+	uint64_t receive_lost_packets = 0;
+	uint64_t retransmitted_packets = 0;
+
+	// Packets dropped because they could not be delivered within the latency
+	uint64_t send_dropped_packets = 0;
+	uint64_t receive_dropped_packets = 0;
+};
@@ -0,0 +1,27 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Compares the relay wire formats (bytes and CPU) in-process,
+# and relays the frames using RelayServer/RelayClient over a lossy loopback link (-o)
+LOCAL_STATIC_LIBRARIES := \
+	relay \
+	mediarouter \
+	application \
+	physical_port \
+	socket \
+	ovcrypto \
+	config \
+	ovlibrary
+
+LOCAL_PREBUILT_LIBRARIES := \
+	libpugixml.a
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl \
+	`pkg-config --libs srt` \
+	`pkg-config --libs openssl`
+
+LOCAL_TARGET := RelayBench
+
+include $(BUILD_EXECUTABLE)
@@ -0,0 +1,307 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "lossy_link.h"
+
+#include <sys/time.h>
+#include <algorithm>
+
+#define OV_LOG_TAG                  "RelayBench"
+
+// Maximum size of a UDP datagram of SRT
+#define LOSSY_LINK_MAX_DATAGRAM_SIZE        1500
+// Interval of checking the stop flag while receiving (ms)
+#define LOSSY_LINK_RECEIVE_TIMEOUT          100
+// Datagrams are dropped if the link is busy longer than this (queue of a router, ms)
+#define LOSSY_LINK_MAX_QUEUE_DELAY          1000
+
+LossySocket::LossySocket(const LossyLinkOptions &options, unsigned int random_seed)
+	: _options(options),
+	  _random_seed(random_seed)
+{
+}
+
+LossySocket::~LossySocket()
+{
+	Stop();
+}
+
+bool LossySocket::Start()
+{
+	if(_stop == false)
+	{
+		return true;
+	}
+
+	_stop = false;
+	_link_free_time = std::chrono::steady_clock::now();
+
+	try
+	{
+		_thread = std::thread(&LossySocket::SenderThread, this);
+	}
+	catch(const std::system_error &e)
+	{
+		_stop = true;
+		logte("Could not start sender thread of the lossy socket");
+		return false;
+	}
+
+	return true;
+}
+
+void LossySocket::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+		if(_stop)
+		{
+			return;
+		}
+
+		_stop = true;
+	}
+
+	_queue_condition.notify_all();
+
+	if(_thread.joinable())
+	{
+		_thread.join();
+	}
+
+	std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+	_queue.clear();
+}
+
+ssize_t LossySocket::SendTo(const ov::SocketAddress &address, const void *data, size_t length)
+{
+	std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+	if((_options.loss > 0) && ((::rand_r(&_random_seed) % 1000) < static_cast<unsigned int>(_options.loss)))
+	{
+		// Regarded as sent (the datagram is lost in the link)
+		_stats.dropped_datagrams++;
+		return static_cast<ssize_t>(length);
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	auto send_time = now + std::chrono::milliseconds(_options.delay);
+
+	if(_options.bandwidth > 0)
+	{
+		_link_free_time = std::max(_link_free_time, now);
+
+		if((_link_free_time - now) > std::chrono::milliseconds(LOSSY_LINK_MAX_QUEUE_DELAY))
+		{
+			// The queue of the link is full
+			_stats.dropped_datagrams++;
+			return static_cast<ssize_t>(length);
+		}
+
+		// The datagram waits until the link sends the queued datagrams
+		_link_free_time += std::chrono::microseconds(length * 8 * 1000 / _options.bandwidth);
+		send_time = std::max(send_time, _link_free_time);
+	}
+
+	auto buffer = static_cast<const uint8_t *>(data);
+
+	_queue.push_back(Datagram { send_time, address, std::vector<uint8_t>(buffer, buffer + length) });
+	_queue_condition.notify_one();
+
+	return static_cast<ssize_t>(length);
+}
+
+LossySocketStats LossySocket::GetStats()
+{
+	std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+	return _stats;
+}
+
+void LossySocket::SenderThread()
+{
+	std::unique_lock<std::mutex> lock(_queue_mutex);
+
+	while(true)
+	{
+		_queue_condition.wait(lock, [this]() -> bool
+		{
+			return _stop || (_queue.empty() == false);
+		});
+
+		if(_stop)
+		{
+			break;
+		}
+
+		// The send times are in order (the delay is constant)
+		auto send_time = _queue.front().send_time;
+
+		if(std::chrono::steady_clock::now() < send_time)
+		{
+			_queue_condition.wait_until(lock, send_time);
+			continue;
+		}
+
+		auto datagram = std::move(_queue.front());
+		_queue.pop_front();
+
+		lock.unlock();
+		ssize_t sent = ov::Socket::SendTo(datagram.address, datagram.data.data(), datagram.data.size());
+		lock.lock();
+
+		if(sent > 0)
+		{
+			_stats.sent_datagrams++;
+			_stats.sent_bytes += static_cast<uint64_t>(sent);
+		}
+	}
+}
+
+LossyLink::LossyLink(const LossyLinkOptions &options)
+	: _client_side(options, 1),
+	  _server_side(options, 2)
+{
+}
+
+LossyLink::~LossyLink()
+{
+	Stop();
+}
+
+bool LossyLink::Start(const ov::SocketAddress &listen_address, const ov::SocketAddress &server_address)
+{
+	if(_stop == false)
+	{
+		return true;
+	}
+
+	_server_address = server_address;
+
+	timeval timeout { 0, LOSSY_LINK_RECEIVE_TIMEOUT * 1000 };
+
+	bool result = _client_side.Create(ov::SocketType::Udp) &&
+	              _client_side.SetSockOpt(SO_RCVTIMEO, timeout) &&
+	              _client_side.Bind(listen_address) &&
+	              _server_side.Create(ov::SocketType::Udp) &&
+	              _server_side.SetSockOpt(SO_RCVTIMEO, timeout) &&
+	              _server_side.Bind(ov::SocketAddress(static_cast<uint16_t>(0))) &&
+	              _client_side.Start() &&
+	              _server_side.Start();
+
+	if(result == false)
+	{
+		logte("Could not start the lossy link on %s", listen_address.ToString().CStr());
+
+		_client_side.Stop();
+		_server_side.Stop();
+		_client_side.Close();
+		_server_side.Close();
+
+		return false;
+	}
+
+	_stop = false;
+
+	_upstream_thread = std::thread(&LossyLink::ForwardThread, this, true);
+	_downstream_thread = std::thread(&LossyLink::ForwardThread, this, false);
+
+	return true;
+}
+
+void LossyLink::Stop()
+{
+	if(_stop)
+	{
+		return;
+	}
+
+	_stop = true;
+
+	// The threads check the stop flag every LOSSY_LINK_RECEIVE_TIMEOUT
+	if(_upstream_thread.joinable())
+	{
+		_upstream_thread.join();
+	}
+
+	if(_downstream_thread.joinable())
+	{
+		_downstream_thread.join();
+	}
+
+	_client_side.Stop();
+	_server_side.Stop();
+	_client_side.Close();
+	_server_side.Close();
+}
+
+LossySocketStats LossyLink::GetUpstreamStats()
+{
+	return _server_side.GetStats();
+}
+
+LossySocketStats LossyLink::GetDownstreamStats()
+{
+	return _client_side.GetStats();
+}
+
+void LossyLink::ForwardThread(bool is_upstream)
+{
+	LossySocket &from = is_upstream ? _client_side : _server_side;
+	LossySocket &to = is_upstream ? _server_side : _client_side;
+
+	auto data = std::make_shared<ov::Data>(LOSSY_LINK_MAX_DATAGRAM_SIZE);
+
+	while(_stop == false)
+	{
+		std::shared_ptr<ov::SocketAddress> address;
+
+		auto error = from.RecvFrom(data, &address);
+
+		if(error != nullptr)
+		{
+			logte("Could not receive from the %s: %s", is_upstream ? "client" : "server", error->ToString().CStr());
+			break;
+		}
+
+		if(data->GetLength() == 0)
+		{
+			// Timed out
+			continue;
+		}
+
+		if(is_upstream)
+		{
+			{
+				// The server sends to the last client address
+				std::lock_guard<std::mutex> lock_guard(_client_address_mutex);
+
+				_client_address = address;
+			}
+
+			to.SendTo(_server_address, data);
+		}
+		else
+		{
+			std::shared_ptr<ov::SocketAddress> client_address;
+
+			{
+				std::lock_guard<std::mutex> lock_guard(_client_address_mutex);
+
+				client_address = _client_address;
+			}
+
+			if(client_address != nullptr)
+			{
+				to.SendTo(*client_address, data);
+			}
+		}
+	}
+}
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket.h>
+
+struct LossyLinkOptions
+{
+	// Loss rate of the datagrams (per mille)
+	int loss = 0;
+	// One-way delay (ms)
+	int delay = 0;
+	// Bandwidth of each direction (kbps), 0 for unlimited
+	// (the datagrams that cannot be sent within a second are dropped)
+	int bandwidth = 0;
+};
+
+struct LossySocketStats
+{
+	uint64_t sent_datagrams = 0;
+	uint64_t sent_bytes = 0;
+	uint64_t dropped_datagrams = 0;
+};
+
+//--------------------------------------------------------------------
+// LossySocket
+//--------------------------------------------------------------------
+// UDP socket that drops or delays the datagrams sent by SendTo() to emulate a lossy long-haul link.
+// The datagrams that are not dropped are sent by a sender thread after the delay,
+// and no faster than the bandwidth (the datagrams are queued while the link is busy).
+class LossySocket : public ov::Socket
+{
+public:
+	explicit LossySocket(const LossyLinkOptions &options, unsigned int random_seed);
+	~LossySocket() override;
+
+	bool Start();
+	void Stop();
+
+	using ov::Socket::SendTo;
+	ssize_t SendTo(const ov::SocketAddress &address, const void *data, size_t length) override;
+
+	LossySocketStats GetStats();
+
+protected:
+	struct Datagram
+	{
+		std::chrono::steady_clock::time_point send_time;
+		ov::SocketAddress address;
+		std::vector<uint8_t> data;
+	};
+
+	void SenderThread();
+
+	LossyLinkOptions _options;
+	unsigned int _random_seed;
+
+	std::mutex _queue_mutex;
+	std::condition_variable _queue_condition;
+	std::deque<Datagram> _queue;
+	// The time when the link can send the next datagram (bandwidth)
+	std::chrono::steady_clock::time_point _link_free_time;
+
+	LossySocketStats _stats;
+
+	bool _stop = true;
+	std::thread _thread;
+};
+
+//--------------------------------------------------------------------
+// LossyLink
+//--------------------------------------------------------------------
+// Forwards the UDP datagrams of a SRT connection between a client (edge) and a server (origin) using LossySockets,
+// so the real SRT stack of both sides handles the loss (retransmission, too-late drop) and the delay (send buffer).
+// The client connects to the listen address instead of the server address.
+class LossyLink
+{
+public:
+	explicit LossyLink(const LossyLinkOptions &options);
+	~LossyLink();
+
+	bool Start(const ov::SocketAddress &listen_address, const ov::SocketAddress &server_address);
+	void Stop();
+
+	// Datagrams from the client to the server
+	LossySocketStats GetUpstreamStats();
+	// Datagrams from the server to the client
+	LossySocketStats GetDownstreamStats();
+
+protected:
+	void ForwardThread(bool is_upstream);
+
+	ov::SocketAddress _server_address;
+
+	// Receives from the client, and sends to the client
+	LossySocket _client_side;
+	// Receives from the server, and sends to the server
+	LossySocket _server_side;
+
+	std::mutex _client_address_mutex;
+	std::shared_ptr<ov::SocketAddress> _client_address;
+
+	volatile bool _stop = true;
+	std::thread _upstream_thread;
+	std::thread _downstream_thread;
+};
@@ -0,0 +1,225 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+
+#include <srt/srt.h>
+
+#include "relay_bench.h"
+
+#define OV_LOG_TAG                  "RelayBench"
+
+// IP(20) + UDP(8) + SRT(16) header of each message
+#define RELAY_BENCH_MESSAGE_OVERHEAD        44
+
+static void PrintUsage(const char *program)
+{
+	printf("Usage: %s [OPTION]...\n", program);
+	printf("    -n <count>    Stream count (default: 10)\n");
+	printf("    -d <sec>      Synthetic media duration (default: 10)\n");
+	printf("    -b <kbps>     Video bitrate (default: 2500)\n");
+	printf("    -a <kbps>     Audio bitrate (default: 128)\n");
+	printf("    -F <fps>      Frame rate (default: 30)\n");
+	printf("    -g <frames>   GOP size (default: 60)\n");
+	printf("    -l <count>    Iteration count (default: 3)\n");
+	printf("    -L <permille> Message loss rate (default: 0)\n");
+	printf("    -o            Relays the frames using RelayServer/RelayClient over a lossy loopback link\n");
+	printf("    -p <port>     Port of the relay server, the link uses port + 1 (default: 19000)\n");
+	printf("    -D <ms>       One-way delay of the link (default: 0)\n");
+	printf("    -B <kbps>     Bandwidth of the link (default: 0, unlimited)\n");
+	printf("    -T <ms>       SRT latency of the relay client (default: 0, SRT default)\n");
+	printf("    -R <KB>       SRT receive buffer size of the relay client (default: 0, SRT default)\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], RelayBenchOptions *options)
+{
+	constexpr const char *opt_string = "hn:d:b:a:F:g:l:L:op:D:B:T:R:";
+
+	while(true)
+	{
+		int name = getopt(argc, argv, opt_string);
+
+		switch(name)
+		{
+			case -1:
+				return true;
+
+			case 'n':
+				options->stream_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'd':
+				options->duration = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'b':
+				options->video_bitrate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'a':
+				options->audio_bitrate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'F':
+				options->frame_rate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'g':
+				options->gop = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'l':
+				options->iteration_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'L':
+				options->loss = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'o':
+				options->loopback = true;
+				break;
+
+			case 'p':
+				options->port = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'D':
+				options->delay = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'B':
+				options->bandwidth = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'T':
+				options->latency = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'R':
+				options->receive_buffer_size = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'h':
+			default:
+				PrintUsage(argv[0]);
+				return false;
+		}
+	}
+}
+
+static int RunLoopback(RelayBench *bench, const RelayBenchOptions &options)
+{
+	printf("source : %d streams, %d sec, video %d kbps (%d fps, GOP %d), audio %d kbps\n",
+	       options.stream_count, options.duration,
+	       options.video_bitrate, options.frame_rate, options.gop, options.audio_bitrate);
+	printf("link   : %.1f%% datagram loss, %d ms delay, %d kbps (0: unlimited), SRT latency %d ms, receive buffer %d KB (0: default)\n",
+	       options.loss / 10.0, options.delay, options.bandwidth, options.latency, options.receive_buffer_size);
+
+	srt_startup();
+
+	RelayBenchResult result;
+	RelayLoopbackStats stats;
+
+	bool is_matched = bench->RunLoopback(&result, &stats);
+
+	srt_cleanup();
+
+	// Frames that are not delivered, or delivered with the wrong data
+	uint64_t lost_frame_count = result.frame_count - (result.delivered_frame_count - result.corrupted_frame_count);
+
+	printf("frames : %" PRIu64 " sent, %" PRIu64 " delivered, %" PRIu64 " lost, %" PRIu64 " corrupted%s\n",
+	       result.frame_count, result.delivered_frame_count, lost_frame_count, result.corrupted_frame_count,
+	       is_matched ? "" : " (MISMATCH)");
+	printf("queue  : %" PRIu64 " frames (%" PRIu64 " bytes) sent, %" PRIu64 " frames (%" PRIu64 " bytes) dropped, %" PRIu64 " overflows, max queued %zu bytes\n",
+	       stats.send_queue.sent_frames, stats.send_queue.sent_bytes,
+	       stats.send_queue.dropped_frames, stats.send_queue.dropped_bytes,
+	       stats.send_queue.overflow_count, stats.send_queue.max_queued_bytes);
+	printf("srt    : %s\n", stats.transport.ToString().CStr());
+	printf("link   : upstream %" PRIu64 " datagrams (%" PRIu64 " dropped), downstream %" PRIu64 " datagrams (%" PRIu64 " bytes, %" PRIu64 " dropped)\n",
+	       stats.upstream.sent_datagrams, stats.upstream.dropped_datagrams,
+	       stats.downstream.sent_datagrams, stats.downstream.sent_bytes, stats.downstream.dropped_datagrams);
+
+	return is_matched ? 0 : 2;
+}
+
+int main(int argc, char *argv[])
+{
+	RelayBenchOptions options;
+
+	if(TryParseOption(argc, argv, &options) == false)
+	{
+		return 1;
+	}
+
+	// The receiver logs a warning for every lost message
+	ov_log_set_level((options.loss > 0) ? OVLogLevelError : OVLogLevelWarning);
+
+	RelayBench bench(options);
+
+	bench.Synthesize();
+
+	if(options.loopback)
+	{
+		return RunLoopback(&bench, options);
+	}
+
+	printf("source : %d streams, %d sec, video %d kbps (%d fps, GOP %d), audio %d kbps, %d iterations, %.1f%% message loss\n",
+	       options.stream_count, options.duration,
+	       options.video_bitrate, options.frame_rate, options.gop, options.audio_bitrate,
+	       options.iteration_count, options.loss / 10.0);
+	printf("%-8s %12s %10s %10s %12s %10s %10s %10s %10s %10s\n",
+	       "format", "sent bytes", "overhead", "messages", "wire bytes", "send ms", "recv ms", "ns/frame", "lost", "corrupted");
+
+	int exit_code = 0;
+
+	for(auto format : { RelayBenchFormat::Legacy, RelayBenchFormat::Frame, RelayBenchFormat::Compact, RelayBenchFormat::Context })
+	{
+		RelayBenchResult result;
+		double send_seconds = 0.0;
+		double receive_seconds = 0.0;
+		bool is_matched = true;
+
+		for(int iteration = 0; iteration < std::max(options.iteration_count, 1); iteration++)
+		{
+			is_matched = bench.Run(format, &result) && is_matched;
+
+			send_seconds += result.send_seconds;
+			receive_seconds += result.receive_seconds;
+		}
+
+		int iteration_count = std::max(options.iteration_count, 1);
+
+		send_seconds /= iteration_count;
+		receive_seconds /= iteration_count;
+
+		uint64_t overhead_bytes = result.sent_bytes - result.payload_bytes;
+		uint64_t wire_bytes = result.sent_bytes + result.message_count * RELAY_BENCH_MESSAGE_OVERHEAD;
+
+		// Frames that are not delivered, or delivered with the wrong data
+		uint64_t lost_frame_count = result.frame_count - (result.delivered_frame_count - result.corrupted_frame_count);
+
+		printf("%-8s %12" PRIu64 " %9.2f%% %10" PRIu64 " %12" PRIu64 " %10.2f %10.2f %10.1f %10" PRIu64 " %10" PRIu64 "%s\n",
+		       RelayBench::GetFormatName(format),
+		       result.sent_bytes,
+		       overhead_bytes * 100.0 / std::max<uint64_t>(result.payload_bytes, 1),
+		       result.message_count,
+		       wire_bytes,
+		       send_seconds * 1000.0, receive_seconds * 1000.0,
+		       (send_seconds + receive_seconds) * 1000000000.0 / std::max<uint64_t>(result.frame_count, 1),
+		       lost_frame_count, result.corrupted_frame_count,
+		       is_matched ? "" : " (MISMATCH)");
+
+		if(is_matched == false)
+		{
+			exit_code = 2;
+		}
+	}
+
+	return exit_code;
+}
@@ -0,0 +1,430 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_bench.h"
+
+#include <time.h>
+#include <algorithm>
+#include <map>
+
+#include <base/media_route/media_buffer.h>
+#include <base/ovsocket/socket.h>
+#include <relay/relay_context_table.h>
+
+#define OV_LOG_TAG                  "RelayBench"
+
+// Layout of RelayPacket used before RelayFrame (every packet is sent as a message of sizeof(LegacyRelayPacket))
+constexpr const int LegacyRelayPacketDataSize = 1200;
+
+#pragma pack(push, 1)
+struct LegacyRelayPacket
+{
+	uint32_t transaction_id;
+	uint8_t start_indicator;
+	uint8_t end_indicator;
+	RelayPacketType type;
+	uint32_t application_id;
+	uint32_t stream_id;
+	int8_t media_type;
+	uint32_t track_id;
+	uint64_t pts;
+	uint8_t flags;
+	FragmentationHeader frag_header;
+	uint16_t data_size;
+	uint8_t data[LegacyRelayPacketDataSize];
+};
+#pragma pack(pop)
+
+static double GetCpuTime()
+{
+	timespec time {};
+
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+	return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+RelayBench::RelayBench(const RelayBenchOptions &options)
+	: _options(options)
+{
+}
+
+const char *RelayBench::GetFormatName(RelayBenchFormat format)
+{
+	switch(format)
+	{
+		case RelayBenchFormat::Legacy:
+			return "legacy";
+
+		case RelayBenchFormat::Frame:
+			return "frame";
+
+		case RelayBenchFormat::Compact:
+			return "compact";
+
+		case RelayBenchFormat::Context:
+			return "context";
+	}
+
+	return "unknown";
+}
+
+void RelayBench::Synthesize()
+{
+	struct Event
+	{
+		double time;
+		RelayFrame frame;
+	};
+
+	int frame_rate = std::max(_options.frame_rate, 1);
+	int gop = std::max(_options.gop, 1);
+
+	// A key frame is 8 times larger than the other frames
+	size_t video_frame_size = std::max<size_t>(static_cast<size_t>(_options.video_bitrate) * 1000 / 8 * gop / frame_rate / (gop - 1 + 8), 64);
+	size_t key_frame_size = video_frame_size * 8;
+	// AAC (1024 samples per frame, 48 kHz)
+	size_t audio_frame_size = std::max<size_t>(static_cast<size_t>(_options.audio_bitrate) * 1000 / 8 * 1024 / 48000, 8);
+
+	_buffer.resize(std::max(key_frame_size, audio_frame_size));
+
+	for(size_t index = 0; index < _buffer.size(); index++)
+	{
+		_buffer[index] = static_cast<uint8_t>(::rand());
+	}
+
+	std::vector<Event> events;
+
+	int video_frame_count = _options.duration * frame_rate;
+	int audio_frame_count = _options.duration * 48000 / 1024;
+
+	for(int stream_index = 0; stream_index < _options.stream_count; stream_index++)
+	{
+		// Spread the frames of the streams
+		double offset = static_cast<double>(stream_index) / frame_rate / _options.stream_count;
+
+		RelayFrame frame(RelayPacketType::Packet);
+
+		frame.application_id = 1;
+		frame.stream_id = static_cast<uint32_t>(stream_index + 1);
+
+		for(int index = 0; index < video_frame_count; index++)
+		{
+			bool is_key_frame = ((index % gop) == 0);
+			size_t size = is_key_frame ? key_frame_size : video_frame_size;
+			auto &fragmentation = frame.fragmentation;
+
+			frame.media_type = static_cast<int8_t>(common::MediaType::Video);
+			frame.track_id = 0;
+			frame.pts = static_cast<uint64_t>(index) * 90000 / frame_rate;
+			frame.flags = static_cast<uint8_t>(is_key_frame ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag);
+
+			if(is_key_frame)
+			{
+				// SPS + PPS + IDR
+				fragmentation.fragmentation_vector_size = 3;
+				fragmentation.fragmentation_offset[0] = 4;
+				fragmentation.fragmentation_length[0] = 20;
+				fragmentation.fragmentation_offset[1] = 28;
+				fragmentation.fragmentation_length[1] = 8;
+				fragmentation.fragmentation_offset[2] = 40;
+				fragmentation.fragmentation_length[2] = size - 40;
+			}
+			else
+			{
+				fragmentation.fragmentation_vector_size = 1;
+				fragmentation.fragmentation_offset[0] = 4;
+				fragmentation.fragmentation_length[0] = size - 4;
+			}
+
+			frame.data = std::make_shared<ov::Data>(_buffer.data(), size, true);
+
+			events.push_back(Event { offset + static_cast<double>(index) / frame_rate, frame });
+		}
+
+		frame.fragmentation = FragmentationHeader();
+
+		for(int index = 0; index < audio_frame_count; index++)
+		{
+			frame.media_type = static_cast<int8_t>(common::MediaType::Audio);
+			frame.track_id = 1;
+			frame.pts = static_cast<uint64_t>(index) * 1024;
+			frame.flags = static_cast<uint8_t>(MediaPacketFlag::Key);
+			frame.data = std::make_shared<ov::Data>(_buffer.data(), audio_frame_size, true);
+
+			events.push_back(Event { offset + index * 1024.0 / 48000.0, frame });
+		}
+	}
+
+	std::stable_sort(events.begin(), events.end(), [](const Event &event1, const Event &event2) -> bool
+	{
+		return event1.time < event2.time;
+	});
+
+	_frames.clear();
+	_frames.reserve(events.size());
+	_frame_index.clear();
+
+	for(auto &event : events)
+	{
+		auto &frame = event.frame;
+
+		_frame_index[std::make_tuple(frame.stream_id, frame.track_id, frame.pts)] = _frames.size();
+		_frames.push_back(frame);
+	}
+}
+
+bool RelayBench::Run(RelayBenchFormat format, RelayBenchResult *result)
+{
+	*result = RelayBenchResult();
+
+	for(auto &frame : _frames)
+	{
+		result->payload_bytes += frame.data->GetLength();
+	}
+
+	result->frame_count = _frames.size();
+
+	// Every format loses the same messages
+	_random_seed = 1;
+	_received_frames.clear();
+	_received_frames.reserve(_frames.size());
+
+	if(format == RelayBenchFormat::Legacy)
+	{
+		RunLegacy(result);
+	}
+	else
+	{
+		RunFrame(format, result);
+	}
+
+	Verify(result);
+
+	return result->is_matched;
+}
+
+bool RelayBench::IsLost()
+{
+	return (_options.loss > 0) && ((::rand_r(&_random_seed) % 1000) < _options.loss);
+}
+
+void RelayBench::OnFrameReceived(uint32_t stream_id, uint32_t track_id, uint64_t pts, uint8_t flags, const void *data, size_t length, bool is_data_matched)
+{
+	// MediaPacket copies the data
+	auto media_data = std::make_shared<ov::Data>(data, length);
+
+	_received_frames.push_back(ReceivedFrame { stream_id, track_id, pts, flags, media_data->GetLength(), is_data_matched });
+}
+
+void RelayBench::Verify(RelayBenchResult *result) const
+{
+	result->delivered_frame_count = _received_frames.size();
+
+	for(auto &received_frame : _received_frames)
+	{
+		auto frame_index = _frame_index.find(std::make_tuple(received_frame.stream_id, received_frame.track_id, received_frame.pts));
+
+		if((frame_index == _frame_index.end()) ||
+		   (_frames[frame_index->second].flags != received_frame.flags) ||
+		   (_frames[frame_index->second].data->GetLength() != received_frame.length) ||
+		   (received_frame.is_data_matched == false))
+		{
+			result->corrupted_frame_count++;
+		}
+	}
+
+	// The frames that cannot be sent within the bandwidth of the link are dropped
+	bool is_lossy = (_options.loss > 0) || (_options.loopback && (_options.bandwidth > 0));
+
+	result->is_matched = (result->corrupted_frame_count == 0) &&
+	                     (is_lossy || (result->delivered_frame_count == result->frame_count));
+}
+
+void RelayBench::RunLegacy(RelayBenchResult *result)
+{
+	//--------------------------------------------------------------------
+	// Sender (RelayServer::Send() before RelayFrame)
+	//--------------------------------------------------------------------
+	std::vector<uint8_t> output;
+	uint32_t transaction_id = 0;
+
+	double start_time = GetCpuTime();
+
+	for(auto &frame : _frames)
+	{
+		LegacyRelayPacket packet {};
+
+		packet.type = frame.type;
+		packet.application_id = ov::HostToBE32(frame.application_id);
+		packet.stream_id = ov::HostToBE32(frame.stream_id);
+		packet.media_type = frame.media_type;
+		packet.track_id = ov::HostToBE32(frame.track_id);
+		packet.pts = ov::HostToBE64(frame.pts);
+		packet.flags = frame.flags;
+		::memcpy(&(packet.frag_header), &(frame.fragmentation), sizeof(packet.frag_header));
+
+		transaction_id++;
+
+		auto data = frame.data->GetDataAs<uint8_t>();
+		size_t remained = frame.data->GetLength();
+		bool is_first = true;
+
+		do
+		{
+			size_t length = std::min<size_t>(remained, LegacyRelayPacketDataSize);
+
+			packet.transaction_id = transaction_id;
+			packet.start_indicator = static_cast<uint8_t>(is_first ? 1 : 0);
+			packet.end_indicator = static_cast<uint8_t>((length == remained) ? 1 : 0);
+			packet.data_size = ov::HostToBE16(static_cast<uint16_t>(length));
+			::memcpy(packet.data, data, length);
+
+			auto packet_data = reinterpret_cast<const uint8_t *>(&packet);
+			output.insert(output.end(), packet_data, packet_data + sizeof(packet));
+
+			data += length;
+			remained -= length;
+			is_first = false;
+		} while(remained > 0);
+	}
+
+	result->send_seconds = GetCpuTime() - start_time;
+	result->sent_bytes = output.size();
+	result->message_count = output.size() / sizeof(LegacyRelayPacket);
+
+	//--------------------------------------------------------------------
+	// Receiver (RelayClient::HandleData() before RelayFrame)
+	//--------------------------------------------------------------------
+	struct Transaction
+	{
+		uint32_t transaction_id = 0;
+		uint64_t pts = 0;
+		uint8_t flags = 0;
+		ov::Data data;
+	};
+
+	// [key: (stream id, track id)]
+	std::map<std::pair<uint32_t, uint32_t>, Transaction> transactions;
+
+	start_time = GetCpuTime();
+
+	for(size_t offset = 0; offset < output.size(); offset += sizeof(LegacyRelayPacket))
+	{
+		if(IsLost())
+		{
+			result->lost_message_count++;
+			continue;
+		}
+
+		LegacyRelayPacket packet;
+		::memcpy(&packet, output.data() + offset, sizeof(packet));
+
+		uint32_t stream_id = ov::BE32ToHost(packet.stream_id);
+		uint32_t track_id = ov::BE32ToHost(packet.track_id);
+		auto &transaction = transactions[std::make_pair(stream_id, track_id)];
+		bool is_different_packet = (packet.transaction_id != transaction.transaction_id);
+
+		if(is_different_packet == false)
+		{
+			transaction.data.Append(packet.data, ov::BE16ToHost(packet.data_size));
+		}
+
+		// The previous packet is delivered even if the end of the packet is lost
+		if(((packet.end_indicator == 1) || is_different_packet) && (transaction.data.GetLength() > 0))
+		{
+			OnFrameReceived(stream_id, track_id, transaction.pts, transaction.flags, transaction.data.GetData(), transaction.data.GetLength());
+			transaction.data.Clear();
+		}
+
+		if(is_different_packet)
+		{
+			transaction.transaction_id = packet.transaction_id;
+			transaction.pts = ov::BE64ToHost(packet.pts);
+			transaction.flags = packet.flags;
+			transaction.data.Append(packet.data, ov::BE16ToHost(packet.data_size));
+
+			if(packet.end_indicator == 1)
+			{
+				OnFrameReceived(stream_id, track_id, transaction.pts, transaction.flags, transaction.data.GetData(), transaction.data.GetLength());
+				transaction.data.Clear();
+			}
+		}
+	}
+
+	result->receive_seconds = GetCpuTime() - start_time;
+}
+
+void RelayBench::RunFrame(RelayBenchFormat format, RelayBenchResult *result)
+{
+	//--------------------------------------------------------------------
+	// Sender (RelayServer::SendMediaPacket())
+	//--------------------------------------------------------------------
+	std::vector<std::shared_ptr<ov::Data>> outputs;
+	RelayContextTable context_table;
+
+	outputs.reserve(_frames.size() * 2);
+
+	double start_time = GetCpuTime();
+
+	for(auto &frame : _frames)
+	{
+		const RelayContext *context = nullptr;
+
+		if(format == RelayBenchFormat::Context)
+		{
+			bool need_to_define;
+
+			context = context_table.Update(frame, &need_to_define);
+
+			if(need_to_define)
+			{
+				outputs.push_back(RelayFrame::FromContext(*context).Serialize());
+			}
+		}
+
+		outputs.push_back(frame.Serialize(format != RelayBenchFormat::Frame, context));
+	}
+
+	result->send_seconds = GetCpuTime() - start_time;
+
+	//--------------------------------------------------------------------
+	// Receiver (RelayClient)
+	//--------------------------------------------------------------------
+	RelayMessageWriter message_writer(ov::MaxSrtPacketSize);
+	RelayFrameParser parser(true);
+
+	start_time = GetCpuTime();
+
+	for(auto &output : outputs)
+	{
+		// The sender thread of RelaySendQueue splits the data into SRT messages
+		message_writer.Write(output.get(), [&](const void *message_data, size_t message_length) -> bool
+		{
+			result->sent_bytes += message_length;
+			result->message_count++;
+
+			if(IsLost())
+			{
+				result->lost_message_count++;
+				return true;
+			}
+
+			ov::Data message(message_data, message_length, true);
+
+			parser.Parse(&message, [&](const RelayFrame &frame) -> void
+			{
+				OnFrameReceived(frame.stream_id, frame.track_id, frame.pts, frame.flags, frame.data->GetData(), frame.data->GetLength());
+			});
+
+			return true;
+		});
+	}
+
+	result->receive_seconds = GetCpuTime() - start_time;
+}
@@ -0,0 +1,152 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <relay/relay_datastructure.h>
+#include <relay/relay_send_queue.h>
+#include <relay/relay_transport_stats.h>
+
+#include "lossy_link.h"
+
+struct RelayBenchOptions
+{
+	int stream_count = 10;
+	// Synthetic media duration (seconds)
+	int duration = 10;
+	int video_bitrate = 2500;
+	int audio_bitrate = 128;
+	int frame_rate = 30;
+	int gop = 60;
+	int iteration_count = 3;
+	// Message loss rate (per mille) of the channel between the sender and the receiver
+	// (the loss rate of the datagrams in the loopback mode)
+	int loss = 0;
+
+	// Relays the frames in real time using RelayServer and RelayClient (SRT over loopback) through a LossyLink
+	bool loopback = false;
+	// Port of the relay server (the link listens on port + 1)
+	int port = 19000;
+	// One-way delay (ms) and bandwidth (kbps, 0 for unlimited) of the link
+	int delay = 0;
+	int bandwidth = 0;
+	// SRT latency (ms) and receive buffer size (KB) of the relay client, 0 to use the default of SRT
+	int latency = 0;
+	int receive_buffer_size = 0;
+};
+
+enum class RelayBenchFormat
+{
+	// Fixed-size RelayPacket (1200 bytes of data per packet), used before RelayFrame
+	Legacy,
+	// RelayFrame with RelayPacketHeader
+	Frame,
+	// RelayFrame with RelayCompactPacketHeader for audio frames
+	Compact,
+	// RelayFrame with RelayContextPacketHeader (header compression)
+	Context
+};
+
+struct RelayBenchResult
+{
+	uint64_t frame_count = 0;
+	uint64_t delivered_frame_count = 0;
+
+	// Bytes of the media data
+	uint64_t payload_bytes = 0;
+	// Bytes passed to the socket
+	uint64_t sent_bytes = 0;
+	// SRT messages (MaxSrtPacketSize bytes at most)
+	uint64_t message_count = 0;
+	// Messages dropped by the channel
+	uint64_t lost_message_count = 0;
+	// Frames delivered with the wrong data (due to the message loss)
+	uint64_t corrupted_frame_count = 0;
+
+	// CPU time of the sender/receiver (serialization/parsing)
+	double send_seconds = 0.0;
+	double receive_seconds = 0.0;
+
+	// false if a frame is corrupted, or not delivered without the message loss
+	bool is_matched = true;
+};
+
+// Statistics of the loopback mode
+struct RelayLoopbackStats
+{
+	RelaySendQueueStats send_queue;
+	RelayTransportStats transport;
+
+	// Datagrams from the relay client to the relay server
+	LossySocketStats upstream;
+	// Datagrams from the relay server to the relay client
+	LossySocketStats downstream;
+};
+
+//--------------------------------------------------------------------
+// RelayBench
+//--------------------------------------------------------------------
+// Relays synthetic media frames of several streams (multiplexed in one connection) from a sender to a receiver
+// in the same thread, without the network.
+// The serialized data is split into SRT messages by RelayMessageWriter, and the receiver parses each message.
+// Messages can be dropped to see how each format handles the loss of SRT live mode (too late packets are dropped).
+//
+// RunLoopback() relays the frames in real time from a RelayServer to a RelayClient instead,
+// using SRT over loopback through a LossyLink, so the SRT options of the client, the retransmission,
+// and the send buffer of the server (Socket::WaitForSrtSendBuffer()) are exercised with the loss/delay of the link.
+class RelayBench
+{
+public:
+	explicit RelayBench(const RelayBenchOptions &options);
+
+	void Synthesize();
+	bool Run(RelayBenchFormat format, RelayBenchResult *result);
+	// srt_startup() must be called before
+	bool RunLoopback(RelayBenchResult *result, RelayLoopbackStats *stats);
+
+	static const char *GetFormatName(RelayBenchFormat format);
+
+protected:
+	struct ReceivedFrame
+	{
+		uint32_t stream_id;
+		uint32_t track_id;
+		uint64_t pts;
+		uint8_t flags;
+		size_t length;
+		bool is_data_matched;
+	};
+
+	void RunLegacy(RelayBenchResult *result);
+	void RunFrame(RelayBenchFormat format, RelayBenchResult *result);
+
+	bool IsLost();
+	// is_data_matched: false if the data is not the same as the data sent (checked only in the loopback mode)
+	void OnFrameReceived(uint32_t stream_id, uint32_t track_id, uint64_t pts, uint8_t flags, const void *data, size_t length, bool is_data_matched = true);
+
+	// Compares the received frames with the frames sent (outside of the measurement)
+	void Verify(RelayBenchResult *result) const;
+
+	RelayBenchOptions _options;
+	unsigned int _random_seed = 0;
+
+	// Media data is shared by the frames (RelayFrame::data refers to this buffer)
+	std::vector<uint8_t> _buffer;
+	std::vector<RelayFrame> _frames;
+	// [key: (stream id, track id, pts), value: index of _frames]
+	std::map<std::tuple<uint32_t, uint32_t, uint64_t>, size_t> _frame_index;
+
+	std::vector<ReceivedFrame> _received_frames;
+	// Frames are received by the thread of RelayClient in the loopback mode
+	std::mutex _received_frames_mutex;
+};
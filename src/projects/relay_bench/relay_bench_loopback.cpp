@@ -0,0 +1,336 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "relay_bench.h"
+
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <base/application/application.h>
+#include <base/media_route/media_buffer.h>
+#include <media_router/media_route_application.h>
+#include <media_router/media_route_stream.h>
+#include <relay/relay_client.h>
+#include <relay/relay_server.h>
+
+#define OV_LOG_TAG                  "RelayBench"
+
+#define RELAY_BENCH_APPLICATION_NAME        "relay_bench"
+// Maximum time to wait until the relay client receives all streams (ms)
+#define RELAY_BENCH_CONNECT_TIMEOUT         5000
+// The frames in flight are waited until no frame is received for this time (ms), in addition to the latency
+#define RELAY_BENCH_DRAIN_TIMEOUT           1000
+// Default latency of SRT (ms)
+#define RELAY_BENCH_SRT_DEFAULT_LATENCY     120
+
+namespace
+{
+	// Origin application that has the synthetic streams (RelayServer sends them to the registered client)
+	class LoopbackOrigin : public MediaRouteApplicationInterface
+	{
+	public:
+		std::shared_ptr<RelayClient> GetOriginConnector() override
+		{
+			return nullptr;
+		}
+
+		const std::map<uint32_t, std::shared_ptr<MediaRouteStream>> GetStreams() const override
+		{
+			return _streams;
+		}
+
+		void AddStream(const std::shared_ptr<StreamInfo> &stream_info)
+		{
+			_streams[stream_info->GetId()] = std::make_shared<MediaRouteStream>(stream_info);
+		}
+
+		std::shared_ptr<MediaRouteStream> GetStream(uint32_t stream_id) const
+		{
+			auto stream = _streams.find(stream_id);
+
+			return (stream != _streams.end()) ? stream->second : nullptr;
+		}
+
+	protected:
+		std::map<uint32_t, std::shared_ptr<MediaRouteStream>> _streams;
+	};
+
+	// Edge application that passes the packets received by RelayClient to the bench instead of the publishers
+	class LoopbackEdge : public MediaRouteApplication
+	{
+	public:
+		typedef std::function<void(const std::shared_ptr<StreamInfo> &stream_info, const MediaPacket &packet)> PacketCallback;
+
+		LoopbackEdge(const info::Application &application_info, PacketCallback callback)
+			: MediaRouteApplication(application_info),
+			  _callback(std::move(callback))
+		{
+		}
+
+		bool OnCreateStream(std::shared_ptr<MediaRouteApplicationConnector> app_conn, std::shared_ptr<StreamInfo> stream) override
+		{
+			// RelayClient finds the stream using GetStreams()
+			bool result = MediaRouteApplication::OnCreateStream(std::move(app_conn), std::move(stream));
+
+			_created_stream_count++;
+
+			return result;
+		}
+
+		bool OnReceiveBuffer(std::shared_ptr<MediaRouteApplicationConnector> app_conn, std::shared_ptr<StreamInfo> stream, std::unique_ptr<MediaPacket> packet) override
+		{
+			_callback(stream, *packet);
+
+			return true;
+		}
+
+		int GetCreatedStreamCount() const
+		{
+			return _created_stream_count;
+		}
+
+	protected:
+		PacketCallback _callback;
+		std::atomic<int> _created_stream_count { 0 };
+	};
+}
+
+// cfg::Application is parsed only from a file
+static bool ParseApplication(const ov::String &xml, cfg::Application *application)
+{
+	char file_name[] = "/tmp/relay_bench_XXXXXX";
+	int file = ::mkstemp(file_name);
+
+	if(file == -1)
+	{
+		logte("Could not create a temporary file");
+		return false;
+	}
+
+	bool result = (::write(file, xml.CStr(), xml.GetLength()) == static_cast<ssize_t>(xml.GetLength())) &&
+	              application->Parse(file_name, "Application");
+
+	::close(file);
+	::unlink(file_name);
+
+	return result;
+}
+
+bool RelayBench::RunLoopback(RelayBenchResult *result, RelayLoopbackStats *stats)
+{
+	*result = RelayBenchResult();
+	*stats = RelayLoopbackStats();
+
+	for(auto &frame : _frames)
+	{
+		result->payload_bytes += frame.data->GetLength();
+	}
+
+	result->frame_count = _frames.size();
+
+	_received_frames.clear();
+	_received_frames.reserve(_frames.size());
+
+	cfg::Application origin_config;
+	cfg::Application edge_config;
+
+	bool is_parsed = ParseApplication(ov::String::FormatString(
+		"<Application><Name>%s</Name><Type>live</Type>"
+		"<Relay><IP>127.0.0.1</IP><Port>%d</Port></Relay>"
+		"</Application>",
+		RELAY_BENCH_APPLICATION_NAME, _options.port), &origin_config) &&
+	                 ParseApplication(ov::String::FormatString(
+		                 "<Application><Name>%s</Name><Type>liveedge</Type>"
+		                 "<Origin><Primary>127.0.0.1:%d</Primary><Latency>%d</Latency><ReceiveBufferSize>%d</ReceiveBufferSize></Origin>"
+		                 "</Application>",
+		                 RELAY_BENCH_APPLICATION_NAME, _options.port + 1, _options.latency, _options.receive_buffer_size), &edge_config);
+
+	if(is_parsed == false)
+	{
+		logte("Could not make the configuration of the applications");
+		return false;
+	}
+
+	info::Application origin_info(origin_config);
+	info::Application edge_info(edge_config);
+
+	//--------------------------------------------------------------------
+	// Origin (RelayServer)
+	//--------------------------------------------------------------------
+	auto origin = std::make_shared<LoopbackOrigin>();
+
+	for(int stream_index = 0; stream_index < _options.stream_count; stream_index++)
+	{
+		auto stream_info = std::make_shared<StreamInfo>(static_cast<uint32_t>(stream_index + 1));
+		auto video_track = std::make_shared<MediaTrack>();
+		auto audio_track = std::make_shared<MediaTrack>();
+
+		stream_info->SetName(ov::String::FormatString("stream%d", stream_index + 1));
+
+		// The track ids and the timebases are the same as Synthesize()
+		video_track->SetId(0);
+		video_track->SetMediaType(common::MediaType::Video);
+		video_track->SetCodecId(common::MediaCodecId::H264);
+		video_track->SetTimeBase(1, 90000);
+		video_track->SetFrameRate(_options.frame_rate);
+		video_track->SetBitrate(_options.video_bitrate * 1000);
+		stream_info->AddTrack(video_track);
+
+		audio_track->SetId(1);
+		audio_track->SetMediaType(common::MediaType::Audio);
+		audio_track->SetCodecId(common::MediaCodecId::Aac);
+		audio_track->SetTimeBase(1, 48000);
+		audio_track->SetSampleRate(48000);
+		audio_track->SetBitrate(_options.audio_bitrate * 1000);
+		stream_info->AddTrack(audio_track);
+
+		origin->AddStream(stream_info);
+	}
+
+	auto relay_server = std::make_shared<RelayServer>(origin.get(), origin_info);
+
+	//--------------------------------------------------------------------
+	// Link (the relay client connects to the link instead of the relay server)
+	//--------------------------------------------------------------------
+	LossyLinkOptions link_options;
+
+	link_options.loss = _options.loss;
+	link_options.delay = _options.delay;
+	link_options.bandwidth = _options.bandwidth;
+
+	LossyLink link(link_options);
+
+	if(link.Start(ov::SocketAddress("127.0.0.1", static_cast<uint16_t>(_options.port + 1)),
+	              ov::SocketAddress("127.0.0.1", static_cast<uint16_t>(_options.port))) == false)
+	{
+		return false;
+	}
+
+	//--------------------------------------------------------------------
+	// Edge (RelayClient)
+	//--------------------------------------------------------------------
+	auto edge = std::make_shared<LoopbackEdge>(edge_info, [this](const std::shared_ptr<StreamInfo> &stream_info, const MediaPacket &packet) -> void
+	{
+		auto &data = packet.GetData();
+		// The data of every frame is the beginning of _buffer
+		bool is_data_matched = (data->GetLength() <= _buffer.size()) && (::memcmp(data->GetData(), _buffer.data(), data->GetLength()) == 0);
+
+		std::lock_guard<std::mutex> lock_guard(_received_frames_mutex);
+
+		OnFrameReceived(stream_info->GetId(), static_cast<uint32_t>(packet.GetTrackId()), static_cast<uint64_t>(packet.GetPts()), static_cast<uint8_t>(packet.GetFlags()),
+		                data->GetData(), data->GetLength(), is_data_matched);
+	});
+
+	auto relay_client = std::make_shared<RelayClient>(edge.get(), edge_info, edge_info.GetOrigin());
+
+	relay_client->Start(edge_info.GetName());
+
+	auto wait_start_time = std::chrono::steady_clock::now();
+
+	while(edge->GetCreatedStreamCount() < _options.stream_count)
+	{
+		if((std::chrono::steady_clock::now() - wait_start_time) > std::chrono::milliseconds(RELAY_BENCH_CONNECT_TIMEOUT))
+		{
+			logte("The relay client could not receive the streams within %d ms", RELAY_BENCH_CONNECT_TIMEOUT);
+
+			relay_client->Stop();
+			edge->UnregisterConnectorApp(relay_client);
+			link.Stop();
+
+			return false;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	//--------------------------------------------------------------------
+	// Sends the frames in real time (MediaRouter -> RelayServer::SendMediaPacket())
+	//--------------------------------------------------------------------
+	auto send_start_time = std::chrono::steady_clock::now();
+
+	for(auto &frame : _frames)
+	{
+		bool is_video = (frame.media_type == static_cast<int8_t>(common::MediaType::Video));
+		double time = frame.pts / (is_video ? 90000.0 : 48000.0);
+
+		std::this_thread::sleep_until(send_start_time + std::chrono::microseconds(static_cast<int64_t>(time * 1000000.0)));
+
+		auto packet = std::make_unique<MediaPacket>(
+			static_cast<common::MediaType>(frame.media_type),
+			static_cast<int32_t>(frame.track_id),
+			frame.data->GetData(),
+			static_cast<int32_t>(frame.data->GetLength()),
+			static_cast<int64_t>(frame.pts),
+			static_cast<MediaPacketFlag>(frame.flags)
+		);
+
+		*(packet->_frag_hdr) = frame.fragmentation;
+
+		relay_server->SendMediaPacket(origin->GetStream(frame.stream_id), packet.get());
+	}
+
+	result->send_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - send_start_time).count();
+
+	//--------------------------------------------------------------------
+	// Waits for the frames in flight (retransmitted within the latency)
+	//--------------------------------------------------------------------
+	int latency = (_options.latency > 0) ? _options.latency : RELAY_BENCH_SRT_DEFAULT_LATENCY;
+	auto drain_timeout = std::chrono::milliseconds(latency + (_options.delay * 2) + RELAY_BENCH_DRAIN_TIMEOUT);
+	auto last_receive_time = std::chrono::steady_clock::now();
+	size_t last_received_count = 0;
+
+	while((std::chrono::steady_clock::now() - last_receive_time) < drain_timeout)
+	{
+		size_t received_count;
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_received_frames_mutex);
+
+			received_count = _received_frames.size();
+		}
+
+		if(received_count >= _frames.size())
+		{
+			break;
+		}
+
+		if(received_count != last_received_count)
+		{
+			last_received_count = received_count;
+			last_receive_time = std::chrono::steady_clock::now();
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	result->receive_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - send_start_time).count() - result->send_seconds;
+
+	// There is only one client
+	for(auto &client_stats : relay_server->GetClientStats())
+	{
+		stats->send_queue = client_stats.second.send_queue;
+		stats->transport = client_stats.second.transport;
+	}
+
+	stats->upstream = link.GetUpstreamStats();
+	stats->downstream = link.GetDownstreamStats();
+
+	result->sent_bytes = stats->send_queue.sent_bytes;
+	result->message_count = stats->transport.sent_packets;
+	result->lost_message_count = stats->downstream.dropped_datagrams;
+
+	relay_client->Stop();
+	edge->UnregisterConnectorApp(relay_client);
+	link.Stop();
+
+	Verify(result);
+
+	return result->is_matched;
+}
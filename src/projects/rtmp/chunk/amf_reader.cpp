@@ -0,0 +1,252 @@
+//==============================================================================
+//
+//  RtmpProvider
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "amf_reader.h"
+
+// 하위 Object 중첩 제한 (잘못된 데이터로 인한 stack 소모 방지)
+#define AMF_READER_MAX_DEPTH    (32)
+
+//====================================================================================================
+// AmfReader
+//====================================================================================================
+AmfReader::AmfReader(const uint8_t *data, size_t data_size)
+{
+    _data = data;
+    _data_size = (data != nullptr) ? data_size : 0;
+    _position = 0;
+    _error = false;
+}
+
+//====================================================================================================
+// ReadValue
+// - marker + 값
+//====================================================================================================
+bool AmfReader::ReadValue(AmfValue &value)
+{
+    value = AmfValue();
+
+    if (!ReadMarker(value.marker))
+    {
+        return false;
+    }
+
+    switch (value.marker)
+    {
+        case AmfTypeMarker::Number:
+            return ReadNumber(value.number);
+
+        case AmfTypeMarker::Boolean:
+            if (!Skip(1))
+            {
+                return false;
+            }
+            value.boolean = (_data[_position - 1] != 0);
+            return true;
+
+        case AmfTypeMarker::String:
+            return ReadString(sizeof(uint16_t), value.string, value.string_length);
+
+        case AmfTypeMarker::LongString:
+        case AmfTypeMarker::Xml:
+            return ReadString(sizeof(uint32_t), value.string, value.string_length);
+
+        case AmfTypeMarker::Object:
+            return true;
+
+        case AmfTypeMarker::TypedObject:
+            // class name 이후는 Object 와 같음
+            return ReadString(sizeof(uint16_t), value.string, value.string_length);
+
+        case AmfTypeMarker::EcmaArray:
+            // count 는 참고용이므로 ObjectEnd 까지 읽음
+            return Skip(sizeof(uint32_t));
+
+        case AmfTypeMarker::StrictArray:
+            return ReadUInt(sizeof(uint32_t), value.count);
+
+        case AmfTypeMarker::Date:
+            // time(8) + timezone(2)
+            return ReadNumber(value.number) && Skip(sizeof(uint16_t));
+
+        case AmfTypeMarker::Reference:
+            return Skip(sizeof(uint16_t));
+
+        case AmfTypeMarker::Null:
+        case AmfTypeMarker::Undefined:
+        case AmfTypeMarker::Unsupported:
+            return true;
+
+        case AmfTypeMarker::MovieClip:
+        case AmfTypeMarker::Recordset:
+        case AmfTypeMarker::ObjectEnd:
+        default:
+            // 값으로 올 수 없는 marker
+            return SetError();
+    }
+}
+
+//====================================================================================================
+// ReadProperty
+// - name length(2) + name + 값
+// - 끝 : 00 00 09
+//====================================================================================================
+bool AmfReader::ReadProperty(AmfKey &key, AmfValue &value)
+{
+    if (!ReadString(sizeof(uint16_t), key.name, key.length))
+    {
+        return false;
+    }
+
+    // ObjectEnd
+    if (key.length == 0 && _position < _data_size && _data[_position] == (uint8_t) AmfTypeMarker::ObjectEnd)
+    {
+        _position++;
+        return false;
+    }
+
+    key.hash = 2166136261u;
+    for (size_t index = 0; index < key.length; index++)
+    {
+        key.hash = (key.hash ^ static_cast<uint8_t>(key.name[index])) * 16777619u;
+    }
+
+    return ReadValue(value);
+}
+
+//====================================================================================================
+// SkipValue
+//====================================================================================================
+bool AmfReader::SkipValue(const AmfValue &value)
+{
+    return SkipValue(value, 0);
+}
+
+bool AmfReader::SkipValue(const AmfValue &value, int depth)
+{
+    if (depth > AMF_READER_MAX_DEPTH)
+    {
+        return SetError();
+    }
+
+    if (value.IsObject())
+    {
+        AmfKey key;
+        AmfValue property;
+
+        while (ReadProperty(key, property))
+        {
+            if (!SkipValue(property, depth + 1))
+            {
+                return false;
+            }
+        }
+
+        return !_error;
+    }
+
+    if (value.marker == AmfTypeMarker::StrictArray)
+    {
+        AmfValue item;
+
+        for (uint32_t index = 0; index < value.count; index++)
+        {
+            if (!ReadValue(item) || !SkipValue(item, depth + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    return !_error;
+}
+
+//====================================================================================================
+// 기본 타입 읽기 (Big Endian)
+//====================================================================================================
+bool AmfReader::ReadMarker(AmfTypeMarker &marker)
+{
+    if (!Skip(1))
+    {
+        return false;
+    }
+
+    marker = static_cast<AmfTypeMarker>(_data[_position - 1]);
+
+    return true;
+}
+
+bool AmfReader::ReadNumber(double &number)
+{
+    if (!Skip(sizeof(double)))
+    {
+        return false;
+    }
+
+    const uint8_t *pt_in = _data + _position - sizeof(double);
+    auto *pt_out = (uint8_t *) &number;
+
+    pt_out[0] = pt_in[7];
+    pt_out[1] = pt_in[6];
+    pt_out[2] = pt_in[5];
+    pt_out[3] = pt_in[4];
+    pt_out[4] = pt_in[3];
+    pt_out[5] = pt_in[2];
+    pt_out[6] = pt_in[1];
+    pt_out[7] = pt_in[0];
+
+    return true;
+}
+
+bool AmfReader::ReadString(size_t length_size, const char *&string, size_t &string_length)
+{
+    uint32_t length = 0;
+
+    if (!ReadUInt(length_size, length))
+    {
+        return false;
+    }
+
+    string = (const char *) (_data + _position);
+    string_length = length;
+
+    return Skip(length);
+}
+
+bool AmfReader::ReadUInt(size_t size, uint32_t &number)
+{
+    if (!Skip(size))
+    {
+        return false;
+    }
+
+    number = 0;
+    for (size_t index = _position - size; index < _position; index++)
+    {
+        number = (number << 8) | _data[index];
+    }
+
+    return true;
+}
+
+bool AmfReader::Skip(size_t size)
+{
+    if (_error || (size > _data_size - _position))
+    {
+        return SetError();
+    }
+
+    _position += size;
+
+    return true;
+}
+
+bool AmfReader::SetError()
+{
+    _error = true;
+    return false;
+}
@@ -0,0 +1,128 @@
+//==============================================================================
+//
+//  RtmpProvider
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include "amf_document.h"
+
+//====================================================================================================
+// AmfKeyHash
+// - FNV-1a (32bit)
+// - constexpr 이므로 switch case 에 문자열 상수를 바로 사용 가능
+//   ex) case AmfKeyHash("width"):
+//====================================================================================================
+constexpr uint32_t AmfKeyHash(const char *name, uint32_t hash = 2166136261u)
+{
+    return (*name == '\0') ? hash : AmfKeyHash(name + 1, (hash ^ static_cast<uint8_t>(*name)) * 16777619u);
+}
+
+//====================================================================================================
+// AmfKey
+// - Object/EcmaArray 속성 이름 (메시지 버퍼를 가리킴, NULL 종료 문자열 아님)
+//====================================================================================================
+struct AmfKey
+{
+    const char *name = nullptr;
+    size_t length = 0;
+    uint32_t hash = 0;
+
+    bool IsEqual(const char *string) const
+    {
+        return (strlen(string) == length) && (memcmp(name, string, length) == 0);
+    }
+};
+
+//====================================================================================================
+// AmfValue
+// - 값 1개 (문자열은 메시지 버퍼를 가리킴, NULL 종료 문자열 아님)
+// - Object/EcmaArray/StrictArray 는 marker 정보만 가지며 내용은 AmfReader 로 이어서 읽음
+//====================================================================================================
+struct AmfValue
+{
+    AmfTypeMarker marker = AmfTypeMarker::Undefined;
+    double number = 0.0;
+    bool boolean = false;
+    const char *string = "";
+    size_t string_length = 0;
+    uint32_t count = 0; // StrictArray 항목 수
+
+    bool IsNumber() const { return marker == AmfTypeMarker::Number; }
+
+    bool IsString() const { return marker == AmfTypeMarker::String || marker == AmfTypeMarker::LongString; }
+
+    // 이름/값 쌍으로 구성된 값 (ReadProperty 로 읽음)
+    bool IsObject() const
+    {
+        return marker == AmfTypeMarker::Object || marker == AmfTypeMarker::EcmaArray ||
+               marker == AmfTypeMarker::TypedObject;
+    }
+
+    bool IsStringEqual(const char *value) const
+    {
+        return IsString() && (strlen(value) == string_length) && (memcmp(string, value, string_length) == 0);
+    }
+};
+
+//====================================================================================================
+// AmfReader
+// - AMF0 메시지를 앞에서부터 한번에 읽는 pull 방식 decoder
+// - AmfDocument 와 달리 property tree 를 만들지 않으며 할당/복사가 없음
+// - 모든 읽기는 버퍼 크기를 확인하며, 잘못된 데이터를 만나면 이후 읽기는 모두 실패
+//
+// 사용 예)
+//  reader.ReadValue(value);                // 값 1개
+//  if (value.IsObject())
+//      while (reader.ReadProperty(key, property))
+//      {
+//          ...
+//          reader.SkipValue(property);     // 하위 Object 를 읽지 않는 경우
+//      }
+//====================================================================================================
+class AmfReader
+{
+public:
+    AmfReader(const uint8_t *data, size_t data_size);
+
+public:
+    // 다음 값을 읽음
+    // - Object/EcmaArray/StrictArray 는 시작 부분까지만 읽으므로 이어서 내용을 읽거나 SkipValue() 호출 필요
+    bool ReadValue(AmfValue &value);
+
+    // Object/EcmaArray 의 다음 속성을 읽음
+    // - ObjectEnd 를 만나거나 오류가 있으면 false (HasError() 로 구분)
+    bool ReadProperty(AmfKey &key, AmfValue &value);
+
+    // ReadValue()/ReadProperty() 로 시작 부분만 읽은 Object/Array 의 나머지를 건너뜀 (그 외 타입은 무시)
+    bool SkipValue(const AmfValue &value);
+
+    bool HasError() const { return _error; }
+
+    bool IsEnd() const { return _error || (_position >= _data_size); }
+
+private:
+    bool SkipValue(const AmfValue &value, int depth);
+
+    bool ReadMarker(AmfTypeMarker &marker);
+
+    bool ReadNumber(double &number);
+
+    bool ReadString(size_t length_size, const char *&string, size_t &string_length);
+
+    bool ReadUInt(size_t size, uint32_t &number);
+
+    bool Skip(size_t size);
+
+    bool SetError();
+
+private:
+    const uint8_t *_data;
+    size_t _data_size;
+    size_t _position;
+    bool _error;
+};
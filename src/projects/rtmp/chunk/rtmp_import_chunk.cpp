@@ -31,6 +31,7 @@ RtmpImportChunk::~RtmpImportChunk()
 //====================================================================================================
 void RtmpImportChunk::Destroy()
 {
+    _partial_stream = nullptr;
     _stream_map.clear();
     _import_message_queue.clear();
 }
@@ -111,107 +112,72 @@ std::shared_ptr<RtmpMuxMessageHeader> RtmpImportChunk::GetMessageHeader(std::sha
 }
 
 //====================================================================================================
-// ChunkMessage 추가
+// Chunk Payload 추가
+// - Chunk Header는 제외하고 Payload만 Message Body에 바로 복사
+// - 수신된 데이터가 Chunk 보다 작으면 남은 크기를 기억해 두었다가 다음 수신 데이터에서 이어서 복사
 //====================================================================================================
-bool
-RtmpImportChunk::AppendChunk(std::shared_ptr<ImportStream> &stream, uint8_t *chunk, int header_size, int data_size)
+int RtmpImportChunk::AppendChunkData(std::shared_ptr<ImportStream> &stream,
+                                     const uint8_t *data,
+                                     int data_size,
+                                     bool &message_complete)
 {
-    int append_size = header_size + data_size;
+    int copy_size = std::min(data_size, stream->chunk_rest_size);
 
-    //10M이상 데이터 경고
-    if (append_size > RTMP_MAX_PACKET_SIZE)//10M
+    if (copy_size > 0)
     {
-        RTMP_CHUNK_WARNING_LOG(("Rtmp Append Data Size ( %d)", append_size));
-        return false;
+        memcpy(stream->body->data() + stream->write_chunk_size, data, (size_t) copy_size);
+        stream->write_chunk_size += copy_size;
+        stream->chunk_rest_size -= copy_size;
     }
 
-    // 버퍼에 남아있는공간 체크. 부족하면 새로 할당
-    if ((stream->buffer->size() - stream->data_size) < append_size)
+    // Chunk 미완료
+    if (stream->chunk_rest_size > 0)
     {
-        stream->buffer->resize(
-                (stream->buffer->size() * 2) > (stream->buffer->size() + append_size) ? (stream->buffer->size() * 2) : (
-                        stream->buffer->size() + append_size));
+        _partial_stream = stream;
+        return copy_size;
     }
 
-    // 복사
-    memcpy(stream->buffer->data() + stream->data_size, chunk, (size_t) append_size);
-    stream->data_size += append_size;
-    stream->write_chunk_size += data_size;
+    _partial_stream = nullptr;
 
-    return true;
-}
-
-//====================================================================================================
-// ChunkData 수신 완료 데이터 복사
-//====================================================================================================
-int RtmpImportChunk::CompleteChunkMessage(std::shared_ptr<ImportStream> &stream, int chunk_size)
-{
-    int chunk_header_size = 0;
-    int chunk_data_raw_size = 0;
-    bool extend_type = false;
-
-    //Chunk Header 읽기
-    auto chunk_header = GetChunkHeader(stream->buffer->data(), stream->data_size, chunk_header_size, extend_type);
-
-    //Message Header 설정
-    auto message_header = GetMessageHeader(stream, chunk_header);
-
-    //전체 크기 확인
-    chunk_data_raw_size = GetChunkDataRawSize(chunk_size, message_header->chunk_stream_id, message_header->body_size,
-                                              extend_type);
-
-    // Chunk Stream 이 완성되지 않았다면 스킵
-    if (stream->data_size < chunk_header_size + chunk_data_raw_size)
+    // Message 완료
+    if (stream->write_chunk_size >= (int) stream->message_header->body_size)
     {
-        RTMP_CHUNK_ERROR_LOG(("Buffer(%d) RawData(%d)", stream->data_size, chunk_header_size + chunk_data_raw_size));
-        return 0;
-    }
+        _import_message_queue.push_back(std::make_shared<ImportMessage>(stream->message_header, stream->body));
 
-    // 데이터 길이가 0인 헤더 정보 정보가 오는 경우 발생
-    if (message_header->body_size == 0)
-    {
-        //스트림 정보 초기화
-        stream->data_size = 0;
+        // 스트림 정보 초기화
+        stream->body = nullptr;
         stream->write_chunk_size = 0;
-        return 0;
+        message_complete = true;
     }
 
-    // 메모리 할당
-    auto message = std::make_shared<ImportMessage>(message_header);
-
-    //Chunk Message 할당
-    if (GetChunkData(chunk_size, stream->buffer->data() + chunk_header_size, chunk_data_raw_size,
-                     message_header->body_size, message->body->data(), extend_type) == 0)
-    {
-        RTMP_CHUNK_ERROR_LOG(("GetChunkData - Header(%d) RawData(%d)", chunk_header_size, chunk_data_raw_size));
-        return 0;
-    }
-
-    // 스트림 정보 초기화
-    stream->data_size = 0;
-    stream->write_chunk_size = 0;
-
-    // 리스트에 등록
-    _import_message_queue.push_back(message);
-
-    return message_header->body_size;
+    return copy_size;
 }
 
 //====================================================================================================
 // ImportStream
 // - Chunk 데이터 삽입
+// - 처리한 크기 반환(0: 데이터 부족, <0: 실패)
 //====================================================================================================
 int RtmpImportChunk::ImportStreamData(uint8_t *data, int data_size, bool &message_complete)
 {
     int chunk_header_size = 0;
-    int rest_chunk_size = 0;
     bool extend_type = false;
 
+    message_complete = false;
+
     if (data_size <= 0 || data == nullptr)
     {
         return 0;
     }
 
+    // 이전 수신 데이터에서 Payload를 다 받지 못한 Chunk 이어서 처리
+    if (_partial_stream != nullptr)
+    {
+        auto stream = _partial_stream;
+
+        return AppendChunkData(stream, data, data_size, message_complete);
+    }
+
     // Chunk Header  읽기
     auto chunk_header = GetChunkHeader(data, data_size, chunk_header_size, extend_type);
 
@@ -243,67 +209,40 @@ int RtmpImportChunk::ImportStreamData(uint8_t *data, int data_size, bool &messag
     // ExtendHeader 설정
     stream->extend_type = extend_type;
 
-    // Message Header 얻기
-    auto message_header = GetMessageHeader(stream, chunk_header);
-
-    rest_chunk_size = message_header->body_size - stream->write_chunk_size;
-
-    if (rest_chunk_size <= 0)
+    // 새로운 Message 시작(진행 중인 Message의 Type3 Chunk가 아닌 경우)
+    if (stream->write_chunk_size == 0 || chunk_header->basic_header.format_type != RTMP_CHUNK_BASIC_FORMAT_TYPE3)
     {
-        RTMP_CHUNK_ERROR_LOG(
-                ("Rest Chunk Size Fail - Header(%d) Data(%d) Chunk(%d)", chunk_header_size, rest_chunk_size, _chunk_size));
-        return -1;
-    }
-
-    // Chunk Size 가 남은 경우
-    if (_chunk_size < rest_chunk_size)
-    {
-        //Data 를 아직 다 받지 못했다면 스킵
-        if (data_size < chunk_header_size + _chunk_size)
+        if (stream->write_chunk_size > 0)
         {
-            return 0;
+            RTMP_CHUNK_WARNING_LOG(("Incomplete Message Drop - Write(%d) Body(%u)",
+                                    stream->write_chunk_size, stream->message_header->body_size));
         }
 
-        // Chunk 추가
-        if (!AppendChunk(stream, data, chunk_header_size, _chunk_size))
+        // Message Header 얻기
+        auto message_header = GetMessageHeader(stream, chunk_header);
+
+        if (message_header->body_size == 0 || message_header->body_size > RTMP_MAX_PACKET_SIZE)
         {
-            RTMP_CHUNK_ERROR_LOG(
-                    ("AppendChunk Fail - Header(%d) Data(%d) Chunk(%d)", chunk_header_size, rest_chunk_size, _chunk_size));
+            RTMP_CHUNK_ERROR_LOG(("Body Size Fail - Header(%d) Body(%u) Chunk(%d)",
+                                  chunk_header_size, message_header->body_size, _chunk_size));
             return -1;
         }
 
-        // Import 스트림 정보 업데이트
-        message_header->timestamp -= stream->timestamp_delta;
+        // header 정보 갱신
+        stream->timestamp_delta = message_header->timestamp - stream->message_header->timestamp;
         stream->message_header = message_header;
-        message_complete = false;
 
-        return chunk_header_size + _chunk_size;
-    }
-
-    // Data 를 아직 다 받지 못했다면 skip
-    if (data_size < chunk_header_size + rest_chunk_size)
-    {
-        return 0;
-    }
-
-    // Chunk 추가
-    if (!AppendChunk(stream, data, chunk_header_size, rest_chunk_size))
-    {
-        RTMP_CHUNK_ERROR_LOG(
-                ("AppendChunk Fail - Header(%d) Data(%d) Chunk(%d)", chunk_header_size, rest_chunk_size, _chunk_size));
-        return -1;
+        // Message Header의 크기로 한번만 할당
+        stream->body = std::make_shared<std::vector<uint8_t>>(message_header->body_size);
+        stream->write_chunk_size = 0;
     }
 
-    // 완료
-    CompleteChunkMessage(stream, _chunk_size);
-
-    // header 정보 갱신
-    stream->timestamp_delta = message_header->timestamp - stream->message_header->timestamp;
-    stream->message_header = message_header;
-    message_complete = true;
-
-    return chunk_header_size + rest_chunk_size;
+    stream->chunk_rest_size = std::min(_chunk_size, (int) stream->message_header->body_size - stream->write_chunk_size);
 
+    return chunk_header_size + AppendChunkData(stream,
+                                               data + chunk_header_size,
+                                               data_size - chunk_header_size,
+                                               message_complete);
 }
 
 //====================================================================================================
@@ -15,6 +15,8 @@
 
 //====================================================================================================
 // ImportStream
+// - Chunk Stream 별 수신 상태
+// - Message Body는 첫 Chunk의 Message Header(body_size) 크기로 할당하고 Chunk Payload만 바로 복사
 //====================================================================================================
 struct ImportStream
 {
@@ -22,19 +24,19 @@ public :
 	ImportStream()
 	{
 		message_header 		= std::make_shared<RtmpMuxMessageHeader>();
-        write_chunk_size	= 0;
-        extend_type		= false;
-        data_size			= 0;
-        buffer 				= std::make_shared<std::vector<uint8_t>>(1024*1024);
+		timestamp_delta		= 0;
+		write_chunk_size	= 0;
+		chunk_rest_size		= 0;
+		extend_type			= false;
 	}
 
 public :
-    std::shared_ptr<RtmpMuxMessageHeader>	message_header;;
+	std::shared_ptr<RtmpMuxMessageHeader>	message_header;
 	uint32_t								timestamp_delta;
-	int										write_chunk_size;
+	int										write_chunk_size;	// body에 복사된 크기
+	int										chunk_rest_size;	// 현재 Chunk에서 아직 수신하지 못한 Payload 크기
 	bool									extend_type;
-	int 									data_size;
-	std::shared_ptr<std::vector<uint8_t>> 	buffer;
+	std::shared_ptr<std::vector<uint8_t>> 	body;
 };
 
 //====================================================================================================
@@ -49,6 +51,13 @@ public :
         body            = std::make_shared<std::vector<uint8_t>>(message_header->body_size);
 	}
 
+	// 이미 수신 완료된 body를 복사 없이 사용
+	ImportMessage(const std::shared_ptr<RtmpMuxMessageHeader> &header, const std::shared_ptr<std::vector<uint8_t>> &body_)
+	{
+		message_header  = header;
+		body            = body_;
+	}
+
 public :
     std::shared_ptr<RtmpMuxMessageHeader>	message_header;
 	std::shared_ptr<std::vector<uint8_t>> 	body;
@@ -71,11 +80,11 @@ public:
 private:
 	std::shared_ptr<ImportStream>           GetStream(uint32_t chunk_stream_id);
 	std::shared_ptr<RtmpMuxMessageHeader>   GetMessageHeader(std::shared_ptr<ImportStream> &stream, std::shared_ptr<RtmpChunkHeader> &chunk_header);
-	bool							        AppendChunk(std::shared_ptr<ImportStream> &stream, uint8_t *chunk, int header_size, int data_size);
-	int								        CompleteChunkMessage(std::shared_ptr<ImportStream> &stream, int chunk_size);
+	int								        AppendChunkData(std::shared_ptr<ImportStream> &stream, const uint8_t *data, int data_size, bool &message_complete);
 
 private:
 	std::map<uint32_t, std::shared_ptr<ImportStream>>	_stream_map;
+	std::shared_ptr<ImportStream>                       _partial_stream;    // Payload를 아직 다 받지 못한 Chunk의 스트림
 	std::deque<std::shared_ptr<ImportMessage>>			_import_message_queue;
 	int                                                 _chunk_size;
 };
@@ -173,34 +173,41 @@ bool RtmpChunkStream::SendData(int data_size, uint8_t *data)
 // - Handshake 처리
 // - Chunkstream 처리
 //====================================================================================================
-int32_t RtmpChunkStream::OnDataReceived(const std::unique_ptr<std::vector<uint8_t>> &data)
+int32_t RtmpChunkStream::OnDataReceived(const std::shared_ptr<const ov::Data> &data)
 {
     int32_t process_size = 0;
-    std::shared_ptr<std::vector<uint8_t>> process_data = nullptr;
+    const uint8_t *process_data = nullptr;
+    int32_t process_data_size = 0;
 
     // setting packet time
     _last_packet_time = time(nullptr);
 
+    // 이전에 처리하지 못한 데이터가 있을 때만 뒤에 붙여서 처리
+    // 없으면 수신 데이터를 복사하지 않고 바로 처리
     if (!_remained_data->empty())
     {
-        process_data = std::make_shared<std::vector<uint8_t>>(_remained_data->begin(), _remained_data->end());
-        process_data->insert(process_data->end(), data->begin(), data->end());
-        _remained_data->clear();
+        _remained_data->insert(_remained_data->end(),
+                               data->GetDataAs<uint8_t>(),
+                               data->GetDataAs<uint8_t>() + data->GetLength());
+
+        process_data = _remained_data->data();
+        process_data_size = static_cast<int32_t>(_remained_data->size());
     }
     else
     {
-        process_data = std::make_shared<std::vector<uint8_t>>(data->begin(), data->end());
+        process_data = data->GetDataAs<uint8_t>();
+        process_data_size = static_cast<int32_t>(data->GetLength());
     }
 
     // 최대 크기 확인
-    if (process_data->size() > RTMP_MAX_PACKET_SIZE)
+    if (process_data_size > RTMP_MAX_PACKET_SIZE)
     {
         logte("Process data size fail - app(%s/%u) stream(%s/%u) size(%d:%d)",
               _app_name.CStr(),
               _app_id,
               _stream_name.CStr(),
               _stream_id,
-              process_data->size(),
+              process_data_size,
               RTMP_MAX_PACKET_SIZE);
 
         return -1;
@@ -208,11 +215,11 @@ int32_t RtmpChunkStream::OnDataReceived(const std::unique_ptr<std::vector<uint8_
 
     if (_handshake_state != RtmpHandshakeState::Complete)
     {
-        process_size = ReceiveHandshakePacket(process_data);
+        process_size = ReceiveHandshakePacket(process_data, process_data_size);
     }
     else
     {
-        process_size = ReceiveChunkPacket(process_data);
+        process_size = ReceiveChunkPacket(process_data, process_data_size);
     }
 
     if (process_size < 0)
@@ -228,9 +235,14 @@ int32_t RtmpChunkStream::OnDataReceived(const std::unique_ptr<std::vector<uint8_
     }
 
     // remained 데이터 설정
-    if (process_size < process_data->size())
+    // - Chunk Payload는 수신 즉시 Message Body에 복사되므로 남는 데이터는 잘린 Chunk Header 정도
+    if (process_data == _remained_data->data())
+    {
+        _remained_data->erase(_remained_data->begin(), _remained_data->begin() + process_size);
+    }
+    else if (process_size < process_data_size)
     {
-        _remained_data->assign(process_data->begin() + process_size, process_data->end());
+        _remained_data->assign(process_data + process_size, process_data + process_data_size);
     }
 
     return process_size;
@@ -243,7 +255,7 @@ int32_t RtmpChunkStream::OnDataReceived(const std::unique_ptr<std::vector<uint8_
 // s0 + s1 + s2 Send
 // c2 Receive
 //====================================================================================================
-int32_t RtmpChunkStream::ReceiveHandshakePacket(const std::shared_ptr<const std::vector<uint8_t>> &data)
+int32_t RtmpChunkStream::ReceiveHandshakePacket(const uint8_t *data, int32_t data_size)
 {
     int32_t process_size = 0;
     int32_t chunk_process_size = 0;
@@ -263,7 +275,7 @@ int32_t RtmpChunkStream::ReceiveHandshakePacket(const std::shared_ptr<const std:
     }
 
     // Process Data Size Check
-    if (data->size() < process_size)
+    if (data_size < process_size)
     {
         return 0;
     }
@@ -273,9 +285,9 @@ int32_t RtmpChunkStream::ReceiveHandshakePacket(const std::shared_ptr<const std:
     {
         // c0 + c1 수신 확인
         // 버전 체크
-        if (data->at(0) != RTMP_HANDSHAKE_VERSION)
+        if (data[0] != RTMP_HANDSHAKE_VERSION)
         {
-            logte("Handshake Version Fail - Version(%d:%d)", data->at(0), RTMP_HANDSHAKE_VERSION);
+            logte("Handshake Version Fail - Version(%d:%d)", data[0], RTMP_HANDSHAKE_VERSION);
             return -1;
         }
         _handshake_state = RtmpHandshakeState::C0;
@@ -292,10 +304,9 @@ int32_t RtmpChunkStream::ReceiveHandshakePacket(const std::shared_ptr<const std:
     _handshake_state = RtmpHandshakeState::C2;
 
     // 최종 c3와 chunk 패킷이 같이 들어오는 경우 처리(encoder 전송 대기 상태에 빠질 수 있음)
-    if (process_size < data->size())
+    if (process_size < data_size)
     {
-        auto process_data = std::make_shared<std::vector<uint8_t>>(data->begin() + process_size, data->end());
-        chunk_process_size = ReceiveChunkPacket(process_data);
+        chunk_process_size = ReceiveChunkPacket(data + process_size, data_size - process_size);
         if (chunk_process_size < 0)
         {
             return -1;
@@ -312,7 +323,7 @@ int32_t RtmpChunkStream::ReceiveHandshakePacket(const std::shared_ptr<const std:
 // Handshake 전송
 // s0 + s1 + s2
 //====================================================================================================
-bool RtmpChunkStream::SendHandshake(const std::shared_ptr<const std::vector<uint8_t>> &data)
+bool RtmpChunkStream::SendHandshake(const uint8_t *data)
 {
     uint8_t s0 = 0;
     uint8_t s1[RTMP_HANDSHAKE_PACKET_SIZE] = {0,};
@@ -321,7 +332,7 @@ bool RtmpChunkStream::SendHandshake(const std::shared_ptr<const std::vector<uint
     // 데이터 설정
     s0 = RTMP_HANDSHAKE_VERSION;
     RtmpHandshake::MakeS1(s1);
-    RtmpHandshake::MakeS2((uint8_t *) data->data() + sizeof(uint8_t), s2);
+    RtmpHandshake::MakeS2((uint8_t *) data + sizeof(uint8_t), s2);
     _handshake_state = RtmpHandshakeState::C1;
 
     // s0 전송
@@ -355,18 +366,18 @@ bool RtmpChunkStream::SendHandshake(const std::shared_ptr<const std::vector<uint
 // Chunk 패킷 수신
 // - OnMetaData 이후에 스트리밍 시작
 //====================================================================================================
-int32_t RtmpChunkStream::ReceiveChunkPacket(const std::shared_ptr<const std::vector<uint8_t>> &data)
+int32_t RtmpChunkStream::ReceiveChunkPacket(const uint8_t *data, int32_t data_size)
 {
     int32_t process_size = 0;
     int32_t import_size = 0;
     bool message_complete = false;
 
-    while (process_size < data->size())
+    while (process_size < data_size)
     {
         message_complete = false;
 
-        import_size = _import_chunk->ImportStreamData((uint8_t *) data->data() + process_size,
-                                                      data->size() - process_size, message_complete);
+        import_size = _import_chunk->ImportStreamData((uint8_t *) data + process_size,
+                                                      data_size - process_size, message_complete);
 
         if (import_size == 0)
         {
@@ -501,63 +512,58 @@ void RtmpChunkStream::ReceiveWindowAcknowledgementSize(std::shared_ptr<ImportMes
 //====================================================================================================
 void RtmpChunkStream::ReceiveAmfCommandMessage(std::shared_ptr<ImportMessage> &message)
 {
-    AmfDocument document;
-    ov::String message_name;
+    AmfReader reader(message->body->data(), message->message_header->body_size);
+    AmfValue message_name;
+    AmfValue transaction;
     double transaction_id = 0.0;
 
-
-    if (document.Decode(message->body->data(), message->message_header->body_size) == 0)
-    {
-        logte("AmfDocument Size 0 ");
-        return;
-    }
-
     // Message Name
-    if (document.GetProperty(0) == nullptr || document.GetProperty(0)->GetType() != AmfDataType::String)
+    if (!reader.ReadValue(message_name) || !message_name.IsString())
     {
         logte("Message Name Fail");
         return;
     }
-    message_name = document.GetProperty(0)->GetString();
 
     // Message Transaction ID 얻기
-    if (document.GetProperty(1) != nullptr && document.GetProperty(1)->GetType() == AmfDataType::Number)
+    if (reader.ReadValue(transaction) && transaction.IsNumber())
     {
-        transaction_id = document.GetProperty(1)->GetNumber();
+        transaction_id = transaction.number;
     }
 
     // 처리
-    if (message_name == RTMP_CMD_NAME_CONNECT)
+    if (message_name.IsStringEqual(RTMP_CMD_NAME_CONNECT))
     {
-        OnAmfConnect(message->message_header, document, transaction_id);
+        OnAmfConnect(message->message_header, reader, transaction_id);
     }
-    else if (message_name == RTMP_CMD_NAME_CREATESTREAM)
+    else if (message_name.IsStringEqual(RTMP_CMD_NAME_CREATESTREAM))
     {
-        OnAmfCreateStream(message->message_header, document, transaction_id);
+        OnAmfCreateStream(message->message_header, reader, transaction_id);
     }
-    else if (message_name == RTMP_CMD_NAME_FCPUBLISH)
+    else if (message_name.IsStringEqual(RTMP_CMD_NAME_FCPUBLISH))
     {
-        OnAmfFCPublish(message->message_header, document, transaction_id);
+        OnAmfFCPublish(message->message_header, reader, transaction_id);
     }
-    else if (message_name == RTMP_CMD_NAME_PUBLISH)
+    else if (message_name.IsStringEqual(RTMP_CMD_NAME_PUBLISH))
     {
-        OnAmfPublish(message->message_header, document, transaction_id);
+        OnAmfPublish(message->message_header, reader, transaction_id);
     }
-    else if (message_name == RTMP_CMD_NAME_RELEASESTREAM)
+    else if (message_name.IsStringEqual(RTMP_CMD_NAME_RELEASESTREAM))
     {
         ;
     }
-    else if (message_name == RTMP_PING)
+    else if (message_name.IsStringEqual(RTMP_PING))
     {
         ;
     }
-    else if (message_name == RTMP_CMD_NAME_DELETESTREAM)
+    else if (message_name.IsStringEqual(RTMP_CMD_NAME_DELETESTREAM))
     {
-        OnAmfDeleteStream(message->message_header, document, transaction_id);
+        OnAmfDeleteStream(message->message_header, reader, transaction_id);
     }
     else
     {
-        logtw("Unknown Amf0CommandMessage - Message(%s:%.1f)", message_name.CStr(), transaction_id);
+        logtw("Unknown Amf0CommandMessage - Message(%s:%.1f)",
+              ov::String(message_name.string, message_name.string_length).CStr(),
+              transaction_id);
         return;
     }
 }
@@ -567,43 +573,27 @@ void RtmpChunkStream::ReceiveAmfCommandMessage(std::shared_ptr<ImportMessage> &m
 //====================================================================================================
 void RtmpChunkStream::ReceiveAmfDataMessage(std::shared_ptr<ImportMessage> &message)
 {
-    AmfDocument document;
-    int32_t decode_lehgth = 0;
-    ov::String message_name;
-    ov::String data_name;
+    AmfReader reader(message->body->data(), message->message_header->body_size);
+    AmfValue message_name;
+    AmfValue data_name;
+    AmfValue object;
 
-    // 응답 디코딩
-    decode_lehgth = document.Decode(message->body->data(), message->message_header->body_size);
-    if (decode_lehgth == 0)
-    {
-        logte("Amf0DataMessage Document Length 0");
-        return;
-    }
-
-    // Message Name 얻기
-    if (document.GetProperty(0) != nullptr && document.GetProperty(0)->GetType() == AmfDataType::String)
-    {
-        message_name = document.GetProperty(0)->GetString();
-    }
-
-    // Data 이름 얻기
-    if (document.GetProperty(1) != nullptr && document.GetProperty(1)->GetType() == AmfDataType::String)
-    {
-        data_name = document.GetProperty(1)->GetString();
-    }
+    // Message Name/Data 이름 얻기
+    reader.ReadValue(message_name);
+    reader.ReadValue(data_name);
 
     // 처리
-    if (message_name == RTMP_CMD_DATA_SETDATAFRAME &&
-        data_name == RTMP_CMD_DATA_ONMETADATA &&
-        document.GetProperty(2) != nullptr &&
-        (document.GetProperty(2)->GetType() == AmfDataType::Object ||
-         document.GetProperty(2)->GetType() == AmfDataType::Array))
+    if (message_name.IsStringEqual(RTMP_CMD_DATA_SETDATAFRAME) &&
+        data_name.IsStringEqual(RTMP_CMD_DATA_ONMETADATA) &&
+        reader.ReadValue(object) &&
+        object.IsObject())
     {
-        OnAmfMetaData(message->message_header, document, 2);
+        OnAmfMetaData(message->message_header, reader);
     }
     else
     {
-        logtw("Unknown Amf0DataMessage - Message(%s)", message_name.CStr());
+        logtw("Unknown Amf0DataMessage - Message(%s)",
+              ov::String(message_name.string, message_name.string_length).CStr());
         return;
     }
 }
@@ -612,26 +602,41 @@ void RtmpChunkStream::ReceiveAmfDataMessage(std::shared_ptr<ImportMessage> &mess
 // Amf Command - Connect
 // - application name 설정
 //====================================================================================================
-void RtmpChunkStream::OnAmfConnect(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document,
+void RtmpChunkStream::OnAmfConnect(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader,
                                    double transaction_id)
 {
     double object_encoding = 0.0;
+    bool is_object_encoding_set = false;
+    bool is_app_set = false;
+    AmfValue object;
+    AmfKey key;
+    AmfValue property;
 
-    if (document.GetProperty(2) != nullptr && document.GetProperty(2)->GetType() == AmfDataType::Object)
+    if (reader.ReadValue(object) && object.IsObject())
     {
-        AmfObject *object = document.GetProperty(2)->GetObject();
-        int32_t index;
-
-        // object encoding
-        if ((index = object->FindName("objectEncoding")) >= 0 && object->GetType(index) == AmfDataType::Number)
+        // 중복된 key 는 처음 값 사용(이후 값 무시)
+        while (reader.ReadProperty(key, property))
         {
-            object_encoding = object->GetNumber(index);
-        }
+            // object encoding
+            if (key.IsEqual("objectEncoding") && property.IsNumber())
+            {
+                if (!is_object_encoding_set)
+                {
+                    object_encoding = property.number;
+                    is_object_encoding_set = true;
+                }
+            }
+            // app 설정
+            else if (key.IsEqual("app") && property.IsString())
+            {
+                if (!is_app_set)
+                {
+                    _app_name = ov::String(property.string, property.string_length);
+                    is_app_set = true;
+                }
+            }
 
-        // app 설정
-        if ((index = object->FindName("app")) >= 0 && object->GetType(index) == AmfDataType::String)
-        {
-            _app_name = object->GetString(index);
+            reader.SkipValue(property);
         }
     }
 
@@ -663,7 +668,7 @@ void RtmpChunkStream::OnAmfConnect(std::shared_ptr<RtmpMuxMessageHeader> &messag
 //====================================================================================================
 // Amf Command - CreateStream
 //====================================================================================================
-void RtmpChunkStream::OnAmfCreateStream(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document,
+void RtmpChunkStream::OnAmfCreateStream(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader,
                                         double transaction_id)
 {
     if (!SendAmfCreateStreamResult(message_header->chunk_stream_id, transaction_id))
@@ -676,32 +681,40 @@ void RtmpChunkStream::OnAmfCreateStream(std::shared_ptr<RtmpMuxMessageHeader> &m
 //====================================================================================================
 // Amf Command - FCPublish
 //====================================================================================================
-void RtmpChunkStream::OnAmfFCPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document,
+void RtmpChunkStream::OnAmfFCPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader,
                                      double transaction_id)
 {
-    if (_stream_name.IsEmpty() && document.GetProperty(3) != nullptr &&
-        document.GetProperty(3)->GetType() == AmfDataType::String)
+    AmfValue command_object;
+    AmfValue stream_name;
+
+    if (_stream_name.IsEmpty() &&
+        reader.ReadValue(command_object) && reader.SkipValue(command_object) &&
+        reader.ReadValue(stream_name) && stream_name.IsString())
     {
         if (!SendAmfOnFCPublish(message_header->chunk_stream_id, _rtmp_stream_id, _client_id))
         {
             logte("SendAmfOnFCPublish Fail");
             return;
         }
-        _stream_name = document.GetProperty(3)->GetString();
+        _stream_name = ov::String(stream_name.string, stream_name.string_length);
     }
 }
 
 //====================================================================================================
 // Amf Command - Publish
 //====================================================================================================
-void RtmpChunkStream::OnAmfPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document,
+void RtmpChunkStream::OnAmfPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader,
                                    double transaction_id)
 {
     if (_stream_name.IsEmpty())
     {
-        if (document.GetProperty(3) != nullptr && document.GetProperty(3)->GetType() == AmfDataType::String)
+        AmfValue command_object;
+        AmfValue stream_name;
+
+        if (reader.ReadValue(command_object) && reader.SkipValue(command_object) &&
+            reader.ReadValue(stream_name) && stream_name.IsString())
         {
-            _stream_name = document.GetProperty(3)->GetString();
+            _stream_name = ov::String(stream_name.string, stream_name.string_length);
         }
         else
         {
@@ -744,7 +757,7 @@ void RtmpChunkStream::OnAmfPublish(std::shared_ptr<RtmpMuxMessageHeader> &messag
 // Amf Command - Publish
 //====================================================================================================
 void RtmpChunkStream::OnAmfDeleteStream(std::shared_ptr<RtmpMuxMessageHeader> &message_header,
-                                        AmfDocument &document,
+                                        AmfReader &reader,
                                         double transaction_id)
 {
     logtd("Delete Stream - app(%s/%u) stream(%s/%u)", _app_name.CStr(), _app_id, _stream_name.CStr(), _stream_id);
@@ -1467,11 +1480,71 @@ bool RtmpChunkStream::StreamCreate()
     return true;
 }
 
+//====================================================================================================
+// OnMetaData 에서 사용하는 속성
+//====================================================================================================
+enum class RtmpMetaDataKey : int32_t
+{
+    Unknown = 0,
+    VideoDevice,
+    Encoder,
+    VideoCodecId,
+    FrameRate,
+    VideoFrameRate,
+    Width,
+    Height,
+    VideoDataRate,
+    Bitrate,
+    MaxBitrate,
+    AudioCodecId,
+    AudioDataRate,
+    AudioBitrate,
+    AudioChannels,
+    AudioSampleRate,
+    AudioSampleSize,
+
+    Count,
+};
+
+//====================================================================================================
+// 속성 이름 -> RtmpMetaDataKey
+// - 이름의 hash 값은 compile time 에 계산되므로 문자열 비교는 hash 가 같을 때 1번만 수행
+//====================================================================================================
+static RtmpMetaDataKey GetMetaDataKey(const AmfKey &key)
+{
+    RtmpMetaDataKey meta_data_key;
+    const char *name;
+
+    switch (key.hash)
+    {
+        case AmfKeyHash("videodevice"):     meta_data_key = RtmpMetaDataKey::VideoDevice;       name = "videodevice";       break;
+        case AmfKeyHash("encoder"):         meta_data_key = RtmpMetaDataKey::Encoder;           name = "encoder";           break;
+        case AmfKeyHash("videocodecid"):    meta_data_key = RtmpMetaDataKey::VideoCodecId;      name = "videocodecid";      break;
+        case AmfKeyHash("framerate"):       meta_data_key = RtmpMetaDataKey::FrameRate;         name = "framerate";         break;
+        case AmfKeyHash("videoframerate"):  meta_data_key = RtmpMetaDataKey::VideoFrameRate;    name = "videoframerate";    break;
+        case AmfKeyHash("width"):           meta_data_key = RtmpMetaDataKey::Width;             name = "width";             break;
+        case AmfKeyHash("height"):          meta_data_key = RtmpMetaDataKey::Height;            name = "height";            break;
+        case AmfKeyHash("videodatarate"):   meta_data_key = RtmpMetaDataKey::VideoDataRate;     name = "videodatarate";     break;
+        case AmfKeyHash("bitrate"):         meta_data_key = RtmpMetaDataKey::Bitrate;           name = "bitrate";           break;
+        case AmfKeyHash("maxBitrate"):      meta_data_key = RtmpMetaDataKey::MaxBitrate;        name = "maxBitrate";        break;
+        case AmfKeyHash("audiocodecid"):    meta_data_key = RtmpMetaDataKey::AudioCodecId;      name = "audiocodecid";      break;
+        case AmfKeyHash("audiodatarate"):   meta_data_key = RtmpMetaDataKey::AudioDataRate;     name = "audiodatarate";     break;
+        case AmfKeyHash("audiobitrate"):    meta_data_key = RtmpMetaDataKey::AudioBitrate;      name = "audiobitrate";      break;
+        case AmfKeyHash("audiochannels"):   meta_data_key = RtmpMetaDataKey::AudioChannels;     name = "audiochannels";     break;
+        case AmfKeyHash("audiosamplerate"): meta_data_key = RtmpMetaDataKey::AudioSampleRate;   name = "audiosamplerate";   break;
+        case AmfKeyHash("audiosamplesize"): meta_data_key = RtmpMetaDataKey::AudioSampleSize;   name = "audiosamplesize";   break;
+        default:
+            return RtmpMetaDataKey::Unknown;
+    }
+
+    return key.IsEqual(name) ? meta_data_key : RtmpMetaDataKey::Unknown;
+}
+
 //====================================================================================================
 // Amf Command - OnMetaData
+// - Object/EcmaArray 시작 marker 이후부터 reader 로 속성을 1번만 훑으면서 필요한 값만 보관
 //====================================================================================================
-bool RtmpChunkStream::OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document,
-                                    int32_t object_index)
+bool RtmpChunkStream::OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader)
 {
     RtmpCodecType video_codec_type = RtmpCodecType::Unknown;
     RtmpCodecType audio_codec_type = RtmpCodecType::Unknown;
@@ -1483,28 +1556,52 @@ bool RtmpChunkStream::OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &messa
     double audio_channels = 1.0;
     double audio_samplerate = 0.0;
     double audio_samplesize = 0.0;
-    AmfObjectArray *object = nullptr;
-    int32_t index = 0;
-    ov::String bitrate_string;
     RtmpEncoderType encoder_type = RtmpEncoderType::Custom;
+    AmfValue values[static_cast<int>(RtmpMetaDataKey::Count)];
+    AmfKey key;
+    AmfValue property;
 
-    // dump 정보 출력
-    std::string dump_string;
-    document.Dump(dump_string);
-    logtd(dump_string.c_str());
+    while (reader.ReadProperty(key, property))
+    {
+        auto meta_data_key = GetMetaDataKey(key);
 
-    // object encoding 얻기
-    if (document.GetProperty(object_index)->GetType() == AmfDataType::Object)
-        object = (AmfObjectArray *) (document.GetProperty(object_index)->GetObject());
-    else
-        object = (AmfObjectArray *) (document.GetProperty(object_index)->GetArray());
+        // 같은 이름이 여러 번 있으면 처음 값 사용
+        if (meta_data_key != RtmpMetaDataKey::Unknown &&
+            values[static_cast<int>(meta_data_key)].marker == AmfTypeMarker::Undefined)
+        {
+            values[static_cast<int>(meta_data_key)] = property;
+        }
 
-    // DeviceType
-    if ((index = object->FindName("videodevice")) >= 0 && object->GetType(index) == AmfDataType::String)
-        _device_string = object->GetString(index);    //DeviceType - XSplit
-    else if ((index = object->FindName("encoder")) >= 0 && object->GetType(index) == AmfDataType::String)
-        _device_string = object->GetString(index);
+        reader.SkipValue(property);
+    }
 
+    if (reader.HasError())
+    {
+        logtw("Metadata parsing stopped by invalid data - app(%s) stream(%s)", _app_name.CStr(), _stream_name.CStr());
+    }
+
+    auto &video_device = values[static_cast<int>(RtmpMetaDataKey::VideoDevice)];
+    auto &encoder = values[static_cast<int>(RtmpMetaDataKey::Encoder)];
+    auto &video_codec_id = values[static_cast<int>(RtmpMetaDataKey::VideoCodecId)];
+    auto &frame_rate_value = values[static_cast<int>(RtmpMetaDataKey::FrameRate)];
+    auto &video_frame_rate = values[static_cast<int>(RtmpMetaDataKey::VideoFrameRate)];
+    auto &width = values[static_cast<int>(RtmpMetaDataKey::Width)];
+    auto &height = values[static_cast<int>(RtmpMetaDataKey::Height)];
+    auto &video_data_rate = values[static_cast<int>(RtmpMetaDataKey::VideoDataRate)];
+    auto &bitrate = values[static_cast<int>(RtmpMetaDataKey::Bitrate)];
+    auto &max_bitrate = values[static_cast<int>(RtmpMetaDataKey::MaxBitrate)];
+    auto &audio_codec_id = values[static_cast<int>(RtmpMetaDataKey::AudioCodecId)];
+    auto &audio_data_rate = values[static_cast<int>(RtmpMetaDataKey::AudioDataRate)];
+    auto &audio_bitrate_value = values[static_cast<int>(RtmpMetaDataKey::AudioBitrate)];
+    auto &audio_channels_value = values[static_cast<int>(RtmpMetaDataKey::AudioChannels)];
+    auto &audio_samplerate_value = values[static_cast<int>(RtmpMetaDataKey::AudioSampleRate)];
+    auto &audio_samplesize_value = values[static_cast<int>(RtmpMetaDataKey::AudioSampleSize)];
+
+    // DeviceType
+    if (video_device.IsString())
+        _device_string = ov::String(video_device.string, video_device.string_length);    //DeviceType - XSplit
+    else if (encoder.IsString())
+        _device_string = ov::String(encoder.string, encoder.string_length);
 
     // Encoder 인식
     if (_device_string.IndexOf("Open Broadcaster") >= 0)
@@ -1519,85 +1616,72 @@ bool RtmpChunkStream::OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &messa
         encoder_type = RtmpEncoderType::Custom;
 
     // Video Codec
-    if ((index = object->FindName("videocodecid")) >= 0)
-    {
-        if (object->GetType(index) == AmfDataType::String && strcmp("avc1", object->GetString(index)) == 0)
-            video_codec_type = RtmpCodecType::H264;
-        else if (object->GetType(index) == AmfDataType::String && strcmp("H264Avc", object->GetString(index)) == 0)
-            video_codec_type = RtmpCodecType::H264;
-        else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == 7.0)
-            video_codec_type = RtmpCodecType::H264;
-    }
+    if (video_codec_id.IsStringEqual("avc1"))
+        video_codec_type = RtmpCodecType::H264;
+    else if (video_codec_id.IsStringEqual("H264Avc"))
+        video_codec_type = RtmpCodecType::H264;
+    else if (video_codec_id.IsNumber() && video_codec_id.number == 7.0)
+        video_codec_type = RtmpCodecType::H264;
 
     // Video Framerate
-    if ((index = object->FindName("framerate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        frame_rate = object->GetNumber(index);
-    else if ((index = object->FindName("videoframerate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        frame_rate = object->GetNumber(index);
+    if (frame_rate_value.IsNumber())
+        frame_rate = frame_rate_value.number;
+    else if (video_frame_rate.IsNumber())
+        frame_rate = video_frame_rate.number;
 
     // Video Width
-    if ((index = object->FindName("width")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        video_width = object->GetNumber(index);
+    if (width.IsNumber())
+        video_width = width.number;
 
     // Video Height
-    if ((index = object->FindName("height")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        video_height = object->GetNumber(index);
+    if (height.IsNumber())
+        video_height = height.number;
 
     // Video Bitrate
-    if ((index = object->FindName("videodatarate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        video_bitrate = object->GetNumber(index);    // Video Data Rate
-    if ((index = object->FindName("bitrate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        video_bitrate = object->GetNumber(index);    // Video Data Rate
-    if (((index = object->FindName("maxBitrate")) >= 0) && object->GetType(index) == AmfDataType::String)
-    {
-        bitrate_string = object->GetString(index);
-        video_bitrate = strtol(bitrate_string.CStr(), nullptr, 0);
-    }
+    if (video_data_rate.IsNumber())
+        video_bitrate = video_data_rate.number;    // Video Data Rate
+    if (bitrate.IsNumber())
+        video_bitrate = bitrate.number;    // Video Data Rate
+    if (max_bitrate.IsString())
+        video_bitrate = strtol(ov::String(max_bitrate.string, max_bitrate.string_length).CStr(), nullptr, 0);
 
     // Audio Codec
-    if ((index = object->FindName("audiocodecid")) >= 0)
-    {
-        if (object->GetType(index) == AmfDataType::String && strcmp("mp4a", object->GetString(index)) == 0)
-            audio_codec_type = RtmpCodecType::AAC;    //AAC
-        else if (object->GetType(index) == AmfDataType::String && strcmp("mp3", object->GetString(index)) == 0)
-            audio_codec_type = RtmpCodecType::MP3;    //MP3
-        else if (object->GetType(index) == AmfDataType::String && strcmp(".mp3", object->GetString(index)) == 0)
-            audio_codec_type = RtmpCodecType::MP3;    //MP3
-        else if (object->GetType(index) == AmfDataType::String && strcmp("speex", object->GetString(index)) == 0)
-            audio_codec_type = RtmpCodecType::SPEEX;//Speex
-        else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == 10.0)
-            audio_codec_type = RtmpCodecType::AAC;//AAC
-        else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == 11.0)
-            audio_codec_type = RtmpCodecType::SPEEX;//Speex
-        else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == 2.0)
-            audio_codec_type = RtmpCodecType::MP3;    //MP3
-    }
+    if (audio_codec_id.IsStringEqual("mp4a"))
+        audio_codec_type = RtmpCodecType::AAC;    //AAC
+    else if (audio_codec_id.IsStringEqual("mp3"))
+        audio_codec_type = RtmpCodecType::MP3;    //MP3
+    else if (audio_codec_id.IsStringEqual(".mp3"))
+        audio_codec_type = RtmpCodecType::MP3;    //MP3
+    else if (audio_codec_id.IsStringEqual("speex"))
+        audio_codec_type = RtmpCodecType::SPEEX;//Speex
+    else if (audio_codec_id.IsNumber() && audio_codec_id.number == 10.0)
+        audio_codec_type = RtmpCodecType::AAC;//AAC
+    else if (audio_codec_id.IsNumber() && audio_codec_id.number == 11.0)
+        audio_codec_type = RtmpCodecType::SPEEX;//Speex
+    else if (audio_codec_id.IsNumber() && audio_codec_id.number == 2.0)
+        audio_codec_type = RtmpCodecType::MP3;    //MP3
 
     // Audio bitreate
-    if ((index = object->FindName("audiodatarate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        audio_bitrate = object->GetNumber(index);    // Audio Data Rate
-    else if ((index = object->FindName("audiobitrate")) >= 0 && object->GetType(index) == AmfDataType::Number)
-        audio_bitrate = object->GetNumber(index);    // Audio Data Rate
+    if (audio_data_rate.IsNumber())
+        audio_bitrate = audio_data_rate.number;    // Audio Data Rate
+    else if (audio_bitrate_value.IsNumber())
+        audio_bitrate = audio_bitrate_value.number;    // Audio Data Rate
 
     // Audio Channels
-    if ((index = object->FindName("audiochannels")) >= 0)
-    {
-        if (object->GetType(index) == AmfDataType::Number)
-            audio_channels = object->GetNumber(index);
-        else if (object->GetType(index) == AmfDataType::String && strcmp("stereo", object->GetString(index)) == 0)
-            audio_channels = 2;
-        else if (object->GetType(index) == AmfDataType::String && strcmp("mono", object->GetString(index)) == 0)
-            audio_channels = 1;
-
-    }
+    if (audio_channels_value.IsNumber())
+        audio_channels = audio_channels_value.number;
+    else if (audio_channels_value.IsStringEqual("stereo"))
+        audio_channels = 2;
+    else if (audio_channels_value.IsStringEqual("mono"))
+        audio_channels = 1;
 
     // Audio samplerate
-    if ((index = object->FindName("audiosamplerate")) >= 0)
-        audio_samplerate = object->GetNumber(index);    // Audio Sample Rate
+    if (audio_samplerate_value.IsNumber())
+        audio_samplerate = audio_samplerate_value.number;    // Audio Sample Rate
 
     // Audio samplesize
-    if ((index = object->FindName("audiosamplesize")) >= 0)
-        audio_samplesize = object->GetNumber(index);    // Audio Sample Size
+    if (audio_samplesize_value.IsNumber())
+        audio_samplesize = audio_samplesize_value.number;    // Audio Sample Size
 
     // support codec check (H264/AAC 지원)
     if (!(video_codec_type == RtmpCodecType::H264) && !(audio_codec_type == RtmpCodecType::AAC))
@@ -21,6 +21,7 @@
 #include "chunk/rtmp_export_chunk.h"
 #include "chunk/rtmp_handshake.h"
 #include "chunk/amf_document.h"
+#include "chunk/amf_reader.h"
 
 //====================================================================================================
 // Interface
@@ -65,7 +66,7 @@ public:
     ~RtmpChunkStream() override = default;
 
 public:
-    int32_t OnDataReceived(const std::unique_ptr<std::vector<uint8_t>> &data);
+    int32_t OnDataReceived(const std::shared_ptr<const ov::Data> &data);
 
     static ov::String GetCodecString(RtmpCodecType codec_type);
 
@@ -88,11 +89,11 @@ public:
 private :
     bool SendData(int data_size, uint8_t *data);
 
-    int32_t ReceiveHandshakePacket(const std::shared_ptr<const std::vector<uint8_t>> &data);
+    int32_t ReceiveHandshakePacket(const uint8_t *data, int32_t data_size);
 
-    int32_t ReceiveChunkPacket(const std::shared_ptr<const std::vector<uint8_t>> &data);
+    int32_t ReceiveChunkPacket(const uint8_t *data, int32_t data_size);
 
-    bool SendHandshake(const std::shared_ptr<const std::vector<uint8_t>> &data);
+    bool SendHandshake(const uint8_t *data);
 
     bool ReceiveChunkMessage();
 
@@ -108,25 +109,21 @@ private :
 
     bool ReceiveVideoMessage(std::shared_ptr<ImportMessage> &message);
 
-    void
-    OnAmfConnect(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document, double transaction_id);
+    void OnAmfConnect(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader, double transaction_id);
 
     void OnAmfCreateStream(std::shared_ptr<RtmpMuxMessageHeader> &message_header,
-                            AmfDocument &document,
+                            AmfReader &reader,
                             double transaction_id);
 
-    void
-    OnAmfFCPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document, double transaction_id);
+    void OnAmfFCPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader, double transaction_id);
 
-    void
-    OnAmfPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document, double transaction_id);
+    void OnAmfPublish(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader, double transaction_id);
 
     void OnAmfDeleteStream(std::shared_ptr<RtmpMuxMessageHeader> &message_header,
-                            AmfDocument &document,
+                            AmfReader &reader,
                             double transaction_id);
 
-    bool
-    OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document, int32_t object_index);
+    bool OnAmfMetaData(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfReader &reader);
 
     bool SendMessagePacket(std::shared_ptr<RtmpMuxMessageHeader> &message_header,
                            std::shared_ptr<std::vector<uint8_t>> &data);
@@ -171,7 +168,7 @@ protected :
     uint32_t _stream_id;
     ov::String _device_string;
 
-    std::unique_ptr<std::vector<uint8_t>> _remained_data;
+    std::unique_ptr<std::vector<uint8_t>> _remained_data; // 처리하지 못한 수신 데이터(잘린 Chunk Header 등)
     RtmpHandshakeState _handshake_state;
     std::unique_ptr<RtmpImportChunk> _import_chunk;
     std::unique_ptr<RtmpExportChunk> _export_chunk;
@@ -68,7 +68,14 @@ bool RtmpProvider::Start()
 
     // RtmpServer 에 Observer 연결
     _rtmp_server->AddObserver(RtmpObserver::GetSharedPtr());
-    _rtmp_server->Start(ov::SocketAddress(_provider_info->GetPort()));
+    int thread_count = _provider_info->GetThreadCount();
+
+    if (thread_count <= 0)
+    {
+        thread_count = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    _rtmp_server->Start(ov::SocketAddress(_provider_info->GetPort()), thread_count);
 
     return Provider::Start();
 }
@@ -96,6 +103,9 @@ bool RtmpProvider::OnStreamReadyComplete(const ov::String &app_name,
                                             info::application_id_t &application_id,
                                             uint32_t &stream_id)
 {
+    // 여러 RtmpServerWorker에서 동시에 호출될 수 있으므로 중복 스트림 확인/생성을 묶어서 처리
+    std::lock_guard<std::mutex> lock(_stream_ready_mutex);
+
     // 어플리케이션 조회, 어플리케이션명에 해당하는 정보가 없다면 RTMP 커넥션을 종료함.
     auto application = std::dynamic_pointer_cast<RtmpApplication>(GetApplicationByName(app_name.CStr()));
     if (application == nullptr)
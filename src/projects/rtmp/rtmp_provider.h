@@ -73,5 +73,7 @@ private:
     const cfg::RtmpProvider *_provider_info;
 
     std::shared_ptr<RtmpServer> _rtmp_server;
+
+    std::mutex _stream_ready_mutex;
 };
 
@@ -21,8 +21,9 @@ RtmpServer::~RtmpServer()
 
 //====================================================================================================
 // Start
+// - worker_count 만큼 Worker Thread 생성
 //====================================================================================================
-bool RtmpServer::Start(const ov::SocketAddress &address)
+bool RtmpServer::Start(const ov::SocketAddress &address, int worker_count)
 {
     logtd("RtmpServer Start");
 
@@ -32,6 +33,25 @@ bool RtmpServer::Start(const ov::SocketAddress &address)
         return false;
     }
 
+    worker_count = std::max(MIN_RTMP_WORKER_COUNT, std::min(worker_count, MAX_RTMP_WORKER_COUNT));
+
+	_physical_port = PhysicalPortManager::Instance()->CreatePort(ov::SocketType::Tcp, address);
+
+	if(_physical_port == nullptr)
+	{
+		return false;
+	}
+
+    for(int index = 0; index < worker_count; index++)
+    {
+        auto worker = std::make_shared<RtmpServerWorker>(index, this);
+
+        worker->Start(_physical_port);
+        _workers.push_back(worker);
+    }
+
+    logtd("RtmpServer worker count(%d)", worker_count);
+
     // Gargabe Check Timer Setting
     _garbage_check_timer.Push([this](void *paramter) ->bool
                               {
@@ -42,14 +62,9 @@ bool RtmpServer::Start(const ov::SocketAddress &address)
     // Gargabe Check Timer Start
     _garbage_check_timer.Start();
 
-	_physical_port = PhysicalPortManager::Instance()->CreatePort(ov::SocketType::Tcp, address);
+	_physical_port->AddObserver(this);
 
-	if(_physical_port != nullptr)
-	{
-		_physical_port->AddObserver(this);
-	}
-
-	return _physical_port != nullptr;
+	return true;
 }
 
 //====================================================================================================
@@ -66,12 +81,30 @@ bool RtmpServer::Stop()
     _garbage_check_timer.Stop();
 
 	_physical_port->RemoveObserver(this);
+
+    for(auto &worker : _workers)
+    {
+        worker->Stop();
+    }
+    _workers.clear();
+
 	PhysicalPortManager::Instance()->DeletePort(_physical_port);
 	_physical_port = nullptr;
 
 	return true;
 }
 
+//====================================================================================================
+// GetWorker
+// - socket(fd) 기준으로 Worker 선택
+//====================================================================================================
+std::shared_ptr<RtmpServerWorker> &RtmpServer::GetWorker(const std::shared_ptr<ov::Socket> &remote)
+{
+    auto socket = static_cast<size_t>(remote->GetSocket().GetSocket());
+
+    return _workers[socket % _workers.size()];
+}
+
 //====================================================================================================
 // AddObserver
 // - RtmpOvserver 등록
@@ -120,88 +153,40 @@ bool RtmpServer::RemoveObserver(const std::shared_ptr<RtmpObserver> &observer)
 
 //====================================================================================================
 // OnConnected
-// - client 세션 추가
+// - client 세션 추가(Worker에서 처리)
 //====================================================================================================
 void RtmpServer::OnConnected(const std::shared_ptr<ov::Socket> &remote)
 {
     logtd("Rtmp encoder connected - remote(%s)", remote->ToString().CStr());
 
-    std::unique_lock<std::recursive_mutex> lock(_chunk_stream_list_mutex);
-
-    _chunk_stream_list[remote.get()] = std::make_shared<RtmpChunkStream>(dynamic_cast<ov::ClientSocket *>(remote.get()), this);
+    GetWorker(remote)->PushConnected(remote);
 }
 
 //====================================================================================================
 // Disconnect
 // - stream name은 중복 가능 해서 stream id 로 검색
+// - 어느 Worker가 처리 중인지 모르므로 모든 Worker에 요청(비동기)
 //====================================================================================================
 bool RtmpServer::Disconnect(const ov::String &app_name, uint32_t stream_id)
 {
-    std::unique_lock<std::recursive_mutex> lock(_chunk_stream_list_mutex);
-
-    for(auto item = _chunk_stream_list.begin(); item != _chunk_stream_list.end(); ++item)
+    for(auto &worker : _workers)
     {
-        auto chunk_stream = item->second;
-
-        if(chunk_stream->GetAppName() == app_name && chunk_stream->GetStreamId()== stream_id)
-        {
-	        _physical_port->DisconnectClient(dynamic_cast<ov::ClientSocket *>(item->first));
-            _chunk_stream_list.erase(item);
-            return true;
-        }
+        worker->PushDisconnectStream(app_name, stream_id);
     }
 
-    return false;
+    return true;
 }
 
 //====================================================================================================
 // OnDataReceived
 // - 데이터 수신
+// - 파싱/전달은 접속에 할당된 Worker에서 순서대로 처리
 //====================================================================================================
 void RtmpServer::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
                                 const ov::SocketAddress &address,
                                 const std::shared_ptr<const ov::Data> &data)
 {
-    std::unique_lock<std::recursive_mutex> lock(_chunk_stream_list_mutex);
-
-	auto item = _chunk_stream_list.find(remote.get());
-
-	// clinet 세션 확인
-	if(item != _chunk_stream_list.end())
-	{
-        // client 접속 상태 확인
-        if(remote->GetState() != ov::SocketState::Connected)
-        {
-            logte("Rtmp encoder erase - remote(%s)", remote->ToString().CStr());
-            _chunk_stream_list.erase(item);
-            return;
-        }
-
-        // 데이터 전달
-        auto process_data = std::make_unique<std::vector<uint8_t>>((uint8_t *)data->GetData(),
-                                                                   (uint8_t *)data->GetData() + data->GetLength());
-
-        if(item->second->OnDataReceived(std::move(process_data)) < 0)
-        {
-            // Stream Close
-            if(item->second->GetAppId() != 0 && item->second->GetStreamId() != 0)
-            {
-                OnDeleteStream(item->second->GetRemoteSocket(),
-                               item->second->GetAppName(),
-                               item->second->GetStreamName(),
-                               item->second->GetAppId(),
-                               item->second->GetStreamId());
-            }
-
-            // Socket Close
-	        _physical_port->DisconnectClient(dynamic_cast<ov::ClientSocket *>(item->first));
-
-            // Strema Close
-            _chunk_stream_list.erase(item);
-
-            return;
-        }
-    }
+    GetWorker(remote)->PushData(remote, data);
 }
 
 //====================================================================================================
@@ -213,32 +198,7 @@ void RtmpServer::OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
                                 PhysicalPortDisconnectReason reason,
                                 const std::shared_ptr<const ov::Error> &error)
 {
-	std::unique_lock<std::recursive_mutex> lock(_chunk_stream_list_mutex);
-
-    auto item = _chunk_stream_list.find(remote.get());
-
-    if(item != _chunk_stream_list.end())
-    {
-
-        logtd("Rtmp encoder disconnected - app(%s/%u) stream(%s/%u) remote(%s)",
-                item->second->GetAppName().CStr(),
-                item->second->GetAppId(),
-                item->second->GetStreamName().CStr(),
-                item->second->GetStreamId(),
-                remote->ToString().CStr());
-
-        // Stream Delete
-        if(item->second->GetAppId() != 0 && item->second->GetStreamId() != 0)
-        {
-            OnDeleteStream(item->second->GetRemoteSocket(),
-                           item->second->GetAppName(),
-                           item->second->GetStreamName(),
-                           item->second->GetAppId(),
-                           item->second->GetStreamId());
-        }
-
-        _chunk_stream_list.erase(item);
-    }
+    GetWorker(remote)->PushDisconnected(remote);
 }
 
 //====================================================================================================
@@ -371,51 +331,12 @@ bool RtmpServer::OnDeleteStream(ov::ClientSocket *remote,
 //====================================================================================================
 // Gerbage Check
 // - Last Packet Time Check
+// - 각 Worker에서 자신의 Chunk Stream만 확인
 //====================================================================================================
-#define MAX_STREAM_PACKET_GAP (10)
 void RtmpServer::OnGarbageCheck()
 {
-    time_t current_time = time(nullptr);
-
-    std::unique_lock<std::recursive_mutex> lock(_chunk_stream_list_mutex);
-
-    for(auto item = _chunk_stream_list.begin(); item != _chunk_stream_list.end();)
+    for(auto &worker : _workers)
     {
-        auto chunk_stream = item->second;
-
-        // 10초 Stream Packet 체크
-        if(current_time - chunk_stream->GetLastPacketTime() > MAX_STREAM_PACKET_GAP)
-        {
-
-            logtd("RtmpServer garbage check - stream time over remove - app(%s/%u) stream(%s/%u) gap(%d/%d) remote(%s)",
-                               item->second->GetAppName().CStr(),
-                    item->second->GetAppId(),
-                    item->second->GetStreamName().CStr(),
-                    item->second->GetStreamId(),
-                    current_time - chunk_stream->GetLastPacketTime(),
-                    MAX_STREAM_PACKET_GAP,
-                    item->first->ToString().CStr());
-
-            // Stream Close
-            if(item->second->GetAppId() != 0 && item->second->GetStreamId() != 0)
-            {
-                OnDeleteStream(item->second->GetRemoteSocket(),
-                                item->second->GetAppName(),
-                                item->second->GetStreamName(),
-                                item->second->GetAppId(),
-                                item->second->GetStreamId());
-            }
-
-            // Socket Close
-	        _physical_port->DisconnectClient(dynamic_cast<ov::ClientSocket *>(item->first));
-
-            // Strema Close
-            _chunk_stream_list.erase(item++);
-        }
-        else
-        {
-            item++;
-        }
+        worker->PushGarbageCheck();
     }
 }
-
@@ -9,6 +9,7 @@
 #pragma once
 #include <map>
 #include "rtmp_chunk_stream.h"
+#include "rtmp_server_worker.h"
 #include <base/ovsocket/ovsocket.h>
 #include <physical_port/physical_port_manager.h>
 #include "rtmp_observer.h"
@@ -24,7 +25,7 @@ public:
     virtual ~RtmpServer();
 
 public:
-    bool Start(const ov::SocketAddress &address);
+    bool Start(const ov::SocketAddress &address, int worker_count);
 
     bool Stop();
 
@@ -78,12 +79,16 @@ protected:
 
     void OnGarbageCheck();
 
+    // 접속(socket) 별로 항상 같은 Worker를 사용
+    std::shared_ptr<RtmpServerWorker> &GetWorker(const std::shared_ptr<ov::Socket> &remote);
+
 private :
     std::shared_ptr<PhysicalPort> _physical_port;
-    std::map<ov::Socket *, std::shared_ptr<RtmpChunkStream>> _chunk_stream_list;
     std::vector<std::shared_ptr<RtmpObserver>> _observers;
 
+    // 각 Worker가 자신에게 할당된 Chunk Stream을 관리(전역 lock 없음)
+    std::vector<std::shared_ptr<RtmpServerWorker>> _workers;
+
     ov::DelayQueue _garbage_check_timer;
-    std::recursive_mutex _chunk_stream_list_mutex; // 동일 Thread에서 접속 가능
 
 };
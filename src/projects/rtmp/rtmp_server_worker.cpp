@@ -0,0 +1,355 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_server_worker.h"
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG "RtmpProvider"
+
+#define MAX_STREAM_PACKET_GAP (10)
+
+//====================================================================================================
+// RtmpServerWorker
+//====================================================================================================
+RtmpServerWorker::RtmpServerWorker(int worker_id, IRtmpChunkStream *stream_interface)
+{
+    _worker_id = worker_id;
+    _stream_interface = stream_interface;
+    _stop_thread_flag = true;
+}
+
+//====================================================================================================
+// ~RtmpServerWorker
+//====================================================================================================
+RtmpServerWorker::~RtmpServerWorker()
+{
+    Stop();
+}
+
+//====================================================================================================
+// Start
+//====================================================================================================
+bool RtmpServerWorker::Start(const std::shared_ptr<PhysicalPort> &physical_port)
+{
+    if (!_stop_thread_flag)
+    {
+        return true;
+    }
+
+    _physical_port = physical_port;
+    _stop_thread_flag = false;
+    _worker_thread = std::thread(&RtmpServerWorker::WorkerThread, this);
+
+    return true;
+}
+
+//====================================================================================================
+// Stop
+//====================================================================================================
+bool RtmpServerWorker::Stop()
+{
+    if (_stop_thread_flag)
+    {
+        return true;
+    }
+
+    _stop_thread_flag = true;
+    _queue_event.Notify();
+    _worker_thread.join();
+
+    _chunk_stream_list.clear();
+    _physical_port = nullptr;
+
+    return true;
+}
+
+//====================================================================================================
+// Task 등록
+//====================================================================================================
+void RtmpServerWorker::PushConnected(const std::shared_ptr<ov::Socket> &remote)
+{
+    auto task = std::make_unique<Task>();
+
+    task->type = TaskType::Connected;
+    task->remote = remote;
+
+    PushTask(std::move(task));
+}
+
+void RtmpServerWorker::PushData(const std::shared_ptr<ov::Socket> &remote, const std::shared_ptr<const ov::Data> &data)
+{
+    auto task = std::make_unique<Task>();
+
+    task->type = TaskType::Data;
+    task->remote = remote;
+    task->data = data;
+
+    PushTask(std::move(task));
+}
+
+void RtmpServerWorker::PushDisconnected(const std::shared_ptr<ov::Socket> &remote)
+{
+    auto task = std::make_unique<Task>();
+
+    task->type = TaskType::Disconnected;
+    task->remote = remote;
+
+    PushTask(std::move(task));
+}
+
+void RtmpServerWorker::PushDisconnectStream(const ov::String &app_name, uint32_t stream_id)
+{
+    auto task = std::make_unique<Task>();
+
+    task->type = TaskType::DisconnectStream;
+    task->app_name = app_name;
+    task->stream_id = stream_id;
+
+    PushTask(std::move(task));
+}
+
+void RtmpServerWorker::PushGarbageCheck()
+{
+    auto task = std::make_unique<Task>();
+
+    task->type = TaskType::GarbageCheck;
+
+    PushTask(std::move(task));
+}
+
+void RtmpServerWorker::PushTask(std::unique_ptr<Task> task)
+{
+    std::unique_lock<std::mutex> lock(_task_queue_guard);
+    _task_queue.push(std::move(task));
+    lock.unlock();
+
+    _queue_event.Notify();
+}
+
+//====================================================================================================
+// Queue에 쌓인 Task를 모두 꺼낸다.
+//====================================================================================================
+bool RtmpServerWorker::PopTasks(std::vector<std::unique_ptr<Task>> &tasks)
+{
+    tasks.clear();
+
+    std::unique_lock<std::mutex> lock(_task_queue_guard);
+
+    while (!_task_queue.empty())
+    {
+        tasks.push_back(std::move(_task_queue.front()));
+        _task_queue.pop();
+    }
+
+    return !tasks.empty();
+}
+
+//====================================================================================================
+// Worker Thread
+// - 하나의 접속에 대한 Task는 항상 같은 Worker에서 순서대로 처리됨
+//====================================================================================================
+void RtmpServerWorker::WorkerThread()
+{
+    std::vector<std::unique_ptr<Task>> tasks;
+
+    logtd("RtmpServerWorker(%d) started", _worker_id);
+
+    while (!_stop_thread_flag)
+    {
+        _queue_event.Wait();
+
+        if (!PopTasks(tasks))
+        {
+            continue;
+        }
+
+        for (auto &task : tasks)
+        {
+            switch (task->type)
+            {
+                case TaskType::Connected:
+                    OnConnected(task->remote);
+                    break;
+                case TaskType::Data:
+                    OnDataReceived(task->remote, task->data);
+                    break;
+                case TaskType::Disconnected:
+                    OnDisconnected(task->remote);
+                    break;
+                case TaskType::DisconnectStream:
+                    OnDisconnectStream(task->app_name, task->stream_id);
+                    break;
+                case TaskType::GarbageCheck:
+                    OnGarbageCheck();
+                    break;
+            }
+        }
+
+        tasks.clear();
+    }
+
+    logtd("RtmpServerWorker(%d) stopped", _worker_id);
+}
+
+//====================================================================================================
+// OnConnected
+// - client 세션 추가
+//====================================================================================================
+void RtmpServerWorker::OnConnected(const std::shared_ptr<ov::Socket> &remote)
+{
+    auto &item = _chunk_stream_list[remote.get()];
+
+    item.remote = remote;
+    item.chunk_stream = std::make_shared<RtmpChunkStream>(dynamic_cast<ov::ClientSocket *>(remote.get()),
+                                                          _stream_interface);
+}
+
+//====================================================================================================
+// OnDataReceived
+// - 데이터 수신
+//====================================================================================================
+void RtmpServerWorker::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
+                                      const std::shared_ptr<const ov::Data> &data)
+{
+    auto item = _chunk_stream_list.find(remote.get());
+
+    // clinet 세션 확인
+    if (item == _chunk_stream_list.end())
+    {
+        return;
+    }
+
+    // client 접속 상태 확인
+    if (remote->GetState() != ov::SocketState::Connected)
+    {
+        logte("Rtmp encoder erase - remote(%s)", remote->ToString().CStr());
+        _chunk_stream_list.erase(item);
+        return;
+    }
+
+    if (item->second.chunk_stream->OnDataReceived(data) < 0)
+    {
+        CloseChunkStream(item->second, true);
+        _chunk_stream_list.erase(item);
+    }
+}
+
+//====================================================================================================
+// OnDisconnected
+// - client(Encoder) 문제로 접속 종료 이벤트 발생
+// - socket 세션은 호출한 ServerSocket에서 스스로 정리
+//====================================================================================================
+void RtmpServerWorker::OnDisconnected(const std::shared_ptr<ov::Socket> &remote)
+{
+    auto item = _chunk_stream_list.find(remote.get());
+
+    if (item == _chunk_stream_list.end())
+    {
+        return;
+    }
+
+    auto &chunk_stream = item->second.chunk_stream;
+
+    logtd("Rtmp encoder disconnected - app(%s/%u) stream(%s/%u) remote(%s)",
+          chunk_stream->GetAppName().CStr(),
+          chunk_stream->GetAppId(),
+          chunk_stream->GetStreamName().CStr(),
+          chunk_stream->GetStreamId(),
+          remote->ToString().CStr());
+
+    // Stream Delete
+    if (chunk_stream->GetAppId() != 0 && chunk_stream->GetStreamId() != 0)
+    {
+        _stream_interface->OnDeleteStream(chunk_stream->GetRemoteSocket(),
+                                          chunk_stream->GetAppName(),
+                                          chunk_stream->GetStreamName(),
+                                          chunk_stream->GetAppId(),
+                                          chunk_stream->GetStreamId());
+    }
+
+    _chunk_stream_list.erase(item);
+}
+
+//====================================================================================================
+// OnDisconnectStream
+// - stream name은 중복 가능 해서 stream id 로 검색
+// - 스트림 정보는 요청한 곳(Provider)에서 정리
+//====================================================================================================
+void RtmpServerWorker::OnDisconnectStream(const ov::String &app_name, uint32_t stream_id)
+{
+    for (auto item = _chunk_stream_list.begin(); item != _chunk_stream_list.end(); ++item)
+    {
+        auto &chunk_stream = item->second.chunk_stream;
+
+        if (chunk_stream->GetAppName() == app_name && chunk_stream->GetStreamId() == stream_id)
+        {
+            CloseChunkStream(item->second, false);
+            _chunk_stream_list.erase(item);
+            return;
+        }
+    }
+}
+
+//====================================================================================================
+// Gerbage Check
+// - Last Packet Time Check
+//====================================================================================================
+void RtmpServerWorker::OnGarbageCheck()
+{
+    time_t current_time = time(nullptr);
+
+    for (auto item = _chunk_stream_list.begin(); item != _chunk_stream_list.end();)
+    {
+        auto &chunk_stream = item->second.chunk_stream;
+
+        // 10초 Stream Packet 체크
+        if (current_time - chunk_stream->GetLastPacketTime() > MAX_STREAM_PACKET_GAP)
+        {
+            logtd("RtmpServer garbage check - stream time over remove - app(%s/%u) stream(%s/%u) gap(%d/%d) remote(%s)",
+                  chunk_stream->GetAppName().CStr(),
+                  chunk_stream->GetAppId(),
+                  chunk_stream->GetStreamName().CStr(),
+                  chunk_stream->GetStreamId(),
+                  current_time - chunk_stream->GetLastPacketTime(),
+                  MAX_STREAM_PACKET_GAP,
+                  item->second.remote->ToString().CStr());
+
+            CloseChunkStream(item->second, true);
+            _chunk_stream_list.erase(item++);
+        }
+        else
+        {
+            item++;
+        }
+    }
+}
+
+//====================================================================================================
+// Chunk Stream 종료
+// - delete_stream: Provider에 스트림 삭제 알림 여부
+//====================================================================================================
+void RtmpServerWorker::CloseChunkStream(ChunkStreamItem &item, bool delete_stream)
+{
+    auto &chunk_stream = item.chunk_stream;
+
+    // Stream Close
+    if (delete_stream && chunk_stream->GetAppId() != 0 && chunk_stream->GetStreamId() != 0)
+    {
+        _stream_interface->OnDeleteStream(chunk_stream->GetRemoteSocket(),
+                                          chunk_stream->GetAppName(),
+                                          chunk_stream->GetStreamName(),
+                                          chunk_stream->GetAppId(),
+                                          chunk_stream->GetStreamId());
+    }
+
+    // Socket Close
+    if (_physical_port != nullptr)
+    {
+        _physical_port->DisconnectClient(dynamic_cast<ov::ClientSocket *>(item.remote.get()));
+    }
+}
@@ -0,0 +1,109 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <map>
+#include <queue>
+#include <thread>
+#include "rtmp_chunk_stream.h"
+#include <base/ovlibrary/semaphore.h>
+#include <base/ovsocket/ovsocket.h>
+#include <physical_port/physical_port_manager.h>
+
+#define MIN_RTMP_WORKER_COUNT   1
+#define MAX_RTMP_WORKER_COUNT   72
+
+//====================================================================================================
+// RtmpServerWorker
+// - 접속(socket) 단위로 하나의 Worker에 할당되어 수신/파싱/전달을 처리
+// - Chunk Stream 목록은 Worker Thread에서만 접근하므로 별도의 lock이 필요 없음
+//====================================================================================================
+class RtmpServerWorker
+{
+public:
+    RtmpServerWorker(int worker_id, IRtmpChunkStream *stream_interface);
+
+    ~RtmpServerWorker();
+
+public:
+    bool Start(const std::shared_ptr<PhysicalPort> &physical_port);
+
+    bool Stop();
+
+    // PhysicalPort Thread에서 호출
+    void PushConnected(const std::shared_ptr<ov::Socket> &remote);
+
+    void PushData(const std::shared_ptr<ov::Socket> &remote, const std::shared_ptr<const ov::Data> &data);
+
+    void PushDisconnected(const std::shared_ptr<ov::Socket> &remote);
+
+    // 다른 Thread(Provider, Timer)에서 호출
+    void PushDisconnectStream(const ov::String &app_name, uint32_t stream_id);
+
+    void PushGarbageCheck();
+
+private:
+    enum class TaskType
+    {
+        Connected,
+        Data,
+        Disconnected,
+        DisconnectStream,
+        GarbageCheck,
+    };
+
+    struct Task
+    {
+        TaskType type;
+        std::shared_ptr<ov::Socket> remote;
+        std::shared_ptr<const ov::Data> data;
+        ov::String app_name;
+        uint32_t stream_id = 0;
+    };
+
+    struct ChunkStreamItem
+    {
+        // Worker가 처리하는 동안 socket이 해제되지 않도록 참조를 유지
+        std::shared_ptr<ov::Socket> remote;
+        std::shared_ptr<RtmpChunkStream> chunk_stream;
+    };
+
+    void PushTask(std::unique_ptr<Task> task);
+
+    bool PopTasks(std::vector<std::unique_ptr<Task>> &tasks);
+
+    void WorkerThread();
+
+    void OnConnected(const std::shared_ptr<ov::Socket> &remote);
+
+    void OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const std::shared_ptr<const ov::Data> &data);
+
+    void OnDisconnected(const std::shared_ptr<ov::Socket> &remote);
+
+    void OnDisconnectStream(const ov::String &app_name, uint32_t stream_id);
+
+    void OnGarbageCheck();
+
+    void CloseChunkStream(ChunkStreamItem &item, bool delete_stream);
+
+private:
+    int _worker_id;
+    IRtmpChunkStream *_stream_interface;
+    std::shared_ptr<PhysicalPort> _physical_port;
+
+    // Worker Thread 전용
+    std::map<ov::Socket *, ChunkStreamItem> _chunk_stream_list;
+
+    std::queue<std::unique_ptr<Task>> _task_queue;
+    std::mutex _task_queue_guard;
+    ov::Semaphore _queue_event;
+
+    bool _stop_thread_flag;
+    std::thread _worker_thread;
+};
@@ -0,0 +1,20 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# RTMP ingest(chunk parser -> bitstream filter) 성능 측정용 도구
+LOCAL_STATIC_LIBRARIES := \
+	rtmpprovider \
+	mediarouter \
+	socket \
+	ovlibrary \
+	bench_common
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl \
+	`pkg-config --libs srt` \
+	`pkg-config --libs openssl`
+
+LOCAL_TARGET := RtmpIngestBench
+
+include $(BUILD_EXECUTABLE)
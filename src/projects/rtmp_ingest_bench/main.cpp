@@ -0,0 +1,210 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+#include "rtmp_ingest_bench.h"
+#include "rtmp_ingest_source.h"
+
+#define OV_LOG_TAG                  "RtmpIngestBench"
+
+//====================================================================================================
+// 실행 옵션
+//====================================================================================================
+struct ParseOption
+{
+    // -f <capture_path> : 지정하지 않으면 합성 세션 사용
+    ov::String capture_path;
+    bool verbose = false;
+
+    RtmpIngestSourceOptions source;
+    RtmpIngestBenchOptions bench;
+};
+
+static void PrintUsage(const char *program)
+{
+    printf("Usage: %s [OPTION]...\n", program);
+    printf("  Input\n");
+    printf("    -f <path>     Replay a captured client->server RTMP byte stream (starts with C0)\n");
+    printf("    -d <sec>      Synthetic media duration (default: 10)\n");
+    printf("    -b <kbps>     Synthetic video bitrate (default: 2500)\n");
+    printf("    -a <kbps>     Synthetic audio bitrate (default: 128)\n");
+    printf("    -F <fps>      Synthetic frame rate (default: 30)\n");
+    printf("    -g <frames>   Synthetic GOP size (default: 60)\n");
+    printf("    -k <bytes>    Synthetic chunk size (default: 4096)\n");
+    printf("  Load\n");
+    printf("    -n <count>    Connection count (default: 1)\n");
+    printf("    -t <count>    Thread count (default: 1)\n");
+    printf("    -l <count>    Sessions per connection (default: 1)\n");
+    printf("    -s <bytes>    Bytes per read (default: 4096)\n");
+    printf("    -r <kbps>     Feed rate per connection, 0 = unlimited (default: 0)\n");
+    printf("    -p            Parse only (skip AnnexB/ADTS conversion)\n");
+    printf("    -v            Enable debug logs\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], ParseOption *parse_option)
+{
+    constexpr const char *opt_string = "hf:d:b:a:F:g:k:n:t:l:s:r:pv";
+
+    while (true)
+    {
+        int name = getopt(argc, argv, opt_string);
+
+        switch (name)
+        {
+            case -1:
+                return true;
+
+            case 'f':
+                parse_option->capture_path = optarg;
+                break;
+
+            case 'd':
+                parse_option->source.duration = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'b':
+                parse_option->source.video_bitrate = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'a':
+                parse_option->source.audio_bitrate = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'F':
+                parse_option->source.frame_rate = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'g':
+                parse_option->source.gop = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'k':
+                parse_option->source.chunk_size = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'n':
+                parse_option->bench.connection_count = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 't':
+                parse_option->bench.thread_count = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'l':
+                parse_option->bench.iteration_count = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 's':
+                parse_option->bench.read_size = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'r':
+                parse_option->bench.rate = ov::Converter::ToInt32(optarg);
+                break;
+
+            case 'p':
+                parse_option->bench.convert_bitstream = false;
+                break;
+
+            case 'v':
+                parse_option->verbose = true;
+                break;
+
+            case 'h':
+            default: // '?'
+                PrintUsage(argv[0]);
+                return false;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    ParseOption parse_option;
+
+    if (!TryParseOption(argc, argv, &parse_option))
+    {
+        return 1;
+    }
+
+    // 측정 중 debug log 출력이 결과에 영향을 주지 않도록 기본은 warning 이상만 출력
+    ov_log_set_level(parse_option.verbose ? OVLogLevelDebug : OVLogLevelWarning);
+
+    RtmpIngestSource source;
+
+    if (parse_option.capture_path.IsEmpty())
+    {
+        if (!source.Synthesize(parse_option.source))
+        {
+            return 1;
+        }
+    }
+    else if (!source.LoadFromFile(parse_option.capture_path))
+    {
+        return 1;
+    }
+
+    auto &bench_option = parse_option.bench;
+
+    printf("source     : %s, %zu bytes/session%s\n",
+           parse_option.capture_path.IsEmpty() ? "synthetic" : parse_option.capture_path.CStr(),
+           source.GetData().size(),
+           bench_option.convert_bitstream ? "" : " (parse only)");
+    printf("load       : %d connections / %d threads / %d sessions per connection / %d bytes per read / %s\n",
+           bench_option.connection_count,
+           bench_option.thread_count,
+           bench_option.iteration_count,
+           bench_option.read_size,
+           (bench_option.rate > 0) ? ov::String::FormatString("%d kbps", bench_option.rate).CStr() : "unlimited");
+
+    RtmpIngestBench bench(source.GetData(), bench_option);
+    RtmpIngestBenchResult result;
+
+    if (!bench.Run(result))
+    {
+        return 1;
+    }
+
+    double elapsed = std::max(result.elapsed_seconds, 0.000001);
+
+    printf("elapsed    : %.3f sec, %lu sessions (%lu failed), %lu reads\n",
+           result.elapsed_seconds,
+           result.session_count,
+           result.failed_session_count,
+           result.read_count);
+    printf("messages   : %lu (%.0f msgs/sec)\n",
+           result.message_count,
+           result.message_count / elapsed);
+    printf("bytes      : %lu (%.2f MB/sec, %.2f Mbps)\n",
+           result.byte_count,
+           result.byte_count / elapsed / (1024.0 * 1024.0),
+           result.byte_count * 8.0 / elapsed / 1000000.0);
+    printf("allocs     : %lu (%.2f per message)\n",
+           result.allocation_count,
+           (result.message_count > 0) ? static_cast<double>(result.allocation_count) / result.message_count : 0.0);
+    printf("latency    : p50 %.2f us, p99 %.2f us, p99.9 %.2f us, max %.2f us (per read)\n",
+           result.latency_p50 / 1000.0,
+           result.latency_p99 / 1000.0,
+           result.latency_p999 / 1000.0,
+           result.latency_max / 1000.0);
+
+    // 합성 세션은 전달되어야 할 메시지 수를 알고 있으므로 parser 회귀를 바로 확인할 수 있음
+    // (media frame + video/audio sequence header)
+    if (source.GetMediaMessageCount() > 0)
+    {
+        uint64_t expected = (source.GetMediaMessageCount() + 2) * (result.session_count - result.failed_session_count);
+
+        if (result.message_count != expected || result.failed_session_count > 0)
+        {
+            printf("MISMATCH   : expected %lu messages, delivered %lu\n", expected, result.message_count);
+            return 2;
+        }
+    }
+
+    return 0;
+}
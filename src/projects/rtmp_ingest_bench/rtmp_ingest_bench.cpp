@@ -0,0 +1,338 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_ingest_bench.h"
+#include <bench_common/allocation_counter.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#define OV_LOG_TAG                  "RtmpIngestBench"
+
+using BenchClock = std::chrono::steady_clock;
+
+//====================================================================================================
+// BenchSocket
+// - 실제 전송 없이 응답(S0/S1/S2, _result, onStatus 등)을 버림
+//====================================================================================================
+class BenchSocket : public ov::ClientSocket
+{
+public:
+    using ov::ClientSocket::Send;
+
+    ssize_t Send(const void *data, size_t length) override
+    {
+        return static_cast<ssize_t>(length);
+    }
+};
+
+//====================================================================================================
+// Connection
+// - encoder 접속 1개(RtmpChunkStream 1개)
+// - RtmpProvider::OnVideoData/OnAudioData와 같이 MediaPacket을 만들고
+//   MediaRouteStream과 같이 AnnexB/ADTS로 변환
+//====================================================================================================
+class RtmpIngestBench::Connection : public IRtmpChunkStream
+{
+public:
+    Connection(std::atomic<uint32_t> &last_stream_id, bool convert_bitstream)
+        : _last_stream_id(last_stream_id),
+          _convert_bitstream(convert_bitstream)
+    {
+    }
+
+    void StartSession()
+    {
+        _chunk_stream = std::make_shared<RtmpChunkStream>(&_socket, this);
+        _bsfv = std::make_unique<BitstreamToAnnexB>();
+        _bsfa = std::make_unique<BitstreamToADTS>();
+        _offset = 0;
+        _session_start_time = BenchClock::now();
+    }
+
+    //====================================================================================================
+    // IRtmpChunkStream 구현
+    //====================================================================================================
+    bool OnChunkStreamReadyComplete(ov::ClientSocket *remote,
+                                    ov::String &app_name, ov::String &stream_name,
+                                    std::shared_ptr<RtmpMediaInfo> &media_info,
+                                    info::application_id_t &applicaiton_id,
+                                    uint32_t &stream_id) override
+    {
+        applicaiton_id = 1;
+        stream_id = ++_last_stream_id;
+
+        return true;
+    }
+
+    bool OnChunkStreamVideoData(ov::ClientSocket *remote,
+                                info::application_id_t applicaiton_id,
+                                uint32_t stream_id,
+                                uint32_t timestamp,
+                                std::shared_ptr<std::vector<uint8_t>> &data) override
+    {
+        message_count++;
+
+        if (_convert_bitstream)
+        {
+            auto packet = std::make_unique<MediaPacket>(common::MediaType::Video,
+                                                        0,
+                                                        data->data(),
+                                                        data->size(),
+                                                        timestamp,
+                                                        MediaPacketFlag::NoFlag);
+
+            _bsfv->convert_to(packet.get());
+        }
+
+        return true;
+    }
+
+    bool OnChunkStreamAudioData(ov::ClientSocket *remote,
+                                info::application_id_t applicaiton_id,
+                                uint32_t stream_id,
+                                uint32_t timestamp,
+                                std::shared_ptr<std::vector<uint8_t>> &data) override
+    {
+        message_count++;
+
+        if (_convert_bitstream)
+        {
+            auto packet = std::make_unique<MediaPacket>(common::MediaType::Audio,
+                                                        1,
+                                                        data->data(),
+                                                        data->size(),
+                                                        timestamp,
+                                                        MediaPacketFlag::NoFlag);
+
+            _bsfa->convert_to(packet.get());
+        }
+
+        return true;
+    }
+
+    bool OnDeleteStream(ov::ClientSocket *remote,
+                        ov::String &app_name,
+                        ov::String &stream_name,
+                        info::application_id_t applicaiton_id,
+                        uint32_t stream_id) override
+    {
+        return true;
+    }
+
+public:
+    std::shared_ptr<RtmpChunkStream> _chunk_stream;
+    size_t _offset = 0;
+    int _iteration = 0;
+    bool _done = false;
+    BenchClock::time_point _session_start_time;
+
+    uint64_t message_count = 0;
+
+private:
+    std::atomic<uint32_t> &_last_stream_id;
+    bool _convert_bitstream;
+
+    BenchSocket _socket;
+    std::unique_ptr<BitstreamToAnnexB> _bsfv;
+    std::unique_ptr<BitstreamToADTS> _bsfa;
+};
+
+//====================================================================================================
+// RtmpIngestBench
+//====================================================================================================
+RtmpIngestBench::RtmpIngestBench(const std::vector<uint8_t> &source, const RtmpIngestBenchOptions &options)
+    : _source(source),
+      _options(options),
+      _last_stream_id(0)
+{
+}
+
+//====================================================================================================
+// Run
+// - 모든 접속의 모든 세션이 끝날 때까지 수행
+//====================================================================================================
+bool RtmpIngestBench::Run(RtmpIngestBenchResult &result)
+{
+    if (_source.empty() || _options.connection_count <= 0 || _options.thread_count <= 0 ||
+        _options.iteration_count <= 0 || _options.read_size <= 0)
+    {
+        logte("Invalid bench options - source(%zu) connection(%d) thread(%d) iteration(%d) read(%d)",
+              _source.size(),
+              _options.connection_count,
+              _options.thread_count,
+              _options.iteration_count,
+              _options.read_size);
+        return false;
+    }
+
+    int thread_count = std::min(_options.thread_count, _options.connection_count);
+    std::vector<ThreadResult> thread_results(thread_count);
+    std::vector<std::thread> threads;
+
+    auto start_time = BenchClock::now();
+
+    for (int index = 0; index < thread_count; index++)
+    {
+        threads.emplace_back(&RtmpIngestBench::WorkerThread, this, index, &thread_results[index]);
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    result = RtmpIngestBenchResult();
+    result.elapsed_seconds = std::chrono::duration<double>(BenchClock::now() - start_time).count();
+
+    std::vector<uint64_t> latencies;
+
+    for (auto &thread_result : thread_results)
+    {
+        result.session_count += thread_result.session_count;
+        result.failed_session_count += thread_result.failed_session_count;
+        result.byte_count += thread_result.byte_count;
+        result.message_count += thread_result.message_count;
+        result.allocation_count += thread_result.allocation_count;
+
+        latencies.insert(latencies.end(), thread_result.latencies.begin(), thread_result.latencies.end());
+    }
+
+    result.read_count = latencies.size();
+    result.latency_p50 = GetPercentile(latencies, 0.50);
+    result.latency_p99 = GetPercentile(latencies, 0.99);
+    result.latency_p999 = GetPercentile(latencies, 0.999);
+    result.latency_max = GetPercentile(latencies, 1.0);
+
+    return true;
+}
+
+//====================================================================================================
+// Worker Thread
+// - connection_count 중 thread_index에 해당하는 접속들을 read_size 단위로 번갈아 처리
+// - 측정 구간은 OnDataReceived() 호출(파싱 + Provider 전달 + bitstream 변환)
+//====================================================================================================
+void RtmpIngestBench::WorkerThread(int thread_index, ThreadResult *thread_result)
+{
+    int thread_count = std::min(_options.thread_count, _options.connection_count);
+    std::vector<std::unique_ptr<Connection>> connections;
+
+    for (int index = thread_index; index < _options.connection_count; index += thread_count)
+    {
+        connections.push_back(std::make_unique<Connection>(_last_stream_id, _options.convert_bitstream));
+        connections.back()->StartSession();
+    }
+
+    // 측정 중에는 latency 저장으로 인한 할당이 없도록 미리 확보
+    size_t reads_per_session = (_source.size() + _options.read_size - 1) / _options.read_size;
+    thread_result->latencies.reserve(reads_per_session * _options.iteration_count * connections.size());
+
+    // kbps -> byte/sec
+    double bytes_per_second = static_cast<double>(_options.rate) * 1000.0 / 8.0;
+    size_t active_count = connections.size();
+
+    while (active_count > 0)
+    {
+        bool fed = false;
+
+        for (auto &connection : connections)
+        {
+            if (connection->_done)
+            {
+                continue;
+            }
+
+            size_t size = std::min(static_cast<size_t>(_options.read_size), _source.size() - connection->_offset);
+
+            // 속도 제한: 세션 시작 이후 경과 시간만큼만 전달
+            if (bytes_per_second > 0.0)
+            {
+                double elapsed = std::chrono::duration<double>(BenchClock::now() - connection->_session_start_time).count();
+
+                if (static_cast<double>(connection->_offset + size) > (elapsed * bytes_per_second))
+                {
+                    continue;
+                }
+            }
+
+            // socket 수신 데이터와 같이 읽은 만큼을 ov::Data로 전달(복사 없음, 측정 구간 밖에서 생성)
+            auto data = std::make_shared<const ov::Data>(_source.data() + connection->_offset, size, true);
+
+            uint64_t allocation_count = GetThreadAllocationCount();
+            auto read_start_time = BenchClock::now();
+
+            int32_t process_size = connection->_chunk_stream->OnDataReceived(data);
+
+            auto read_end_time = BenchClock::now();
+            thread_result->allocation_count += GetThreadAllocationCount() - allocation_count;
+
+            thread_result->latencies.push_back(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time).count()));
+
+            fed = true;
+            connection->_offset += size;
+            thread_result->byte_count += size;
+
+            bool session_end = (connection->_offset >= _source.size());
+
+            if (process_size < 0)
+            {
+                logte("Session failed - connection(%s) offset(%zu)",
+                      connection->_chunk_stream->GetStreamName().CStr(),
+                      connection->_offset);
+
+                thread_result->failed_session_count++;
+                session_end = true;
+            }
+
+            if (session_end)
+            {
+                thread_result->session_count++;
+                connection->_iteration++;
+
+                if (connection->_iteration < _options.iteration_count)
+                {
+                    connection->StartSession();
+                }
+                else
+                {
+                    connection->_chunk_stream = nullptr;
+                    connection->_done = true;
+                    active_count--;
+                }
+            }
+        }
+
+        if (!fed)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    for (auto &connection : connections)
+    {
+        thread_result->message_count += connection->message_count;
+    }
+}
+
+//====================================================================================================
+// 백분위 값(ns)
+//====================================================================================================
+uint64_t RtmpIngestBench::GetPercentile(std::vector<uint64_t> &latencies, double percentile)
+{
+    if (latencies.empty())
+    {
+        return 0;
+    }
+
+    auto index = static_cast<size_t>(percentile * (latencies.size() - 1));
+
+    std::nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+
+    return latencies[index];
+}
@@ -0,0 +1,86 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <rtmp/rtmp_chunk_stream.h>
+#include <media_router/bitstream/bitstream_to_annexb.h>
+#include <media_router/bitstream/bitstream_to_adts.h>
+
+//====================================================================================================
+// 측정 설정
+//====================================================================================================
+struct RtmpIngestBenchOptions
+{
+    int connection_count = 1;
+    int thread_count = 1;       // RtmpServerWorker 수에 해당
+    int iteration_count = 1;    // 접속 당 세션 반복 횟수(매번 새 RtmpChunkStream 생성)
+    int read_size = 4096;       // socket 1회 수신 크기
+    int rate = 0;               // 접속 당 전송 속도(kbps), 0이면 제한 없음
+    bool convert_bitstream = true; // MediaRouteStream과 같이 AnnexB/ADTS 변환까지 수행
+};
+
+//====================================================================================================
+// 측정 결과
+//====================================================================================================
+struct RtmpIngestBenchResult
+{
+    double elapsed_seconds = 0.0;
+
+    uint64_t session_count = 0;
+    uint64_t failed_session_count = 0;
+    uint64_t read_count = 0;            // OnDataReceived() 호출 횟수
+    uint64_t byte_count = 0;            // 입력 byte
+    uint64_t message_count = 0;         // Provider로 전달된 Video/Audio 메시지
+    uint64_t allocation_count = 0;      // OnDataReceived() 수행 중 할당 횟수
+
+    // OnDataReceived() 1회 처리 시간(ns)
+    uint64_t latency_p50 = 0;
+    uint64_t latency_p99 = 0;
+    uint64_t latency_p999 = 0;
+    uint64_t latency_max = 0;
+};
+
+//====================================================================================================
+// RtmpIngestBench
+// - RtmpServerWorker와 같이 thread 하나가 여러 접속을 번갈아 가며 처리
+// - 네트워크/PhysicalPort 없이 준비된 byte stream을 read_size 단위로 RtmpChunkStream에 전달
+// - RtmpProvider 대신 MediaPacket 생성 + bitstream 변환까지만 수행(Application/MediaRouter 제외)
+//====================================================================================================
+class RtmpIngestBench
+{
+public:
+    RtmpIngestBench(const std::vector<uint8_t> &source, const RtmpIngestBenchOptions &options);
+
+    bool Run(RtmpIngestBenchResult &result);
+
+private:
+    class Connection;
+
+    struct ThreadResult
+    {
+        uint64_t session_count = 0;
+        uint64_t failed_session_count = 0;
+        uint64_t byte_count = 0;
+        uint64_t message_count = 0;
+        uint64_t allocation_count = 0;
+        std::vector<uint64_t> latencies;
+    };
+
+    void WorkerThread(int thread_index, ThreadResult *thread_result);
+
+    static uint64_t GetPercentile(std::vector<uint64_t> &latencies, double percentile);
+
+private:
+    const std::vector<uint8_t> &_source;
+    RtmpIngestBenchOptions _options;
+
+    std::atomic<uint32_t> _last_stream_id;
+};
@@ -0,0 +1,278 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_ingest_source.h"
+#include <fstream>
+#include <iterator>
+
+#define OV_LOG_TAG                  "RtmpIngestBench"
+
+#define BENCH_MEDIA_STREAM_ID       (1)
+#define BENCH_AUDIO_SAMPLERATE      (44100)
+#define BENCH_AAC_FRAME_SAMPLES     (1024)
+#define BENCH_KEY_FRAME_RATIO       (4)     // key frame 크기 = 평균 frame 크기 * 4
+
+// H264 Baseline 3.0 SPS/PPS (640x480)
+static const uint8_t g_bench_sps[] = { 0x67, 0x42, 0xC0, 0x1E, 0xDA, 0x02, 0x80, 0xF6, 0x84, 0x00, 0x00, 0x03, 0x00, 0x04,
+                                       0x00, 0x00, 0x03, 0x00, 0xF0, 0x3C, 0x58, 0xBA, 0x80 };
+static const uint8_t g_bench_pps[] = { 0x68, 0xCE, 0x0F, 0xC8 };
+
+// AAC LC / 44100hz / stereo
+static const uint8_t g_bench_audio_specific_config[] = { 0x12, 0x10 };
+
+//====================================================================================================
+// Synthesize
+// - 실제 encoder(OBS/ffmpeg)와 같은 순서로 메시지를 생성
+//  - C0 + C1, C2
+//  - Set Chunk Size, connect, createStream, publish, @setDataFrame(onMetaData)
+//  - Video/Audio Sequence Header, Video/Audio Frame(timestamp 순서)
+//====================================================================================================
+bool RtmpIngestSource::Synthesize(const RtmpIngestSourceOptions &options)
+{
+    if (options.chunk_size <= 0 || options.frame_rate <= 0 || options.gop <= 0 || options.duration <= 0)
+    {
+        logte("Invalid synthetic options - chunk(%d) fps(%d) gop(%d) duration(%d)",
+              options.chunk_size, options.frame_rate, options.gop, options.duration);
+        return false;
+    }
+
+    _data.clear();
+    _media_message_count = 0;
+    _random_seed = 0x12345678;
+
+    // encoder는 Set Chunk Size 이후의 메시지를 지정한 크기로 나누어 보냄
+    _export_chunk = std::make_unique<RtmpExportChunk>(true, options.chunk_size);
+
+    // C0 + C1 + C2
+    _data.push_back(RTMP_HANDSHAKE_VERSION);
+    _data.resize(_data.size() + RTMP_HANDSHAKE_PACKET_SIZE * 2, 0);
+
+    // Set Chunk Size
+    auto chunk_size_body = std::make_shared<std::vector<uint8_t>>(sizeof(uint32_t));
+    RtmpMuxUtil::WriteInt32(chunk_size_body->data(), static_cast<uint32_t>(options.chunk_size));
+    AppendMessage(RTMP_CHUNK_STREAM_ID_URGENT, 0, RTMP_MSGID_SET_CHUNK_SIZE, 0, chunk_size_body);
+
+    // connect
+    ov::String tc_url = ov::String::FormatString("rtmp://127.0.0.1:1935/%s", options.app_name.CStr());
+    AmfDocument connect_document;
+    auto connect_object = new AmfObject;
+
+    connect_object->AddProperty("app", options.app_name.CStr());
+    connect_object->AddProperty("type", "nonprivate");
+    connect_object->AddProperty("flashVer", "FMLE/3.0 (compatible; RtmpIngestBench)");
+    connect_object->AddProperty("tcUrl", tc_url.CStr());
+
+    connect_document.AddProperty(RTMP_CMD_NAME_CONNECT);
+    connect_document.AddProperty(1.0);
+    connect_document.AddProperty(connect_object);
+    AppendAmfMessage(RTMP_CHUNK_STREAM_ID_CONTROL, RTMP_MSGID_AMF0_COMMAND_MESSAGE, 0, connect_document);
+
+    // createStream
+    AmfDocument create_stream_document;
+
+    create_stream_document.AddProperty(RTMP_CMD_NAME_CREATESTREAM);
+    create_stream_document.AddProperty(2.0);
+    create_stream_document.AddProperty(AmfDataType::Null);
+    AppendAmfMessage(RTMP_CHUNK_STREAM_ID_CONTROL, RTMP_MSGID_AMF0_COMMAND_MESSAGE, 0, create_stream_document);
+
+    // publish
+    AmfDocument publish_document;
+
+    publish_document.AddProperty(RTMP_CMD_NAME_PUBLISH);
+    publish_document.AddProperty(3.0);
+    publish_document.AddProperty(AmfDataType::Null);
+    publish_document.AddProperty(options.stream_name.CStr());
+    publish_document.AddProperty("live");
+    AppendAmfMessage(RTMP_CHUNK_STREAM_ID_CONTROL, RTMP_MSGID_AMF0_COMMAND_MESSAGE, BENCH_MEDIA_STREAM_ID,
+                     publish_document);
+
+    // @setDataFrame(onMetaData)
+    AmfDocument meta_document;
+    auto meta_array = new AmfArray;
+
+    meta_array->AddProperty("width", 640.0);
+    meta_array->AddProperty("height", 480.0);
+    meta_array->AddProperty("framerate", static_cast<double>(options.frame_rate));
+    meta_array->AddProperty("videocodecid", 7.0);
+    meta_array->AddProperty("videodatarate", static_cast<double>(options.video_bitrate));
+    meta_array->AddProperty("audiocodecid", 10.0);
+    meta_array->AddProperty("audiodatarate", static_cast<double>(options.audio_bitrate));
+    meta_array->AddProperty("audiosamplerate", static_cast<double>(BENCH_AUDIO_SAMPLERATE));
+    meta_array->AddProperty("audiochannels", 2.0);
+    meta_array->AddProperty("encoder", "RtmpIngestBench");
+
+    meta_document.AddProperty(RTMP_CMD_DATA_SETDATAFRAME);
+    meta_document.AddProperty(RTMP_CMD_DATA_ONMETADATA);
+    meta_document.AddProperty(meta_array);
+    AppendAmfMessage(RTMP_CHUNK_STREAM_ID_MEDIA, RTMP_MSGID_AMF0_DATA_MESSAGE, BENCH_MEDIA_STREAM_ID, meta_document);
+
+    // Video Sequence Header(AVCDecoderConfigurationRecord)
+    auto video_header = std::make_shared<std::vector<uint8_t>>();
+
+    video_header->insert(video_header->end(), { RTMP_H264_I_FRAME_TYPE, RTMP_SEQUENCE_INFO_TYPE, 0x00, 0x00, 0x00 });
+    video_header->insert(video_header->end(), { 0x01, g_bench_sps[1], g_bench_sps[2], g_bench_sps[3], 0xFF, 0xE1 });
+    video_header->insert(video_header->end(), { 0x00, static_cast<uint8_t>(sizeof(g_bench_sps)) });
+    video_header->insert(video_header->end(), g_bench_sps, g_bench_sps + sizeof(g_bench_sps));
+    video_header->insert(video_header->end(), { 0x01, 0x00, static_cast<uint8_t>(sizeof(g_bench_pps)) });
+    video_header->insert(video_header->end(), g_bench_pps, g_bench_pps + sizeof(g_bench_pps));
+    AppendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, 0, RTMP_MSGID_VIDEO_MESSAGE, BENCH_MEDIA_STREAM_ID, video_header);
+
+    // Audio Sequence Header(AudioSpecificConfig)
+    auto audio_header = std::make_shared<std::vector<uint8_t>>();
+
+    audio_header->insert(audio_header->end(), { 0xAF, RTMP_SEQUENCE_INFO_TYPE });
+    audio_header->insert(audio_header->end(),
+                         g_bench_audio_specific_config,
+                         g_bench_audio_specific_config + sizeof(g_bench_audio_specific_config));
+    AppendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, 0, RTMP_MSGID_AUDIO_MESSAGE, BENCH_MEDIA_STREAM_ID, audio_header);
+
+    // frame 크기 계산 (GOP 전체 크기가 bitrate에 맞도록 key frame에 더 많이 할당)
+    int average_video_size = std::max(options.video_bitrate * 1000 / 8 / options.frame_rate, 64);
+    int key_frame_size = average_video_size * BENCH_KEY_FRAME_RATIO;
+    int p_frame_size = average_video_size;
+
+    if (options.gop > 1)
+    {
+        p_frame_size = std::max((average_video_size * options.gop - key_frame_size) / (options.gop - 1), 64);
+    }
+
+    int audio_frame_size = std::max(options.audio_bitrate * 1000 / 8 * BENCH_AAC_FRAME_SAMPLES / BENCH_AUDIO_SAMPLERATE, 8);
+
+    // video/audio를 timestamp 순서로 섞어서 생성
+    int64_t video_frame_count = static_cast<int64_t>(options.duration) * options.frame_rate;
+    int64_t audio_frame_count = static_cast<int64_t>(options.duration) * BENCH_AUDIO_SAMPLERATE / BENCH_AAC_FRAME_SAMPLES;
+    int64_t video_index = 0;
+    int64_t audio_index = 0;
+
+    while (video_index < video_frame_count || audio_index < audio_frame_count)
+    {
+        auto video_timestamp = static_cast<uint32_t>(video_index * 1000 / options.frame_rate);
+        auto audio_timestamp = static_cast<uint32_t>(audio_index * BENCH_AAC_FRAME_SAMPLES * 1000 / BENCH_AUDIO_SAMPLERATE);
+
+        if (video_index < video_frame_count && (audio_index >= audio_frame_count || video_timestamp <= audio_timestamp))
+        {
+            bool key_frame = (video_index % options.gop) == 0;
+
+            AppendVideoFrame(video_timestamp, key_frame, key_frame ? key_frame_size : p_frame_size);
+            video_index++;
+        }
+        else
+        {
+            AppendAudioFrame(audio_timestamp, audio_frame_size);
+            audio_index++;
+        }
+    }
+
+    _export_chunk = nullptr;
+
+    return true;
+}
+
+//====================================================================================================
+// LoadFromFile
+// - client -> server 방향만 저장한 raw capture (예: Wireshark "Follow TCP Stream" -> Raw)
+//====================================================================================================
+bool RtmpIngestSource::LoadFromFile(const ov::String &file_path)
+{
+    std::ifstream file(file_path.CStr(), std::ios::binary);
+
+    if (!file.is_open())
+    {
+        logte("Could not open file - path(%s)", file_path.CStr());
+        return false;
+    }
+
+    _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    _media_message_count = 0;
+
+    if (_data.size() < (1 + RTMP_HANDSHAKE_PACKET_SIZE * 2) || _data[0] != RTMP_HANDSHAKE_VERSION)
+    {
+        logte("Not a client-side rtmp capture - path(%s) size(%zu)", file_path.CStr(), _data.size());
+        return false;
+    }
+
+    return true;
+}
+
+//====================================================================================================
+// Message -> Chunk 변환 후 추가
+//====================================================================================================
+void RtmpIngestSource::AppendMessage(uint32_t chunk_stream_id, uint32_t timestamp, uint8_t type_id,
+                                     uint32_t stream_id, std::shared_ptr<std::vector<uint8_t>> &body)
+{
+    auto message_header = std::make_shared<RtmpMuxMessageHeader>(chunk_stream_id,
+                                                                timestamp,
+                                                                type_id,
+                                                                stream_id,
+                                                                body->size());
+
+    auto chunk_data = _export_chunk->ExportStreamData(message_header, body);
+
+    _data.insert(_data.end(), chunk_data->begin(), chunk_data->end());
+}
+
+void RtmpIngestSource::AppendAmfMessage(uint32_t chunk_stream_id, uint8_t type_id, uint32_t stream_id,
+                                        AmfDocument &document)
+{
+    auto body = std::make_shared<std::vector<uint8_t>>(2048);
+
+    body->resize(document.Encode(body->data()));
+
+    AppendMessage(chunk_stream_id, 0, type_id, stream_id, body);
+}
+
+//====================================================================================================
+// Video Frame
+// - control(1) + avc packet type(1) + composition time(3) + [nal size(4) + nal]
+//====================================================================================================
+void RtmpIngestSource::AppendVideoFrame(uint32_t timestamp, bool key_frame, int frame_size)
+{
+    const int header_size = 5 + 4;
+    int nal_size = std::max(frame_size - header_size, 2);
+    auto body = std::make_shared<std::vector<uint8_t>>(header_size + nal_size);
+    uint8_t *data = body->data();
+
+    data[0] = key_frame ? RTMP_H264_I_FRAME_TYPE : RTMP_H264_P_FRAME_TYPE;
+    data[1] = 0x01;
+    data[2] = data[3] = data[4] = 0x00;
+    RtmpMuxUtil::WriteInt32(data + 5, static_cast<uint32_t>(nal_size));
+    data[9] = key_frame ? 0x65 : 0x41;  // IDR / non-IDR slice
+    FillPayload(data + 10, nal_size - 1);
+
+    AppendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, timestamp, RTMP_MSGID_VIDEO_MESSAGE, BENCH_MEDIA_STREAM_ID, body);
+    _media_message_count++;
+}
+
+//====================================================================================================
+// Audio Frame
+// - control(1) + aac packet type(1) + raw aac
+//====================================================================================================
+void RtmpIngestSource::AppendAudioFrame(uint32_t timestamp, int frame_size)
+{
+    auto body = std::make_shared<std::vector<uint8_t>>(2 + frame_size);
+    uint8_t *data = body->data();
+
+    data[0] = 0xAF;
+    data[1] = 0x01;
+    FillPayload(data + 2, frame_size);
+
+    AppendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, timestamp, RTMP_MSGID_AUDIO_MESSAGE, BENCH_MEDIA_STREAM_ID, body);
+    _media_message_count++;
+}
+
+//====================================================================================================
+// 임의의 payload (같은 옵션이면 항상 같은 byte stream이 생성되도록 고정 seed 사용)
+//====================================================================================================
+void RtmpIngestSource::FillPayload(uint8_t *data, int size)
+{
+    for (int index = 0; index < size; index++)
+    {
+        _random_seed = _random_seed * 1103515245 + 12345;
+        data[index] = static_cast<uint8_t>(_random_seed >> 16);
+    }
+}
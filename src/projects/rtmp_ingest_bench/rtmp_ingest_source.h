@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <base/ovlibrary/ovlibrary.h>
+#include <rtmp/chunk/rtmp_export_chunk.h>
+#include <rtmp/chunk/amf_document.h>
+
+//====================================================================================================
+// 합성(synthetic) 세션 설정
+//====================================================================================================
+struct RtmpIngestSourceOptions
+{
+    ov::String app_name = "app";
+    ov::String stream_name = "stream";
+
+    int chunk_size = 4096;      // encoder가 Set Chunk Size로 지정하는 크기
+    int duration = 10;          // 초 단위 미디어 길이
+    int frame_rate = 30;
+    int gop = 60;               // key frame 간격(frame)
+    int video_bitrate = 2500;   // kbps
+    int audio_bitrate = 128;    // kbps
+};
+
+//====================================================================================================
+// RtmpIngestSource
+// - encoder(client) -> server 방향의 RTMP byte stream을 준비
+//  - 합성 : handshake + connect + createStream + publish + onMetaData + H264/AAC FLV tag
+//  - 재생 : 캡처한 client -> server 방향 raw byte(C0 부터 시작)를 그대로 사용
+//====================================================================================================
+class RtmpIngestSource
+{
+public:
+    bool Synthesize(const RtmpIngestSourceOptions &options);
+
+    bool LoadFromFile(const ov::String &file_path);
+
+    const std::vector<uint8_t> &GetData() const { return _data; }
+
+    // 합성한 경우에만 유효(재생 시에는 0)
+    uint32_t GetMediaMessageCount() const { return _media_message_count; }
+
+private:
+    void AppendMessage(uint32_t chunk_stream_id, uint32_t timestamp, uint8_t type_id, uint32_t stream_id,
+                       std::shared_ptr<std::vector<uint8_t>> &body);
+
+    void AppendAmfMessage(uint32_t chunk_stream_id, uint8_t type_id, uint32_t stream_id, AmfDocument &document);
+
+    void AppendVideoFrame(uint32_t timestamp, bool key_frame, int frame_size);
+
+    void AppendAudioFrame(uint32_t timestamp, int frame_size);
+
+    void FillPayload(uint8_t *data, int size);
+
+private:
+    std::vector<uint8_t> _data;
+    std::unique_ptr<RtmpExportChunk> _export_chunk;
+    uint32_t _media_message_count = 0;
+    uint32_t _random_seed = 0x12345678;
+};
@@ -23,6 +23,17 @@ bool RtpRtcp::SendOutgoingData(std::shared_ptr<ov::Data> packet)
 	return node->SendData(GetNodeType(), packet);
 }
 
+bool RtpRtcp::SendOutgoingData(const std::vector<std::shared_ptr<ov::Data>> &packets)
+{
+	auto node = GetLowerNode();
+	if(!node)
+	{
+		return false;
+	}
+
+	return node->SendDataBatch(GetNodeType(), packets);
+}
+
 bool RtpRtcp::SendData(SessionNodeType from_node, const std::shared_ptr<ov::Data> &data)
 {
 	// RTPRTCP는 Send를 하는 첫번째 NODE이므로 SendData를 통해 스트림을 받지 않고 SendOutgoingData를 사용한다.
@@ -14,6 +14,8 @@ public:
 
 	// 패킷을 전송한다. 성능을 위해 상위에서 Packetizing을 하는 경우 사용한다.
 	bool SendOutgoingData(std::shared_ptr<ov::Data> packet);
+	// 한 프레임을 구성하는 여러 패킷을 한번에 전송한다. (SRTP에서 일괄 암호화)
+	bool SendOutgoingData(const std::vector<std::shared_ptr<ov::Data>> &packets);
 
 	// Implement SessionNode Interface
 	// RtpRtcp는 최상위 노드로 SendData를 사용하지 않는다. SendOutgoingData를 사용한다.
@@ -7,7 +7,6 @@
 //
 //==============================================================================
 
-#include <regex>
 #include "common_attr.h"
 
 CommonAttr::CommonAttr()
@@ -49,55 +48,40 @@ bool CommonAttr::SerializeCommonAttr(ov::String &sdp)
 	return true;
 }
 
-bool CommonAttr::ParsingCommonAttrLine(char type, std::string content)
+bool CommonAttr::ParsingCommonAttrLine(char type, SdpTokenizer content)
 {
-	std::smatch matches;
-
 	// a=fingerprint:sha-256 D7:81:CF:01:46:FB:2D
-	if(content.compare(0, OV_COUNTOF("fi") - 1, "fi") == 0)
+	if(content.SkipPrefix("fingerprint:"))
 	{
-		if(std::regex_search(content, matches, std::regex("^fingerprint:(\\S*) (\\S*)")))
+		auto algorithm = content.NextNonSpaceToken();
+
+		if(content.SkipChar(' '))
 		{
-			_fingerprint_algorithm = std::string(matches[1]).c_str();
-			_fingerprint_value = std::string(matches[2]).c_str();
+			_fingerprint_algorithm = algorithm.ToString();
+			_fingerprint_value = content.NextNonSpaceToken().ToString();
 		}
 	}
 		// a=ice-options:trickle
-	else if(content.compare(0, OV_COUNTOF("ice-o") - 1, "ice-o") == 0)
+	else if(content.SkipPrefix("ice-options:"))
 	{
-		if(std::regex_search(content, matches, std::regex("^ice-options:(\\S*)")))
-		{
-			_ice_option = std::string(matches[1]).c_str();
-		}
+		_ice_option = content.NextNonSpaceToken().ToString();
 	}
 		// a=ice-ufrag:0dfa46c9
-	else if(content.compare(0, OV_COUNTOF("ice-u") - 1, "ice-u") == 0)
+	else if(content.SkipPrefix("ice-ufrag:"))
 	{
-		if(std::regex_search(content, matches, std::regex("^ice-ufrag:(\\S*)")))
-		{
-			_ice_ufrag = std::string(matches[1]).c_str();
-		}
+		_ice_ufrag = content.NextNonSpaceToken().ToString();
 	}
-	else if(content.compare(0, OV_COUNTOF("ice-p") - 1, "ice-p") == 0)
+	else if(content.SkipPrefix("ice-pwd:"))
 	{
-		if(std::regex_search(content, matches, std::regex("^ice-pwd:(\\S*)")))
-		{
-			_ice_pwd = std::string(matches[1]).c_str();
-		}
+		_ice_pwd = content.NextNonSpaceToken().ToString();
 	}
-	else if(content.compare(0, OV_COUNTOF("fmtp") - 1, "fmtp") == 0)
+	else if(content.StartsWith("fmtp:"))
 	{
-		if(std::regex_search(content, matches, std::regex("fmtp:(\\d*) (.*)profile-level-id=(.*)")))
-		{
-			// a=fmtp:97 level-asymmetry-allowed=1;packetization-mode=0;profile-level-id=42e01f
-		}
+		// a=fmtp:97 level-asymmetry-allowed=1;packetization-mode=0;profile-level-id=42e01f
 	}
-	else if(content.compare(0, OV_COUNTOF("rtcp:") - 1, "rtcp:") == 0)
+	else if(content.StartsWith("rtcp:"))
 	{
-		if(std::regex_search(content, matches, std::regex("rtcp:(\\d*) IN (.*)")))
-		{
-			// a=rtcp:9 IN IP4 0.0.0.0
-		}
+		// a=rtcp:9 IN IP4 0.0.0.0
 	}
 	else
 	{
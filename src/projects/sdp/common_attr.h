@@ -13,6 +13,7 @@
 // Session Level과 Media Level 양쪽에서 모두 사용될 수 있는 Attribute
 
 #include "sdp_base.h"
+#include "sdp_tokenizer.h"
 
 class CommonAttr
 {
@@ -21,7 +22,7 @@ protected:
 	~CommonAttr();
 
 	bool			SerializeCommonAttr(ov::String &sdp);
-	bool			ParsingCommonAttrLine(char type, std::string content);
+	bool			ParsingCommonAttrLine(char type, SdpTokenizer content);
 
 public:
 	// a=fingerprint:sha-256 D7:81:CF:01:46:FB:2D
@@ -10,8 +10,6 @@
 #include "media_description.h"
 #include "session_description.h"
 
-#include <regex>
-
 MediaDescription::MediaDescription(const std::shared_ptr<SessionDescription> &session_desc)
 {
 	_session_description = session_desc;
@@ -162,22 +160,15 @@ bool MediaDescription::SetMediaType(const ov::String &type)
 
 bool MediaDescription::FromString(const ov::String &desc)
 {
-	std::stringstream sdpstream(desc.CStr());
-	std::string line;
+	SdpTokenizer lines(desc);
+	char type;
+	SdpTokenizer content;
 
-	while(std::getline(sdpstream, line, '\n'))
+	while(lines.NextLine(&type, &content))
 	{
-		if(line.size() && line[line.length() - 1] == '\r')
-		{
-			line.pop_back();
-		}
-
-		char type = line[0];
-		std::string content = line.substr(2);
-
 		if(ParsingMediaLine(type, content) == false)
 		{
-			logw("SDP", "Could not parse line: %c: %s (%s)", type, content.c_str(), line.c_str());
+			logw("SDP", "Could not parse line: %c=%.*s", type, static_cast<int>(content.GetLength()), content.GetData());
 			return false;
 		}
 	}
@@ -211,204 +202,180 @@ bool MediaDescription::SetDirection(const ov::String &dir)
 	return true;
 }
 
-bool MediaDescription::ParsingMediaLine(char type, std::string content)
+bool MediaDescription::ParsingMediaLine(char type, SdpTokenizer content)
 {
 	bool parsing_error = false;
-	std::smatch matches;
+	// 에러 로그 출력용
+	const SdpTokenizer line = content;
 
 	switch(type)
 	{
 		case 'm':
+		{
 			// m=video 9 UDP/TLS/RTP/SAVPF 97
+			auto media_type = content.NextToken(' ');
+			uint32_t port;
+			ov::String protocol;
 
-			if(std::regex_search(content, matches, std::regex("^(\\w*) (\\d*) ([\\w\\/]*)(?: (.*))?")))
+			if(content.IsEmpty() || (content.NextToken(' ').ToUInt32(&port) == false))
 			{
-				if(matches.size() < 4 + 1)
-				{
-					parsing_error = true;
-					break;
-				}
-
-				if(!SetMediaType(std::string(matches[1]).c_str()))
-				{
-					parsing_error = true;
-					break;
-				}
+				// 필수값 이므로 m이 에러가 나면 실패
+				parsing_error = true;
+				break;
+			}
 
-				SetPort(std::stoul(matches[2]));
+			if(!SetMediaType(media_type.ToString()))
+			{
+				parsing_error = true;
+				break;
+			}
 
-				ov::String protocol = std::string(matches[3]).c_str();
-				if(protocol.UpperCaseString() == "UDP/TLS/RTP/SAVPF")
-				{
-					UseDtls(true);
-				}
-				else if(protocol.UpperCaseString() == "RTP/AVPF")
-				{
-					UseDtls(false);
-				}
-				else
-				{
-					loge("SDP", "Cannot support %s protocol", protocol.CStr());
-					parsing_error = true;
-					break;
-				}
+			SetPort(static_cast<uint16_t>(port));
 
-				// Payload를 모두 생성하여 넣는다.
-				// 나중에 Payload에 관련된 정보(rtpmap, fmtp, rtcp-fb)가 나오면 파싱하여 해당 Payload에 값을 설정한다.
-				std::string payload_number;
-				std::stringstream payload_numbers(matches[4]);
-				while(std::getline(payload_numbers, payload_number, ' '))
-				{
-					auto payload = std::make_shared<PayloadAttr>();
-					payload->SetId(static_cast<uint8_t>(std::stoul(payload_number)));
-					AddPayload(payload);
-				}
+			protocol = content.NextToken(' ').ToString();
+			if(protocol.UpperCaseString() == "UDP/TLS/RTP/SAVPF")
+			{
+				UseDtls(true);
+			}
+			else if(protocol.UpperCaseString() == "RTP/AVPF")
+			{
+				UseDtls(false);
 			}
 			else
 			{
-				// 필수값 이므로 m이 에러가 나면 실패
+				loge("SDP", "Cannot support %s protocol", protocol.CStr());
 				parsing_error = true;
+				break;
 			}
-			break;
-		case 'c':
-			// c=IN IP4 0.0.0.0
-			if(std::regex_search(content, matches, std::regex("^IN IP(\\d) (\\S*)")))
+
+			// Payload를 모두 생성하여 넣는다.
+			// 나중에 Payload에 관련된 정보(rtpmap, fmtp, rtcp-fb)가 나오면 파싱하여 해당 Payload에 값을 설정한다.
+			while(content.IsEmpty() == false)
 			{
-				if(matches.size() != 2 + 1)
+				uint32_t payload_number;
+
+				if(content.NextToken(' ').ToUInt32(&payload_number) == false)
 				{
 					parsing_error = true;
 					break;
 				}
 
-				SetConnection(std::stoul(matches[1]), std::string(matches[2]).c_str());
+				auto payload = std::make_shared<PayloadAttr>();
+				payload->SetId(static_cast<uint8_t>(payload_number));
+				AddPayload(payload);
 			}
-			else
+
+			break;
+		}
+
+		case 'c':
+		{
+			// c=IN IP4 0.0.0.0
+			uint32_t ip_version;
+
+			if((content.SkipPrefix("IN IP") == false) || (content.NextToken(' ').ToUInt32(&ip_version) == false))
 			{
 				// 필수값 이므로 m이 에러가 나면 실패
 				parsing_error = true;
+				break;
 			}
 
+			SetConnection(static_cast<uint8_t>(ip_version), content.NextNonSpaceToken().ToString());
 			break;
+		}
 
 		case 'a':
-			// For Performance
-			if(content.compare(0, OV_COUNTOF("rtp") - 1,"rtp") == 0)
+			if(content.SkipPrefix("rtpmap:"))
 			{
 				// a=rtpmap:96 VP8/50000/?
-				if(std::regex_search(content,
-				                     matches,
-				                     std::regex("rtpmap:(\\d*) ([\\w\\-\\.]*)(?:\\s*\\/(\\d*)(?:\\s*\\/(\\S*))?)?")))
+				uint32_t payload_type;
+				uint32_t rate;
+
+				if(content.NextToken(' ').ToUInt32(&payload_type) == false)
+				{
+					parsing_error = true;
+					break;
+				}
+
+				auto codec = content.NextToken('/');
+
+				if(content.NextToken('/').ToUInt32(&rate) == false)
 				{
-					if(matches.size() < 3 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
-
-					//TODO(getroot): matches[4]가 없는 경우에도 메모리는 할당 되는지 확인
-					AddRtpmap(static_cast<uint8_t>(std::stoul(matches[1])), std::string(matches[2]).c_str(),
-					          static_cast<uint32_t>(std::stoul(matches[3])), std::string(matches[4]).c_str());
+					parsing_error = true;
+					break;
 				}
+
+				AddRtpmap(static_cast<uint8_t>(payload_type), codec.ToString(), rate, content.NextNonSpaceToken().ToString());
 			}
 				// a=rtcp-mux
-			else if(content.compare(0, OV_COUNTOF("rtcp-m") - 1,"rtcp-m") == 0)
+			else if(content.IsEqual("rtcp-mux"))
 			{
-				if(std::regex_search(content, matches, std::regex("^(rtcp-mux)")))
-				{
-					UseRtcpMux(true);
-				}
+				UseRtcpMux(true);
 			}
-			else if(content.compare(0, OV_COUNTOF("rtcp-f") - 1, "rtcp-f") == 0)
+			else if(content.SkipPrefix("rtcp-fb:"))
 			{
 				// a=rtcp-fb:96 nack pli
 				// pli는 subtype으로 구분해야 하지만 여기서는 type-subtype 형태로 구분한다.
-				if(std::regex_search(content,
-				                     matches,
-				                     std::regex("rtcp-fb:(\\*|\\d*) (.*)")))
-				{
-					if(matches.size() != 2 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
+				auto id = content.NextToken(' ');
+				uint32_t payload_type;
 
-					EnableRtcpFb(static_cast<uint8_t>(std::stoul(matches[1])), std::string(matches[2]).c_str(), true);
+				if(id.IsEqual("*"))
+				{
+					// 모든 payload에 적용되는 wildcard는 아직 지원하지 않음
+				}
+				else if(id.ToUInt32(&payload_type))
+				{
+					EnableRtcpFb(static_cast<uint8_t>(payload_type), content.ToString(), true);
+				}
+				else
+				{
+					parsing_error = true;
+					break;
 				}
 			}
-			else if(content.compare(0, OV_COUNTOF("mid") - 1, "mid") == 0)
+			else if(content.SkipPrefix("mid:"))
 			{
 				// a=mid:video,
-				if(std::regex_search(content, matches, std::regex("^mid:([^\\s]*)")))
-				{
-					if(matches.size() != 1 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
-
-					SetMid(std::string(matches[1]).c_str());
-				}
+				SetMid(content.NextNonSpaceToken().ToString());
 			}
-			else if(content.compare(0, OV_COUNTOF("set") - 1, "set") == 0)
+			else if(content.SkipPrefix("setup:"))
 			{
 				// a=setup:actpass
-				if(std::regex_search(content, matches, std::regex("^setup:(\\w*)")))
-				{
-					if(matches.size() != 1 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
-
-					SetSetup(std::string(matches[1]).c_str());
-				}
+				SetSetup(content.NextNonSpaceToken().ToString());
 			}
-			else if(content.compare(0, OV_COUNTOF("ss") - 1, "ss") == 0)
+			else if(content.SkipPrefix("ssrc:"))
 			{
 				// a=ssrc:2064629418 cname:{b2266c86-259f-4853-8662-ea94cf0835a3}
-				if(std::regex_search(content, matches, std::regex("ssrc:(\\d*) cname(?::(.*))?")))
-				{
-					if(matches.size() != 2 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
+				// (a=ssrc:2064629418 msid:... 등 cname이 아닌 line은 무시한다)
+				uint32_t ssrc;
 
-					SetCname(stoul(matches[1]), std::string(matches[2]).c_str());
+				if((content.NextToken(' ').ToUInt32(&ssrc)) && content.SkipPrefix("cname"))
+				{
+					content.SkipChar(':');
+					SetCname(ssrc, content.ToString());
 				}
 			}
-			else if(content.compare(0, OV_COUNTOF("fra") - 1, "fra") == 0)
+			else if(content.SkipPrefix("framerate:"))
 			{
 				// a=framerate:29.97
-				if(std::regex_search(content, matches, std::regex("^framerate:(\\d+(?:$|\\.\\d+))")))
-				{
-					if(matches.size() != 1 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
+				float framerate;
 
-					SetFramerate(std::stof(matches[1]));
+				if(content.ToFloat(&framerate) == false)
+				{
+					parsing_error = true;
+					break;
 				}
+
+				SetFramerate(framerate);
 			}
 				// a=sendonly
-			else if(content.compare(0, OV_COUNTOF("se") - 1, "se") == 0 ||
-			        content.compare(0, OV_COUNTOF("re") - 1, "re") == 0 ||
-			        content.compare(0, OV_COUNTOF("in") - 1, "in") == 0)
+			else if(content.IsEqual("sendrecv") || content.IsEqual("recvonly") ||
+			        content.IsEqual("sendonly") || content.IsEqual("inactive"))
 			{
-				if(std::regex_search(content, matches, std::regex("^(sendrecv|recvonly|sendonly|inactive)")))
+				if(!SetDirection(content.ToString()))
 				{
-					if(matches.size() != 1 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
-
-					if(!SetDirection(std::string(matches[1]).c_str()))
-					{
-						parsing_error = true;
-						break;
-					}
+					parsing_error = true;
+					break;
 				}
 			}
 			else if(ParsingCommonAttrLine(type, content))
@@ -417,20 +384,20 @@ bool MediaDescription::ParsingMediaLine(char type, std::string content)
 			}
 			else
 			{
-				// TODO Implementing of unknown attributes\
-            // a=fmtp:112 minptime=10;useinbandfec=1
-				logw("SDP", "Unknown Attributes : %c=%s", type, content.c_str());
+				// TODO Implementing of unknown attributes
+				// a=fmtp:112 minptime=10;useinbandfec=1
+				logw("SDP", "Unknown Attributes : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 			}
 
 			break;
 		default:
-			logw("SDP", "Unknown Attributes : %c=%s", type, content.c_str());
+			logw("SDP", "Unknown Attributes : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 			break;
 	}
 
 	if(parsing_error)
 	{
-		loge("SDP", "Sdp parsing error : %c=%s", type, content.c_str());
+		loge("SDP", "Sdp parsing error : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 		return false;
 	}
 
@@ -103,7 +103,9 @@ public:
 
 private:
 	bool UpdateData(ov::String &sdp) override;
-	bool ParsingMediaLine(char type, std::string content);
+	// SessionDescription이 SDP를 한번에 읽어가며 media level line을 넘겨준다
+	friend class SessionDescription;
+	bool ParsingMediaLine(char type, SdpTokenizer content);
 
 	MediaType _media_type = MediaType::Unknown;
 	ov::String _media_type_str = "UNKNOWN";
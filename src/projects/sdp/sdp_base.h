@@ -39,6 +39,17 @@ public:
 protected:
 	virtual bool UpdateData(ov::String &sdp) = 0;
 
+	// UpdateData()를 거치지 않고 이미 만들어진 SDP text를 사용한다. (template에서 patch한 경우 등)
+	void SetSdpText(ov::String sdp)
+	{
+		_sdp_text = std::move(sdp);
+	}
+
+	const ov::String &GetSdpText() const
+	{
+		return _sdp_text;
+	}
+
 private:
 	ov::String _sdp_text;
 };
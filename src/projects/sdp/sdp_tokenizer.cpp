@@ -0,0 +1,214 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "sdp_tokenizer.h"
+
+#include <cstdlib>
+
+SdpTokenizer::SdpTokenizer(const char *data, size_t length)
+	: _data(data),
+	  _length(length)
+{
+}
+
+SdpTokenizer::SdpTokenizer(const ov::String &text)
+	: _data(text.CStr()),
+	  _length(text.GetLength())
+{
+}
+
+bool SdpTokenizer::NextLine(char *type, SdpTokenizer *content)
+{
+	while(_length > 0)
+	{
+		SdpTokenizer line = NextToken('\n');
+
+		if((line._length > 0) && (line._data[line._length - 1] == '\r'))
+		{
+			line._length--;
+		}
+
+		// ^([a-z])=(.*)
+		if((line._length < 2) || (line._data[0] < 'a') || (line._data[0] > 'z') || (line._data[1] != '='))
+		{
+			continue;
+		}
+
+		*type = line._data[0];
+		*content = SdpTokenizer(line._data + 2, line._length - 2);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool SdpTokenizer::StartsWith(const char *prefix) const
+{
+	size_t prefix_length = ::strlen(prefix);
+
+	return (_length >= prefix_length) && (::memcmp(_data, prefix, prefix_length) == 0);
+}
+
+bool SdpTokenizer::SkipPrefix(const char *prefix)
+{
+	size_t prefix_length = ::strlen(prefix);
+
+	if((_length < prefix_length) || (::memcmp(_data, prefix, prefix_length) != 0))
+	{
+		return false;
+	}
+
+	_data += prefix_length;
+	_length -= prefix_length;
+
+	return true;
+}
+
+bool SdpTokenizer::SkipChar(char c)
+{
+	if((_length == 0) || (_data[0] != c))
+	{
+		return false;
+	}
+
+	_data++;
+	_length--;
+
+	return true;
+}
+
+SdpTokenizer SdpTokenizer::NextToken(char delimiter)
+{
+	auto found = static_cast<const char *>(::memchr(_data, delimiter, _length));
+	size_t token_length = (found == nullptr) ? _length : static_cast<size_t>(found - _data);
+
+	SdpTokenizer token(_data, token_length);
+
+	// token과 delimiter를 건너뜀
+	size_t consumed = (found == nullptr) ? token_length : (token_length + 1);
+
+	_data += consumed;
+	_length -= consumed;
+
+	return token;
+}
+
+SdpTokenizer SdpTokenizer::NextNonSpaceToken()
+{
+	size_t token_length = 0;
+
+	while((token_length < _length) && (_data[token_length] != ' ') && (_data[token_length] != '\t'))
+	{
+		token_length++;
+	}
+
+	SdpTokenizer token(_data, token_length);
+
+	_data += token_length;
+	_length -= token_length;
+
+	return token;
+}
+
+void SdpTokenizer::SkipSpaces()
+{
+	while((_length > 0) && ((_data[0] == ' ') || (_data[0] == '\t')))
+	{
+		_data++;
+		_length--;
+	}
+}
+
+bool SdpTokenizer::ToUInt64(uint64_t *value) const
+{
+	if((_length == 0) || (_length > 19))
+	{
+		return false;
+	}
+
+	uint64_t result = 0;
+
+	for(size_t index = 0; index < _length; index++)
+	{
+		char c = _data[index];
+
+		if((c < '0') || (c > '9'))
+		{
+			return false;
+		}
+
+		result = (result * 10) + (c - '0');
+	}
+
+	*value = result;
+
+	return true;
+}
+
+bool SdpTokenizer::ToUInt32(uint32_t *value) const
+{
+	uint64_t result;
+
+	if((ToUInt64(&result) == false) || (result > UINT32_MAX))
+	{
+		return false;
+	}
+
+	*value = static_cast<uint32_t>(result);
+
+	return true;
+}
+
+bool SdpTokenizer::ToFloat(float *value) const
+{
+	// ^(\d+(?:$|\.\d+))
+	char buffer[32];
+
+	if((_length == 0) || (_length >= sizeof(buffer)))
+	{
+		return false;
+	}
+
+	bool dot_found = false;
+
+	for(size_t index = 0; index < _length; index++)
+	{
+		char c = _data[index];
+
+		if(c == '.')
+		{
+			if(dot_found || (index == 0) || (index == (_length - 1)))
+			{
+				return false;
+			}
+
+			dot_found = true;
+		}
+		else if((c < '0') || (c > '9'))
+		{
+			return false;
+		}
+	}
+
+	// strtof()는 NUL로 끝나는 문자열이 필요하므로 복사한다
+	::memcpy(buffer, _data, _length);
+	buffer[_length] = '\0';
+
+	*value = ::strtof(buffer, nullptr);
+
+	return true;
+}
+
+bool SdpTokenizer::IsEqual(const char *str) const
+{
+	size_t str_length = ::strlen(str);
+
+	return (_length == str_length) && (::memcmp(_data, str, str_length) == 0);
+}
@@ -0,0 +1,71 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include "base/ovlibrary/ovlibrary.h"
+
+// SDP text를 복사하지 않고 앞에서부터 한번에 읽어 나가는 tokenizer
+// (원본 문자열의 일부를 가리키기만 하므로, 원본이 tokenizer보다 오래 살아 있어야 함)
+//
+// 값을 저장할 때만 ToString()으로 ov::String을 만든다.
+class SdpTokenizer
+{
+public:
+	SdpTokenizer() = default;
+	SdpTokenizer(const char *data, size_t length);
+	explicit SdpTokenizer(const ov::String &text);
+
+	const char *GetData() const
+	{
+		return _data;
+	}
+
+	size_t GetLength() const
+	{
+		return _length;
+	}
+
+	bool IsEmpty() const
+	{
+		return _length == 0;
+	}
+
+	// 다음 "<type>=<value>" line을 읽는다. 형식에 맞지 않는 line은 건너뛴다.
+	// content는 '='의 다음부터 line의 끝까지(CRLF 제외)를 가리킨다.
+	bool NextLine(char *type, SdpTokenizer *content);
+
+	// prefix로 시작하는지 확인 (건너뛰지 않음)
+	bool StartsWith(const char *prefix) const;
+	// prefix로 시작하면 prefix를 건너뛰고 true를 반환
+	bool SkipPrefix(const char *prefix);
+	bool SkipChar(char c);
+
+	// delimiter 전까지를 token으로 반환하고, delimiter는 건너뛴다. (delimiter가 없으면 나머지 전체)
+	SdpTokenizer NextToken(char delimiter = ' ');
+	// 공백(' ', '\t')이 아닌 문자들을 token으로 반환 (regex의 \S*)
+	SdpTokenizer NextNonSpaceToken();
+	void SkipSpaces();
+
+	// token 전체가 10진수일 때만 성공한다
+	bool ToUInt64(uint64_t *value) const;
+	bool ToUInt32(uint32_t *value) const;
+	bool ToFloat(float *value) const;
+
+	bool IsEqual(const char *str) const;
+
+	ov::String ToString() const
+	{
+		return ov::String(_data, _length);
+	}
+
+protected:
+	const char *_data = "";
+	size_t _length = 0;
+};
@@ -1,14 +1,12 @@
 /*
  *
- * The REGEX pattern in this source code is refers to libsdptransform.
+ * The SDP grammar in this source code is refers to libsdptransform.
  * https://github.com/ibc/libsdptransform [MIT LICENSE]
  *
  *
  */
 
 #include "session_description.h"
-#include <sstream>
-#include <regex>
 
 SessionDescription::SessionDescription()
 {
@@ -53,6 +51,18 @@ bool SessionDescription::UpdateData(ov::String &sdp)
 		return false;
 	}
 
+	// viewer 별 offer를 만들 때 ice-ufrag만 교체할 수 있도록 위치를 기억해 둔다
+	_ice_ufrag_offset = -1;
+	_ice_ufrag_length = 0;
+
+	off_t ice_ufrag_index = common_attr_text.IndexOf("a=ice-ufrag:");
+
+	if(ice_ufrag_index >= 0)
+	{
+		_ice_ufrag_length = CommonAttr::GetIceUfrag().GetLength();
+		_ice_ufrag_offset = sdp.GetLength() + ice_ufrag_index + (OV_COUNTOF("a=ice-ufrag:") - 1);
+	}
+
 	sdp += common_attr_text;
 
 	// Media
@@ -72,175 +82,180 @@ bool SessionDescription::UpdateData(ov::String &sdp)
 	return true;
 }
 
-bool SessionDescription::FromString(const ov::String &sdp)
+std::shared_ptr<SessionDescription> SessionDescription::CreateOfferWithIceUfrag(const ov::String &ice_ufrag) const
 {
-	static const std::regex ValidLineRegex("^([a-z])=(.*)");
-	std::stringstream sdpstream(sdp.CStr());
-	std::string line;
+	// Media description 등은 stream과 공유한다. (viewer 별로 변경되지 않음)
+	auto session_description = std::make_shared<SessionDescription>(*this);
+
+	session_description->SetIceUfrag(ice_ufrag);
 
-	ov::String media_desc_sdp;
-	bool media_level = false;
+	const ov::String &sdp_template = GetSdpText();
 
-	while(std::getline(sdpstream, line, '\n'))
+	if((_ice_ufrag_offset < 0) || sdp_template.IsEmpty())
 	{
-		if(line.size() && line[line.length() - 1] == '\r')
-		{
-			line.pop_back();
-		}
+		// Template이 없으면 전체를 다시 만든다
+		session_description->Update();
+		return session_description;
+	}
 
-		if(!std::regex_search(line, ValidLineRegex))
-		{
-			continue;
-		}
-		char type = line[0];
-		std::string content = line.substr(2);
+	size_t suffix_offset = _ice_ufrag_offset + _ice_ufrag_length;
+	ov::String sdp;
+
+	sdp.SetCapacity(sdp_template.GetLength() - _ice_ufrag_length + ice_ufrag.GetLength());
+	sdp.Append(sdp_template.CStr(), static_cast<size_t>(_ice_ufrag_offset));
+	sdp.Append(ice_ufrag.CStr(), ice_ufrag.GetLength());
+	sdp.Append(sdp_template.CStr() + suffix_offset, sdp_template.GetLength() - suffix_offset);
+
+	session_description->SetSdpText(std::move(sdp));
+	session_description->_ice_ufrag_length = ice_ufrag.GetLength();
+
+	return session_description;
+}
+
+bool SessionDescription::FromString(const ov::String &sdp)
+{
+	// SDP를 복사하지 않고 처음부터 끝까지 한번만 읽는다
+	SdpTokenizer lines(sdp);
+	char type;
+	SdpTokenizer content;
+
+	std::shared_ptr<MediaDescription> media_desc = nullptr;
 
-		// media라면 다음 m을 만날때까지 또는 stream이 끝날때까지 모아서 media description에 넘긴다.
+	while(lines.NextLine(&type, &content))
+	{
+		// 새로운 m을 만나면 다음 m을 만날때까지 또는 sdp가 끝날때까지 media level line이다.
 		if(type == 'm')
 		{
-			// 새로운 m을 만나면 기존 m level을 파싱
-			if(media_level == true)
+			if(media_desc != nullptr)
 			{
-				auto media_desc = std::make_shared<MediaDescription>(GetSharedPtr());
-				if(media_desc->FromString(media_desc_sdp) == false)
-				{
-					return false;
-				}
 				AddMedia(media_desc);
 			}
 
-			// 초기화
-			media_desc_sdp.Clear();
-			media_desc_sdp.AppendFormat("%s\n", line.c_str());
-			media_level = true;
+			media_desc = std::make_shared<MediaDescription>(GetSharedPtr());
 		}
-			// media level이면 계속 모은다.
-		else if(media_level == true)
-		{
-			media_desc_sdp.AppendFormat("%s\n", line.c_str());
 
-			// 만약 sdp의 끝이면 생성
-			if(sdpstream.rdbuf()->in_avail() == 0)
+		if(media_desc != nullptr)
+		{
+			if(media_desc->ParsingMediaLine(type, content) == false)
 			{
-				auto media_desc = std::make_shared<MediaDescription>(GetSharedPtr());
-				if(media_desc->FromString(media_desc_sdp) == false)
-				{
-					return false;
-				}
-				AddMedia(media_desc);
+				logw("SDP", "Could not parse line: %c=%.*s", type, static_cast<int>(content.GetLength()), content.GetData());
+				return false;
 			}
 		}
 			// media level이 아니면 파싱하여 저장
-		else
+		else if(ParsingSessionLine(type, content) == false)
 		{
-			if(ParsingSessionLine(type, content) == false)
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
+	if(media_desc != nullptr)
+	{
+		AddMedia(media_desc);
+	}
+
 	return true;
 }
 
-bool SessionDescription::ParsingSessionLine(char type, std::string content)
+bool SessionDescription::ParsingSessionLine(char type, SdpTokenizer content)
 {
 	bool parsing_error = false;
-	std::smatch matches;
+	// 에러 로그 출력용
+	const SdpTokenizer line = content;
 
 	switch(type)
 	{
 		case 'v':
+		{
 			// v=0
-			if(std::regex_search(content, matches, std::regex("^(\\d*)$")))
+			uint32_t version;
+
+			if(content.ToUInt32(&version))
 			{
-				if(matches.size() != 1 + 1)
-				{
-					parsing_error = true;
-					break;
-				}
-				SetVersion(static_cast<uint8_t>(std::stoi(matches[1])));
+				SetVersion(static_cast<uint8_t>(version));
 			}
 			break;
+		}
+
 		case 'o':
+		{
 			// o=OvenMediaEngine 1882243660 2 IN IP4 127.0.0.1
-			if(std::regex_search(content, matches, std::regex("^(\\S*) (\\d*) (\\d*) (\\S*) IP(\\d) (\\S*)")))
+			// (브라우저는 64bit session id를 사용하므로 하위 32bit만 사용한다)
+			auto user_name = content.NextToken(' ');
+			uint64_t session_id;
+			uint64_t session_version;
+
+			if((content.NextToken(' ').ToUInt64(&session_id) == false) ||
+			   (content.NextToken(' ').ToUInt64(&session_version) == false))
 			{
-				if(matches.size() != 6 + 1)
-				{
-					parsing_error = true;
-					break;
-				}
+				parsing_error = true;
+				break;
+			}
+
+			auto net_type = content.NextToken(' ');
+			uint32_t ip_version;
 
-				SetOrigin(std::string(matches[1]).c_str(),
-				          static_cast<uint32_t>(std::stoul(matches[2])),
-				          static_cast<uint32_t>(std::stoul(matches[3])),
-				          std::string(matches[4]).c_str(),
-				          static_cast<uint8_t>(std::stoul(matches[5])),
-				          std::string(matches[6]).c_str());
+			if((content.SkipPrefix("IP") == false) || (content.NextToken(' ').ToUInt32(&ip_version) == false))
+			{
+				parsing_error = true;
+				break;
 			}
+
+			SetOrigin(user_name.ToString(),
+			          static_cast<uint32_t>(session_id),
+			          static_cast<uint32_t>(session_version),
+			          net_type.ToString(),
+			          static_cast<uint8_t>(ip_version),
+			          content.NextNonSpaceToken().ToString());
 			break;
+		}
+
 		case 's':
 			// s=-
-			if(std::regex_search(content, matches, std::regex("^(.*)")))
-			{
-				if(matches.size() != 1 + 1)
-				{
-					parsing_error = true;
-					break;
-				}
-
-				SetSessionName(std::string(matches[1]).c_str());
-			}
+			SetSessionName(content.ToString());
 			break;
+
 		case 't':
+		{
 			// t=0 0
-			if(std::regex_search(content, matches, std::regex("^(\\d*) (\\d*)")))
-			{
-				if(matches.size() != 2 + 1)
-				{
-					parsing_error = true;
-					break;
-				}
+			uint32_t start;
+			uint32_t stop;
 
-				SetTiming(static_cast<uint32_t>(std::stoul(matches[1])),
-				          static_cast<uint32_t>(std::stoul(matches[2])));
+			if((content.NextToken(' ').ToUInt32(&start) == false) || (content.NextToken(' ').ToUInt32(&stop) == false))
+			{
+				parsing_error = true;
+				break;
 			}
 
+			SetTiming(start, stop);
 			break;
+		}
+
 		case 'a':
 			// a=group:BUNDLE video audio ...
-			if(content.compare(0, OV_COUNTOF("gr") - 1, "gr") == 0)
+			if(content.SkipPrefix("group:BUNDLE "))
 			{
-				if(std::regex_search(content, matches, std::regex("^group:BUNDLE (.*)")))
+				while(content.IsEmpty() == false)
 				{
-					if(matches.size() != 1 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
+					auto bundle = content.NextToken(' ');
 
-					std::string bundle;
-					std::stringstream bundles(matches[1]);
-					while(std::getline(bundles, bundle, ' '))
+					if(bundle.IsEmpty() == false)
 					{
 						// 당장은 사용하는 곳이 없다. bundle only 이므로...
-						_bundles.emplace_back(bundle.c_str());
+						_bundles.emplace_back(bundle.ToString());
 					}
 				}
 			}
-			// a=msid-semantic:WMS *
-			if(content.compare(0, OV_COUNTOF("ms") - 1, "ms") == 0)
+				// a=msid-semantic:WMS *
+			else if(content.SkipPrefix("msid-semantic:"))
 			{
-				if(std::regex_search(content, matches, std::regex(R"(^msid-semantic:\s?(\w*) (\S*))")))
-				{
-					if(matches.size() != 2 + 1)
-					{
-						parsing_error = true;
-						break;
-					}
+				content.SkipChar(' ');
 
-					SetMsidSemantic(std::string(matches[1]).c_str(), std::string(matches[2]).c_str());
+				auto semantic = content.NextToken(' ');
+
+				if(content.IsEmpty() == false)
+				{
+					SetMsidSemantic(semantic.ToString(), content.NextNonSpaceToken().ToString());
 				}
 			}
 			else if(ParsingCommonAttrLine(type, content))
@@ -249,17 +264,17 @@ bool SessionDescription::ParsingSessionLine(char type, std::string content)
 			}
 			else
 			{
-				logw("SDP", "Unknown Attributes : %c=%s", type, content.c_str());
+				logw("SDP", "Unknown Attributes : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 			}
 
 			break;
 		default:
-			logw("SDP", "Unknown Attributes : %c=%s", type, content.c_str());
+			logw("SDP", "Unknown Attributes : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 	}
 
 	if(parsing_error)
 	{
-		loge("SDP", "Sdp parsing error : %c=%s", type, content.c_str());
+		loge("SDP", "Sdp parsing error : %c=%.*s", type, static_cast<int>(line.GetLength()), line.GetData());
 		return false;
 	}
 
@@ -54,6 +54,11 @@ public:
 
 	bool FromString(const ov::String &sdp) override;
 
+	// 이 SDP(Stream의 offer)를 template으로 사용하여 viewer 별 offer를 만든다.
+	// viewer 마다 ice-ufrag만 다르므로 media description을 다시 serialize 하지 않고,
+	// 이미 만들어진 SDP text에서 ice-ufrag 부분만 교체한다. (Update()/ToString()이 먼저 호출되어 있어야 함)
+	std::shared_ptr<SessionDescription> CreateOfferWithIceUfrag(const ov::String &ice_ufrag) const;
+
 	// v=0
 	void SetVersion(uint8_t version);
 	uint8_t GetVersion();
@@ -104,7 +109,7 @@ public:
 
 private:
 	bool UpdateData(ov::String &sdp) override;
-	bool ParsingSessionLine(char type, std::string content);
+	bool ParsingSessionLine(char type, SdpTokenizer content);
 
 	// version
 	uint8_t _version = 0;
@@ -133,4 +138,8 @@ private:
 
 	// Media
 	std::vector<std::shared_ptr<MediaDescription>> _media_list;
+
+	// Serialize된 SDP text에서 session level ice-ufrag 값의 위치 (없으면 -1)
+	off_t _ice_ufrag_offset = -1;
+	size_t _ice_ufrag_length = 0;
 };
\ No newline at end of file
@@ -0,0 +1,15 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Compares the SDP tokenizer/template path with the regex parser used before (CPU time per SDP)
+LOCAL_STATIC_LIBRARIES := \
+	sdp \
+	ovlibrary
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl
+
+LOCAL_TARGET := SdpParseBench
+
+include $(BUILD_EXECUTABLE)
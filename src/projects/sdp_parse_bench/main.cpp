@@ -0,0 +1,97 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+
+#include "sdp_parse_bench.h"
+
+#define OV_LOG_TAG                  "SdpParseBench"
+
+static void PrintUsage(const char *program)
+{
+	printf("Usage: %s [OPTION]...\n", program);
+	printf("    -l <count>    Iteration count (default: 1000)\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], SdpParseBenchOptions *options)
+{
+	constexpr const char *opt_string = "hl:";
+
+	while(true)
+	{
+		int name = getopt(argc, argv, opt_string);
+
+		switch(name)
+		{
+			case -1:
+				return true;
+
+			case 'l':
+				options->iteration_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'h':
+			default:
+				PrintUsage(argv[0]);
+				return false;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	SdpParseBenchOptions options;
+
+	if(TryParseOption(argc, argv, &options) == false)
+	{
+		return 1;
+	}
+
+	// Both parsers log every unknown attribute (a=extmap, a=rtcp-rsize, ...)
+	ov_log_set_level(OVLogLevelError);
+
+	SdpParseBench bench(options);
+
+	if(bench.Prepare() == false)
+	{
+		return 2;
+	}
+
+	if(bench.Verify() == false)
+	{
+		return 2;
+	}
+
+	printf("source : %zu browser answers, 1 stream offer, %d iterations\n",
+	       bench.GetAnswerCount(), options.iteration_count);
+	printf("%-10s %10s %12s %8s %10s %12s\n",
+	       "mode", "sdps", "bytes", "failed", "cpu ms", "ns/sdp");
+
+	int exit_code = 0;
+
+	for(auto mode : { SdpParseBenchMode::LegacyParse, SdpParseBenchMode::TokenizerParse,
+	                  SdpParseBenchMode::SerializeOffer, SdpParseBenchMode::TemplateOffer })
+	{
+		SdpParseBenchResult result;
+
+		bench.Run(mode, &result);
+
+		printf("%-10s %10" PRIu64 " %12" PRIu64 " %8" PRIu64 " %10.2f %12.1f\n",
+		       SdpParseBench::GetModeName(mode),
+		       result.sdp_count, result.sdp_bytes, result.failed_count,
+		       result.seconds * 1000.0,
+		       result.seconds * 1000000000.0 / std::max<uint64_t>(result.sdp_count, 1));
+
+		if(result.failed_count > 0)
+		{
+			exit_code = 2;
+		}
+	}
+
+	return exit_code;
+}
@@ -0,0 +1,769 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "sdp_parse_bench.h"
+
+#include <regex>
+#include <sstream>
+#include <time.h>
+
+#define OV_LOG_TAG                  "SdpParseBench"
+
+// Answers captured from the browsers (addresses, keys and fingerprints are replaced)
+static const char *g_browser_answers[] = {
+	// Chrome 124
+	"v=0\r\n"
+	"o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+	"s=-\r\n"
+	"t=0 0\r\n"
+	"a=group:BUNDLE video audio\r\n"
+	"a=msid-semantic:WMS *\r\n"
+	"m=video 9 UDP/TLS/RTP/SAVPF 97 98\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtcp:9 IN IP4 0.0.0.0\r\n"
+	"a=ice-ufrag:Hk3L\r\n"
+	"a=ice-pwd:4oH9Bvq4pE8x3kAa1lDdE7t1\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=fingerprint:sha-256 7B:1F:3A:9C:5E:0D:22:84:B6:41:9A:EF:70:13:C8:5D:2E:66:A1:0B:94:3F:D7:18:C2:4E:85:B9:01:6A:F3:2C\r\n"
+	"a=setup:active\r\n"
+	"a=mid:video\r\n"
+	"a=extmap:2 http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\r\n"
+	"a=extmap:3 http://www.ietf.org/id/draft-holmer-rmcat-transport-wide-cc-extensions-01\r\n"
+	"a=recvonly\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtcp-rsize\r\n"
+	"a=rtpmap:97 H264/90000\r\n"
+	"a=rtcp-fb:97 goog-remb\r\n"
+	"a=rtcp-fb:97 transport-cc\r\n"
+	"a=rtcp-fb:97 ccm fir\r\n"
+	"a=rtcp-fb:97 nack\r\n"
+	"a=rtcp-fb:97 nack pli\r\n"
+	"a=fmtp:97 level-asymmetry-allowed=1;packetization-mode=1;profile-level-id=42e01f\r\n"
+	"a=rtpmap:98 rtx/90000\r\n"
+	"a=fmtp:98 apt=97\r\n"
+	"m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtcp:9 IN IP4 0.0.0.0\r\n"
+	"a=ice-ufrag:Hk3L\r\n"
+	"a=ice-pwd:4oH9Bvq4pE8x3kAa1lDdE7t1\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=fingerprint:sha-256 7B:1F:3A:9C:5E:0D:22:84:B6:41:9A:EF:70:13:C8:5D:2E:66:A1:0B:94:3F:D7:18:C2:4E:85:B9:01:6A:F3:2C\r\n"
+	"a=setup:active\r\n"
+	"a=mid:audio\r\n"
+	"a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+	"a=recvonly\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtpmap:111 opus/48000/2\r\n"
+	"a=rtcp-fb:111 transport-cc\r\n"
+	"a=fmtp:111 minptime=10;useinbandfec=1\r\n",
+
+	// Firefox 125
+	"v=0\r\n"
+	"o=mozilla...THIS_IS_SDPARTA-99.0 7098917893416520958 0 IN IP4 0.0.0.0\r\n"
+	"s=-\r\n"
+	"t=0 0\r\n"
+	"a=fingerprint:sha-256 3D:A8:51:0C:E9:47:BB:12:6F:80:2A:C5:93:1E:D4:77:08:B3:6C:F1:29:5A:E0:84:4D:17:CA:62:9F:03:B8:E5\r\n"
+	"a=group:BUNDLE video audio\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=msid-semantic:WMS *\r\n"
+	"m=video 9 UDP/TLS/RTP/SAVPF 97\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=recvonly\r\n"
+	"a=fmtp:97 profile-level-id=42e01f;level-asymmetry-allowed=1;packetization-mode=1\r\n"
+	"a=ice-pwd:0c5d8b6f2e4a49a7b1f3d9e8c7a6b5f4\r\n"
+	"a=ice-ufrag:9f8e7d6c\r\n"
+	"a=mid:video\r\n"
+	"a=rtcp-fb:97 nack\r\n"
+	"a=rtcp-fb:97 nack pli\r\n"
+	"a=rtcp-fb:97 ccm fir\r\n"
+	"a=rtcp-fb:97 goog-remb\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtpmap:97 H264/90000\r\n"
+	"a=setup:active\r\n"
+	"a=ssrc:3137286367 cname:{6a2ba6e9-6b39-4a3a-8b1d-4e4e9d2f0e2b}\r\n"
+	"m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=recvonly\r\n"
+	"a=fmtp:111 maxplaybackrate=48000;stereo=1;useinbandfec=1\r\n"
+	"a=ice-pwd:0c5d8b6f2e4a49a7b1f3d9e8c7a6b5f4\r\n"
+	"a=ice-ufrag:9f8e7d6c\r\n"
+	"a=mid:audio\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtpmap:111 opus/48000/2\r\n"
+	"a=setup:active\r\n"
+	"a=ssrc:2284756102 cname:{6a2ba6e9-6b39-4a3a-8b1d-4e4e9d2f0e2b}\r\n",
+
+	// Safari 17
+	"v=0\r\n"
+	"o=- 2305619417829165233 2 IN IP4 127.0.0.1\r\n"
+	"s=-\r\n"
+	"t=0 0\r\n"
+	"a=group:BUNDLE video audio\r\n"
+	"a=msid-semantic:WMS *\r\n"
+	"m=video 9 UDP/TLS/RTP/SAVPF 97\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtcp:9 IN IP4 0.0.0.0\r\n"
+	"a=ice-ufrag:Qz7p\r\n"
+	"a=ice-pwd:Vb2nM8kLq1Wx5Rt6Yu9Io0Pa\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=fingerprint:sha-256 A4:60:2F:DB:13:9E:C7:58:04:B1:6D:3A:E2:95:7F:C0:18:4B:A9:E6:52:0D:F8:37:BC:71:26:9D:C3:5E:84:0A\r\n"
+	"a=setup:active\r\n"
+	"a=mid:video\r\n"
+	"a=recvonly\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtcp-rsize\r\n"
+	"a=rtpmap:97 H264/90000\r\n"
+	"a=rtcp-fb:97 nack\r\n"
+	"a=rtcp-fb:97 nack pli\r\n"
+	"a=rtcp-fb:97 ccm fir\r\n"
+	"a=fmtp:97 level-asymmetry-allowed=1;packetization-mode=1;profile-level-id=42e01f\r\n"
+	"m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtcp:9 IN IP4 0.0.0.0\r\n"
+	"a=ice-ufrag:Qz7p\r\n"
+	"a=ice-pwd:Vb2nM8kLq1Wx5Rt6Yu9Io0Pa\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=fingerprint:sha-256 A4:60:2F:DB:13:9E:C7:58:04:B1:6D:3A:E2:95:7F:C0:18:4B:A9:E6:52:0D:F8:37:BC:71:26:9D:C3:5E:84:0A\r\n"
+	"a=setup:active\r\n"
+	"a=mid:audio\r\n"
+	"a=recvonly\r\n"
+	"a=rtcp-mux\r\n"
+	"a=rtpmap:111 opus/48000/2\r\n"
+	"a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+};
+
+// Offer of a stream (H.264 + OPUS), like RtcStream::Start() makes
+static const char *g_stream_offer =
+	"v=0\r\n"
+	"o=OvenMediaEngine 1882243660 2 IN IP4 127.0.0.1\r\n"
+	"s=-\r\n"
+	"t=0 0\r\n"
+	"a=group:BUNDLE video audio\r\n"
+	"a=fingerprint:sha-256 D7:81:CF:01:46:FB:2D:93:8E:04:AF:47:76:0A:88:08:FF:73:37:C6:A7:45:0B:31:FE:12:49:DE:A7:E4:1F:3A\r\n"
+	"a=ice-options:trickle\r\n"
+	"a=ice-pwd:c32d4070c67e9782bea90a9ab46ea838\r\n"
+	"a=ice-ufrag:0dfa46c9\r\n"
+	"a=msid-semantic:WMS *\r\n"
+	"m=video 9 UDP/TLS/RTP/SAVPF 97\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtpmap:97 H264/90000\r\n"
+	"a=rtcp-fb:97 nack pli\r\n"
+	"a=framerate:30.00\r\n"
+	"a=mid:video\r\n"
+	"a=rtcp-mux\r\n"
+	"a=setup:actpass\r\n"
+	"a=sendonly\r\n"
+	"a=ssrc:2064629418 cname:{b2266c86-259f-4853-8662-ea94cf0835a3}\r\n"
+	"m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+	"c=IN IP4 0.0.0.0\r\n"
+	"a=rtpmap:111 OPUS/48000/2\r\n"
+	"a=mid:audio\r\n"
+	"a=rtcp-mux\r\n"
+	"a=setup:actpass\r\n"
+	"a=sendonly\r\n"
+	"a=ssrc:3298174653 cname:{b2266c86-259f-4853-8662-ea94cf0835a3}\r\n";
+
+static double GetCpuTime()
+{
+	timespec time {};
+
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+	return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+SdpParseBench::SdpParseBench(const SdpParseBenchOptions &options)
+	: _options(options)
+{
+}
+
+const char *SdpParseBench::GetModeName(SdpParseBenchMode mode)
+{
+	switch(mode)
+	{
+		case SdpParseBenchMode::LegacyParse:
+			return "regex";
+
+		case SdpParseBenchMode::TokenizerParse:
+			return "tokenizer";
+
+		case SdpParseBenchMode::SerializeOffer:
+			return "serialize";
+
+		case SdpParseBenchMode::TemplateOffer:
+			return "template";
+	}
+
+	return "?";
+}
+
+bool SdpParseBench::Prepare()
+{
+	_answers.clear();
+
+	for(auto answer : g_browser_answers)
+	{
+		_answers.emplace_back(answer);
+	}
+
+	_stream_offer = std::make_shared<SessionDescription>();
+
+	if(_stream_offer->FromString(g_stream_offer) == false)
+	{
+		return false;
+	}
+
+	// RtcStream::Start() serializes the offer once, and it is used as a template
+	if(_stream_offer->Update() == false)
+	{
+		return false;
+	}
+
+	// Viewers get the ufrags from IcePort::GenerateUfrag()
+	_ice_ufrags.clear();
+
+	for(int index = 0; index < 16; index++)
+	{
+		_ice_ufrags.push_back(ov::String::FormatString("%08x", 0x1A2B3C4Du * static_cast<uint32_t>(index + 1)));
+	}
+
+	return true;
+}
+
+bool SdpParseBench::Verify()
+{
+	for(const auto &answer : _answers)
+	{
+		LegacySession legacy;
+		auto session_description = std::make_shared<SessionDescription>();
+
+		if(ParseLegacy(answer, &legacy) == false)
+		{
+			logte("Could not parse the answer using regex:\n%s", answer.CStr());
+			return false;
+		}
+
+		if(session_description->FromString(answer) == false)
+		{
+			logte("Could not parse the answer using tokenizer:\n%s", answer.CStr());
+			return false;
+		}
+
+		const auto &media_list = session_description->GetMediaList();
+
+		if(media_list.size() != legacy.media_list.size())
+		{
+			logte("Media count mismatch: regex: %zu, tokenizer: %zu", legacy.media_list.size(), media_list.size());
+			return false;
+		}
+
+		if((session_description->GetSessionId() != legacy.session_id) ||
+		   (session_description->GetMsidSemantic() != legacy.msid_semantic))
+		{
+			logte("Session mismatch: regex: %u/%s, tokenizer: %u/%s",
+			      legacy.session_id, legacy.msid_semantic.CStr(),
+			      session_description->GetSessionId(), session_description->GetMsidSemantic().CStr());
+			return false;
+		}
+
+		for(size_t index = 0; index < media_list.size(); index++)
+		{
+			const auto &media = media_list[index];
+			const auto &legacy_media = legacy.media_list[index];
+
+			if((media->GetMid() != legacy_media.mid) ||
+			   (media->GetPort() != legacy_media.port) ||
+			   (media->GetIceUfrag() != legacy_media.ice_ufrag) ||
+			   (media->GetIcePwd() != legacy_media.ice_pwd))
+			{
+				logte("Media mismatch: regex: %s/%s, tokenizer: %s/%s",
+				      legacy_media.mid.CStr(), legacy_media.ice_ufrag.CStr(),
+				      media->GetMid().CStr(), media->GetIceUfrag().CStr());
+				return false;
+			}
+
+			for(const auto &legacy_payload : legacy_media.payload_list)
+			{
+				if(media->GetPayload(legacy_payload.id) == nullptr)
+				{
+					logte("Payload %d of %s is not found", legacy_payload.id, legacy_media.mid.CStr());
+					return false;
+				}
+			}
+		}
+	}
+
+	for(const auto &ice_ufrag : _ice_ufrags)
+	{
+		auto serialized = SerializeOffer(ice_ufrag);
+		auto from_template = _stream_offer->CreateOfferWithIceUfrag(ice_ufrag);
+
+		ov::String serialized_sdp;
+		ov::String template_sdp;
+
+		if((serialized->ToString(serialized_sdp) == false) || (from_template->ToString(template_sdp) == false) ||
+		   (serialized_sdp != template_sdp))
+		{
+			logte("Offer mismatch:\n[serialize]\n%s\n[template]\n%s", serialized_sdp.CStr(), template_sdp.CStr());
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void SdpParseBench::Run(SdpParseBenchMode mode, SdpParseBenchResult *result)
+{
+	*result = SdpParseBenchResult();
+
+	double start_time = GetCpuTime();
+
+	for(int iteration = 0; iteration < _options.iteration_count; iteration++)
+	{
+		switch(mode)
+		{
+			case SdpParseBenchMode::LegacyParse:
+				for(const auto &answer : _answers)
+				{
+					LegacySession session;
+
+					if(ParseLegacy(answer, &session) == false)
+					{
+						result->failed_count++;
+					}
+
+					result->sdp_count++;
+					result->sdp_bytes += answer.GetLength();
+				}
+				break;
+
+			case SdpParseBenchMode::TokenizerParse:
+				for(const auto &answer : _answers)
+				{
+					auto session_description = std::make_shared<SessionDescription>();
+
+					if(session_description->FromString(answer) == false)
+					{
+						result->failed_count++;
+					}
+
+					result->sdp_count++;
+					result->sdp_bytes += answer.GetLength();
+				}
+				break;
+
+			case SdpParseBenchMode::SerializeOffer:
+				for(const auto &ice_ufrag : _ice_ufrags)
+				{
+					auto offer = SerializeOffer(ice_ufrag);
+					// The signalling server sends the offer as a text
+					ov::String sdp;
+
+					if(offer->ToString(sdp) == false)
+					{
+						result->failed_count++;
+					}
+
+					result->sdp_count++;
+					result->sdp_bytes += sdp.GetLength();
+				}
+				break;
+
+			case SdpParseBenchMode::TemplateOffer:
+				for(const auto &ice_ufrag : _ice_ufrags)
+				{
+					auto offer = _stream_offer->CreateOfferWithIceUfrag(ice_ufrag);
+					// The signalling server sends the offer as a text
+					ov::String sdp;
+
+					if(offer->ToString(sdp) == false)
+					{
+						result->failed_count++;
+					}
+
+					result->sdp_count++;
+					result->sdp_bytes += sdp.GetLength();
+				}
+				break;
+		}
+	}
+
+	result->seconds = GetCpuTime() - start_time;
+}
+
+std::shared_ptr<SessionDescription> SdpParseBench::SerializeOffer(const ov::String &ice_ufrag)
+{
+	auto session_description = std::make_shared<SessionDescription>(*_stream_offer);
+
+	session_description->SetIceUfrag(ice_ufrag);
+	session_description->Update();
+
+	return session_description;
+}
+
+//====================================================================================================
+// The regex parser used before SdpTokenizer
+//====================================================================================================
+bool SdpParseBench::ParseLegacy(const ov::String &sdp, LegacySession *session)
+{
+	static const std::regex ValidLineRegex("^([a-z])=(.*)");
+	std::stringstream sdpstream(sdp.CStr());
+	std::string line;
+
+	ov::String media_desc_sdp;
+	bool media_level = false;
+
+	while(std::getline(sdpstream, line, '\n'))
+	{
+		if(line.size() && line[line.length() - 1] == '\r')
+		{
+			line.pop_back();
+		}
+
+		if(!std::regex_search(line, ValidLineRegex))
+		{
+			continue;
+		}
+		char type = line[0];
+		std::string content = line.substr(2);
+
+		// media라면 다음 m을 만날때까지 또는 stream이 끝날때까지 모아서 media description에 넘긴다.
+		if(type == 'm')
+		{
+			if(media_level == true)
+			{
+				session->media_list.emplace_back();
+				if(ParseLegacyMedia(media_desc_sdp, &session->media_list.back()) == false)
+				{
+					return false;
+				}
+			}
+
+			media_desc_sdp.Clear();
+			media_desc_sdp.AppendFormat("%s\n", line.c_str());
+			media_level = true;
+		}
+		else if(media_level == true)
+		{
+			media_desc_sdp.AppendFormat("%s\n", line.c_str());
+
+			if(sdpstream.rdbuf()->in_avail() == 0)
+			{
+				session->media_list.emplace_back();
+				if(ParseLegacyMedia(media_desc_sdp, &session->media_list.back()) == false)
+				{
+					return false;
+				}
+			}
+		}
+		else
+		{
+			if(ParseLegacySessionLine(type, content, session) == false)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool SdpParseBench::ParseLegacySessionLine(char type, const std::string &content, LegacySession *session)
+{
+	bool parsing_error = false;
+	std::smatch matches;
+
+	switch(type)
+	{
+		case 'v':
+			if(std::regex_search(content, matches, std::regex("^(\\d*)$")))
+			{
+				session->version = static_cast<uint8_t>(std::stoi(matches[1]));
+			}
+			break;
+
+		case 'o':
+			if(std::regex_search(content, matches, std::regex("^(\\S*) (\\d*) (\\d*) (\\S*) IP(\\d) (\\S*)")))
+			{
+				session->user_name = std::string(matches[1]).c_str();
+				session->session_id = static_cast<uint32_t>(std::stoul(matches[2]));
+				session->session_version = static_cast<uint32_t>(std::stoul(matches[3]));
+				session->net_type = std::string(matches[4]).c_str();
+				session->ip_version = static_cast<uint8_t>(std::stoul(matches[5]));
+				session->address = std::string(matches[6]).c_str();
+			}
+			break;
+
+		case 's':
+			if(std::regex_search(content, matches, std::regex("^(.*)")))
+			{
+				session->session_name = std::string(matches[1]).c_str();
+			}
+			break;
+
+		case 't':
+			if(std::regex_search(content, matches, std::regex("^(\\d*) (\\d*)")))
+			{
+				session->start_time = static_cast<uint32_t>(std::stoul(matches[1]));
+				session->stop_time = static_cast<uint32_t>(std::stoul(matches[2]));
+			}
+			break;
+
+		case 'a':
+			if(content.compare(0, OV_COUNTOF("gr") - 1, "gr") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^group:BUNDLE (.*)")))
+				{
+					std::string bundle;
+					std::stringstream bundles(matches[1]);
+					while(std::getline(bundles, bundle, ' '))
+					{
+						session->bundles.emplace_back(bundle.c_str());
+					}
+				}
+			}
+			if(content.compare(0, OV_COUNTOF("ms") - 1, "ms") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex(R"(^msid-semantic:\s?(\w*) (\S*))")))
+				{
+					session->msid_semantic = std::string(matches[1]).c_str();
+					session->msid_token = std::string(matches[2]).c_str();
+				}
+			}
+			else
+			{
+				ParseLegacyCommonAttrLine(content, session);
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return parsing_error == false;
+}
+
+bool SdpParseBench::ParseLegacyMedia(const ov::String &desc, LegacyMedia *media)
+{
+	std::stringstream sdpstream(desc.CStr());
+	std::string line;
+
+	while(std::getline(sdpstream, line, '\n'))
+	{
+		if(line.size() && line[line.length() - 1] == '\r')
+		{
+			line.pop_back();
+		}
+
+		char type = line[0];
+		std::string content = line.substr(2);
+
+		if(ParseLegacyMediaLine(type, content, media) == false)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool SdpParseBench::ParseLegacyMediaLine(char type, const std::string &content, LegacyMedia *media)
+{
+	std::smatch matches;
+
+	switch(type)
+	{
+		case 'm':
+			if(std::regex_search(content, matches, std::regex("^(\\w*) (\\d*) ([\\w\\/]*)(?: (.*))?")))
+			{
+				media->media_type = std::string(matches[1]).c_str();
+				media->port = static_cast<uint16_t>(std::stoul(matches[2]));
+
+				ov::String protocol = std::string(matches[3]).c_str();
+				if(protocol.UpperCaseString() == "UDP/TLS/RTP/SAVPF")
+				{
+					media->use_dtls = true;
+				}
+				else if(protocol.UpperCaseString() == "RTP/AVPF")
+				{
+					media->use_dtls = false;
+				}
+				else
+				{
+					return false;
+				}
+
+				std::string payload_number;
+				std::stringstream payload_numbers(matches[4]);
+				while(std::getline(payload_numbers, payload_number, ' '))
+				{
+					LegacyPayload payload;
+					payload.id = static_cast<uint8_t>(std::stoul(payload_number));
+					media->payload_list.push_back(payload);
+				}
+			}
+			else
+			{
+				return false;
+			}
+			break;
+
+		case 'c':
+			if(std::regex_search(content, matches, std::regex("^IN IP(\\d) (\\S*)")))
+			{
+				media->connection_ip_version = static_cast<uint8_t>(std::stoul(matches[1]));
+				media->connection_address = std::string(matches[2]).c_str();
+			}
+			else
+			{
+				return false;
+			}
+			break;
+
+		case 'a':
+			if(content.compare(0, OV_COUNTOF("rtp") - 1, "rtp") == 0)
+			{
+				if(std::regex_search(content,
+				                     matches,
+				                     std::regex("rtpmap:(\\d*) ([\\w\\-\\.]*)(?:\\s*\\/(\\d*)(?:\\s*\\/(\\S*))?)?")))
+				{
+					auto id = static_cast<uint8_t>(std::stoul(matches[1]));
+
+					for(auto &payload : media->payload_list)
+					{
+						if(payload.id == id)
+						{
+							payload.codec = std::string(matches[2]).c_str();
+							payload.rate = static_cast<uint32_t>(std::stoul(matches[3]));
+							payload.parameter = std::string(matches[4]).c_str();
+						}
+					}
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("rtcp-m") - 1, "rtcp-m") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^(rtcp-mux)")))
+				{
+					media->use_rtcp_mux = true;
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("rtcp-f") - 1, "rtcp-f") == 0)
+			{
+				// (stoul() throws on "rtcp-fb:*", so "*" is skipped here)
+				if(std::regex_search(content, matches, std::regex("rtcp-fb:(\\d+) (.*)")))
+				{
+					auto id = static_cast<uint8_t>(std::stoul(matches[1]));
+
+					for(auto &payload : media->payload_list)
+					{
+						if(payload.id == id)
+						{
+							payload.rtcp_fb_list.emplace_back(std::string(matches[2]).c_str());
+						}
+					}
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("mid") - 1, "mid") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^mid:([^\\s]*)")))
+				{
+					media->mid = std::string(matches[1]).c_str();
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("set") - 1, "set") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^setup:(\\w*)")))
+				{
+					media->setup = std::string(matches[1]).c_str();
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("ss") - 1, "ss") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("ssrc:(\\d*) cname(?::(.*))?")))
+				{
+					media->ssrc = static_cast<uint32_t>(std::stoul(matches[1]));
+					media->cname = std::string(matches[2]).c_str();
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("fra") - 1, "fra") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^framerate:(\\d+(?:$|\\.\\d+))")))
+				{
+					media->framerate = std::stof(matches[1]);
+				}
+			}
+			else if(content.compare(0, OV_COUNTOF("se") - 1, "se") == 0 ||
+			        content.compare(0, OV_COUNTOF("re") - 1, "re") == 0 ||
+			        content.compare(0, OV_COUNTOF("in") - 1, "in") == 0)
+			{
+				if(std::regex_search(content, matches, std::regex("^(sendrecv|recvonly|sendonly|inactive)")))
+				{
+					media->direction = std::string(matches[1]).c_str();
+				}
+			}
+			else
+			{
+				ParseLegacyCommonAttrLine(content, media);
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return true;
+}
+
+bool SdpParseBench::ParseLegacyCommonAttrLine(const std::string &content, LegacyCommonAttr *attr)
+{
+	std::smatch matches;
+
+	if(content.compare(0, OV_COUNTOF("fi") - 1, "fi") == 0)
+	{
+		if(std::regex_search(content, matches, std::regex("^fingerprint:(\\S*) (\\S*)")))
+		{
+			attr->fingerprint_algorithm = std::string(matches[1]).c_str();
+			attr->fingerprint_value = std::string(matches[2]).c_str();
+		}
+	}
+	else if(content.compare(0, OV_COUNTOF("ice-o") - 1, "ice-o") == 0)
+	{
+		if(std::regex_search(content, matches, std::regex("^ice-options:(\\S*)")))
+		{
+			attr->ice_option = std::string(matches[1]).c_str();
+		}
+	}
+	else if(content.compare(0, OV_COUNTOF("ice-u") - 1, "ice-u") == 0)
+	{
+		if(std::regex_search(content, matches, std::regex("^ice-ufrag:(\\S*)")))
+		{
+			attr->ice_ufrag = std::string(matches[1]).c_str();
+		}
+	}
+	else if(content.compare(0, OV_COUNTOF("ice-p") - 1, "ice-p") == 0)
+	{
+		if(std::regex_search(content, matches, std::regex("^ice-pwd:(\\S*)")))
+		{
+			attr->ice_pwd = std::string(matches[1]).c_str();
+		}
+	}
+	else if(content.compare(0, OV_COUNTOF("fmtp") - 1, "fmtp") == 0)
+	{
+		std::regex_search(content, matches, std::regex("fmtp:(\\d*) (.*)profile-level-id=(.*)"));
+	}
+	else if(content.compare(0, OV_COUNTOF("rtcp:") - 1, "rtcp:") == 0)
+	{
+		std::regex_search(content, matches, std::regex("rtcp:(\\d*) IN (.*)"));
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,131 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <sdp/session_description.h>
+
+struct SdpParseBenchOptions
+{
+	int iteration_count = 1000;
+};
+
+enum class SdpParseBenchMode
+{
+	// Parses the browser answers with std::regex per line, used before the tokenizer
+	LegacyParse,
+	// SessionDescription::FromString() (SdpTokenizer)
+	TokenizerParse,
+	// Copies the stream offer, changes ice-ufrag and serializes the whole SDP again, used before the template
+	SerializeOffer,
+	// SessionDescription::CreateOfferWithIceUfrag() (splices ice-ufrag into the stream offer)
+	TemplateOffer
+};
+
+struct SdpParseBenchResult
+{
+	uint64_t sdp_count = 0;
+	uint64_t sdp_bytes = 0;
+	uint64_t failed_count = 0;
+
+	double seconds = 0.0;
+};
+
+class SdpParseBench
+{
+public:
+	explicit SdpParseBench(const SdpParseBenchOptions &options);
+
+	static const char *GetModeName(SdpParseBenchMode mode);
+
+	// Prepares the browser answers and the stream offer
+	bool Prepare();
+
+	size_t GetAnswerCount() const
+	{
+		return _answers.size();
+	}
+
+	// Checks that both parsers extract the same values, and both offers are the same
+	bool Verify();
+
+	void Run(SdpParseBenchMode mode, SdpParseBenchResult *result);
+
+protected:
+	struct LegacyPayload
+	{
+		uint8_t id = 0;
+		ov::String codec;
+		uint32_t rate = 0;
+		ov::String parameter;
+		std::vector<ov::String> rtcp_fb_list;
+	};
+
+	struct LegacyCommonAttr
+	{
+		ov::String fingerprint_algorithm;
+		ov::String fingerprint_value;
+		ov::String ice_option;
+		ov::String ice_ufrag;
+		ov::String ice_pwd;
+	};
+
+	struct LegacyMedia : public LegacyCommonAttr
+	{
+		ov::String media_type;
+		uint16_t port = 0;
+		bool use_dtls = false;
+		std::vector<LegacyPayload> payload_list;
+		uint8_t connection_ip_version = 0;
+		ov::String connection_address;
+		bool use_rtcp_mux = false;
+		ov::String mid;
+		ov::String setup;
+		ov::String direction;
+		uint32_t ssrc = 0;
+		ov::String cname;
+		float framerate = 0.0f;
+	};
+
+	struct LegacySession : public LegacyCommonAttr
+	{
+		uint8_t version = 0;
+		ov::String user_name;
+		uint32_t session_id = 0;
+		uint32_t session_version = 0;
+		ov::String net_type;
+		uint8_t ip_version = 0;
+		ov::String address;
+		ov::String session_name;
+		uint32_t start_time = 0;
+		uint32_t stop_time = 0;
+		std::vector<ov::String> bundles;
+		ov::String msid_semantic;
+		ov::String msid_token;
+		std::vector<LegacyMedia> media_list;
+	};
+
+	// The parser of SessionDescription/MediaDescription/CommonAttr before SdpTokenizer
+	static bool ParseLegacy(const ov::String &sdp, LegacySession *session);
+	static bool ParseLegacySessionLine(char type, const std::string &content, LegacySession *session);
+	static bool ParseLegacyMedia(const ov::String &desc, LegacyMedia *media);
+	static bool ParseLegacyMediaLine(char type, const std::string &content, LegacyMedia *media);
+	static bool ParseLegacyCommonAttrLine(const std::string &content, LegacyCommonAttr *attr);
+
+	// The offer creation of WebRtcPublisher::OnRequestOffer() before the template
+	std::shared_ptr<SessionDescription> SerializeOffer(const ov::String &ice_ufrag);
+
+	SdpParseBenchOptions _options;
+
+	std::vector<ov::String> _answers;
+	std::shared_ptr<SessionDescription> _stream_offer;
+	std::vector<ov::String> _ice_ufrags;
+};
@@ -19,41 +19,27 @@ BitWriter::BitWriter(uint32_t data_size)
 }
 
 //====================================================================================================
-// Destructor
+// Bit 쓰기
+// - 기록 위치의 Bit 들을 64bit Word 하나로 정렬 후 Byte 단위로 OR
+// - bit_count : 최대 32
 //====================================================================================================
 void BitWriter::Write(uint32_t bit_count, uint32_t value)
 {
-	uint8_t     *data 	= nullptr;
-	uint32_t    space 	= 0;
-	
-	data = _data->data();
-	
-	if (_bit_count + bit_count > _data->size()*8)
+	if (bit_count == 0 || _bit_count + bit_count > _data->size()*8)
 	{
 		return;
 	}
 
-	data += _bit_count/8;
+	uint8_t		*data 		= _data->data() + _bit_count/8;
+	uint32_t	bit_offset	= _bit_count%8;
+	uint32_t	byte_count	= (bit_offset + bit_count + 7)/8;
+	uint64_t	mask		= (bit_count == 32) ? 0xFFFFFFFF : ((1ULL<<bit_count)-1);
+	uint64_t	word		= ((uint64_t)value & mask) << (64 - bit_offset - bit_count);
 
-	space = 8-(_bit_count%8);
-
-	while (bit_count) 
+	for (uint32_t index = 0; index < byte_count; index++)
 	{
-		uint32_t mask = bit_count==32 ? 0xFFFFFFFF : ((1<<bit_count)-1);
-		
-		if (bit_count <= space)
-		{
-			*data |= ((value&mask) << (space -bit_count));
-			_bit_count += bit_count;
-			return;
-		}
-		else
-		{
-			*data |= ((value&mask) >> (bit_count- space));
-			++data;
-			_bit_count	+= space;
-			bit_count	-= space;
-			space		= 8;
-		}
+		data[index] |= (uint8_t)(word >> (56 - index*8));
 	}
-}
\ No newline at end of file
+
+	_bit_count += bit_count;
+}
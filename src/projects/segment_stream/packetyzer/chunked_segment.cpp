@@ -0,0 +1,142 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "chunked_segment.h"
+#include <chrono>
+
+//====================================================================================================
+// Constructor
+//====================================================================================================
+ChunkedSegment::ChunkedSegment(uint32_t sequence_number, const std::string &file_name, uint64_t timestamp)
+{
+    _sequence_number = sequence_number;
+    _file_name = file_name;
+    _timestamp = timestamp;
+}
+
+//====================================================================================================
+// Chunk 추가
+//====================================================================================================
+bool ChunkedSegment::AppendChunk(const std::shared_ptr<std::vector<uint8_t>> &data,
+                                 uint64_t timestamp,
+                                 uint64_t duration,
+                                 bool independent)
+{
+    if (data == nullptr || data->empty())
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    if (_is_completed)
+    {
+        return false;
+    }
+
+    SegmentChunk chunk;
+
+    chunk.data = data;
+    chunk.timestamp = timestamp;
+    chunk.duration = duration;
+    chunk.independent = independent;
+
+    _chunks.push_back(chunk);
+    _data_size += data->size();
+    _duration += duration;
+
+    chunks_lock.unlock();
+
+    _chunks_condition.notify_all();
+
+    return true;
+}
+
+//====================================================================================================
+// Segment 완료
+//====================================================================================================
+void ChunkedSegment::Complete()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    _is_completed = true;
+
+    chunks_lock.unlock();
+
+    _chunks_condition.notify_all();
+}
+
+bool ChunkedSegment::IsCompleted()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    return _is_completed;
+}
+
+size_t ChunkedSegment::GetChunkCount()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    return _chunks.size();
+}
+
+uint64_t ChunkedSegment::GetDuration()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    return _duration;
+}
+
+std::vector<SegmentChunk> ChunkedSegment::GetChunks()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    return _chunks;
+}
+
+//====================================================================================================
+// Chunk 대기
+//====================================================================================================
+bool ChunkedSegment::WaitChunk(size_t index, int timeout_ms, SegmentChunk &chunk)
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    bool result = _chunks_condition.wait_for(chunks_lock, std::chrono::milliseconds(timeout_ms), [this, index]() -> bool {
+        return index < _chunks.size() || _is_completed;
+    });
+
+    if (!result || index >= _chunks.size())
+    {
+        return false;
+    }
+
+    chunk = _chunks[index];
+
+    return true;
+}
+
+//====================================================================================================
+// 전체 데이터
+// - Segment 완료 이후 GetSegmentData 응답용
+//====================================================================================================
+std::shared_ptr<std::vector<uint8_t>> ChunkedSegment::GetData()
+{
+    std::unique_lock<std::mutex> chunks_lock(_chunks_mutex);
+
+    auto data = std::make_shared<std::vector<uint8_t>>();
+
+    data->reserve(_data_size);
+
+    for (auto &chunk : _chunks)
+    {
+        data->insert(data->end(), chunk.data->begin(), chunk.data->end());
+    }
+
+    return data;
+}
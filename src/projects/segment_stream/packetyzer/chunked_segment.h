@@ -0,0 +1,91 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+//====================================================================================================
+// SegmentChunk
+// - HLS : Partial Segment(TS)
+// - DASH : CMAF Chunk(moof + mdat)
+//====================================================================================================
+struct SegmentChunk
+{
+    std::shared_ptr<std::vector<uint8_t>> data;
+    uint64_t timestamp = 0;
+    uint64_t duration = 0;
+    bool independent = false;    // Key Frame 으로 시작
+};
+
+//====================================================================================================
+// ChunkedSegment
+// - 생성 중인 Segment(Low Latency)
+// - Segment 데이터 = Chunk 데이터의 연결
+// - Chunk 추가(Packetyzer) 와 Chunk 대기(Http 요청 Thread)가 서로 다른 Thread 에서 처리됨
+//====================================================================================================
+class ChunkedSegment
+{
+public:
+    ChunkedSegment(uint32_t sequence_number, const std::string &file_name, uint64_t timestamp);
+    ~ChunkedSegment() = default;
+
+public :
+    uint32_t GetSequenceNumber() const
+    {
+        return _sequence_number;
+    }
+
+    const std::string &GetFileName() const
+    {
+        return _file_name;
+    }
+
+    uint64_t GetTimestamp() const
+    {
+        return _timestamp;
+    }
+
+    bool AppendChunk(const std::shared_ptr<std::vector<uint8_t>> &data, uint64_t timestamp, uint64_t duration, bool independent);
+
+    // 더 이상 Chunk 가 추가되지 않음(대기 중인 요청 깨움)
+    void Complete();
+
+    bool IsCompleted();
+
+    size_t GetChunkCount();
+
+    uint64_t GetDuration();
+
+    std::vector<SegmentChunk> GetChunks();
+
+    // index 번째 Chunk 가 추가될 때 까지 대기
+    // - false : timeout or Chunk 추가 없이 Segment 완료
+    bool WaitChunk(size_t index, int timeout_ms, SegmentChunk &chunk);
+
+    // 전체 Chunk 연결 데이터
+    std::shared_ptr<std::vector<uint8_t>> GetData();
+
+private :
+    uint32_t _sequence_number;
+    std::string _file_name;
+    uint64_t _timestamp;
+
+    std::vector<SegmentChunk> _chunks;
+    size_t _data_size = 0;
+    uint64_t _duration = 0;
+    bool _is_completed = false;
+
+    std::mutex _chunks_mutex;
+    std::condition_variable _chunks_condition;
+};
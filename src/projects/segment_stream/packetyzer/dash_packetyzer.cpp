@@ -24,8 +24,11 @@ DashPacketyzer::DashPacketyzer(std::string &segment_prefix,
                                PacketyzerStreamType stream_type,
                                uint32_t segment_count,
                                uint32_t segment_duration,
-                               PacketyzerMediaInfo &media_info) :
-        Packetyzer(PacketyzerType::Dash, segment_prefix, stream_type, segment_count, segment_duration, media_info)
+                               PacketyzerMediaInfo &media_info,
+                               uint32_t chunk_duration,
+                               const std::shared_ptr<SegmentArena> &segment_arena) :
+        Packetyzer(PacketyzerType::Dash, segment_prefix, stream_type, segment_count, segment_duration, media_info,
+                   chunk_duration, segment_arena)
 {
     _avc_nal_header_size = 0;
     _video_frame_datas.clear();
@@ -63,21 +66,24 @@ DashPacketyzer::~DashPacketyzer()
 // - sps/pps
 // - init m4s 생성
 //====================================================================================================
-bool DashPacketyzer::VideoInit(std::shared_ptr<std::vector<uint8_t>> &data)
+bool DashPacketyzer::VideoInit(const std::shared_ptr<const ov::Data> &data)
 {
+    auto buffer = data->GetDataAs<uint8_t>();
+    size_t buffer_size = data->GetLength();
+
     // 패턴 확인
-    int current_index = 0;
-    int sps_start_index = -1;
-    int sps_end_index = -1;
-    int pps_start_index = -1;
-    int pps_end_index = -1;
+    size_t current_index = 0;
+    ssize_t sps_start_index = -1;
+    ssize_t sps_end_index = -1;
+    ssize_t pps_start_index = -1;
+    ssize_t pps_end_index = -1;
 
     // sps/pps parsing
-    while (current_index + AVC_NAL_START_PATTERN_SIZE < data->size())
+    while (current_index + AVC_NAL_START_PATTERN_SIZE < buffer_size)
     {
         // 0x00 0x00 0x00 0x01 패턴 체크
-        if (data->at(current_index) == 0 && data->at(current_index + 1) == 0 && data->at(current_index + 2) == 0 &&
-            data->at(current_index + 3) == 1)
+        if (buffer[current_index] == 0 && buffer[current_index + 1] == 0 && buffer[current_index + 2] == 0 &&
+            buffer[current_index + 3] == 1)
         {
             if (sps_start_index == -1)
             {
@@ -100,7 +106,7 @@ bool DashPacketyzer::VideoInit(std::shared_ptr<std::vector<uint8_t>> &data)
             }
         }
         // 0x00 0x00 0x01 패턴 체크
-        else if (data->at(current_index) == 0 && data->at(current_index + 1) == 0 && data->at(current_index + 2) == 1)
+        else if (buffer[current_index] == 0 && buffer[current_index + 1] == 0 && buffer[current_index + 2] == 1)
         {
             if (sps_start_index == -1)
             {
@@ -132,11 +138,11 @@ bool DashPacketyzer::VideoInit(std::shared_ptr<std::vector<uint8_t>> &data)
     }
 
     // SPS/PPS 저장
-    auto avc_sps = std::make_shared<std::vector<uint8_t>>(data->begin() + sps_start_index,
-                                                          data->begin() + sps_end_index + 1);
+    auto avc_sps = std::make_shared<std::vector<uint8_t>>(buffer + sps_start_index,
+                                                          buffer + sps_end_index + 1);
 
-    auto avc_pps = std::make_shared<std::vector<uint8_t>>(data->begin() + pps_start_index,
-                                                          data->begin() + pps_end_index + 1);
+    auto avc_pps = std::make_shared<std::vector<uint8_t>>(buffer + pps_start_index,
+                                                          buffer + pps_end_index + 1);
 
     // Video init m4s 생성(메모리)
     auto writer = std::make_unique<M4sInitWriter>(M4sMediaType::VideoMediaType,
@@ -223,10 +229,15 @@ bool DashPacketyzer::AppendVideoFrame(std::shared_ptr<PacketyzerFrameData> &fram
 
     // Fragment Check
     // - KeyFrame ~ KeyFrame 전까지
-    if (frame_data->type == PacketyzerFrameType::VideoIFrame && !_video_frame_datas.empty())
+    if (!_video_frame_datas.empty())
     {
+        // Low Latency : 이미 전송된 Chunk 포함
+        uint64_t segment_start_timestamp = (_video_chunked_segment != nullptr) ? _video_chunked_segment->GetTimestamp()
+                                                                               : _video_frame_datas[0]->timestamp;
+
         // druation check(I-Frame Start)
-        if ((frame_data->timestamp - _video_frame_datas[0]->timestamp) >
+        if (frame_data->type == PacketyzerFrameType::VideoIFrame &&
+            (frame_data->timestamp - segment_start_timestamp) >
             ((((double) _segment_duration) * 0.80) * _media_info.video_timescale)) // I-Frame 관련 threshold 80% 한도 내에서 처리
         {
             // Video Segment Write
@@ -243,6 +254,28 @@ bool DashPacketyzer::AppendVideoFrame(std::shared_ptr<PacketyzerFrameData> &fram
             // Mpd Update
             UpdatePlayList(true);
         }
+        else if (IsLowLatency() &&
+                 (frame_data->timestamp - _video_frame_datas[0]->timestamp) >= (uint64_t) _chunk_duration * _media_info.video_timescale / 1000)
+        {
+            bool new_segment = (_video_chunked_segment == nullptr);
+
+            // Video Chunk Write
+            VideoChunkWrite(frame_data->timestamp);
+
+            // Audio Chunk Write
+            if (_stream_type != PacketyzerStreamType::VideoOnly && _audio_init)
+            {
+                AudioChunkWrite(ConvertTimeScale(frame_data->timestamp,
+                                                  _media_info.video_timescale,
+                                                  _media_info.audio_timescale));
+            }
+
+            // Mpd Update(생성 중인 Segment 추가)
+            if (new_segment)
+            {
+                UpdatePlayList(true);
+            }
+        }
     }
 
     _video_frame_datas.push_back(frame_data);
@@ -264,8 +297,11 @@ bool DashPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &fram
 
     if (!_audio_frame_datas.empty() && _stream_type == PacketyzerStreamType::AudioOnly)
     {
+        uint64_t segment_start_timestamp = (_audio_chunked_segment != nullptr) ? _audio_chunked_segment->GetTimestamp()
+                                                                               : _audio_frame_datas[0]->timestamp;
+
         // duration check
-        if ((frame_data->timestamp - _audio_frame_datas[0]->timestamp) >
+        if ((frame_data->timestamp - segment_start_timestamp) >
             (_segment_duration * _media_info.audio_timescale))
         {
             AudioSegmentWrite(frame_data->timestamp);
@@ -273,6 +309,19 @@ bool DashPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &fram
             // Mpd Update
             UpdatePlayList(false);
         }
+        else if (IsLowLatency() &&
+                 (frame_data->timestamp - _audio_frame_datas[0]->timestamp) >= (uint64_t) _chunk_duration * _media_info.audio_timescale / 1000)
+        {
+            bool new_segment = (_audio_chunked_segment == nullptr);
+
+            AudioChunkWrite(frame_data->timestamp);
+
+            // Mpd Update(생성 중인 Segment 추가)
+            if (new_segment)
+            {
+                UpdatePlayList(false);
+            }
+        }
     }
 
     _audio_frame_datas.push_back(frame_data);
@@ -281,13 +330,15 @@ bool DashPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &fram
 }
 
 //====================================================================================================
-// Video Segment Write
-// - Duration/Key Frame 확인 이후 이전 데이터 까지 생성
+// Video Fragment(moof + mdat) Write
+// - 저장된 Video Frame 전체
+// - Low Latency : Chunk 단위 Fragment
 //====================================================================================================
-bool DashPacketyzer::VideoSegmentWrite(uint64_t last_timestamp)
+std::shared_ptr<std::vector<uint8_t>> DashPacketyzer::VideoFragmentWrite(uint64_t last_timestamp,
+                                                                        uint64_t &start_timestamp,
+                                                                        bool &independent)
 {
     uint64_t duration = 0;
-    uint64_t start_timestamp = 0;
     bool start_check = false;
     std::vector<std::shared_ptr<FragmentSampleData>> sample_datas;
 
@@ -300,6 +351,7 @@ bool DashPacketyzer::VideoSegmentWrite(uint64_t last_timestamp)
         {
             start_check = true;
             start_timestamp = frame_data->timestamp;
+            independent = (frame_data->type == PacketyzerFrameType::VideoIFrame);
         }
 
         if (_video_frame_datas.empty())
@@ -307,20 +359,23 @@ bool DashPacketyzer::VideoSegmentWrite(uint64_t last_timestamp)
         else
             duration = _video_frame_datas.front()->timestamp - frame_data->timestamp;
 
-        auto data = std::make_shared<std::vector<uint8_t>>(
-                (frame_data->type == PacketyzerFrameType::VideoIFrame) ? (frame_data->data->begin() +
-                                                                          _avc_nal_header_size) : (
-                        frame_data->data->begin() + AVC_NAL_START_PATTERN_SIZE), frame_data->data->end());
-
+        // Frame 데이터 참조(sps/pps + start code 제외)
         auto sample_data = std::make_shared<FragmentSampleData>(duration,
                                                                 frame_data->type == PacketyzerFrameType::VideoIFrame
                                                                 ? 0X02000000 : 0X01010000, frame_data->time_offset,
-                                                                data);
+                                                                frame_data->data,
+                                                                (frame_data->type == PacketyzerFrameType::VideoIFrame)
+                                                                ? _avc_nal_header_size : AVC_NAL_START_PATTERN_SIZE);
 
         sample_datas.push_back(sample_data);
     }
     _video_frame_datas.clear();
 
+    if (sample_datas.empty())
+    {
+        return nullptr;
+    }
+
     // Fragment 쓰기
     auto fragment_writer = std::make_unique<M4sFragmentWriter>(M4sMediaType::VideoMediaType,
                                                                 4096,
@@ -330,35 +385,111 @@ bool DashPacketyzer::VideoSegmentWrite(uint64_t last_timestamp)
                                                                 sample_datas);
 
     fragment_writer->CreateData();
-    auto data_stream = fragment_writer->GetDataStream();
 
-    std::ostringstream file_name;
-    file_name << _segment_prefix << "_" << start_timestamp << "_video.m4s";
+    _video_sequence_number++;
+
+    return fragment_writer->GetDataStream();
+}
+
+//====================================================================================================
+// Video Segment Write
+// - Duration/Key Frame 확인 이후 이전 데이터 까지 생성
+// - Low Latency : 마지막 Chunk Write 이후 Segment 완료
+//====================================================================================================
+bool DashPacketyzer::VideoSegmentWrite(uint64_t last_timestamp)
+{
+    uint64_t start_timestamp = 0;
+    std::shared_ptr<std::vector<uint8_t>> data_stream;
+    std::string file_name;
+
+    if (IsLowLatency())
+    {
+        VideoChunkWrite(last_timestamp);
+
+        if (_video_chunked_segment == nullptr)
+        {
+            return false;
+        }
+
+        start_timestamp = _video_chunked_segment->GetTimestamp();
+        data_stream = _video_chunked_segment->GetData();
+        file_name = _video_chunked_segment->GetFileName();
+    }
+    else
+    {
+        bool independent = false;
+
+        data_stream = VideoFragmentWrite(last_timestamp, start_timestamp, independent);
+
+        if (data_stream == nullptr)
+        {
+            return false;
+        }
+
+        std::ostringstream file_name_stream;
+        file_name_stream << _segment_prefix << "_" << start_timestamp << "_video.m4s";
+        file_name = file_name_stream.str();
+    }
 
     // m4s 데이터 저장
     SetSegmentData(SegmentDataType::Mp4Video,
                     _sequence_number,
-                    file_name.str(),
+                    file_name,
                     last_timestamp - start_timestamp,
                     start_timestamp,
                     data_stream);
 
+    if (_video_chunked_segment != nullptr)
+    {
+        _video_chunked_segment->Complete();
+        _video_chunked_segment = nullptr;
+    }
+
     _sequence_number++;
-    _video_sequence_number++;
 
     return true;
 }
 
 //====================================================================================================
-// Audio Segment Write
-// - 비디오 Segment 생성이후 생성 or Audio Only 에서 생성
+// Video Chunk Write(Low Latency)
+// - 저장된 Video Frame 을 CMAF Chunk 로 생성 중인 Segment 에 추가
+// - Segment 첫 Chunk 에서 Segment 생성
 //====================================================================================================
-bool DashPacketyzer::AudioSegmentWrite(uint64_t last_timestamp)
+bool DashPacketyzer::VideoChunkWrite(uint64_t last_timestamp)
 {
-    uint32_t duration = 0;
     uint64_t start_timestamp = 0;
+    bool independent = false;
+
+    auto data_stream = VideoFragmentWrite(last_timestamp, start_timestamp, independent);
+
+    if (data_stream == nullptr)
+    {
+        return false;
+    }
+
+    if (_video_chunked_segment == nullptr)
+    {
+        std::ostringstream file_name;
+        file_name << _segment_prefix << "_" << start_timestamp << "_video.m4s";
+
+        _video_chunked_segment = std::make_shared<ChunkedSegment>(_sequence_number, file_name.str(), start_timestamp);
+
+        AddChunkedSegment(_video_chunked_segment);
+    }
+
+    return _video_chunked_segment->AppendChunk(data_stream, start_timestamp, last_timestamp - start_timestamp, independent);
+}
+
+//====================================================================================================
+// Audio Fragment(moof + mdat) Write
+// - last_timestamp 이전 Audio Frame(duration 계산을 위해 마지막 Frame 은 유지)
+//====================================================================================================
+std::shared_ptr<std::vector<uint8_t>> DashPacketyzer::AudioFragmentWrite(uint64_t last_timestamp,
+                                                                        uint64_t &start_timestamp,
+                                                                        uint64_t &end_timestamp)
+{
+    uint32_t duration = 0;
     bool start_check = false;
-    uint64_t end_timestamp = 0;
     std::vector<std::shared_ptr<FragmentSampleData>> sample_datas;
 
     while (!_audio_frame_datas.empty())
@@ -382,10 +513,8 @@ bool DashPacketyzer::AudioSegmentWrite(uint64_t last_timestamp)
         duration = (uint32_t) (_audio_frame_datas.front()->timestamp - frame_data->timestamp);
         end_timestamp = _audio_frame_datas.front()->timestamp;
 
-        auto data = std::make_shared<std::vector<uint8_t>>((frame_data->data->begin() + ADTS_HEADER_SIZE),
-                                                           frame_data->data->end());
-
-        auto sample_data = std::make_shared<FragmentSampleData>(duration, 0, 0, data);
+        // Frame 데이터 참조(ADTS header 제외)
+        auto sample_data = std::make_shared<FragmentSampleData>(duration, 0, 0, frame_data->data, ADTS_HEADER_SIZE);
 
         sample_datas.push_back(sample_data);
     }
@@ -399,26 +528,96 @@ bool DashPacketyzer::AudioSegmentWrite(uint64_t last_timestamp)
                                                                 sample_datas);
 
     fragment_writer->CreateData();
-    auto data_stream = fragment_writer->GetDataStream();
 
-    std::ostringstream file_name;
+    _audio_sequence_number++;
+
+    return fragment_writer->GetDataStream();
+}
+
+//====================================================================================================
+// Audio Segment Write
+// - 비디오 Segment 생성이후 생성 or Audio Only 에서 생성
+// - Low Latency : 마지막 Chunk Write 이후 Segment 완료
+//====================================================================================================
+bool DashPacketyzer::AudioSegmentWrite(uint64_t last_timestamp)
+{
+    uint64_t start_timestamp = 0;
+    uint64_t end_timestamp = 0;
+    std::shared_ptr<std::vector<uint8_t>> data_stream;
+    std::string file_name;
+
+    if (IsLowLatency())
+    {
+        AudioChunkWrite(last_timestamp);
 
-    file_name << _segment_prefix << "_" << start_timestamp << "_audio.m4s";
+        if (_audio_chunked_segment == nullptr)
+        {
+            return false;
+        }
+
+        start_timestamp = _audio_chunked_segment->GetTimestamp();
+        end_timestamp = start_timestamp + _audio_chunked_segment->GetDuration();
+        data_stream = _audio_chunked_segment->GetData();
+        file_name = _audio_chunked_segment->GetFileName();
+    }
+    else
+    {
+        data_stream = AudioFragmentWrite(last_timestamp, start_timestamp, end_timestamp);
+
+        std::ostringstream file_name_stream;
+        file_name_stream << _segment_prefix << "_" << start_timestamp << "_audio.m4s";
+        file_name = file_name_stream.str();
+    }
 
     // m4s 데이터 저장
     SetSegmentData(SegmentDataType::Mp4Audio,
                     _sequence_number,
-                    file_name.str(),
+                    file_name,
                     end_timestamp - start_timestamp,
                     start_timestamp,
                     data_stream);
 
+    if (_audio_chunked_segment != nullptr)
+    {
+        _audio_chunked_segment->Complete();
+        _audio_chunked_segment = nullptr;
+    }
+
     _sequence_number++;
-    _audio_sequence_number++;
 
     return true;
 }
 
+//====================================================================================================
+// Audio Chunk Write(Low Latency)
+// - Video Chunk 생성이후 생성 or Audio Only 에서 생성
+//====================================================================================================
+bool DashPacketyzer::AudioChunkWrite(uint64_t last_timestamp)
+{
+    // Chunk 에 포함될 Frame 확인(마지막 Frame 은 duration 계산을 위해 유지)
+    if (_audio_frame_datas.size() <= 1 || _audio_frame_datas.front()->timestamp >= last_timestamp)
+    {
+        return false;
+    }
+
+    uint64_t start_timestamp = 0;
+    uint64_t end_timestamp = 0;
+
+    auto data_stream = AudioFragmentWrite(last_timestamp, start_timestamp, end_timestamp);
+
+    if (_audio_chunked_segment == nullptr)
+    {
+        std::ostringstream file_name;
+        file_name << _segment_prefix << "_" << start_timestamp << "_audio.m4s";
+
+        _audio_chunked_segment = std::make_shared<ChunkedSegment>(_sequence_number, file_name.str(), start_timestamp);
+
+        AddChunkedSegment(_audio_chunked_segment);
+    }
+
+    return _audio_chunked_segment->AppendChunk(data_stream, start_timestamp, end_timestamp - start_timestamp, true);
+}
+
 //====================================================================================================
 // PlayList(mpd) 업데이트
 // - 차후 자동 인덱싱 사용시 참고 : LSN = floor(now - (availabilityStartTime + PST) / segmentDuration + startNumber - 1)
@@ -434,44 +633,71 @@ bool DashPacketyzer::UpdatePlayList(bool video_update)
     std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
 
     // Video Segment Listing
-    for (int index = std::max((int) (_video_segment_indexer.size() - _segment_count), 0);
-         index < _video_segment_indexer.size(); index++)
+    uint32_t video_start_key = GetPlayListStartKey(SegmentDataType::Mp4Video);
+
+    for (uint32_t key = video_start_key; key < _video_segment_ring.GetNextKey(); key++)
     {
-        auto item = _segment_datas.find(_video_segment_indexer[index]);
-        if (item == _segment_datas.end()) continue;
+        auto segment_data = FindSegmentData(SegmentDataType::Mp4Video, key);
 
         // Timeline Setting
-        if (index != std::max((int) (_video_segment_indexer.size() - _segment_count), 0))
-            video_segment_urls << "\t\t\t\t" << "<S d=\"" << item->second->duration << "\"/>\n";
+        // - Low Latency : 생성 중인 Segment 의 예상 duration 과 실제 duration 이 다를 수 있어 시작 시간 항상 표시
+        if (key != video_start_key && !IsLowLatency())
+            video_segment_urls << "\t\t\t\t" << "<S d=\"" << segment_data->duration << "\"/>\n";
         else
-            video_segment_urls  << "\t\t\t\t" << "<S t=\"" << item->second->timestamp
-                                << "\" d=\"" << item->second->duration
+            video_segment_urls  << "\t\t\t\t" << "<S t=\"" << segment_data->timestamp
+                                << "\" d=\"" << segment_data->duration
                                 << "\"/>\n";
         // 전체 duration
-        video_total_duration += item->second->duration;
+        video_total_duration += segment_data->duration;
 
     }
 
     // Audio Segment Listing
-    for (int index = std::max((int) (_audio_segment_indexer.size() - _segment_count), 0);
-         index < _audio_segment_indexer.size(); index++)
+    uint32_t audio_start_key = GetPlayListStartKey(SegmentDataType::Mp4Audio);
+
+    for (uint32_t key = audio_start_key; key < _audio_segment_ring.GetNextKey(); key++)
     {
-        auto item = _segment_datas.find(_audio_segment_indexer[index]);
-        if (item == _segment_datas.end()) continue;
+        auto segment_data = FindSegmentData(SegmentDataType::Mp4Audio, key);
 
         // Timeline Setting
-        if (index != std::max((int) (_audio_segment_indexer.size() - _segment_count), 0))
-            audio_segment_urls << "\t\t\t\t<S d=\"" << item->second->duration << "\"/>\n";
+        if (key != audio_start_key && !IsLowLatency())
+            audio_segment_urls << "\t\t\t\t<S d=\"" << segment_data->duration << "\"/>\n";
         else
-            audio_segment_urls << "\t\t\t\t<S t=\"" << item->second->timestamp
-                               << "\" d=\"" << item->second->duration
+            audio_segment_urls << "\t\t\t\t<S t=\"" << segment_data->timestamp
+                               << "\" d=\"" << segment_data->duration
                                << "\"/>\n";
         // 전체 duration
-        audio_total_duration += item->second->duration;
+        audio_total_duration += segment_data->duration;
     }
 
     segment_datas_lock.unlock();
 
+    // 생성 중인 Segment(Low Latency)
+    // - 예상 duration(Segment Duration) 으로 표시, Chunk 단위로 응답(availabilityTimeOffset)
+    if (_video_chunked_segment != nullptr)
+    {
+        video_segment_urls << "\t\t\t\t" << "<S t=\"" << _video_chunked_segment->GetTimestamp()
+                           << "\" d=\"" << _segment_duration * _media_info.video_timescale
+                           << "\"/>\n";
+    }
+
+    if (_audio_chunked_segment != nullptr)
+    {
+        audio_segment_urls << "\t\t\t\t" << "<S t=\"" << _audio_chunked_segment->GetTimestamp()
+                           << "\" d=\"" << _segment_duration * _media_info.audio_timescale
+                           << "\"/>\n";
+    }
+
+    // Segment 완료 이전 요청 가능 시간(Chunked Transfer)
+    std::ostringstream availability_time;
+
+    if (IsLowLatency())
+    {
+        availability_time << std::fixed << std::setprecision(3)
+                          << "\" availabilityTimeOffset=\"" << (_segment_duration - _chunk_duration / 1000.0)
+                          << "\" availabilityTimeComplete=\"false";
+    }
+
     if (_start_time.empty())
     {
         _start_time = MakeUtcTimeString(time(nullptr));
@@ -512,7 +738,8 @@ bool DashPacketyzer::UpdatePlayList(bool video_update)
             << "\" segmentAlignment=\"true\" startWithSAP=\"1\" subsegmentAlignment=\"true\" subsegmentStartsWithSAP=\"1\">"
             << "\n"
             << "\t\t<SegmentTemplate timescale=\"" << _media_info.video_timescale
-            << "\" initialization=\"video_init.m4s\" media=\"" << _segment_prefix << "_$Time$_video.m4s\">\n"
+            << "\" initialization=\"video_init.m4s\" media=\"" << _segment_prefix << "_$Time$_video.m4s"
+            << availability_time.str() << "\">\n"
             << "\t\t\t<SegmentTimeline>\n"
             << video_segment_urls.str()
             << "\t\t\t</SegmentTimeline>\n"
@@ -529,7 +756,8 @@ bool DashPacketyzer::UpdatePlayList(bool video_update)
             << "\t\t<AudioChannelConfiguration schemeIdUri=\"urn:mpeg:dash:23003:3:audio_channel_configuration:2011\" value=\""
             << _media_info.audio_channels << "\"/>\n"
             << "\t\t<SegmentTemplate timescale=\"" << _media_info.audio_timescale
-            << "\" initialization=\"audio_init.m4s\" media=\"" << _segment_prefix << "_$Time$_audio.m4s\">\n"
+            << "\" initialization=\"audio_init.m4s\" media=\"" << _segment_prefix << "_$Time$_audio.m4s"
+            << availability_time.str() << "\">\n"
             << "\t\t\t<SegmentTimeline>\n"
             << audio_segment_urls.str()
             << "\t\t\t</SegmentTimeline>\n"
@@ -17,6 +17,7 @@
 // DashPacketyzer
 // m4s : [Prefix]_[Index].TS
 // mpd : manifest.mpd
+// Low Latency : 생성 중인 Segment 를 CMAF Chunk(moof + mdat) 단위로 전송
 //====================================================================================================
 class DashPacketyzer : public Packetyzer
 {
@@ -25,12 +26,14 @@ public:
                    PacketyzerStreamType stream_type,
                    uint32_t segment_count,
                    uint32_t segment_duration,
-                   PacketyzerMediaInfo &media_info);
+                   PacketyzerMediaInfo &media_info,
+                   uint32_t chunk_duration = 0,
+                   const std::shared_ptr<SegmentArena> &segment_arena = nullptr);
 
     ~DashPacketyzer() final;
 
 public :
-    bool VideoInit(std::shared_ptr<std::vector<uint8_t>> &data);
+    bool VideoInit(const std::shared_ptr<const ov::Data> &data);
 
     bool AudioInit();
 
@@ -45,6 +48,15 @@ public :
 protected :
     bool UpdatePlayList(bool video_update);
 
+    std::shared_ptr<std::vector<uint8_t>> VideoFragmentWrite(uint64_t last_timestamp, uint64_t &start_timestamp, bool &independent);
+
+    std::shared_ptr<std::vector<uint8_t>> AudioFragmentWrite(uint64_t last_timestamp, uint64_t &start_timestamp, uint64_t &end_timestamp);
+
+    // Low Latency
+    bool VideoChunkWrite(uint64_t last_timestamp);
+
+    bool AudioChunkWrite(uint64_t last_timestamp);
+
 private :
     bool _video_init;
     bool _audio_init;
@@ -57,4 +69,8 @@ private :
 
     std::deque<std::shared_ptr<PacketyzerFrameData>> _video_frame_datas;
     std::deque<std::shared_ptr<PacketyzerFrameData>> _audio_frame_datas;
+
+    // Low Latency(생성 중인 Segment)
+    std::shared_ptr<ChunkedSegment> _video_chunked_segment;
+    std::shared_ptr<ChunkedSegment> _audio_chunked_segment;
 };
\ No newline at end of file
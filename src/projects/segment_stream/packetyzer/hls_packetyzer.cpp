@@ -13,11 +13,16 @@
 #include <iomanip>
 #include <array>
 #include <algorithm>
+#include <cmath>
 #include <base/ovlibrary/ovlibrary.h>
 
 #define OV_LOG_TAG                  "SegmentStream"
 #define HLS_MAX_TEMP_VIDEO_DATA_COUNT        (500)
 
+// Part duration 은 PART-TARGET 을 넘지 않아야 함(Frame 경계에서 분리)
+// - Chunk Duration 85% 이상 진행된 Frame 에서 Part 분리
+#define HLS_PART_DURATION_THRESHOLD     (0.85)
+
 //====================================================================================================
 // Constructor
 //====================================================================================================
@@ -25,9 +30,11 @@ HlsPacketyzer::HlsPacketyzer(std::string &segment_prefix,
                              PacketyzerStreamType stream_type,
                              uint32_t segment_count,
                              uint32_t segment_duration,
-                             PacketyzerMediaInfo &media_info) :
+                             PacketyzerMediaInfo &media_info,
+                             uint32_t chunk_duration,
+                             const std::shared_ptr<SegmentArena> &segment_arena) :
         Packetyzer(PacketyzerType::Hls, segment_prefix, stream_type, segment_count, (uint32_t) segment_duration,
-                   media_info)
+                   media_info, chunk_duration, segment_arena)
 {
     _media_info.audio_timescale = PACKTYZER_DEFAULT_TIMESCALE;
 }
@@ -64,7 +71,26 @@ bool HlsPacketyzer::AppendVideoFrame(std::shared_ptr<PacketyzerFrameData> &frame
         time_offset = ConvertTimeScale(frame_data->time_offset, frame_data->timescale, _media_info.video_timescale);
     }
 
-    if (frame_data->type == PacketyzerFrameType::VideoIFrame && !_frame_datas.empty())
+    if (IsLowLatency())
+    {
+        if (_chunked_segment == nullptr)
+        {
+            CreateChunkedSegment(timestamp);
+        }
+        else if (frame_data->type == PacketyzerFrameType::VideoIFrame &&
+                 (timestamp - _chunked_segment->GetTimestamp()) > (double) _segment_duration * 0.87 * _media_info.video_timescale)
+        {
+            // Segment Write(마지막 Part 포함)
+            ChunkedSegmentWrite(timestamp);
+        }
+        else if ((timestamp - _part_start_timestamp) >= _chunk_duration * HLS_PART_DURATION_THRESHOLD * _media_info.video_timescale / 1000)
+        {
+            // Part Write
+            PartWrite(timestamp);
+            UpdatePlayList();
+        }
+    }
+    else if (frame_data->type == PacketyzerFrameType::VideoIFrame && !_frame_datas.empty())
     {
         // Duration Check
         uint64_t duration = timestamp - _frame_datas[0]->timestamp;
@@ -77,11 +103,9 @@ bool HlsPacketyzer::AppendVideoFrame(std::shared_ptr<PacketyzerFrameData> &frame
         }
     }
 
-    // 데이터 복사
-    auto frame = std::make_shared<std::vector<uint8_t>>(frame_data->data->data(),
-                                                        frame_data->data->data() + frame_data->data->size());
+    // Frame 데이터는 복사하지 않고 공유(Segment Write 이후 해제)
     auto video_data = std::make_shared<PacketyzerFrameData>(frame_data->type, timestamp, time_offset,
-                                                            PACKTYZER_DEFAULT_TIMESCALE, frame);
+                                                            PACKTYZER_DEFAULT_TIMESCALE, frame_data->data);
 
     _frame_datas.push_back(video_data);
 
@@ -115,7 +139,23 @@ bool HlsPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &frame
                                                                                 : ConvertTimeScale(
                     frame_data->timestamp, frame_data->timescale, _media_info.audio_timescale);
 
-    if (_stream_type == PacketyzerStreamType::AudioOnly && !_frame_datas.empty())
+    if (_stream_type == PacketyzerStreamType::AudioOnly && IsLowLatency())
+    {
+        if (_chunked_segment == nullptr)
+        {
+            CreateChunkedSegment(timestamp);
+        }
+        else if ((timestamp - _chunked_segment->GetTimestamp()) >= (_segment_duration * _media_info.audio_timescale))
+        {
+            ChunkedSegmentWrite(timestamp);
+        }
+        else if ((timestamp - _part_start_timestamp) >= _chunk_duration * HLS_PART_DURATION_THRESHOLD * _media_info.audio_timescale / 1000)
+        {
+            PartWrite(timestamp);
+            UpdatePlayList();
+        }
+    }
+    else if (_stream_type == PacketyzerStreamType::AudioOnly && !_frame_datas.empty())
     {
         // Duration Check
         uint64_t duration = timestamp - _frame_datas[0]->timestamp;
@@ -127,11 +167,9 @@ bool HlsPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &frame
         }
     }
 
-    // 데이터 복사
-    auto frame = std::make_shared<std::vector<uint8_t>>(frame_data->data->data(),
-                                                        frame_data->data->data() + frame_data->data->size());
+    // Frame 데이터는 복사하지 않고 공유(Segment Write 이후 해제)
     auto audio_data = std::make_shared<PacketyzerFrameData>(frame_data->type, timestamp, 0, _media_info.audio_timescale,
-                                                            frame);
+                                                            frame_data->data);
 
     _frame_datas.push_back(audio_data);
 
@@ -143,7 +181,16 @@ bool HlsPacketyzer::AppendAudioFrame(std::shared_ptr<PacketyzerFrameData> &frame
 //====================================================================================================
 bool HlsPacketyzer::SegmentWrite(uint64_t start_timestamp, uint64_t duration)
 {
-    auto ts_writer = std::make_unique<TsWriter>(_stream_type);
+    size_t frame_data_size = 0;
+
+    for (auto &frame_data : _frame_datas)
+    {
+        frame_data_size += frame_data->data->GetLength();
+    }
+
+    // Segment 버퍼 미리 할당(TS 패킷 추가시 재할당 방지)
+    auto ts_writer = std::make_unique<TsWriter>(_stream_type,
+                                                TsWriter::EstimateDataSize(_frame_datas.size(), frame_data_size));
     int64_t _first_audio_time_stamp = 0;
     int64_t _first_video_time_stamp = 0;
 
@@ -155,7 +202,8 @@ bool HlsPacketyzer::SegmentWrite(uint64_t start_timestamp, uint64_t duration)
                                frame_data->type == PacketyzerFrameType::VideoIFrame,
                                frame_data->timestamp,
                                frame_data->time_offset,
-                               frame_data->data);
+                               frame_data->data->GetDataAs<uint8_t>(),
+                               frame_data->data->GetLength());
 
         if(_first_audio_time_stamp == 0 && frame_data->type == PacketyzerFrameType::AudioFrame)
             _first_audio_time_stamp = frame_data->timestamp;
@@ -189,25 +237,33 @@ bool HlsPacketyzer::SegmentWrite(uint64_t start_timestamp, uint64_t duration)
 //====================================================================================================
 bool HlsPacketyzer::UpdatePlayList()
 {
+    if (IsLowLatency())
+    {
+        return UpdateChunkedPlayList();
+    }
+
     std::ostringstream play_list;
     std::ostringstream m3u8_play_list;
     double max_duration = 0;
+    int64_t media_sequence = -1;
 
     std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
 
-    for (int index = std::max(0, (int) (_segment_indexer.size() - _segment_count));
-         index < _segment_indexer.size(); index++)
+    for (uint32_t key = GetPlayListStartKey(SegmentDataType::Ts); key < _segment_ring.GetNextKey(); key++)
     {
-        auto file_name = _segment_indexer[index];
-        auto item = _segment_datas.find(file_name);
+        auto segment_data = FindSegmentData(SegmentDataType::Ts, key);
 
-        if (item != _segment_datas.end())
+        if (segment_data != nullptr)
         {
-            auto segment_data = item->second;
+            // 첫 Segment 의 sequence number(DVR Window 이동시 Player 가 Segment 위치 확인)
+            if (media_sequence < 0)
+            {
+                media_sequence = segment_data->sequence_number;
+            }
 
             m3u8_play_list << "#EXTINF:" << std::fixed << std::setprecision(3)
                            << (double)(segment_data->duration) / (double)(PACKTYZER_DEFAULT_TIMESCALE) << ",\r\n"
-                           << file_name << "\r\n";
+                           << segment_data->file_name << "\r\n";
 
             if (segment_data->duration > max_duration)
             {
@@ -218,7 +274,7 @@ bool HlsPacketyzer::UpdatePlayList()
     segment_datas_lock.unlock();
 
     play_list << "#EXTM3U" << "\r\n"
-              << "#EXT-X-MEDIA-SEQUENCE:" << _sequence_number + 1 << "\r\n"
+              << "#EXT-X-MEDIA-SEQUENCE:" << ((media_sequence >= 0) ? media_sequence : _sequence_number) << "\r\n"
               << "#EXT-X-VERSION:3" << "\r\n"
               << "#EXT-X-ALLOW-CACHE:NO" << "\r\n"
               << "#EXT-X-TARGETDURATION:" << (int) (max_duration / PACKTYZER_DEFAULT_TIMESCALE) << "\r\n"
@@ -230,3 +286,288 @@ bool HlsPacketyzer::UpdatePlayList()
 
     return true;
 }
+
+//====================================================================================================
+// Chunked Segment 생성(Low Latency)
+// - Segment 첫 Frame 기준
+// - 첫 Part 이름 미리 등록(Preload Hint)
+//====================================================================================================
+bool HlsPacketyzer::CreateChunkedSegment(uint64_t start_timestamp)
+{
+    std::ostringstream file_name_stream;
+    file_name_stream << _segment_prefix << "_" << _sequence_number << ".ts";
+
+    _chunked_segment = std::make_shared<ChunkedSegment>(_sequence_number, file_name_stream.str(), start_timestamp);
+
+    // PAT/PMT 는 첫 Part 에 포함(이후 독립 Part 는 PartWrite 에서 추가)
+    // - Segment 버퍼는 이전 Segment 크기 기준으로 미리 할당
+    size_t data_init_size = TS_WRITER_DEFAULT_DATA_SIZE;
+
+    if (_ts_writer != nullptr)
+    {
+        data_init_size = std::max(data_init_size, _ts_writer->GetDataStream()->size() * 5 / 4);
+    }
+
+    _ts_writer = std::make_unique<TsWriter>(_stream_type, data_init_size);
+    _part_data_offset = 0;
+    _part_start_timestamp = start_timestamp;
+
+    AddChunkedSegment(_chunked_segment);
+    AddChunkedSegmentPart(MakePartFileName(_sequence_number, 0), _chunked_segment, 0);
+
+    return true;
+}
+
+//====================================================================================================
+// Part(Partial Segment) Write
+// - 현재 Part Frame 들을 Segment TsWriter 에 쓰고 추가된 데이터를 Part 로 등록
+// - Segment 데이터 = Part 데이터의 연결
+//====================================================================================================
+bool HlsPacketyzer::PartWrite(uint64_t last_timestamp)
+{
+    if (_chunked_segment == nullptr || _frame_datas.empty())
+    {
+        return false;
+    }
+
+    // Key Frame 으로 시작하는 Part 만 독립 재생 가능(Audio Only 는 모든 Part)
+    bool independent = (_stream_type == PacketyzerStreamType::AudioOnly);
+
+    for (auto &frame_data : _frame_datas)
+    {
+        if (frame_data->type != PacketyzerFrameType::AudioFrame)
+        {
+            independent = (frame_data->type == PacketyzerFrameType::VideoIFrame);
+            break;
+        }
+    }
+
+    // 독립 Part 는 PAT/PMT 부터 시작(첫 Part 는 TsWriter 생성시 기록)
+    if (independent && _part_data_offset > 0)
+    {
+        _ts_writer->WritePsi();
+    }
+
+    for (auto &frame_data : _frame_datas)
+    {
+        bool is_video = frame_data->type != PacketyzerFrameType::AudioFrame;
+
+        // TS(PES) Write
+        _ts_writer->WriteSample(is_video,
+                                frame_data->type == PacketyzerFrameType::AudioFrame ||
+                                frame_data->type == PacketyzerFrameType::VideoIFrame,
+                                frame_data->timestamp,
+                                frame_data->time_offset,
+                                frame_data->data->GetDataAs<uint8_t>(),
+                                frame_data->data->GetLength());
+    }
+
+    _frame_datas.clear();
+
+    auto &data_stream = _ts_writer->GetDataStream();
+    auto part_data = std::make_shared<std::vector<uint8_t>>(data_stream->begin() + _part_data_offset, data_stream->end());
+    _part_data_offset = data_stream->size();
+
+    int part_index = (int) _chunked_segment->GetChunkCount();
+
+    AddChunkedSegmentPart(MakePartFileName(_chunked_segment->GetSequenceNumber(), part_index), _chunked_segment, part_index);
+
+    _chunked_segment->AppendChunk(part_data, _part_start_timestamp, last_timestamp - _part_start_timestamp, independent);
+
+    _part_start_timestamp = last_timestamp;
+
+    // 다음 Part 이름 미리 등록(Preload Hint)
+    // - Segment 가 먼저 완료되면 해당 Part 요청은 실패 처리
+    AddChunkedSegmentPart(MakePartFileName(_chunked_segment->GetSequenceNumber(), part_index + 1), _chunked_segment, part_index + 1);
+
+    return true;
+}
+
+//====================================================================================================
+// Chunked Segment Write
+// - 마지막 Part Write 이후 Segment 완료
+// - 다음 Segment 생성
+//====================================================================================================
+bool HlsPacketyzer::ChunkedSegmentWrite(uint64_t last_timestamp)
+{
+    PartWrite(last_timestamp);
+
+    auto start_timestamp = _chunked_segment->GetTimestamp();
+
+    SetSegmentData(SegmentDataType::Ts,
+                   _sequence_number,
+                   _chunked_segment->GetFileName(),
+                   last_timestamp - start_timestamp,
+                   start_timestamp,
+                   _ts_writer->GetDataStream());
+
+    _chunked_segment->Complete();
+
+    _sequence_number++;
+
+    CreateChunkedSegment(last_timestamp);
+
+    UpdatePlayList();
+
+    return true;
+}
+
+//====================================================================================================
+// Part 이름
+// 방송번호_인덱스_Part인덱스.TS
+//====================================================================================================
+std::string HlsPacketyzer::MakePartFileName(uint32_t sequence_number, size_t part_index)
+{
+    std::ostringstream file_name_stream;
+    file_name_stream << _segment_prefix << "_" << sequence_number << "_" << part_index << ".ts";
+
+    return file_name_stream.str();
+}
+
+//====================================================================================================
+// PlayList(M3U8) 업데이트 - Low Latency
+// - 최근 Segment 및 생성 중인 Segment 의 Part(EXT-X-PART)
+// - 다음 Part(EXT-X-PRELOAD-HINT)
+//====================================================================================================
+bool HlsPacketyzer::UpdateChunkedPlayList()
+{
+    std::ostringstream play_list;
+    std::ostringstream m3u8_play_list;
+    double max_duration = 0;
+    double part_target = _chunk_duration / 1000.0;
+    int64_t media_sequence = -1;
+    int64_t chunked_sequence = -1;
+    size_t chunked_part_count = 0;
+
+    auto part_list = [this, &m3u8_play_list](const std::shared_ptr<ChunkedSegment> &segment) -> void {
+        auto chunks = segment->GetChunks();
+
+        for (size_t index = 0; index < chunks.size(); index++)
+        {
+            m3u8_play_list << "#EXT-X-PART:DURATION=" << std::fixed << std::setprecision(3)
+                           << (double) (chunks[index].duration) / (double) (PACKTYZER_DEFAULT_TIMESCALE)
+                           << ",URI=\"" << MakePartFileName(segment->GetSequenceNumber(), index) << "\""
+                           << (chunks[index].independent ? ",INDEPENDENT=YES" : "") << "\r\n";
+        }
+    };
+
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    for (uint32_t key = GetPlayListStartKey(SegmentDataType::Ts); key < _segment_ring.GetNextKey(); key++)
+    {
+        auto segment_data = FindSegmentData(SegmentDataType::Ts, key);
+
+        if (segment_data == nullptr)
+        {
+            continue;
+        }
+
+        const auto &file_name = segment_data->file_name;
+
+        if (media_sequence < 0)
+        {
+            media_sequence = segment_data->sequence_number;
+        }
+
+        // 최근 Segment Part
+        auto chunked_segment = std::find_if(_chunked_segments.begin(), _chunked_segments.end(),
+                                            [&file_name](const std::shared_ptr<ChunkedSegment> &segment) -> bool {
+                                                return segment->GetFileName() == file_name;
+                                            });
+
+        if (chunked_segment != _chunked_segments.end())
+        {
+            part_list(*chunked_segment);
+        }
+
+        m3u8_play_list << "#EXTINF:" << std::fixed << std::setprecision(3)
+                       << (double) (segment_data->duration) / (double) (PACKTYZER_DEFAULT_TIMESCALE) << ",\r\n"
+                       << file_name << "\r\n";
+
+        if (segment_data->duration > max_duration)
+        {
+            max_duration = segment_data->duration;
+        }
+    }
+
+    // 생성 중인 Segment Part + 다음 Part
+    if (_chunked_segment != nullptr)
+    {
+        part_list(_chunked_segment);
+
+        chunked_sequence = _chunked_segment->GetSequenceNumber();
+        chunked_part_count = _chunked_segment->GetChunkCount();
+
+        m3u8_play_list << "#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\""
+                       << MakePartFileName(_chunked_segment->GetSequenceNumber(), _chunked_segment->GetChunkCount())
+                       << "\"\r\n";
+
+        if (media_sequence < 0)
+        {
+            media_sequence = _chunked_segment->GetSequenceNumber();
+        }
+    }
+
+    segment_datas_lock.unlock();
+
+    play_list << "#EXTM3U" << "\r\n"
+              << "#EXT-X-VERSION:6" << "\r\n"
+              << "#EXT-X-TARGETDURATION:" << (int) std::ceil(max_duration / PACKTYZER_DEFAULT_TIMESCALE) << "\r\n"
+              << std::fixed << std::setprecision(3)
+              << "#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=" << part_target * 3 << "\r\n"
+              << "#EXT-X-PART-INF:PART-TARGET=" << part_target << "\r\n"
+              << "#EXT-X-MEDIA-SEQUENCE:" << std::max<int64_t>(media_sequence, 0) << "\r\n"
+              << m3u8_play_list.str();
+
+    // Playlist 설정
+    std::string play_list_data = play_list.str();
+    SetPlayList(play_list_data);
+
+    // Blocking PlayList Reload 대기 해제
+    {
+        std::unique_lock<std::mutex> play_list_lock(_play_list_mutex);
+
+        _play_list_sequence = chunked_sequence;
+        _play_list_part_count = chunked_part_count;
+    }
+
+    _play_list_condition.notify_all();
+
+    return true;
+}
+
+//====================================================================================================
+// Blocking PlayList Reload 대기(_HLS_msn/_HLS_part)
+// - 생성 중인 Segment 이전 Segment 는 PlayList 에 완료 Segment 로 표시
+// - 생성 중인 Segment 는 표시된 Part 까지 포함
+// - 대기 시간 : Target Duration x 3(이후 Timeout)
+//====================================================================================================
+PlayListWaitResult HlsPacketyzer::WaitPlayList(int64_t media_sequence, int64_t part_index)
+{
+    std::unique_lock<std::mutex> play_list_lock(_play_list_mutex);
+
+    // 마지막 완료 Segment + 2 이후 요청은 잘못된 요청
+    if (_play_list_sequence >= 0 && media_sequence > _play_list_sequence + 1)
+    {
+        return PlayListWaitResult::InvalidRequest;
+    }
+
+    bool result = _play_list_condition.wait_for(play_list_lock,
+                                                std::chrono::milliseconds(_segment_duration * 3 * 1000),
+                                                [this, media_sequence, part_index]() -> bool {
+        if (_play_list_sequence < 0)
+        {
+            return false;
+        }
+
+        if (media_sequence < _play_list_sequence)
+        {
+            return true;
+        }
+
+        return media_sequence == _play_list_sequence && part_index >= 0 &&
+               static_cast<size_t>(part_index) < _play_list_part_count;
+    });
+
+    return result ? PlayListWaitResult::Ready : PlayListWaitResult::Timeout;
+}
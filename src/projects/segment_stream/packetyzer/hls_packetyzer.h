@@ -13,6 +13,7 @@
 //====================================================================================================
 // HlsPacketyzer
 // TS : [Prefix]_[Index].TS
+// Partial Segment(Low Latency) : [Prefix]_[Index]_[Part Index].TS
 // M3U8 : playlist.M3U8
 //====================================================================================================
 class HlsPacketyzer : public Packetyzer
@@ -22,7 +23,9 @@ public:
 					PacketyzerStreamType 	stream_type,
 					uint32_t 				segment_count,
 					uint32_t				segment_duration,
-					PacketyzerMediaInfo		&media_info);
+					PacketyzerMediaInfo		&media_info,
+					uint32_t				chunk_duration = 0,
+					const std::shared_ptr<SegmentArena> &segment_arena = nullptr);
 	~HlsPacketyzer() = default;
 	
 public :
@@ -30,10 +33,33 @@ public :
 	bool AppendAudioFrame(std::shared_ptr<PacketyzerFrameData>  &frame_data);
 	bool SegmentWrite(uint64_t start_timestamp, uint64_t duration);
 
+	// Blocking PlayList Reload(Low Latency)
+	// - PlayList 에 media_sequence Segment(part_index >= 0 : 해당 Part) 가 포함될 때 까지 대기
+	PlayListWaitResult WaitPlayList(int64_t media_sequence, int64_t part_index);
+
 protected : 	
 	bool UpdatePlayList();
+
+	// Low Latency
+	bool CreateChunkedSegment(uint64_t start_timestamp);
+	bool ChunkedSegmentWrite(uint64_t last_timestamp);
+	bool PartWrite(uint64_t last_timestamp);
+	bool UpdateChunkedPlayList();
+	std::string MakePartFileName(uint32_t sequence_number, size_t part_index);
 	
 protected :
-	std::vector<std::shared_ptr<PacketyzerFrameData>> _frame_datas;
+	std::vector<std::shared_ptr<PacketyzerFrameData>> _frame_datas; // Low Latency : 현재 Part 의 Frame
+
+	// Low Latency(생성 중인 Segment)
+	std::shared_ptr<ChunkedSegment> _chunked_segment;
+	std::unique_ptr<TsWriter> _ts_writer;
+	size_t _part_data_offset = 0;
+	uint64_t _part_start_timestamp = 0;
+
+	// Low Latency(PlayList 에 표시된 생성 중인 Segment)
+	std::mutex _play_list_mutex;
+	std::condition_variable _play_list_condition;
+	int64_t _play_list_sequence = -1;
+	size_t _play_list_part_count = 0;
 };
 
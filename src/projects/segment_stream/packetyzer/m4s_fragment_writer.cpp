@@ -31,6 +31,7 @@ M4sFragmentWriter::M4sFragmentWriter(	M4sMediaType	media_type,
 										M4sWriter(media_type, data_init_size)
 {
 	_sequence_number    = sequence_number;
+	_data_offset_position = 0;
 	_track_id			= track_id;
 	_start_timestamp	= start_timestamp; 
 	_sample_datas	    = sample_datas;
@@ -46,30 +47,35 @@ M4sFragmentWriter::~M4sFragmentWriter( )
 
 //====================================================================================================
 //  CreateData
+//  - moof/mdat 을 하나의 버퍼에 순서대로 기록(box size back-patching)
+//  - sample 데이터는 mdat 에 한번만 복사
+//    header + sample 목록(scatter-gather)으로 넘기지 않는 이유
+//    - fragment 는 LL-DASH chunk 누적, SegmentArena/SegmentSpill 보관, Range 응답에서
+//      연속된 하나의 버퍼로 사용됨(어차피 한번은 모아야 함)
+//    - sample 은 MediaPacket 버퍼를 참조하므로, 목록으로 보관하면 segment 보관 기간 동안
+//      frame 버퍼(start code/SPS/PPS 포함)가 해제되지 않음
 //====================================================================================================
 int M4sFragmentWriter::CreateData()
 {
-	int moof_size = 0;
-	int mdata_size = 0;
+	size_t moof_position = _data_stream->size();
+	size_t data_size = 0;
 
-	moof_size += MoofBoxWrite(_data_stream);
-
-	//trun data offset 값 변경
-	uint32_t data_offset = _data_stream->size() + 8;
-	uint32_t position = 0;
+	for (auto &sample_data : _sample_datas)
+	{
+		data_size += sample_data->GetDataSize() + 4;
+	}
 
-	if (_media_type == M4sMediaType::VideoMediaType)		position = _data_stream->size() - _sample_datas.size() * 16 - 4;
-	else if (_media_type == M4sMediaType::AudioMediaType)	position = _data_stream->size() - _sample_datas.size() * 8 - 4;
+	// moof(box header + sample 당 최대 16byte) + mdat 크기 예약
+	_data_stream->reserve(_data_stream->size() + 128 + _sample_datas.size() * 16 + MP4_BOX_HEADER_SIZE + data_size);
 
+	MoofBoxWrite(_data_stream);
 
-	(*_data_stream)[position] = ((uint8_t)(data_offset >> 24 & 0xFF));
-	(*_data_stream)[position + 1] = ((uint8_t)(data_offset >> 16 & 0xFF));
-	(*_data_stream)[position + 2] = ((uint8_t)(data_offset >> 8 & 0xFF));
-	(*_data_stream)[position + 3] = ((uint8_t)(data_offset & 0xFF));
+	// trun data offset 값 변경(default-base-is-moof : moof 시작 기준 mdat 데이터 위치)
+	PatchUint32((uint32_t)(_data_stream->size() - moof_position + MP4_BOX_HEADER_SIZE), _data_offset_position, _data_stream);
 
-	mdata_size += MdatBoxWrite(_data_stream);
+	MdatBoxWrite(_data_stream);
 
-	return moof_size + mdata_size;
+	return (int)(_data_stream->size() - moof_position);
 }
 
 //====================================================================================================
@@ -77,12 +83,12 @@ int M4sFragmentWriter::CreateData()
 //====================================================================================================
 int M4sFragmentWriter::MoofBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+	size_t box_position = BoxBegin("moof", data_stream);
 
-	MfhdBoxWrite(data);
-	TrafBoxWrite(data);
+	MfhdBoxWrite(data_stream);
+	TrafBoxWrite(data_stream);
 	
-	return BoxDataWrite("moof", data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -90,11 +96,11 @@ int M4sFragmentWriter::MoofBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 //====================================================================================================
 int M4sFragmentWriter::MfhdBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+	size_t box_position = BoxBegin("mfhd", 0, 0, data_stream);
 
-	WriteUint32(_sequence_number, data);	// Sequence Number
+	WriteUint32(_sequence_number, data_stream);	// Sequence Number
 
-	return BoxDataWrite("mfhd", 0, 0, data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -102,13 +108,13 @@ int M4sFragmentWriter::MfhdBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 //====================================================================================================
 int M4sFragmentWriter::TrafBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+	size_t box_position = BoxBegin("traf", data_stream);
 
-	TfhdBoxWrite(data);
-	TfdtBoxWrite(data);
-	TrunBoxWrite(data);
+	TfhdBoxWrite(data_stream);
+	TfdtBoxWrite(data_stream);
+	TrunBoxWrite(data_stream);
 
-	return BoxDataWrite("traf", data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -123,12 +129,12 @@ int M4sFragmentWriter::TrafBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 #define TFHD_FLAG_DEFAULT_BASE_IS_MOOF              (0x20000)
 int M4sFragmentWriter::TfhdBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
 	uint32_t flag = TFHD_FLAG_DEFAULT_BASE_IS_MOOF;
+	size_t box_position = BoxBegin("tfhd", 0, flag, data_stream);
 
-	WriteUint32(_track_id, data);	// track id
+	WriteUint32(_track_id, data_stream);	// track id
 
-	return BoxDataWrite("tfhd", 0, flag, data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -136,11 +142,11 @@ int M4sFragmentWriter::TfhdBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 //====================================================================================================
 int M4sFragmentWriter::TfdtBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+	size_t box_position = BoxBegin("tfdt", 1, 0, data_stream);
 	
-	WriteUint64(_start_timestamp, data);    // Base media decode time
+	WriteUint64(_start_timestamp, data_stream);    // Base media decode time
 
-	return BoxDataWrite("tfdt", 1, 0, data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -154,9 +160,7 @@ int M4sFragmentWriter::TfdtBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 #define TRUN_FLAG_SAMPLE_COMPOSITION_TIME_OFFSET_PRESENT (0x0800)
 int M4sFragmentWriter::TrunBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>>	data				= std::make_shared<std::vector<uint8_t>>();
-	uint32_t								flag				= 0;
-	uint32_t								first_sample_flag	= 0;
+	uint32_t flag = 0;
 
 	if (M4sMediaType::VideoMediaType == _media_type)
 	{
@@ -167,26 +171,30 @@ int M4sFragmentWriter::TrunBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 		flag = TRUN_FLAG_DATA_OFFSET_PRESENT | TRUN_FLAG_SAMPLE_DURATION_PRESENT | TRUN_FLAG_SAMPLE_SIZE_PRESENT;
 	}
 
-	WriteUint32(_sample_datas.size(), data);	// Sample Item Count;
-	WriteUint32(0x11111111, data);	            // Data offset - temp 0 setting
+	size_t box_position = BoxBegin("trun", 0, flag, data_stream);
+
+	WriteUint32(_sample_datas.size(), data_stream);	// Sample Item Count;
+
+	_data_offset_position = data_stream->size();
+	WriteUint32(0, data_stream);	                // Data offset - mdat 위치 확인 이후 기록
 
 	for (auto &sample_data : _sample_datas)
 	{
-		WriteUint32(sample_data->duration, data);					// duration
+		WriteUint32(sample_data->duration, data_stream);					// duration
 
 		if (_media_type == M4sMediaType::VideoMediaType)
 		{
-			WriteUint32(sample_data->data->size() + 4, data);			// size + sample
-			WriteUint32(sample_data->flag, data);;						// flag
-			WriteUint32(sample_data->composition_time_offset, data);	// compoistion timeoffset 
+			WriteUint32(sample_data->GetDataSize() + 4, data_stream);		// size + sample
+			WriteUint32(sample_data->flag, data_stream);					// flag
+			WriteUint32(sample_data->composition_time_offset, data_stream);	// compoistion timeoffset 
 		}
 		else if (_media_type == M4sMediaType::AudioMediaType)
 		{
-			WriteUint32(sample_data->data->size(), data);				// sample
+			WriteUint32(sample_data->GetDataSize(), data_stream);			// sample
 		}
 	}
 
-	return BoxDataWrite("trun", 0, flag, data, data_stream);
+	return BoxEnd(box_position, data_stream);
 }
 
 //====================================================================================================
@@ -194,16 +202,17 @@ int M4sFragmentWriter::TrunBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_
 //====================================================================================================
 int M4sFragmentWriter::MdatBoxWrite(std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+	size_t box_position = BoxBegin("mdat", data_stream);
 
 	for (auto &sample_data : _sample_datas)
 	{
 		if (_media_type == M4sMediaType::VideoMediaType)
 		{
-			WriteUint32(sample_data->data->size(), data);	// size
+			WriteUint32(sample_data->GetDataSize(), data_stream);	// size
 		}
 
-		WriteData(*(sample_data->data), data);
+		WriteData(sample_data->GetData(), sample_data->GetDataSize(), data_stream);
 	}
-	return BoxDataWrite("mdat", data, data_stream);
-}
\ No newline at end of file
+
+	return BoxEnd(box_position, data_stream);
+}
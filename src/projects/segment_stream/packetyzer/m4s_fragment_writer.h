@@ -14,23 +14,36 @@
 
 //====================================================================================================
 // Fragment Sample Data
+// - data 참조(복사 없음), data_offset 이후가 sample 데이터(ex) start code/ADTS header 제외)
 //====================================================================================================
 struct FragmentSampleData
 {
 public:
-	FragmentSampleData(uint32_t duration_, uint32_t flag_, uint32_t composition_time_offset_, std::shared_ptr<std::vector<uint8_t>> &data_)
+	FragmentSampleData(uint32_t duration_, uint32_t flag_, uint32_t composition_time_offset_, const std::shared_ptr<const ov::Data> &data_, size_t data_offset_ = 0)
 	{
 		duration                =  duration_;
 		flag                    = flag_;
 		composition_time_offset = composition_time_offset_;
 		data		            = data_;
+		data_offset             = data_offset_;
+	}
+
+	const uint8_t *GetData() const
+	{
+		return data->GetDataAs<uint8_t>() + data_offset;
+	}
+
+	uint32_t GetDataSize() const
+	{
+		return (uint32_t)(data->GetLength() - data_offset);
 	}
 
 public:
 	uint32_t duration;
 	uint32_t flag;
 	uint32_t composition_time_offset;
-	std::shared_ptr<std::vector<uint8_t>> 	data;
+	std::shared_ptr<const ov::Data> 	data;
+	size_t data_offset;
 };
 
 //====================================================================================================
@@ -65,6 +78,7 @@ protected :
    
 private :
 	uint32_t _sequence_number;
+	size_t _data_offset_position;   // trun data offset 위치(mdat 기록 이후 back-patching)
 	uint32_t _track_id;
 	uint64_t _start_timestamp;
 	std::vector<std::shared_ptr<FragmentSampleData>> _sample_datas;
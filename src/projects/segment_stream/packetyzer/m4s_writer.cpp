@@ -8,9 +8,8 @@
 //==============================================================================
 
 #include "m4s_writer.h"
-
-#define MP4_BOX_HEADER_SIZE  (8)        // size(4) + type(4)
-#define MP4_BOX_EXT_HEADER_SIZE (12)    // size(4) + type(4) + version(1) + flag(3)
+#include <string.h>
+#include <base/ovlibrary/byte_ordering.h>
 
 //====================================================================================================
 // Constructor
@@ -54,10 +53,7 @@ bool M4sWriter::WriteData(const uint8_t *data, int data_size, std::shared_ptr<st
 //====================================================================================================
 bool M4sWriter::WriteInit(uint8_t value, int init_size, std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	for (int index = 0; index < init_size; index++)
-	{
-		data_stream->push_back(value);
-	}
+	data_stream->insert(data_stream->end(), init_size, value);
 
 	return true;
 }
@@ -67,14 +63,10 @@ bool M4sWriter::WriteInit(uint8_t value, int init_size, std::shared_ptr<std::vec
 //====================================================================================================
 bool M4sWriter::WriteUint64(uint64_t value, std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	data_stream->push_back((uint8_t)(value >> 56 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 48 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 40 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 32 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 24 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 16 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 8 & 0xFF));
-	data_stream->push_back((uint8_t)(value & 0xFF));
+	uint64_t be_value = ov::HostToBE64(value);
+	auto bytes = reinterpret_cast<const uint8_t *>(&be_value);
+
+	data_stream->insert(data_stream->end(), bytes, bytes + sizeof(be_value));
 
 	return true;
 }
@@ -84,10 +76,10 @@ bool M4sWriter::WriteUint64(uint64_t value, std::shared_ptr<std::vector<uint8_t>
 //====================================================================================================
 bool M4sWriter::WriteUint32(uint32_t value, std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	data_stream->push_back((uint8_t)(value >> 24 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 16 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 8 & 0xFF));
-	data_stream->push_back((uint8_t)(value & 0xFF));
+	uint32_t be_value = ov::HostToBE32(value);
+	auto bytes = reinterpret_cast<const uint8_t *>(&be_value);
+
+	data_stream->insert(data_stream->end(), bytes, bytes + sizeof(be_value));
 
 	return true;
 }
@@ -97,9 +89,11 @@ bool M4sWriter::WriteUint32(uint32_t value, std::shared_ptr<std::vector<uint8_t>
 //====================================================================================================
 bool M4sWriter::WriteUint24(uint32_t value, std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	data_stream->push_back((uint8_t)(value >> 16 & 0xFF));
-	data_stream->push_back((uint8_t)(value >> 8 & 0xFF));
-	data_stream->push_back((uint8_t)(value & 0xFF));
+	// 하위 3byte
+	uint32_t be_value = ov::HostToBE32(value);
+	auto bytes = reinterpret_cast<const uint8_t *>(&be_value);
+
+	data_stream->insert(data_stream->end(), bytes + 1, bytes + sizeof(be_value));
 	return true;
 }
 
@@ -108,8 +102,10 @@ bool M4sWriter::WriteUint24(uint32_t value, std::shared_ptr<std::vector<uint8_t>
 //====================================================================================================
 bool M4sWriter::WriteUint16(uint16_t value, std::shared_ptr<std::vector<uint8_t>> &data_stream)
 {
-	data_stream->push_back((uint8_t)(value >> 8 & 0xFF));
-	data_stream->push_back((uint8_t)(value & 0xFF));
+	uint16_t be_value = ov::HostToBE16(value);
+	auto bytes = reinterpret_cast<const uint8_t *>(&be_value);
+
+	data_stream->insert(data_stream->end(), bytes, bytes + sizeof(be_value));
 	return true;
 }
 
@@ -161,3 +157,53 @@ int M4sWriter::BoxDataWrite(std::string type, uint8_t version, uint32_t flags, s
 
 	return data_stream->size();
 }
+
+//====================================================================================================
+// Box 시작(Single-pass)
+// - size 는 BoxEnd() 에서 기록
+//====================================================================================================
+size_t M4sWriter::BoxBegin(const char *type, std::shared_ptr<std::vector<uint8_t>> &data_stream)
+{
+	size_t box_position = data_stream->size();
+
+	WriteUint32(0, data_stream);                                        // box size(BoxEnd 에서 기록)
+	data_stream->insert(data_stream->end(), type, type + 4);    // type write
+
+	return box_position;
+}
+
+//====================================================================================================
+// Box 시작(Single-pass, Full Box)
+//====================================================================================================
+size_t M4sWriter::BoxBegin(const char *type, uint8_t version, uint32_t flags, std::shared_ptr<std::vector<uint8_t>> &data_stream)
+{
+	size_t box_position = BoxBegin(type, data_stream);
+
+	// version(8bit) + flags(24bit)
+	WriteUint32(((uint32_t)version << 24) | (flags & 0x00FFFFFF), data_stream);
+
+	return box_position;
+}
+
+//====================================================================================================
+// Box 종료(Single-pass)
+// - box size back-patching
+//====================================================================================================
+uint32_t M4sWriter::BoxEnd(size_t box_position, std::shared_ptr<std::vector<uint8_t>> &data_stream)
+{
+	auto box_size = (uint32_t)(data_stream->size() - box_position);
+
+	PatchUint32(box_size, box_position, data_stream);
+
+	return box_size;
+}
+
+//====================================================================================================
+// 기록된 위치에 uint32_t 재기록
+//====================================================================================================
+void M4sWriter::PatchUint32(uint32_t value, size_t position, std::shared_ptr<std::vector<uint8_t>> &data_stream)
+{
+	uint32_t be_value = ov::HostToBE32(value);
+
+	::memcpy(data_stream->data() + position, &be_value, sizeof(be_value));
+}
@@ -14,6 +14,9 @@
 #include <string>
 #include <memory>
 
+#define MP4_BOX_HEADER_SIZE  (8)        // size(4) + type(4)
+#define MP4_BOX_EXT_HEADER_SIZE (12)    // size(4) + type(4) + version(1) + flag(3)
+
 enum class M4sMediaType
 {
 	VideoMediaType, 
@@ -47,6 +50,16 @@ protected :
 	int BoxDataWrite(std::string type, std::shared_ptr<std::vector<uint8_t>> &data, std::shared_ptr<std::vector<uint8_t>> &data_stream);
 	int BoxDataWrite(std::string type, uint8_t version, uint32_t flags, std::shared_ptr<std::vector<uint8_t>> &data, std::shared_ptr<std::vector<uint8_t>> &data_stream);
 
+	// Single-pass box write
+	// - BoxBegin : size 필드(4byte) 예약 + type(+ version/flags) 기록, return : box 시작 위치
+	// - BoxEnd : box 종료 시점에 size 필드 기록(back-patching), return : box size
+	// - 하위 box 를 별도 vector 에 만들지 않고 data_stream 에 바로 기록
+	size_t BoxBegin(const char *type, std::shared_ptr<std::vector<uint8_t>> &data_stream);
+	size_t BoxBegin(const char *type, uint8_t version, uint32_t flags, std::shared_ptr<std::vector<uint8_t>> &data_stream);
+	uint32_t BoxEnd(size_t box_position, std::shared_ptr<std::vector<uint8_t>> &data_stream);
+
+	static void PatchUint32(uint32_t value, size_t position, std::shared_ptr<std::vector<uint8_t>> &data_stream);
+
 protected :
 	M4sMediaType							_media_type;
 	std::shared_ptr<std::vector<uint8_t>>	_data_stream;
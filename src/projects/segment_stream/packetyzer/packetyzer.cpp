@@ -11,6 +11,7 @@
 #include <sstream>
 #include <algorithm>
 #include <sys/time.h>
+#include <cstdlib>
 
 //====================================================================================================
 // Constructor
@@ -20,10 +21,13 @@ Packetyzer::Packetyzer(PacketyzerType packetyzer_type,
                        PacketyzerStreamType stream_type,
                        uint32_t segment_count,
                        uint32_t segment_duration,
-                       PacketyzerMediaInfo &media_info)
+                       PacketyzerMediaInfo &media_info,
+                       uint32_t chunk_duration,
+                       const std::shared_ptr<SegmentArena> &segment_arena)
 {
     _packetyzer_type = packetyzer_type;
     _segment_prefix = segment_prefix;
+    _create_milliseconds = (uint64_t) GetCurrentMilliseconds();
     _stream_type = stream_type;
     _segment_count = segment_count;
     _segment_save_count = segment_count * 3;
@@ -40,13 +44,15 @@ Packetyzer::Packetyzer(PacketyzerType packetyzer_type,
 
     _init_segment_count_complete = false;
 
+    _chunk_duration = chunk_duration;
+
     if (_stream_type == PacketyzerStreamType::VideoOnly)_audio_init = true;
     if (_stream_type == PacketyzerStreamType::AudioOnly)_video_init = true;
 
-    _segment_datas.clear();
-    _segment_indexer.clear();
-    _video_segment_indexer.clear();
-    _audio_segment_indexer.clear();
+    _segment_arena = segment_arena;
+    _segment_ring.SetCapacity(_segment_save_count);
+    _video_segment_ring.SetCapacity(_segment_save_count);
+    _audio_segment_ring.SetCapacity(_segment_save_count);
 }
 
 //====================================================================================================
@@ -54,11 +60,139 @@ Packetyzer::Packetyzer(PacketyzerType packetyzer_type,
 //====================================================================================================
 Packetyzer::~Packetyzer()
 {
-    _segment_datas.clear();
-    _segment_indexer.clear();
-    _video_segment_indexer.clear();
-    _audio_segment_indexer.clear();
+    // Arena 삭제 요청 중지
+    if (_segment_arena != nullptr)
+    {
+        _segment_arena->Unregister(this);
+    }
+
+    // Chunk 대기 중인 요청 해제
+    for (auto &segment : _chunked_segments)
+    {
+        segment->Complete();
+    }
+
+    _chunked_segments.clear();
+    _chunked_segment_names.clear();
+    _segment_ring.Clear();
+    _video_segment_ring.Clear();
+    _audio_segment_ring.Clear();
+    _dvr_segment_ring.Clear();
+    _dvr_video_segment_ring.Clear();
+    _dvr_audio_segment_ring.Clear();
+}
+
+//====================================================================================================
+// SegmentRing 크기 설정
+//====================================================================================================
+void SegmentRing::SetCapacity(size_t capacity)
+{
+    _items.assign(std::max(capacity, (size_t) 1), nullptr);
+    _keys.assign(_items.size(), 0);
+}
+
+//====================================================================================================
+// SegmentRing 저장
+// - 저장 위치(key % capacity)의 이전 Segment 및 건너뛴 key(저장 실패) 위치의 Segment 제거
+//====================================================================================================
+void SegmentRing::Push(uint32_t key,
+                       const std::shared_ptr<SegmentData> &segment_data,
+                       std::vector<std::shared_ptr<SegmentData>> &removed_items)
+{
+    if (key < _next_key)
+    {
+        return;
+    }
+
+    size_t capacity = _items.size();
+    uint32_t clear_key = std::max(_next_key, (key >= capacity) ? (uint32_t) (key - capacity + 1) : 0U);
+
+    for (; clear_key <= key; clear_key++)
+    {
+        auto &item = _items[clear_key % capacity];
+
+        if (item != nullptr)
+        {
+            RemoveTimestamp(item, _keys[clear_key % capacity]);
+            removed_items.push_back(std::move(item));
+            item = nullptr;
+        }
+    }
+
+    _items[key % capacity] = segment_data;
+    _keys[key % capacity] = key;
+    _next_key = key + 1;
+
+    if (segment_data != nullptr)
+    {
+        _timestamp_keys[segment_data->timestamp] = key;
+    }
+}
+
+//====================================================================================================
+// SegmentRing 검색
+//====================================================================================================
+std::shared_ptr<SegmentData> SegmentRing::Find(uint32_t key) const
+{
+    size_t capacity = _items.size();
+
+    if (key >= _next_key || (size_t) (_next_key - key) > capacity || _keys[key % capacity] != key)
+    {
+        return nullptr;
+    }
+
+    return _items[key % capacity];
+}
+
+//====================================================================================================
+// SegmentRing 검색(M4S : 파일 이름이 timestamp 기준, timestamp -> key Index 사용)
+//====================================================================================================
+std::shared_ptr<SegmentData> SegmentRing::FindByTimestamp(uint64_t timestamp) const
+{
+    auto item = _timestamp_keys.find(timestamp);
+
+    if (item == _timestamp_keys.end())
+    {
+        return nullptr;
+    }
+
+    return Find(item->second);
+}
+
+//====================================================================================================
+// SegmentRing 삭제
+//====================================================================================================
+std::shared_ptr<SegmentData> SegmentRing::Remove(uint32_t key)
+{
+    auto item = Find(key);
+
+    if (item != nullptr)
+    {
+        RemoveTimestamp(item, key);
+        _items[key % _items.size()] = nullptr;
+    }
+
+    return item;
+}
+
+void SegmentRing::Clear()
+{
+    std::fill(_items.begin(), _items.end(), nullptr);
+    _timestamp_keys.clear();
+}
+
+//====================================================================================================
+// SegmentRing timestamp Index 삭제
+// - 같은 timestamp 로 이후 저장된 Segment 의 Index 는 유지
+//====================================================================================================
+void SegmentRing::RemoveTimestamp(const std::shared_ptr<SegmentData> &item, uint32_t key)
+{
+    auto timestamp_key = _timestamp_keys.find(item->timestamp);
 
+    if (timestamp_key != _timestamp_keys.end() && timestamp_key->second == key)
+    {
+        _timestamp_keys.erase(timestamp_key);
+    }
 }
 
 //====================================================================================================
@@ -95,6 +229,17 @@ bool Packetyzer::SetPlayList(std::string &play_list)
     return true;
 }
 
+//====================================================================================================
+// Writer 데이터 공유(복사하지 않음)
+// - Arena 를 사용하지 않는 Segment 및 init.m4s
+//====================================================================================================
+static std::shared_ptr<const ov::Data> ShareWriterData(const std::shared_ptr<std::vector<uint8_t>> &data)
+{
+    return std::shared_ptr<const ov::Data>(new ov::Data(data->data(), data->size(), true), [data](const ov::Data *item) {
+        delete item;
+    });
+}
+
 //====================================================================================================
 // Segment
 //====================================================================================================
@@ -105,59 +250,80 @@ bool Packetyzer::SetSegmentData(SegmentDataType data_type,
                                 uint64_t timestamp,
                                 std::shared_ptr<std::vector<uint8_t>> &data)
 {
-    auto segment_data = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, data);
-
     if(file_name == MPD_VIDEO_INIT_FILE_NAME)
     {
-        _mpd_video_init_file = segment_data;
+        _mpd_video_init_file = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, ShareWriterData(data));
         return true;
     }
     else if(file_name == MPD_AUDIO_INIT_FILE_NAME)
     {
-        _mpd_audio_init_file = segment_data;
+        _mpd_audio_init_file = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, ShareWriterData(data));
         return true;
     }
 
+    auto segment_ring = GetSegmentRing(data_type);
 
-    // Segment 저장
-    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+    // Index key(TS : sequence number, M4S : Video/Audio 별 저장 순서)
+    // - Producer(현재 Thread)만 변경하므로 Lock 없이 확인
+    uint32_t key = (data_type == SegmentDataType::Ts) ? sequence_number : segment_ring->GetNextKey();
 
-    _segment_datas[file_name] = segment_data;
+    // Arena 저장(예산 초과시 오래된 Segment 삭제 요청 - Lock 이전에 처리)
+    // - 저장 실패시 빈 Index 로 남김(PlayList 에서 제외)
+    std::shared_ptr<SegmentData> segment_data = nullptr;
 
-    // 특정 개수 이상 메모리/파일 삭제 처리를 위한 indexer
-    // - indexer 등록되지 않은 segment 데이터 유지(ex) init.m4s)
-    std::deque<std::string> *indexer = nullptr;
+    if (_segment_arena != nullptr)
+    {
+        auto arena_data = _segment_arena->Store(this, (uint32_t) data_type, key, data->data(), data->size());
 
-    if (data_type == SegmentDataType::Ts) indexer = &_segment_indexer;
-    else if (data_type == SegmentDataType::Mp4Video) indexer = &_video_segment_indexer;
-    else if (data_type == SegmentDataType::Mp4Audio) indexer = &_audio_segment_indexer;
-    else indexer = &_segment_indexer;
+        if (arena_data != nullptr)
+        {
+            segment_data = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, arena_data);
+        }
+    }
+    else
+    {
+        segment_data = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, ShareWriterData(data));
+    }
 
-    indexer->push_back(file_name);
+    // DVR 파일 기록(메모리 보관 Segment 도 함께 기록, 메모리에서 삭제된 이후 파일에서 응답)
+    std::shared_ptr<SegmentData> dvr_segment_data = nullptr;
 
-    // 데이터 삭제(데이터 전송 요청을 받기 위해 특정 개수 이상 유지)
-    while (indexer->size() > _segment_save_count)
+    if (_segment_spill != nullptr)
     {
-        auto segment_data_item = _segment_datas.find(indexer->front());
+        auto spill_data = _segment_spill->Store(data->data(), data->size());
 
-        // segment data delete
-        if (segment_data_item != _segment_datas.end())
+        if (spill_data != nullptr)
         {
-            _segment_datas.erase(segment_data_item);
+            dvr_segment_data = std::make_shared<SegmentData>(sequence_number, file_name, duration, timestamp, spill_data);
         }
+    }
 
-        // file delete
-        if (_save_file)
-        {
-            remove(indexer->front().c_str());
-        }
+    // Segment 저장(데이터 전송 요청을 받기 위해 특정 개수 유지)
+    std::vector<std::shared_ptr<SegmentData>> removed_segments;
+
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    segment_ring->Push(key, segment_data, removed_segments);
 
-        // segment data indexer delete
-        indexer->pop_front();
+    if (_segment_spill != nullptr)
+    {
+        GetDvrSegmentRing(data_type)->Push(key, dvr_segment_data, removed_segments);
     }
 
     segment_datas_lock.unlock();
 
+    // file delete
+    if (_save_file)
+    {
+        for (const auto &removed_segment : removed_segments)
+        {
+            remove(removed_segment->file_name.c_str());
+        }
+    }
+
+    // 제거된 Segment 정리(Arena Slab 반환 - Lock 해제 이후)
+    removed_segments.clear();
+
     if (_save_file)
     {
         FILE *file = file = fopen(file_name.c_str(), "wb");
@@ -185,19 +351,28 @@ bool Packetyzer::SetSegmentData(SegmentDataType data_type,
 //====================================================================================================
 // PlayList
 //====================================================================================================
-bool Packetyzer::GetPlayList(std::string &play_list)
+bool Packetyzer::GetPlayList(std::string &play_list, SegmentCacheInfo *cache_info)
 {
     if(!_init_segment_count_complete)
         return false;
 
     play_list = _play_list;
+
+    // Segment 생성 주기 보다 짧게 캐시(Low Latency : Chunk 마다 갱신되므로 캐시 안함)
+    if (cache_info != nullptr)
+    {
+        cache_info->max_age = IsLowLatency() ? 0 : std::max((int) (_segment_duration / 2), 1);
+    }
+
     return true;
 }
 
 //====================================================================================================
 // Segment
 //====================================================================================================
-bool Packetyzer::GetSegmentData(std::string &file_name, std::shared_ptr<std::vector<uint8_t>> &data)
+bool Packetyzer::GetSegmentData(const std::string &file_name,
+                                std::shared_ptr<const ov::Data> &data,
+                                SegmentCacheInfo *cache_info)
 {
 	if(!_init_segment_count_complete)
         return false;
@@ -205,24 +380,266 @@ bool Packetyzer::GetSegmentData(std::string &file_name, std::shared_ptr<std::vec
     if(file_name == MPD_VIDEO_INIT_FILE_NAME && _mpd_video_init_file != nullptr)
     {
         data =_mpd_video_init_file->data;
+
+        if (cache_info != nullptr)
+            MakeSegmentCacheInfo(_mpd_video_init_file, 'V', *cache_info);
+
         return true;
     }
     else if(file_name == MPD_AUDIO_INIT_FILE_NAME && _mpd_audio_init_file != nullptr)
     {
         data =_mpd_audio_init_file->data;
+
+        if (cache_info != nullptr)
+            MakeSegmentCacheInfo(_mpd_audio_init_file, 'A', *cache_info);
+
         return true;
     }
 
+    // 파일 이름 -> Index key
+    // - TS : {prefix}_{sequence number}.ts
+    // - M4S : {prefix}_{timestamp}_video.m4s, {prefix}_{timestamp}_audio.m4s
+    if (file_name.size() <= _segment_prefix.size() + 1 ||
+        file_name.compare(0, _segment_prefix.size(), _segment_prefix) != 0 ||
+        file_name[_segment_prefix.size()] != '_')
+    {
+        return false;
+    }
+
+    const char *number_start = file_name.c_str() + _segment_prefix.size() + 1;
+    char *number_end = nullptr;
+
+    if (*number_start < '0' || *number_start > '9')
+    {
+        return false;
+    }
+
+    uint64_t number = ::strtoull(number_start, &number_end, 10);
+    std::string suffix = number_end;
+
+    std::shared_ptr<SegmentData> segment_data = nullptr;
+    char type_code = 't';
+
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    if (suffix == ".ts")
+    {
+        segment_data = FindSegmentData(SegmentDataType::Ts, (uint32_t) number);
+    }
+    else if (suffix == "_video.m4s")
+    {
+        type_code = 'v';
+        segment_data = _video_segment_ring.FindByTimestamp(number);
+
+        if (segment_data == nullptr && _segment_spill != nullptr)
+            segment_data = _dvr_video_segment_ring.FindByTimestamp(number);
+    }
+    else if (suffix == "_audio.m4s")
+    {
+        type_code = 'a';
+        segment_data = _audio_segment_ring.FindByTimestamp(number);
+
+        if (segment_data == nullptr && _segment_spill != nullptr)
+            segment_data = _dvr_audio_segment_ring.FindByTimestamp(number);
+    }
+
+    if (segment_data == nullptr || segment_data->file_name != file_name)
+    {
+        return false;
+    }
+
+    data = segment_data->data;
+
+    if (cache_info != nullptr)
+        MakeSegmentCacheInfo(segment_data, type_code, *cache_info);
+
+    return true;
+}
+
+//====================================================================================================
+// Segment 응답 캐시 정보
+// - 초기화 Segment(type_code : 'V'/'A') 는 스트림 동안 유지되므로 PlayList 전체 시간
+//====================================================================================================
+void Packetyzer::MakeSegmentCacheInfo(const std::shared_ptr<SegmentData> &segment_data,
+                                      char type_code,
+                                      SegmentCacheInfo &cache_info)
+{
+    int list_count = (_segment_spill != nullptr) ? _dvr_segment_count : _segment_count;
+    auto list_duration = (int64_t) (list_count * _segment_duration);
+    auto elapsed = (int64_t) (time(nullptr) - segment_data->create_time);
+
+    cache_info.etag = ov::String::FormatString("\"%llx-%c%d\"", (unsigned long long) _create_milliseconds,
+                                               type_code, segment_data->sequence_number).CStr();
+    cache_info.last_modified = segment_data->create_time;
+
+    if (type_code == 'V' || type_code == 'A')
+        cache_info.max_age = (int) list_duration;
+    else
+        cache_info.max_age = (int) std::max(list_duration - elapsed, (int64_t) 0);
+}
+
+//====================================================================================================
+// Arena 메모리 부족시 Segment 삭제
+// - SegmentArenaOwner Implementation
+//====================================================================================================
+std::shared_ptr<const ov::Data> Packetyzer::EvictSegmentData(uint32_t data_type, uint32_t key)
+{
     std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
 
-    auto segment_data_item = _segment_datas.find(file_name);
+    auto segment_data = GetSegmentRing((SegmentDataType) data_type)->Remove(key);
+
+    return (segment_data != nullptr) ? segment_data->data : nullptr;
+}
+
+//====================================================================================================
+// SegmentDataType 별 Index
+//====================================================================================================
+SegmentRing *Packetyzer::GetSegmentRing(SegmentDataType data_type)
+{
+    if (data_type == SegmentDataType::Mp4Video)
+        return &_video_segment_ring;
+    else if (data_type == SegmentDataType::Mp4Audio)
+        return &_audio_segment_ring;
+
+    return &_segment_ring;
+}
+
+SegmentRing *Packetyzer::GetDvrSegmentRing(SegmentDataType data_type)
+{
+    if (data_type == SegmentDataType::Mp4Video)
+        return &_dvr_video_segment_ring;
+    else if (data_type == SegmentDataType::Mp4Audio)
+        return &_dvr_audio_segment_ring;
 
-    if (segment_data_item != _segment_datas.end())
+    return &_dvr_segment_ring;
+}
+
+//====================================================================================================
+// DVR(Time Shift) 설정
+// - DVR Window 동안의 Segment 를 파일(mmap)로 보관
+//====================================================================================================
+bool Packetyzer::SetDvr(uint32_t dvr_window, const std::string &dvr_path)
+{
+    if (dvr_window == 0 || _segment_duration == 0)
     {
-        data = segment_data_item->second->data;
-        return true;
+        return false;
+    }
+
+    _dvr_segment_count = std::max((int) ((dvr_window + _segment_duration - 1) / _segment_duration), _segment_count);
+
+    _dvr_segment_ring.SetCapacity(_dvr_segment_count);
+    _dvr_video_segment_ring.SetCapacity(_dvr_segment_count);
+    _dvr_audio_segment_ring.SetCapacity(_dvr_segment_count);
+
+    _segment_spill = std::make_unique<SegmentSpill>(dvr_path, _segment_prefix + (_packetyzer_type == PacketyzerType::Hls ? "_hls" : "_dash"));
+
+    return true;
+}
+
+//====================================================================================================
+// Segment 검색(메모리 -> DVR 파일)
+//====================================================================================================
+std::shared_ptr<SegmentData> Packetyzer::FindSegmentData(SegmentDataType data_type, uint32_t key)
+{
+    auto segment_data = GetSegmentRing(data_type)->Find(key);
+
+    if (segment_data == nullptr && _segment_spill != nullptr)
+    {
+        segment_data = GetDvrSegmentRing(data_type)->Find(key);
+    }
+
+    return segment_data;
+}
+
+//====================================================================================================
+// PlayList 시작 key
+//====================================================================================================
+uint32_t Packetyzer::GetPlayListStartKey(SegmentDataType data_type)
+{
+    uint32_t count = (_segment_spill != nullptr) ? _dvr_segment_count : _segment_count;
+    uint32_t next_key = GetSegmentRing(data_type)->GetNextKey();
+    uint32_t window_start_key = (next_key > count) ? next_key - count : 0;
+    uint32_t start_key = next_key;
+
+    while (start_key > window_start_key && FindSegmentData(data_type, start_key - 1) != nullptr)
+    {
+        start_key--;
+    }
+
+    return start_key;
+}
+
+//====================================================================================================
+// Chunked Segment 등록(Low Latency)
+// - Segment 전체 이름 등록
+// - 보관 개수 초과시 오래된 Segment 및 Part 이름 삭제
+//====================================================================================================
+bool Packetyzer::AddChunkedSegment(const std::shared_ptr<ChunkedSegment> &segment)
+{
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    _chunked_segments.push_back(segment);
+    _chunked_segment_names[segment->GetFileName()] = std::make_pair(segment, -1);
+
+    while (_chunked_segments.size() > CHUNKED_SEGMENT_SAVE_COUNT)
+    {
+        auto old_segment = _chunked_segments.front();
+
+        for (auto item = _chunked_segment_names.begin(); item != _chunked_segment_names.end();)
+        {
+            if (item->second.first == old_segment)
+                item = _chunked_segment_names.erase(item);
+            else
+                ++item;
+        }
+
+        // 완료되지 않은 Segment(ex) 스트림 종료) 대기 해제
+        old_segment->Complete();
+
+        _chunked_segments.pop_front();
     }
-    return false;
+
+    return true;
+}
+
+//====================================================================================================
+// Chunk(Partial Segment) 이름 등록
+// - 아직 생성되지 않은 Chunk 도 등록 가능(Preload Hint)
+//====================================================================================================
+bool Packetyzer::AddChunkedSegmentPart(const std::string &file_name,
+                                       const std::shared_ptr<ChunkedSegment> &segment,
+                                       int part_index)
+{
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    _chunked_segment_names[file_name] = std::make_pair(segment, part_index);
+
+    return true;
+}
+
+//====================================================================================================
+// Chunked Segment 검색
+//====================================================================================================
+bool Packetyzer::GetChunkedSegment(const std::string &file_name,
+                                   std::shared_ptr<ChunkedSegment> &segment,
+                                   int &part_index)
+{
+    if(!_init_segment_count_complete)
+        return false;
+
+    std::unique_lock<std::mutex> segment_datas_lock(_segment_datas_mutex);
+
+    auto item = _chunked_segment_names.find(file_name);
+
+    if (item == _chunked_segment_names.end())
+    {
+        return false;
+    }
+
+    segment = item->second.first;
+    part_index = item->second.second;
+
+    return true;
 }
 
 //====================================================================================================
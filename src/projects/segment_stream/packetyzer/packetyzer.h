@@ -11,13 +11,66 @@
 
 #include <map>
 #include "packetyzer_define.h"
+#include "chunked_segment.h"
+#include "segment_arena.h"
+#include "segment_spill.h"
 
 #define MPD_VIDEO_INIT_FILE_NAME "video_init.m4s"
 #define MPD_AUDIO_INIT_FILE_NAME "audio_init.m4s"
+
+// 생성 중인 Segment + 최근 완료된 Segment 보관 개수(Low Latency)
+#define CHUNKED_SEGMENT_SAVE_COUNT  (4)
+
+//====================================================================================================
+// SegmentRing
+// - 고정 크기 Segment Index(key % capacity 위치에 저장)
+// - key 는 순차 증가(TS : sequence number, M4S : Video/Audio 별 저장 순서)
+// - capacity 이전 key 의 Segment 는 새 Segment 저장시 제거
+// - timestamp -> key Index 유지(M4S : 파일 이름이 timestamp 기준, 전체 검색 없이 검색)
+//====================================================================================================
+class SegmentRing
+{
+public:
+    void SetCapacity(size_t capacity);
+
+    size_t GetCapacity() const
+    {
+        return _items.size();
+    }
+
+    // 다음 저장 key
+    uint32_t GetNextKey() const
+    {
+        return _next_key;
+    }
+
+    // removed_items : 제거된 Segment(Lock 해제 이후 정리)
+    void Push(uint32_t key,
+              const std::shared_ptr<SegmentData> &segment_data,
+              std::vector<std::shared_ptr<SegmentData>> &removed_items);
+
+    std::shared_ptr<SegmentData> Find(uint32_t key) const;
+
+    std::shared_ptr<SegmentData> FindByTimestamp(uint64_t timestamp) const;
+
+    std::shared_ptr<SegmentData> Remove(uint32_t key);
+
+    void Clear();
+
+private :
+    void RemoveTimestamp(const std::shared_ptr<SegmentData> &item, uint32_t key);
+
+private :
+    std::vector<std::shared_ptr<SegmentData>> _items;
+    std::vector<uint32_t> _keys;
+    std::map<uint64_t, uint32_t> _timestamp_keys;   // timestamp -> key
+    uint32_t _next_key = 0;
+};
+
 //====================================================================================================
 // Packetyzer
 //====================================================================================================
-class Packetyzer
+class Packetyzer : public SegmentArenaOwner
 {
 public:
     Packetyzer(PacketyzerType packetyzer_type,
@@ -25,7 +78,9 @@ public:
                PacketyzerStreamType stream_type,
                uint32_t segment_count,
                uint32_t segment_duration,
-               PacketyzerMediaInfo &media_info);
+               PacketyzerMediaInfo &media_info,
+               uint32_t chunk_duration = 0,
+               const std::shared_ptr<SegmentArena> &segment_arena = nullptr);
 
     virtual ~Packetyzer();
 
@@ -41,17 +96,67 @@ public :
                         uint64_t timestamp_,
                         std::shared_ptr<std::vector<uint8_t>> &data);
 
-    bool GetPlayList(std::string &play_list);
+    bool GetPlayList(std::string &play_list, SegmentCacheInfo *cache_info = nullptr);
+
+    bool GetSegmentData(const std::string &file_name,
+                        std::shared_ptr<const ov::Data> &data,
+                        SegmentCacheInfo *cache_info = nullptr);
+
+    // SegmentArenaOwner Implementation
+    std::shared_ptr<const ov::Data> EvictSegmentData(uint32_t data_type, uint32_t key) override;
+
+    // Low Latency
+    // - part_index : -1(Segment 전체) or Chunk(Partial Segment) index
+    bool GetChunkedSegment(const std::string &file_name, std::shared_ptr<ChunkedSegment> &segment, int &part_index);
 
-    bool GetSegmentData(std::string &file_name, std::shared_ptr<std::vector<uint8_t>> &data);
+    bool IsLowLatency() const
+    {
+        return _chunk_duration > 0;
+    }
+
+    // DVR(Time Shift)
+    // - dvr_window : PlayList 에 표시할 시간(second)
+    // - 메모리 보관 이후의 Segment 를 dvr_path 의 파일(mmap)에서 응답
+    // - 첫 Segment 생성 이전에 설정
+    bool SetDvr(uint32_t dvr_window, const std::string &dvr_path);
+
+    bool IsDvr() const
+    {
+        return _segment_spill != nullptr;
+    }
 
     static uint32_t Gcd(uint32_t n1, uint32_t n2);
     static std::string MakeUtcTimeString(time_t value);
     static double GetCurrentMilliseconds();
 
+protected :
+    SegmentRing *GetSegmentRing(SegmentDataType data_type);
+
+    SegmentRing *GetDvrSegmentRing(SegmentDataType data_type);
+
+    // 메모리 -> DVR 파일 순서로 검색(_segment_datas_mutex Lock 상태에서 호출)
+    std::shared_ptr<SegmentData> FindSegmentData(SegmentDataType data_type, uint32_t key);
+
+    // PlayList 시작 key(_segment_datas_mutex Lock 상태에서 호출)
+    // - 최근 Segment(DVR : DVR Window) 중 연속으로 남아 있는 Segment 의 시작 key
+    // - 중간에 삭제된 Segment 가 있으면 이후 Segment 만 표시(Sequence/Timeline 연속성 유지)
+    uint32_t GetPlayListStartKey(SegmentDataType data_type);
+
+    // Segment 응답 캐시 정보
+    // - ETag : Packetyzer 생성 시간 + Segment 종류/Sequence(스트림 재시작시 같은 파일 이름과 구분)
+    // - max-age : PlayList(DVR Window) 에서 제외될 때 까지 남은 시간
+    void MakeSegmentCacheInfo(const std::shared_ptr<SegmentData> &segment_data,
+                              char type_code,
+                              SegmentCacheInfo &cache_info);
+
+    bool AddChunkedSegment(const std::shared_ptr<ChunkedSegment> &segment);
+
+    bool AddChunkedSegmentPart(const std::string &file_name, const std::shared_ptr<ChunkedSegment> &segment, int part_index);
+
 protected :
     PacketyzerType _packetyzer_type;
     std::string _segment_prefix;
+    uint64_t _create_milliseconds;   // ETag 생성용
     PacketyzerStreamType _stream_type;
     int _segment_count;
     int _segment_save_count;
@@ -66,13 +171,26 @@ protected :
     bool _audio_init;
     bool _init_segment_count_complete;
 
-    std::map<std::string, std::shared_ptr<SegmentData>> _segment_datas;
-    std::deque<std::string> _segment_indexer;            // (Video+Audio)Segment Name 인덱서(순차적 데이터 삭제를 위해 사용) - TS
-    std::deque<std::string> _video_segment_indexer;    // Video Segment Name 인덱서(순차적 데이터 삭제를 위해 사용)  - M3S(Video)
-    std::deque<std::string> _audio_segment_indexer;    // Audio Segment Name 인덱서(순차적 데이터 삭제를 위해 사용)  - M3S(Audio)
+    // Segment 보관(_segment_save_count 개)
+    std::shared_ptr<SegmentArena> _segment_arena;   // nullptr : Writer 데이터 그대로 보관(예산 없음)
+    SegmentRing _segment_ring;                      // (Video+Audio)Segment - TS
+    SegmentRing _video_segment_ring;                // Video Segment - M4S(Video)
+    SegmentRing _audio_segment_ring;                // Audio Segment - M4S(Audio)
     std::mutex _segment_datas_mutex;
 
+    // DVR(파일 보관, 메모리 보관 Segment 도 함께 기록)
+    std::unique_ptr<SegmentSpill> _segment_spill;   // nullptr : DVR 사용 안함
+    int _dvr_segment_count = 0;
+    SegmentRing _dvr_segment_ring;
+    SegmentRing _dvr_video_segment_ring;
+    SegmentRing _dvr_audio_segment_ring;
+
     std::shared_ptr<SegmentData> _mpd_video_init_file = nullptr;
     std::shared_ptr<SegmentData> _mpd_audio_init_file = nullptr;
 
+    // Low Latency(Chunk 단위 전송)
+    uint32_t _chunk_duration; // millisecond(0 : disable)
+    std::deque<std::shared_ptr<ChunkedSegment>> _chunked_segments;
+    std::map<std::string, std::pair<std::shared_ptr<ChunkedSegment>, int>> _chunked_segment_names; // key : file name  value : segment, part index
+
 };
@@ -14,6 +14,7 @@
 #include <deque>
 #include <mutex>
 #include <string.h>
+#include <base/ovlibrary/ovlibrary.h>
 #include "bit_writer.h"
 
 #define PACKTYZER_DEFAULT_TIMESCALE                (90000)//90MHz
@@ -52,21 +53,12 @@ enum class SegmentDataType : int32_t {
 
 //====================================================================================================
 // SegmentData
+// - data : SegmentArena Slab or Writer 데이터 참조(복사하지 않음, 수정 금지)
 //====================================================================================================
 struct SegmentData {
 public :
-    SegmentData(int sequence_number_, std::string &file_name_, uint64_t duration_, uint64_t timestamp_, int data_size_,
-                uint8_t *data_) {
-        sequence_number = sequence_number_;
-        file_name = file_name_;
-        create_time = time(nullptr);
-        duration = duration_;
-        timestamp = timestamp_;
-        data = std::make_shared<std::vector<uint8_t>>(data_, data_ + data_size_);
-    }
-
-    SegmentData(int sequence_number_, std::string &file_name_, uint64_t duration_, uint64_t timestamp_,
-                std::shared_ptr<std::vector<uint8_t>> &data_) {
+    SegmentData(int sequence_number_, const std::string &file_name_, uint64_t duration_, uint64_t timestamp_,
+                const std::shared_ptr<const ov::Data> &data_) {
         sequence_number = sequence_number_;
         file_name = file_name_;
         create_time = time(nullptr);
@@ -81,7 +73,7 @@ public :
     time_t create_time;
     uint64_t duration;
     uint64_t timestamp;
-    std::shared_ptr<std::vector<uint8_t>> data;
+    std::shared_ptr<const ov::Data> data;
 };
 
 //====================================================================================================
@@ -96,11 +88,13 @@ enum class PacketyzerFrameType {
 
 //====================================================================================================
 // PacketyzerFrameData
+// - data : MediaRouter 에서 전달된 Frame 데이터(복사하지 않고 HLS/DASH Packetyzer 가 공유)
+//          공유 데이터 이므로 수정 불가, 해당 Segment 생성 후 해제
 //====================================================================================================
 struct PacketyzerFrameData {
 public:
     PacketyzerFrameData(PacketyzerFrameType type_, uint64_t timestamp_, uint64_t time_offset_, uint32_t time_scale_,
-                        std::shared_ptr<std::vector<uint8_t>> &data_) {
+                        const std::shared_ptr<const ov::Data> &data_) {
         type = type_;
         timestamp = timestamp_;
         time_offset = time_offset_;
@@ -113,7 +107,7 @@ public:
         timestamp = timestamp_;
         time_offset = time_offset_;
         timescale = time_scale_;
-        data = std::make_shared<std::vector<uint8_t>>();
+        data = std::make_shared<ov::Data>();
     }
 
 public:
@@ -121,7 +115,7 @@ public:
     uint64_t timestamp;
     uint64_t time_offset;
     uint32_t timescale;
-    std::shared_ptr<std::vector<uint8_t>> data;
+    std::shared_ptr<const ov::Data> data;
 };
 
 
@@ -201,3 +195,23 @@ public :
 };
 
 #pragma pack()
+
+//====================================================================================================
+// SegmentCacheInfo
+// - PlayList/Segment Http 응답 캐시 정보(ETag, Last-Modified, Cache-Control)
+//====================================================================================================
+struct SegmentCacheInfo {
+    std::string etag;           // Strong ETag(따옴표 포함, empty : 사용 안함)
+    time_t last_modified = 0;   // 0 : 사용 안함
+    int max_age = 0;            // Cache-Control max-age(second)
+};
+
+//====================================================================================================
+// PlayListWaitResult
+// - Blocking PlayList Reload(LL-HLS _HLS_msn/_HLS_part) 대기 결과
+//====================================================================================================
+enum class PlayListWaitResult : int32_t {
+    Ready,          // PlayList 에 요청 Segment/Part 포함
+    InvalidRequest, // 요청 Segment 가 마지막 Segment + 2 초과
+    Timeout,        // Target Duration x 3 동안 생성되지 않음
+};
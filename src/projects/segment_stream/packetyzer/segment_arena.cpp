@@ -0,0 +1,291 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "segment_arena.h"
+#include <cstdlib>
+#include <cstring>
+
+#define OV_LOG_TAG                  "SegmentStream"
+
+//====================================================================================================
+// Constructor
+// - budget : byte(0 : 제한 없음)
+//====================================================================================================
+SegmentArena::SegmentArena(const std::string &name, size_t budget)
+{
+    _name = name;
+    _budget = budget;
+}
+
+//====================================================================================================
+// Destructor
+// - 보관 중인 데이터가 Arena 참조를 유지하므로 여유 Slab 만 남아 있음
+//====================================================================================================
+SegmentArena::~SegmentArena()
+{
+    for (auto &free_slabs : _free_slabs)
+    {
+        for (auto slab : free_slabs.second)
+        {
+            ::free(slab);
+        }
+    }
+
+    _free_slabs.clear();
+}
+
+//====================================================================================================
+// Slab 크기
+// - 2의 거듭제곱 구간을 4단계로 나눈 크기(낭비 25% 이하)
+//====================================================================================================
+size_t SegmentArena::GetSlabSize(size_t data_size)
+{
+    if (data_size <= SEGMENT_ARENA_MIN_SLAB_SIZE)
+    {
+        return SEGMENT_ARENA_MIN_SLAB_SIZE;
+    }
+
+    size_t power = SEGMENT_ARENA_MIN_SLAB_SIZE;
+
+    while (power * 2 < data_size)
+    {
+        power *= 2;
+    }
+
+    size_t step = power / 4;
+
+    return (data_size + step - 1) / step * step;
+}
+
+//====================================================================================================
+// Segment 저장
+// - 여유 Slab 재사용 -> 예산 내 신규 할당 -> 오래된 Segment 삭제 후 재시도
+// - 삭제 요청(Owner Lock)은 Arena Lock 상태에서 하고, 삭제된 데이터 정리(Release)는 Lock 해제 후 처리
+//====================================================================================================
+std::shared_ptr<const ov::Data> SegmentArena::Store(SegmentArenaOwner *owner,
+                                                    uint32_t data_type,
+                                                    uint32_t key,
+                                                    const void *data,
+                                                    size_t data_size)
+{
+    if (data == nullptr || data_size == 0)
+    {
+        return nullptr;
+    }
+
+    size_t slab_size = GetSlabSize(data_size);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    uint8_t *slab = (_budget > 0 && slab_size > _budget) ? nullptr : TakeSlab(slab_size);
+
+    while (slab == nullptr)
+    {
+        std::vector<std::shared_ptr<const ov::Data>> evicted_datas;
+        size_t evicted_size = 0;
+
+        if (_budget == 0 || slab_size <= _budget)
+        {
+            for (auto item = _published_blocks.begin(); item != _published_blocks.end() && evicted_size < slab_size;)
+            {
+                auto block = *item;
+
+                // Index 에 등록되기 전 or 응답 중(Index 에서 이미 제거됨) : 참조 해제시 반환됨
+                auto evicted_data = (block->owner != nullptr) ?
+                                    block->owner->EvictSegmentData(block->data_type, block->key) : nullptr;
+
+                if (evicted_data == nullptr)
+                {
+                    ++item;
+                    continue;
+                }
+
+                item = _published_blocks.erase(item);
+                block->listed = false;
+
+                evicted_size += block->slab_size;
+                evicted_datas.push_back(evicted_data);
+                _eviction_count++;
+            }
+        }
+
+        if (evicted_datas.empty())
+        {
+            _drop_count++;
+
+            auto stats_reserved = _reserved;
+            lock.unlock();
+
+            logtw("[%s] Segment memory budget exceeded - segment dropped(size: %zu, reserved: %zu, budget: %zu)",
+                  _name.c_str(), data_size, stats_reserved, _budget);
+
+            return nullptr;
+        }
+
+        lock.unlock();
+
+        // 삭제된 Segment 의 Slab 반환(Release)
+        evicted_datas.clear();
+
+        lock.lock();
+
+        slab = TakeSlab(slab_size);
+    }
+
+    auto block = new Block();
+
+    block->slab = slab;
+    block->slab_size = slab_size;
+    block->data_size = data_size;
+    block->owner = owner;
+    block->data_type = data_type;
+    block->key = key;
+    block->position = _published_blocks.insert(_published_blocks.end(), block);
+    block->listed = true;
+
+    _used += data_size;
+    _segment_count++;
+
+    lock.unlock();
+
+    ::memcpy(slab, data, data_size);
+
+    auto arena = shared_from_this();
+
+    return std::shared_ptr<const ov::Data>(new ov::Data(slab, data_size, true), [arena, block](const ov::Data *segment_data) {
+        delete segment_data;
+        arena->Release(block);
+    });
+}
+
+//====================================================================================================
+// Owner 해제
+//====================================================================================================
+void SegmentArena::Unregister(SegmentArenaOwner *owner)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    for (auto block : _published_blocks)
+    {
+        if (block->owner == owner)
+        {
+            block->owner = nullptr;
+        }
+    }
+}
+
+//====================================================================================================
+// 상태 정보(Monitoring)
+//====================================================================================================
+SegmentArenaStats SegmentArena::GetStats()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    SegmentArenaStats stats;
+
+    stats.budget = _budget;
+    stats.reserved = _reserved;
+    stats.used = _used;
+    stats.segment_count = _segment_count;
+    stats.eviction_count = _eviction_count;
+    stats.drop_count = _drop_count;
+
+    return stats;
+}
+
+//====================================================================================================
+// Slab 획득(Lock 상태에서 호출)
+// - 같은 크기 여유 Slab -> 신규 할당(예산 초과시 다른 크기 여유 Slab 해제)
+//====================================================================================================
+uint8_t *SegmentArena::TakeSlab(size_t slab_size)
+{
+    auto free_slabs = _free_slabs.find(slab_size);
+
+    if (free_slabs != _free_slabs.end() && !free_slabs->second.empty())
+    {
+        auto slab = free_slabs->second.back();
+        free_slabs->second.pop_back();
+
+        return slab;
+    }
+
+    if (_budget > 0 && _reserved + slab_size > _budget)
+    {
+        ReleaseFreeSlabs(slab_size);
+
+        if (_reserved + slab_size > _budget)
+        {
+            return nullptr;
+        }
+    }
+
+    auto slab = static_cast<uint8_t *>(::malloc(slab_size));
+
+    if (slab != nullptr)
+    {
+        _reserved += slab_size;
+    }
+
+    return slab;
+}
+
+//====================================================================================================
+// 여유 Slab 해제(Lock 상태에서 호출)
+// - 큰 Slab 부터 required_size 를 할당할 수 있을 때 까지
+//====================================================================================================
+void SegmentArena::ReleaseFreeSlabs(size_t required_size)
+{
+    for (auto free_slabs = _free_slabs.rbegin(); free_slabs != _free_slabs.rend(); ++free_slabs)
+    {
+        while (!free_slabs->second.empty() && _reserved + required_size > _budget)
+        {
+            ::free(free_slabs->second.back());
+            free_slabs->second.pop_back();
+
+            _reserved -= free_slabs->first;
+        }
+
+        if (_reserved + required_size <= _budget)
+        {
+            break;
+        }
+    }
+}
+
+//====================================================================================================
+// Slab 반환(데이터 마지막 참조 해제)
+//====================================================================================================
+void SegmentArena::Release(Block *block)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    if (block->listed)
+    {
+        _published_blocks.erase(block->position);
+    }
+
+    _used -= block->data_size;
+    _segment_count--;
+
+    auto &free_slabs = _free_slabs[block->slab_size];
+
+    if (free_slabs.size() < SEGMENT_ARENA_FREE_SLAB_COUNT)
+    {
+        free_slabs.push_back(block->slab);
+    }
+    else
+    {
+        ::free(block->slab);
+        _reserved -= block->slab_size;
+    }
+
+    lock.unlock();
+
+    delete block;
+}
@@ -0,0 +1,115 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <map>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <base/ovlibrary/ovlibrary.h>
+
+// Slab 최소 크기(작은 Segment 도 같은 Slab 재사용)
+#define SEGMENT_ARENA_MIN_SLAB_SIZE     (64 * 1024)
+// Slab 크기별 보관하는 여유 Slab 최대 개수
+#define SEGMENT_ARENA_FREE_SLAB_COUNT   (8)
+
+//====================================================================================================
+// SegmentArenaOwner
+// - Arena 에 Segment 를 보관하는 Packetyzer
+// - 메모리 부족시 Arena 가 가장 오래 전에 발행된 Segment 삭제 요청
+//====================================================================================================
+class SegmentArenaOwner
+{
+public:
+    virtual ~SegmentArenaOwner() = default;
+
+    // 보관 중인 Segment 를 Index 에서 제거하고 데이터 반환(보관 중이 아니면 nullptr)
+    // - 반환된 데이터는 Arena Lock 해제 이후 정리됨
+    virtual std::shared_ptr<const ov::Data> EvictSegmentData(uint32_t data_type, uint32_t key) = 0;
+};
+
+//====================================================================================================
+// SegmentArenaStats
+//====================================================================================================
+struct SegmentArenaStats
+{
+    size_t budget = 0;          // byte(0 : 제한 없음)
+    size_t reserved = 0;        // 할당된 Slab 전체 크기(사용 중 + 여유)
+    size_t used = 0;            // 보관 중인 Segment 데이터 크기
+    size_t segment_count = 0;
+    uint64_t eviction_count = 0;
+    uint64_t drop_count = 0;    // 예산 부족으로 저장하지 못한 Segment
+};
+
+//====================================================================================================
+// SegmentArena
+// - Publisher(HLS/DASH) 단위로 전체 스트림의 Segment 데이터 보관
+// - 크기별(2의 거듭제곱을 4단계로 나눈 크기) Slab 을 재사용
+// - 예산 초과시 여유 Slab 해제 -> 가장 오래 전에 발행된 Segment 삭제(Least Recently Published)
+// - 반환된 데이터는 마지막 참조(Http 응답 등)가 해제될 때 Slab 반환
+//====================================================================================================
+class SegmentArena : public std::enable_shared_from_this<SegmentArena>
+{
+public:
+    SegmentArena(const std::string &name, size_t budget);
+    ~SegmentArena();
+
+public :
+    const std::string &GetName() const
+    {
+        return _name;
+    }
+
+    // data 를 Slab 에 복사하여 반환(예산 부족시 nullptr)
+    std::shared_ptr<const ov::Data> Store(SegmentArenaOwner *owner,
+                                          uint32_t data_type,
+                                          uint32_t key,
+                                          const void *data,
+                                          size_t data_size);
+
+    // Owner 삭제 전 호출(이후 삭제 요청 하지 않음)
+    void Unregister(SegmentArenaOwner *owner);
+
+    SegmentArenaStats GetStats();
+
+    static size_t GetSlabSize(size_t data_size);
+
+private :
+    struct Block
+    {
+        uint8_t *slab = nullptr;
+        size_t slab_size = 0;
+        size_t data_size = 0;
+        SegmentArenaOwner *owner = nullptr;
+        uint32_t data_type = 0;
+        uint32_t key = 0;
+        bool listed = false;
+        std::list<Block *>::iterator position;
+    };
+
+    uint8_t *TakeSlab(size_t slab_size);
+    void ReleaseFreeSlabs(size_t required_size);
+    void Release(Block *block);
+
+private :
+    std::string _name;
+    size_t _budget;
+    size_t _reserved = 0;
+    size_t _used = 0;
+    size_t _segment_count = 0;
+    uint64_t _eviction_count = 0;
+    uint64_t _drop_count = 0;
+
+    std::list<Block *> _published_blocks;                   // 발행 순서(오래된 Segment 가 앞)
+    std::map<size_t, std::vector<uint8_t *>> _free_slabs;   // key : slab size
+    std::mutex _mutex;
+};
@@ -0,0 +1,169 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "segment_spill.h"
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define OV_LOG_TAG                  "SegmentStream"
+
+//====================================================================================================
+// Constructor
+//====================================================================================================
+SegmentSpill::SegmentSpill(const std::string &directory, const std::string &name)
+{
+    _directory = directory.empty() ? "/tmp" : directory;
+    _name = name;
+}
+
+//====================================================================================================
+// Destructor
+// - 응답 중인 Segment 가 참조하는 Extent 는 참조 해제시 정리
+//====================================================================================================
+SegmentSpill::~SegmentSpill()
+{
+    _current_extent = nullptr;
+    _extents.clear();
+}
+
+SegmentSpill::Extent::~Extent()
+{
+    if (base != nullptr)
+    {
+        ::munmap(base, size);
+    }
+}
+
+//====================================================================================================
+// Segment 기록
+// - 현재 Extent 에 공간이 없으면 참조가 모두 해제된 Extent 재사용 or 신규 생성
+//====================================================================================================
+std::shared_ptr<const ov::Data> SegmentSpill::Store(const void *data, size_t data_size)
+{
+    if (data == nullptr || data_size == 0)
+    {
+        return nullptr;
+    }
+
+    if (_current_extent == nullptr || _current_extent->write_offset + data_size > _current_extent->size)
+    {
+        size_t free_count = 0;
+
+        _current_extent = nullptr;
+
+        // segment_count 0 : 참조 중인 Segment 없음(Segment 참조는 Store 에서만 생성되므로 다시 증가하지 않음)
+        for (auto item = _extents.begin(); item != _extents.end();)
+        {
+            const auto &extent = *item;
+
+            if (extent->segment_count.load(std::memory_order_acquire) == 0)
+            {
+                if (_current_extent == nullptr && extent->size >= data_size)
+                {
+                    extent->write_offset = 0;
+                    _current_extent = extent;
+                }
+                else if (free_count < SEGMENT_SPILL_FREE_EXTENT_COUNT)
+                {
+                    free_count++;
+                }
+                else
+                {
+                    item = _extents.erase(item);
+                    continue;
+                }
+            }
+
+            ++item;
+        }
+
+        if (_current_extent == nullptr)
+        {
+            _current_extent = CreateExtent(std::max((size_t) SEGMENT_SPILL_EXTENT_SIZE, data_size));
+
+            if (_current_extent == nullptr)
+            {
+                return nullptr;
+            }
+
+            _extents.push_back(_current_extent);
+        }
+    }
+
+    auto extent = _current_extent;
+    auto segment_data = extent->base + extent->write_offset;
+
+    ::memcpy(segment_data, data, data_size);
+
+    extent->write_offset += data_size;
+    extent->segment_count.fetch_add(1, std::memory_order_relaxed);
+
+    // Extent 는 참조 해제시까지 유지(SegmentSpill 삭제 이후 응답 중인 경우)
+    return std::shared_ptr<const ov::Data>(new ov::Data(segment_data, data_size, true), [extent](const ov::Data *item) {
+        delete item;
+        extent->segment_count.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+//====================================================================================================
+// Extent(파일) 생성
+// - 디스크 공간을 미리 할당(mmap 기록 중 공간 부족시 SIGBUS 방지)
+//====================================================================================================
+std::shared_ptr<SegmentSpill::Extent> SegmentSpill::CreateExtent(size_t size)
+{
+    size_t page_size = (size_t) ::sysconf(_SC_PAGESIZE);
+
+    size = (size + page_size - 1) / page_size * page_size;
+
+    std::string path = _directory + "/" + _name + "_XXXXXX";
+    std::vector<char> file_path(path.begin(), path.end());
+    file_path.push_back('\0');
+
+    int fd = ::mkstemp(file_path.data());
+
+    if (fd < 0)
+    {
+        logte("Could not create DVR file(%s): %s", path.c_str(), ::strerror(errno));
+        return nullptr;
+    }
+
+    // 프로세스 종료시 자동 삭제
+    ::unlink(file_path.data());
+
+    int result = ::posix_fallocate(fd, 0, (off_t) size);
+
+    if (result != 0)
+    {
+        logte("Could not allocate DVR file(%s, %zu bytes): %s", file_path.data(), size, ::strerror(result));
+        ::close(fd);
+        return nullptr;
+    }
+
+    void *base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    ::close(fd);
+
+    if (base == MAP_FAILED)
+    {
+        logte("Could not map DVR file(%s, %zu bytes): %s", file_path.data(), size, ::strerror(errno));
+        return nullptr;
+    }
+
+    auto extent = std::make_shared<Extent>();
+
+    extent->base = static_cast<uint8_t *>(base);
+    extent->size = size;
+
+    logtd("DVR file created(%s, %zu bytes)", file_path.data(), size);
+
+    return extent;
+}
@@ -0,0 +1,64 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <string>
+#include <base/ovlibrary/ovlibrary.h>
+
+// DVR 파일(Extent) 기본 크기
+#ifndef SEGMENT_SPILL_EXTENT_SIZE
+#define SEGMENT_SPILL_EXTENT_SIZE       (64 * 1024 * 1024)
+#endif
+// 재사용 대기 Extent 최대 개수
+#define SEGMENT_SPILL_FREE_EXTENT_COUNT (1)
+
+//====================================================================================================
+// SegmentSpill
+// - DVR(Time Shift) 용 Segment 파일 저장(Stream/Packetyzer 단위)
+// - mmap 된 파일(Extent)에 Segment 를 이어서 기록하고, 반환된 데이터는 mmap 영역을 직접 참조(Heap 에 Load 하지 않음)
+// - 파일은 생성 직후 unlink(프로세스 종료시 디스크 자동 정리)
+// - 모든 Segment 참조가 해제된 Extent(segment_count 0) 는 처음부터 다시 기록(재사용)
+// - Packetyzer(Segment 생성 Thread)에서만 Store 호출
+//====================================================================================================
+class SegmentSpill
+{
+public:
+    SegmentSpill(const std::string &directory, const std::string &name);
+    ~SegmentSpill();
+
+public :
+    // data 를 파일에 기록하여 반환(실패시 nullptr)
+    std::shared_ptr<const ov::Data> Store(const void *data, size_t data_size);
+
+private :
+    struct Extent
+    {
+        ~Extent();
+
+        uint8_t *base = nullptr;
+        size_t size = 0;
+        size_t write_offset = 0;
+
+        // 참조 중인 Segment 개수(Store 에서 증가, 응답 Thread 에서 참조 해제시 감소)
+        // - release(감소) / acquire(재사용 확인) : 재사용 기록 이전에 이전 Segment 읽기 완료 보장
+        std::atomic<uint32_t> segment_count { 0 };
+    };
+
+    std::shared_ptr<Extent> CreateExtent(size_t size);
+
+private :
+    std::string _directory;
+    std::string _name;
+    std::vector<std::shared_ptr<Extent>> _extents;
+    std::shared_ptr<Extent> _current_extent;
+};
@@ -30,34 +30,6 @@
 #define TS_PAT_SIZE							(13)
 #define TS_CRC_SIZE							(4)
 
-static uint8_t const HLS_STUFFING_BYTES[TS_PACKET_SIZE] = 
-{
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF
-};
-
 static uint32_t const HLS_CRC_TABLE[256] = 
 {
 	0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b,
@@ -107,6 +79,12 @@ static uint32_t const HLS_CRC_TABLE[256] =
 #define H264_AUD_SIZE (6)
 static const uint8_t g_aud[H264_AUD_SIZE] = { 0x00 ,0x00 ,0x00 ,0x01 ,0x09 ,0xe0 };
 
+// PES Header 고정 부분(9Byte)
+// - packet_start_code_prefix(24) + stream_id(8) + PES_packet_length(16)
+// - '10' + flags(data_alignment_indicator) + PTS_DTS_flags + PES_header_data_length
+static const uint8_t g_video_pes_header[9] = { 0x00, 0x00, 0x01, TS_DEFAULT_VIDEO_STREAM_ID, 0x00, 0x00, 0x84, 0xC0, PES_HEADER_WIDTH_DTS_SIZE - 9 };
+static const uint8_t g_audio_pes_header[9] = { 0x00, 0x00, 0x01, TS_DEFAULT_AUDIO_STREAM_ID, 0x00, 0x00, 0x84, 0x80, PES_HEADER_SIZE - 9 };
+
 //====================================================================================================
 // CRC 생성 
 //====================================================================================================
@@ -122,151 +100,203 @@ uint32_t TsWriter::MakeCrc(const uint8_t *data, uint32_t data_size)
 	return crc;
 }
 
+//====================================================================================================
+// PTS/DTS 쓰기(5Byte)
+// - prefix(4) + [32..30](3) + marker(1) + [29..15](15) + marker(1) + [14..0](15) + marker(1)
+//====================================================================================================
+static inline void WritePesTimestamp(uint8_t *data, uint8_t prefix, uint64_t timestamp)
+{
+	data[0] = (uint8_t)((prefix << 4) | (((timestamp >> 30) & 0x07) << 1) | 0x01);
+	data[1] = (uint8_t)(timestamp >> 22);
+	data[2] = (uint8_t)((((timestamp >> 15) & 0x7F) << 1) | 0x01);
+	data[3] = (uint8_t)(timestamp >> 7);
+	data[4] = (uint8_t)(((timestamp & 0x7F) << 1) | 0x01);
+}
+
 //====================================================================================================
 // Constructor
+// - data_init_size : Segment 버퍼 예약 크기(EstimateDataSize 참고)
 //====================================================================================================
-TsWriter::TsWriter(PacketyzerStreamType stream_type)
+TsWriter::TsWriter(PacketyzerStreamType stream_type, size_t data_init_size)
 {
 	_data_stream = std::make_shared<std::vector<uint8_t>>();
-	_data_stream->reserve(4096);
+	_data_stream->reserve(std::max<size_t>(data_init_size, TS_PACKET_SIZE * 2));
 
 	_audio_continuity_count	= 0;
 	_video_continuity_count	= 0;
+	_pat_continuity_count	= 0;
+	_pmt_continuity_count	= 0;
 	_stream_type			= stream_type;
 
-	WritePAT();
-	WritePMT();
+	// PAT/PMT
+	WritePsi();
 }
 
 //====================================================================================================
-// Stream Data 버퍼에 데이터 추가
+// PAT/PMT 기록
+// - 미리 생성된 패킷 복사 후 Continuity Counter 만 설정
 //====================================================================================================
-bool TsWriter::WriteDataStream(int data_size, const uint8_t * data)
+void TsWriter::WritePsi()
 {
-	_data_stream->insert(_data_stream->end(), data, data + data_size);
-	return true;
+	const uint8_t *pat_packet = GetPatPacket();
+	const uint8_t *pmt_packet = GetPmtPacket(_stream_type);
+	size_t offset = _data_stream->size();
+
+	_data_stream->insert(_data_stream->end(), pat_packet, pat_packet + TS_PACKET_SIZE);
+	_data_stream->insert(_data_stream->end(), pmt_packet, pmt_packet + TS_PACKET_SIZE);
+
+	(*_data_stream)[offset + 3] = (uint8_t)(0x10 | (_pat_continuity_count & 0x0F));
+	(*_data_stream)[offset + TS_PACKET_SIZE + 3] = (uint8_t)(0x10 | (_pmt_continuity_count & 0x0F));
+
+	_pat_continuity_count++;
+	_pmt_continuity_count++;
 }
 
 //====================================================================================================
-// PAT(Program Association Table)  쓰기
-// - 프로그램의 번호와 Program Map Table을 담고 있는 패킷의 Packet Identifier(PID) 간의 연결 관계를 담고 있다.
+// Segment 크기 예측
+// - Frame 당 최대 PES 헤더(+AUD) + PCR Adaptation + 마지막 패킷 여유분
 //====================================================================================================
-bool TsWriter::WritePAT()
+size_t TsWriter::EstimateDataSize(size_t frame_count, size_t frame_data_size)
 {
-	uint32_t payload_size 	= TS_PACKET_PAYLOAD_SIZE;
-	uint32_t crc			= 0;
-
-	// TS Header 설정
-	MakeTsHeader(0, 0, true, payload_size, false, 0, false);
-
-	//PAT Header 설정(13Byte)
-	BitWriter pat_bit(TS_PAT_SIZE);
-	pat_bit.Write(8,	0);  					// pointer
-	pat_bit.Write(8,	0);  					// table_id
-	pat_bit.Write(1,	1);  					// section_syntax_indicator
-	pat_bit.Write(1,	0);  					// '0'
-	pat_bit.Write(2,	3);  					// reserved
-	pat_bit.Write(12,13);					// section_length
-	pat_bit.Write(16,1); 					// transport_stream_id
-	pat_bit.Write(2,	3);  					// reserved
-	pat_bit.Write(5,	0);  					// version_number
-	pat_bit.Write(1,	1);  					// current_next_indicator
-	pat_bit.Write(8,	0);  					// section_number
-	pat_bit.Write(8,	0);  					// last_section_number
-	pat_bit.Write(16,1); 					// program number
-	pat_bit.Write(3,	7);  					// reserved
-	pat_bit.Write(13,TS_DEFAULT_PMT_PID);	// program_map_PID
-	WriteDataStream((int)pat_bit.GetDataSize(), pat_bit.GetData());
-
-	crc = MakeCrc(pat_bit.GetData() + 1, (uint32_t)pat_bit.GetDataSize() - 1); // table_id~program_map_PID
+	size_t frame_overhead = PES_HEADER_WIDTH_DTS_SIZE + H264_AUD_SIZE + 2 + TS_PCR_ADAPTATION_SIZE;
 
-	//CRC(4Byte)
-	BitWriter crc_bit(TS_CRC_SIZE);
-	crc_bit.Write(32, crc);
-	WriteDataStream((int)crc_bit.GetDataSize(), crc_bit.GetData());
-
-	//Stuffing Bytes
-	WriteDataStream(TS_PACKET_PAYLOAD_SIZE - (TS_PAT_SIZE+TS_CRC_SIZE), HLS_STUFFING_BYTES);
-
-	return true;
+	return TS_PACKET_SIZE * (2 + frame_count + (frame_data_size + frame_count * frame_overhead) / TS_PACKET_PAYLOAD_SIZE);
 }
 
 //====================================================================================================
-// PMT(Program Map Table)  쓰기
-// -프로그램의 Elementary Stream을 담은 패킷에 대한 연결 정보를 담고 있다.
+// PSI(PAT/PMT) 패킷 생성
+// - section : pointer_field ~ CRC 이전
 //====================================================================================================
-bool TsWriter::WritePMT()
+void TsWriter::MakePsiPacket(int pid, const uint8_t *section, uint32_t section_size, uint8_t *packet)
 {
-	uint32_t payload_size 	= TS_PACKET_PAYLOAD_SIZE;
-	uint32_t section_size 	= 13;
-	uint32_t pid			= 0;
-	uint32_t crc			= 0;
+	uint32_t crc = MakeCrc(section + 1, section_size - 1); // table_id~end
 
-	// TS Header 설정
-	MakeTsHeader(TS_DEFAULT_PMT_PID, 0, true, payload_size, false, 0, false);
+	packet[0] = TS_SYNC_BYTE;
+	packet[1] = (uint8_t)(0x40 | (pid >> 8));
+	packet[2] = (uint8_t)(pid & 0xFF);
+	packet[3] = 0x10;
 
-	if(_stream_type == PacketyzerStreamType::Common || _stream_type == PacketyzerStreamType::AudioOnly)
-	{
-		section_size += 5;
-		pid = TS_DEFAULT_AUDIO_PID;
-	}
+	memcpy(packet + TS_HEADER_SIZE, section, section_size);
 
-	if(_stream_type == PacketyzerStreamType::Common || _stream_type == PacketyzerStreamType::VideoOnly)
-	{
-		section_size += 5;
-		pid = TS_DEFAULT_VIDEO_PID;
-	}
+	//CRC(4Byte)
+	packet[TS_HEADER_SIZE + section_size + 0] = (uint8_t)(crc >> 24);
+	packet[TS_HEADER_SIZE + section_size + 1] = (uint8_t)(crc >> 16);
+	packet[TS_HEADER_SIZE + section_size + 2] = (uint8_t)(crc >> 8);
+	packet[TS_HEADER_SIZE + section_size + 3] = (uint8_t)crc;
 
-	BitWriter pmt_bit(section_size);
-
-	pmt_bit.Write(8,		0);        			// pointer
-	pmt_bit.Write(8,		2);        			// table_id
-	pmt_bit.Write(1,		1);        			// section_syntax_indicator
-	pmt_bit.Write(1,		0);        			// '0'
-	pmt_bit.Write(2,		3);        			// reserved
-	pmt_bit.Write(12,	section_size); 	// section_length
-	pmt_bit.Write(16,	1);       			// program_number
-	pmt_bit.Write(2,		3);        			// reserved
-	pmt_bit.Write(5,		0);        			// version_number
-	pmt_bit.Write(1,		1);        			// current_next_indicator
-	pmt_bit.Write(8,		0);        			// section_number
-	pmt_bit.Write(8,		0);        			// last_section_number
-	pmt_bit.Write(3,		7);        			// reserved
-	pmt_bit.Write(13,	pid); 				// PCD_PID
-	pmt_bit.Write(4,		0xF);      			// reserved
-	pmt_bit.Write(12,	0);      			// program_info_length
-
-	if(_stream_type == PacketyzerStreamType::Common || _stream_type == PacketyzerStreamType::VideoOnly)
-	{
-		pmt_bit.Write(8,		TS_STREAM_TYPE_AVC); 			// stream_type
-		pmt_bit.Write(3,		0x7);                   		// reserved
-		pmt_bit.Write(13,	TS_DEFAULT_VIDEO_PID);    		// elementary_PID
-		pmt_bit.Write(4,		0xF);                   		// reserved
-		pmt_bit.Write(12,	0);                    			// ES_info_length
-	}
+	//Stuffing Bytes
+	memset(packet + TS_HEADER_SIZE + section_size + TS_CRC_SIZE, 0xFF, TS_PACKET_PAYLOAD_SIZE - (section_size + TS_CRC_SIZE));
+}
 
-	if(_stream_type == PacketyzerStreamType::Common || _stream_type == PacketyzerStreamType::AudioOnly)
+//====================================================================================================
+// PAT(Program Association Table) 패킷
+// - 프로그램의 번호와 Program Map Table을 담고 있는 패킷의 Packet Identifier(PID) 간의 연결 관계를 담고 있다.
+// - 내용이 고정이므로 최초 1회만 생성
+//====================================================================================================
+const uint8_t *TsWriter::GetPatPacket()
+{
+	static const std::array<uint8_t, TS_PACKET_SIZE> pat_packet = []()
 	{
-		pmt_bit.Write(8, 	TS_STREAM_TYPE_ISO_IEC_13818_7);// stream_type
-		pmt_bit.Write(3,		0x7);                   		// reserved
-		pmt_bit.Write(13,	TS_DEFAULT_AUDIO_PID);    		// elementary_PID
-		pmt_bit.Write(4,		0xF);                   		// reserved
-		pmt_bit.Write(12,	0);                    			// ES_info_length
-	}
-
-	WriteDataStream((int)pmt_bit.GetDataSize(), pmt_bit.GetData());
+		std::array<uint8_t, TS_PACKET_SIZE> packet;
+
+		//PAT Header 설정(13Byte)
+		BitWriter pat_bit(TS_PAT_SIZE);
+		pat_bit.Write(8,	0);  					// pointer
+		pat_bit.Write(8,	0);  					// table_id
+		pat_bit.Write(1,	1);  					// section_syntax_indicator
+		pat_bit.Write(1,	0);  					// '0'
+		pat_bit.Write(2,	3);  					// reserved
+		pat_bit.Write(12,13);					// section_length
+		pat_bit.Write(16,1); 					// transport_stream_id
+		pat_bit.Write(2,	3);  					// reserved
+		pat_bit.Write(5,	0);  					// version_number
+		pat_bit.Write(1,	1);  					// current_next_indicator
+		pat_bit.Write(8,	0);  					// section_number
+		pat_bit.Write(8,	0);  					// last_section_number
+		pat_bit.Write(16,1); 					// program number
+		pat_bit.Write(3,	7);  					// reserved
+		pat_bit.Write(13,TS_DEFAULT_PMT_PID);	// program_map_PID
+
+		MakePsiPacket(0, pat_bit.GetData(), (uint32_t)pat_bit.GetDataSize(), packet.data());
+
+		return packet;
+	}();
+
+	return pat_packet.data();
+}
 
-	crc = MakeCrc(pmt_bit.GetData() + 1, (uint32_t)pmt_bit.GetDataSize() - 1); // table_id~end
+//====================================================================================================
+// PMT(Program Map Table) 패킷
+// -프로그램의 Elementary Stream을 담은 패킷에 대한 연결 정보를 담고 있다.
+// - Stream Type(Common/VideoOnly/AudioOnly) 별로 최초 1회만 생성
+//====================================================================================================
+const uint8_t *TsWriter::GetPmtPacket(PacketyzerStreamType stream_type)
+{
+	static const std::array<std::array<uint8_t, TS_PACKET_SIZE>, 3> pmt_packets = []()
+	{
+		std::array<std::array<uint8_t, TS_PACKET_SIZE>, 3> packets;
 
-	//CRC(4Byte)
-	BitWriter crc_bit(TS_CRC_SIZE);
-	crc_bit.Write(32, crc);
-	WriteDataStream((int)crc_bit.GetDataSize(), crc_bit.GetData());
+		for(auto type : { PacketyzerStreamType::Common, PacketyzerStreamType::VideoOnly, PacketyzerStreamType::AudioOnly })
+		{
+			uint32_t section_size 	= 13;
+			uint32_t pid			= 0;
+
+			if(type == PacketyzerStreamType::Common || type == PacketyzerStreamType::AudioOnly)
+			{
+				section_size += 5;
+				pid = TS_DEFAULT_AUDIO_PID;
+			}
+
+			if(type == PacketyzerStreamType::Common || type == PacketyzerStreamType::VideoOnly)
+			{
+				section_size += 5;
+				pid = TS_DEFAULT_VIDEO_PID;
+			}
+
+			BitWriter pmt_bit(section_size);
+
+			pmt_bit.Write(8,		0);        			// pointer
+			pmt_bit.Write(8,		2);        			// table_id
+			pmt_bit.Write(1,		1);        			// section_syntax_indicator
+			pmt_bit.Write(1,		0);        			// '0'
+			pmt_bit.Write(2,		3);        			// reserved
+			pmt_bit.Write(12,	section_size); 	// section_length
+			pmt_bit.Write(16,	1);       			// program_number
+			pmt_bit.Write(2,		3);        			// reserved
+			pmt_bit.Write(5,		0);        			// version_number
+			pmt_bit.Write(1,		1);        			// current_next_indicator
+			pmt_bit.Write(8,		0);        			// section_number
+			pmt_bit.Write(8,		0);        			// last_section_number
+			pmt_bit.Write(3,		7);        			// reserved
+			pmt_bit.Write(13,	pid); 				// PCD_PID
+			pmt_bit.Write(4,		0xF);      			// reserved
+			pmt_bit.Write(12,	0);      			// program_info_length
+
+			if(type == PacketyzerStreamType::Common || type == PacketyzerStreamType::VideoOnly)
+			{
+				pmt_bit.Write(8,		TS_STREAM_TYPE_AVC); 			// stream_type
+				pmt_bit.Write(3,		0x7);                   		// reserved
+				pmt_bit.Write(13,	TS_DEFAULT_VIDEO_PID);    		// elementary_PID
+				pmt_bit.Write(4,		0xF);                   		// reserved
+				pmt_bit.Write(12,	0);                    			// ES_info_length
+			}
+
+			if(type == PacketyzerStreamType::Common || type == PacketyzerStreamType::AudioOnly)
+			{
+				pmt_bit.Write(8, 	TS_STREAM_TYPE_ISO_IEC_13818_7);// stream_type
+				pmt_bit.Write(3,		0x7);                   		// reserved
+				pmt_bit.Write(13,	TS_DEFAULT_AUDIO_PID);    		// elementary_PID
+				pmt_bit.Write(4,		0xF);                   		// reserved
+				pmt_bit.Write(12,	0);                    			// ES_info_length
+			}
+
+			MakePsiPacket(TS_DEFAULT_PMT_PID, pmt_bit.GetData(), (uint32_t)pmt_bit.GetDataSize(), packets[(int)type].data());
+		}
 
-	//Stuffing Bytes
-	WriteDataStream(TS_PACKET_PAYLOAD_SIZE - (section_size + TS_CRC_SIZE), HLS_STUFFING_BYTES);
+		return packets;
+	}();
 
-	return true;
+	return pmt_packets[(int)stream_type].data();
 }
 
 //====================================================================================================
@@ -275,66 +305,72 @@ bool TsWriter::WritePMT()
 //    Header(9Byte) + PTS(5Byte) + [DTS(5Byte)] 
 // - TS 헤더 추가 
 //====================================================================================================
-bool TsWriter::WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, std::shared_ptr<std::vector<uint8_t>> &data)
+bool TsWriter::WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, const std::shared_ptr<std::vector<uint8_t>> &data)
+{
+	return WriteSample(is_video, is_keyframe, timestamp, time_offset, data->data(), data->size());
+}
+
+//====================================================================================================
+// Sample 추가 
+// - 필요한 TS 패킷 개수만큼 버퍼를 한번에 늘리고 패킷을 직접 채움
+// - 첫 패킷 : TS Header + Adaptation(PCR) + PES Header + [AUD] + Frame 데이터
+// - 이후 패킷 : TS Header + [Adaptation(Stuffing)] + Frame 데이터
+//====================================================================================================
+bool TsWriter::WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, const uint8_t *data, size_t data_size)
 {
-	uint8_t		pes_header[PES_HEADER_WIDTH_DTS_SIZE]	= {0, }; 
-	uint32_t	pes_header_size							= 0; 
-	uint32_t	rest_data_size							= 0;
-	uint32_t	payload_size 							= 0; 
-	uint8_t		*data_pos								= nullptr;
-	bool 		first_payload 							= true; 
-	
-
-	//Video(H264) - access unit delimiter(AUD) 정보 추가
+	uint8_t		pes_header[PES_HEADER_WIDTH_DTS_SIZE + H264_AUD_SIZE];
+	uint32_t	pes_header_size		= 0;
+	int			pid					= is_video ? TS_DEFAULT_VIDEO_PID : TS_DEFAULT_AUDIO_PID;
+	uint32_t	&continuity_count	= is_video ? _video_continuity_count : _audio_continuity_count;
+	bool		use_pcr				= is_video || (_stream_type == PacketyzerStreamType::AudioOnly);
+
+	// PES Header 생성 
+	pes_header_size = MakePesHeader(is_video, (uint32_t)data_size, timestamp, time_offset, pes_header);
+
+	//Video(H264) - access unit delimiter(AUD) 정보 추가(Frame 데이터 앞에 먼저 기록)
 	if(is_video)
 	{
-		data->insert(data->begin(), g_aud, g_aud + H264_AUD_SIZE);
+		memcpy(pes_header + pes_header_size, g_aud, H264_AUD_SIZE);
+		pes_header_size += H264_AUD_SIZE;
 	}
-	data_pos = data->data(); 
 
-	// PES Header 생성 
-	MakePesHeader(data->size(), is_video, timestamp, time_offset, pes_header, pes_header_size);
-	
-	// TS Header + Payload 설정 
-	rest_data_size = pes_header_size + data->size();
-			
-	// Buffer 공간 체크 
-	// (Payload 개수 + 2)*  TS_PACKET_SIZE
-	
+	// 패킷 개수 계산
+	size_t		rest_data_size		= pes_header_size + data_size;
+	uint32_t	first_payload_size	= TS_PACKET_PAYLOAD_SIZE - (use_pcr ? (2 + TS_PCR_ADAPTATION_SIZE) : 0);
+	size_t		packet_count		= 1;
+
+	if(rest_data_size > first_payload_size)
+	{
+		packet_count += (rest_data_size - first_payload_size + TS_PACKET_PAYLOAD_SIZE - 1) / TS_PACKET_PAYLOAD_SIZE;
+	}
+
+	size_t data_stream_size = _data_stream->size();
+	_data_stream->resize(data_stream_size + packet_count * TS_PACKET_SIZE);
+
+	uint8_t *packet = _data_stream->data() + data_stream_size;
+
+	// 첫 패킷
+	uint32_t payload_size = (uint32_t)std::min<size_t>(rest_data_size, first_payload_size);
+	uint8_t *payload = WriteTsHeader(packet, pid, continuity_count++, true, payload_size, use_pcr, timestamp * 300, is_keyframe);
+
+	memcpy(payload, pes_header, pes_header_size);
+	memcpy(payload + pes_header_size, data, payload_size - pes_header_size);
+
+	data += payload_size - pes_header_size;
+	rest_data_size -= payload_size;
+
+	// 이후 패킷
 	while(rest_data_size > 0)
 	{
-		payload_size = rest_data_size;
+		packet += TS_PACKET_SIZE;
+		payload_size = (uint32_t)std::min<size_t>(rest_data_size, TS_PACKET_PAYLOAD_SIZE);
+		payload = WriteTsHeader(packet, pid, continuity_count++, false, payload_size, false, 0, is_keyframe);
 
-		if(payload_size > TS_PACKET_PAYLOAD_SIZE)
-		{
-			payload_size = TS_PACKET_PAYLOAD_SIZE;
-		}
-		
-		if(first_payload)
-		{
-			first_payload = false;
-	
-			// TS Header 설정 
-			if(is_video)	MakeTsHeader(TS_DEFAULT_VIDEO_PID, _video_continuity_count++, true, payload_size, true, timestamp*300, is_keyframe);
-			else 			MakeTsHeader(TS_DEFAULT_AUDIO_PID, _audio_continuity_count++, true, payload_size, _stream_type == PacketyzerStreamType::AudioOnly, timestamp*300, is_keyframe);
-						
-			// PES헤더 설정 
-			WriteDataStream(pes_header_size, pes_header); 
-			rest_data_size -= pes_header_size;
-			payload_size -= pes_header_size; 
-		}
-		else
-		{
-			// TS Header 설정 
-			if(is_video)	MakeTsHeader(TS_DEFAULT_VIDEO_PID, _video_continuity_count++, false, payload_size, false, 0, is_keyframe);
-			else 			MakeTsHeader(TS_DEFAULT_AUDIO_PID, _audio_continuity_count++, false, payload_size, false, 0, is_keyframe);
-		}
+		memcpy(payload, data, payload_size);
 
-		// Data 설정
-		WriteDataStream(payload_size, data_pos);
-		data_pos += payload_size;
+		data += payload_size;
 		rest_data_size -= payload_size;
-	};
+	}
 
 	return true; 
 }
@@ -345,147 +381,78 @@ bool TsWriter::WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp,
 // - PTS : Presentation Time Stamp 
 // - DTS : Deciding Time Stamp
 // - header 는 최대치인 PES_HEADER_WIDTH_DTS_SIZE로 전달 
+// - 고정 부분 복사 후 PES_packet_length/PTS/DTS 만 기록
+// - return : header size
 //====================================================================================================
-bool TsWriter::MakePesHeader(int data_size, bool is_video, uint64_t timestamp, uint64_t time_offset, uint8_t * header, uint32_t & header_size)
+uint32_t TsWriter::MakePesHeader(bool is_video, uint32_t data_size, uint64_t timestamp, uint64_t time_offset, uint8_t *header)
 {
-	uint32_t	stream_id 		= 0;
-	uint32_t	pes_packet_size = 0;
-	bool		is_dts			= false; 
-	uint64_t	pts				= 0; 
-	uint64_t	dts				= 0;
-
 	// DTS
-	dts = timestamp;
+	uint64_t dts = timestamp;
 
 	// PTS
-	pts = timestamp + time_offset;
-	
+	uint64_t pts = timestamp + time_offset;
+
 	if(is_video)
 	{
-		stream_id 			= TS_DEFAULT_VIDEO_STREAM_ID; 
-		is_dts				= true;
-		header_size			= PES_HEADER_WIDTH_DTS_SIZE;
-		pes_packet_size 	= 0; //Video 0(초과) 으로 설정 Client 문제시 16bit 한도에서 분활 하여 패킷 정송 고려 
-		
-	}
-	else 
-	{
-		stream_id 			= TS_DEFAULT_AUDIO_STREAM_ID; 
-		is_dts				= false;
-		header_size			= PES_HEADER_SIZE;
-		pes_packet_size 	= data_size + header_size - 6;
-	}
+		// PES_packet_length : Video 0(초과) 으로 설정 Client 문제시 16bit 한도에서 분활 하여 패킷 정송 고려 
+		memcpy(header, g_video_pes_header, sizeof(g_video_pes_header));
 
-	//PES Header 설정 
-	BitWriter pes_bit(header_size); 
-	pes_bit.Write(24, 	0x000001);    				// packet_start_code_prefix
-	pes_bit.Write(8, 	stream_id);   				// stream_id
-	pes_bit.Write(16, 	pes_packet_size); 			// PES_packet_length
-	pes_bit.Write(2, 	2);           				// '01'
-	pes_bit.Write(2, 	0);            				// PES_scrambling_control
-	pes_bit.Write(1, 	0);            				// PES_priority
-	pes_bit.Write(1, 	1);            				// data_alignment_indicator
-	pes_bit.Write(1, 	0);            				// copyright
-	pes_bit.Write(1, 	0);            				// original_or_copy
-	pes_bit.Write(2, 	is_dts ? 3:2); 		// PTS_DTS_flags
-	pes_bit.Write(1, 	0);            				// ESCR_flag
-	pes_bit.Write(1, 	0);           	 			// ES_rate_flag
-	pes_bit.Write(1, 	0);            				// DSM_trick_mode_flag
-	pes_bit.Write(1, 	0);            				// additional_copy_info_flag
-	pes_bit.Write(1, 	0);            				// PES_CRC_flag
-	pes_bit.Write(1, 	0);            				// PES_extension_flag
-	pes_bit.Write(8, 	header_size - 9);			// PES_header_data_length
-
-	//PTS  
-	pes_bit.Write(4, 	is_dts ? 3:2);		// '0010'(PTS) or '0011'(PTS+DTS)
-	pes_bit.Write(3, 	(uint32_t)(pts >>30));  		// PTS[32..30]
-	pes_bit.Write(1, 	1);                   	 	// marker_bit
-	pes_bit.Write(15, 	(uint32_t)(pts >>15)); 		// PTS[29..15]
-	pes_bit.Write(1, 	1);                    		// marker_bit
-	pes_bit.Write(15, 	(uint32_t)pts);       		// PTS[14..0]
-	pes_bit.Write(1, 	1);                    		// market_bit
-
-	//DTS	
-	if(is_dts)
-	{
-		pes_bit.Write(4, 	1);                    	// '0001'
-		pes_bit.Write(3, 	(uint32_t)(dts >>30));  	// DTS[32..30]
-		pes_bit.Write(1, 	1);                    	// marker_bit
-		pes_bit.Write(15, 	(uint32_t)(dts >>15)); 	// DTS[29..15]
-		pes_bit.Write(1, 	1);                    	// marker_bit
-		pes_bit.Write(15, 	(uint32_t)dts);      	// DTS[14..0]
-		pes_bit.Write(1, 	1);                    	// market_bit
+		WritePesTimestamp(header + 9, 3, pts);		// '0011'(PTS+DTS)
+		WritePesTimestamp(header + 14, 1, dts);		// '0001'
+
+		return PES_HEADER_WIDTH_DTS_SIZE;
 	}
 
-	memcpy(header, pes_bit.GetData(), pes_bit.GetDataSize());
-	
-	return true;
+	uint32_t pes_packet_size = data_size + PES_HEADER_SIZE - 6;
+
+	memcpy(header, g_audio_pes_header, sizeof(g_audio_pes_header));
+
+	header[4] = (uint8_t)(pes_packet_size >> 8);
+	header[5] = (uint8_t)pes_packet_size;
+
+	WritePesTimestamp(header + 9, 2, pts);			// '0010'(PTS)
+
+	return PES_HEADER_SIZE;
 }
 
 //====================================================================================================
-// TS Header 설정 
+// TS Header 쓰기
 // - PCR : Program Clock Reference
 // - Adaptation field control : Playload의 위치가 확인 
 // - Continuity counter : 0~15 순환되며  각각 패킷에 부여 
+// - payload_size 는 PCR 사용시 TS_PACKET_PAYLOAD_SIZE - 8 이하
+// - 남는 공간은 Adaptation field 의 Stuffing 으로 채움
+// - return : Payload 시작 위치
 //====================================================================================================
-bool TsWriter::MakeTsHeader(int pid, uint32_t continuity_count, bool payload_start, uint32_t & payload_size, bool use_pcr, uint64_t pcr, bool is_keyframe)
+uint8_t *TsWriter::WriteTsHeader(uint8_t *packet, int pid, uint32_t continuity_count, bool payload_start, uint32_t payload_size, bool use_pcr, uint64_t pcr, bool is_keyframe)
 {
-	uint8_t		header[TS_HEADER_SIZE] 					= {0,};
-	uint8_t		adaptation_data[TS_PCR_ADAPTATION_SIZE] = {0,};
-	uint32_t	adaptation_field_size 					= 0;
-	uint32_t	pcr_size 								= 0;
+	uint32_t adaptation_field_size = TS_PACKET_PAYLOAD_SIZE - payload_size;
 
-	header[0] = TS_SYNC_BYTE;
-	header[1] = (uint8_t)(((payload_start ? 1 : 0)<<6) | (pid >> 8));
-	header[2] = (uint8_t)(pid & 0xFF);
-
-	if(use_pcr)
-	{
-		adaptation_field_size +=  (2 + TS_PCR_ADAPTATION_SIZE);
-	}
-	
-	// clamp the Payload size
-	if(payload_size + adaptation_field_size > TS_PACKET_PAYLOAD_SIZE)
-	{
-		payload_size = TS_PACKET_PAYLOAD_SIZE - adaptation_field_size;
-	}
-
-	// adjust the adaptation field to include stuffing if necessary
-	if(adaptation_field_size + payload_size < TS_PACKET_PAYLOAD_SIZE)
-	{
-		adaptation_field_size = TS_PACKET_PAYLOAD_SIZE - payload_size;
-	}
+	packet[0] = TS_SYNC_BYTE;
+	packet[1] = (uint8_t)(((payload_start ? 1 : 0)<<6) | (pid >> 8));
+	packet[2] = (uint8_t)(pid & 0xFF);
 
 	// no adaptation field
 	if(adaptation_field_size == 0)
 	{
-		header[3] = (uint8_t)(1<<4 | (continuity_count & 0x0F));
+		packet[3] = (uint8_t)(1<<4 | (continuity_count & 0x0F));
 
-		//Segment 데이터 설정 
-		WriteDataStream(4, header); 
-		
-		return true; 
-  
+		return packet + TS_HEADER_SIZE;
 	}
-	
+
 	// adaptation field present
-	header[3] = (uint8_t)(3<<4 | (continuity_count & 0x0F));
-	
-	//Segment 데이터 설정 
-	WriteDataStream(4, header); 
+	packet[3] = (uint8_t)(3<<4 | (continuity_count & 0x0F));
 
-	
-	if(adaptation_field_size == 1) 
+	if(adaptation_field_size == 1)
 	{
-		adaptation_data[0] = 0; 
-
-		//Segment 데이터 설정 
-		WriteDataStream(1, adaptation_data); 
+		packet[4] = 0;
 
-		return true; 		
-	} 
+		return packet + TS_HEADER_SIZE + 1;
+	}
 
 	// two or more bytes (stuffing and/or PCR)
+	uint8_t *adaptation_data = packet + TS_HEADER_SIZE;
+
 	adaptation_data[0] = (uint8_t)(adaptation_field_size - 1);
 	adaptation_data[1] = (uint8_t)(use_pcr ? 1<<4 : 0);
 
@@ -493,34 +460,27 @@ bool TsWriter::MakeTsHeader(int pid, uint32_t continuity_count, bool payload_sta
 	{	
 		adaptation_data[1] =  (uint8_t)(adaptation_data[1] | 1<<6);
 	}
-	
-	//Segment 데이터 설정 
-	WriteDataStream(2, adaptation_data); 
+
+	uint32_t pcr_size = 0;
 
 	if(use_pcr)
 	{
-		BitWriter 	pcr_bit(TS_PCR_ADAPTATION_SIZE); 
+		// base(33) + reserved(6) + extension(9)
 		uint64_t	pcr_base = pcr/300;
 		uint32_t 	pcr_ext  = (uint32_t)(pcr%300);
-		
-		pcr_bit.Write(1, 	(uint32_t)(pcr_base>>32));
-		pcr_bit.Write(32, 	(uint32_t)pcr_base);
-		pcr_bit.Write(6, 	0x3F);
-		pcr_bit.Write(9, 	pcr_ext);
-			
-		//Segment 데이터 설정 
-		WriteDataStream((int)pcr_bit.GetDataSize(), pcr_bit.GetData());
-
-		//PCR 사이즈 저장 
-		pcr_size = TS_PCR_ADAPTATION_SIZE; 
-	}
 
-	//Stuffing Bytes 	
-	if (adaptation_field_size > 2) 
-	{
-		
-		WriteDataStream(adaptation_field_size - pcr_size - 2, HLS_STUFFING_BYTES); 
+		adaptation_data[2] = (uint8_t)(pcr_base >> 25);
+		adaptation_data[3] = (uint8_t)(pcr_base >> 17);
+		adaptation_data[4] = (uint8_t)(pcr_base >> 9);
+		adaptation_data[5] = (uint8_t)(pcr_base >> 1);
+		adaptation_data[6] = (uint8_t)(((pcr_base & 0x01) << 7) | 0x7E | ((pcr_ext >> 8) & 0x01));
+		adaptation_data[7] = (uint8_t)pcr_ext;
+
+		pcr_size = TS_PCR_ADAPTATION_SIZE;
 	}
-   
-	return true;
-} 
+
+	//Stuffing Bytes
+	memset(adaptation_data + 2 + pcr_size, 0xFF, adaptation_field_size - pcr_size - 2);
+
+	return packet + TS_HEADER_SIZE + adaptation_field_size;
+}
@@ -11,30 +11,47 @@
 #include "packetyzer.h"
 #include "bit_writer.h"
 
+// Segment 버퍼 초기 크기(PAT + PMT 포함)
+#define TS_WRITER_DEFAULT_DATA_SIZE		(4096)
+
 //====================================================================================================
 // TsWriter
+// - PAT/PMT 패킷은 Stream Type 별로 한번만 생성
+// - PAT/PMT 는 Segment 시작에 기록, 이후 WritePsi 로 추가 기록 가능(Low Latency 독립 Part)
+// - Sample 당 필요한 TS 패킷 개수를 미리 계산하여 버퍼를 한번에 늘리고 188Byte 패킷을 직접 채움
+// - 입력 Frame 데이터는 수정하지 않음(AUD 는 PES 헤더 뒤에 먼저 기록)
 //====================================================================================================
 class TsWriter
 {
 public:
-	TsWriter(PacketyzerStreamType stream_type);
+	TsWriter(PacketyzerStreamType stream_type, size_t data_init_size = TS_WRITER_DEFAULT_DATA_SIZE);
 	virtual ~TsWriter() = default;
 	
 public :
-	bool				WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, std::shared_ptr<std::vector<uint8_t>> &data);
+	bool				WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, const std::shared_ptr<std::vector<uint8_t>> &data);
+	bool				WriteSample(bool is_video, bool is_keyframe, uint64_t timestamp, uint64_t time_offset, const uint8_t *data, size_t data_size);
 	std::shared_ptr<std::vector<uint8_t>>& GetDataStream(){ return _data_stream; };
 
+	// PAT/PMT 기록(Continuity Counter 증가)
+	// - Part 중간부터 재생하는 Player 가 Demux 할 수 있도록 독립 Part 시작에 기록
+	void				WritePsi();
+
+	// Frame 데이터 크기 합으로 Segment 크기 예측(버퍼 예약용)
+	static size_t		EstimateDataSize(size_t frame_count, size_t frame_data_size);
+
 protected : 	
 	static uint32_t	MakeCrc(const uint8_t * data, uint32_t data_size);
-	bool				WritePAT();
-	bool				WritePMT();
-	bool				MakePesHeader(int data_size, bool is_video, uint64_t timestamp, uint64_t time_offset, uint8_t * header, uint32_t & header_size);
-	bool				MakeTsHeader(int pid, uint32_t continuity_count, bool payload_start, uint32_t & payload_size, bool use_pcr, uint64_t pcr, bool is_keyframe);
-	bool				WriteDataStream(int data_size, const uint8_t * dat);
+	static const uint8_t *GetPatPacket();
+	static const uint8_t *GetPmtPacket(PacketyzerStreamType stream_type);
+	static void			MakePsiPacket(int pid, const uint8_t *section, uint32_t section_size, uint8_t *packet);
+	static uint32_t		MakePesHeader(bool is_video, uint32_t data_size, uint64_t timestamp, uint64_t time_offset, uint8_t *header);
+	static uint8_t *	WriteTsHeader(uint8_t *packet, int pid, uint32_t continuity_count, bool payload_start, uint32_t payload_size, bool use_pcr, uint64_t pcr, bool is_keyframe);
 
 protected : 
 	PacketyzerStreamType					_stream_type;
 	std::shared_ptr<std::vector<uint8_t>>   _data_stream;
 	uint32_t 				                _audio_continuity_count;
 	uint32_t 				                _video_continuity_count;
-};
\ No newline at end of file
+	uint32_t 				                _pat_continuity_count;
+	uint32_t 				                _pmt_continuity_count;
+};
@@ -99,6 +99,8 @@ SegmentStream::SegmentStream(const std::shared_ptr<Application> application, con
             {
                 dash_segment_config_info._count = dynamic_cast<const cfg::DashPublisher *>(publisher_info)->GetSegmentCount();
                 dash_segment_config_info._duration = dynamic_cast<const cfg::DashPublisher *>(publisher_info)->GetSegmentDuration();
+                dash_segment_config_info._dvr_window = dynamic_cast<const cfg::DashPublisher *>(publisher_info)->GetDvrWindow();
+                dash_segment_config_info._dvr_path = dynamic_cast<const cfg::DashPublisher *>(publisher_info)->GetDvrPath().CStr();
 
                 if (dash_segment_config_info._count <= 0)
                     dash_segment_config_info._count = DEFAULT_SEGMENT_COUNT;
@@ -106,20 +108,51 @@ SegmentStream::SegmentStream(const std::shared_ptr<Application> application, con
                 if (dash_segment_config_info._duration <= 0)
                     dash_segment_config_info._duration = DEFAULT_SEGMENT_DURATION;
 
+                // Low Latency(Chunk Duration 은 Segment Duration 보다 작아야 함)
+                if (dynamic_cast<const cfg::DashPublisher *>(publisher_info)->IsLowLatency())
+                {
+                    dash_segment_config_info._chunk_duration = dynamic_cast<const cfg::DashPublisher *>(publisher_info)->GetChunkDuration();
+
+                    if (dash_segment_config_info._chunk_duration <= 0 ||
+                        dash_segment_config_info._chunk_duration >= dash_segment_config_info._duration * 1000)
+                        dash_segment_config_info._chunk_duration = std::min(DEFAULT_CHUNK_DURATION, dash_segment_config_info._duration * 1000 / 2);
+                }
+
             }
             else if (cfg::PublisherType::Hls == publisher_info->GetType())
             {
                 hls_segment_config_info._count = dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->GetSegmentCount();
                 hls_segment_config_info._duration = dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->GetSegmentDuration();
+                hls_segment_config_info._dvr_window = dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->GetDvrWindow();
+                hls_segment_config_info._dvr_path = dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->GetDvrPath().CStr();
 
                 if (hls_segment_config_info._count <= 0)
                     hls_segment_config_info._count = DEFAULT_SEGMENT_COUNT;
 
                 if (hls_segment_config_info._duration <= 0)
                     hls_segment_config_info._duration = DEFAULT_SEGMENT_DURATION;
+
+                // Low Latency(Chunk Duration 은 Segment Duration 보다 작아야 함)
+                if (dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->IsLowLatency())
+                {
+                    hls_segment_config_info._chunk_duration = dynamic_cast<const cfg::HlsPublisher *>(publisher_info)->GetChunkDuration();
+
+                    if (hls_segment_config_info._chunk_duration <= 0 ||
+                        hls_segment_config_info._chunk_duration >= hls_segment_config_info._duration * 1000)
+                        hls_segment_config_info._chunk_duration = std::min(DEFAULT_CHUNK_DURATION, hls_segment_config_info._duration * 1000 / 2);
+                }
             }
         }
 
+        // Publisher 의 Segment 보관 Arena(메모리 예산)
+        auto segment_application = std::dynamic_pointer_cast<SegmentStreamApplication>(application);
+
+        if (segment_application != nullptr)
+        {
+            dash_segment_config_info._arena = segment_application->GetDashSegmentArena();
+            hls_segment_config_info._arena = segment_application->GetHlsSegmentArena();
+        }
+
         _stream_packetyzer = std::make_unique<StreamPacketyzer>(dash_segment_config_info,
                                                                 hls_segment_config_info,
                                                                 prefix,
@@ -155,6 +188,22 @@ bool SegmentStream::Stop()
     return Stream::Stop();
 }
 
+//====================================================================================================
+// Frame 데이터
+// - MediaRouter 의 데이터를 복사하지 않고 참조(Packetyzer 에서 수정하지 않음)
+//====================================================================================================
+static std::shared_ptr<const ov::Data> GetFrameData(const std::unique_ptr<EncodedFrame> &encoded_frame)
+{
+    std::shared_ptr<const ov::Data> data = encoded_frame->_buffer;
+
+    if (data != nullptr && encoded_frame->_length < data->GetLength())
+    {
+        return data->Subdata(0, encoded_frame->_length);
+    }
+
+    return data;
+}
+
 //====================================================================================================
 // SendVideoFrame
 // - Packetyzer에 Video데이터 추가
@@ -174,8 +223,7 @@ void SegmentStream::SendVideoFrame(std::shared_ptr<MediaTrack> track,
                                             track->GetTimeBase().GetDen(),
                                             encoded_frame->_frame_type == FrameType::VideoFrameKey,
                                             0,
-                                            encoded_frame->_length,
-                                            encoded_frame->_buffer->GetDataAs<uint8_t>());
+                                            GetFrameData(encoded_frame));
 
         if (encoded_frame->_frame_type == FrameType::VideoFrameKey)
         {
@@ -226,8 +274,7 @@ void SegmentStream::SendAudioFrame(std::shared_ptr<MediaTrack> track,
     {
         _stream_packetyzer->AppendAudioData(encoded_frame->_time_stamp,
                                             track->GetTimeBase().GetDen(),
-                                            encoded_frame->_length,
-                                            encoded_frame->_buffer->GetDataAs<uint8_t>());
+                                            GetFrameData(encoded_frame));
 
         _last_audio_timestamp = encoded_frame->_time_stamp/(track->GetTimeBase().GetDen()/1000);
         _audio_frame_count++;
@@ -238,11 +285,29 @@ void SegmentStream::SendAudioFrame(std::shared_ptr<MediaTrack> track,
 // GetPlayList
 // - M3U8/MPD
 //====================================================================================================
-bool SegmentStream::GetPlayList(PlayListType play_list_type, ov::String &play_list)
+bool SegmentStream::GetPlayList(PlayListType play_list_type, ov::String &play_list, SegmentCacheInfo &cache_info)
 {
     if (_stream_packetyzer != nullptr)
     {
-        return _stream_packetyzer->GetPlayList(play_list_type, play_list);
+        return _stream_packetyzer->GetPlayList(play_list_type, play_list, cache_info);
+    }
+
+    return false;
+}
+
+//====================================================================================================
+// WaitPlayList
+// - Blocking PlayList Reload(LL-HLS)
+//====================================================================================================
+bool SegmentStream::WaitPlayList(PlayListType play_list_type,
+                                 int64_t media_sequence,
+                                 int64_t part_index,
+                                 PlayListWaitResult &wait_result)
+{
+    if (_stream_packetyzer != nullptr)
+    {
+        wait_result = _stream_packetyzer->WaitPlayList(play_list_type, media_sequence, part_index);
+        return true;
     }
 
     return false;
@@ -252,11 +317,29 @@ bool SegmentStream::GetPlayList(PlayListType play_list_type, ov::String &play_li
 // GetSegment
 // - TS/M4S(mp4)
 //====================================================================================================
-bool SegmentStream::GetSegment(SegmentType type, const ov::String &file_name, std::shared_ptr<ov::Data> &data)
+bool SegmentStream::GetSegment(SegmentType type,
+                               const ov::String &file_name,
+                               std::shared_ptr<const ov::Data> &data,
+                               SegmentCacheInfo &cache_info)
+{
+    if (_stream_packetyzer != nullptr)
+    {
+        return _stream_packetyzer->GetSegment(type, file_name, data, cache_info);
+    }
+
+    return false;
+}
+
+//====================================================================================================
+// GetChunkedSegment
+// - 생성 중인 TS/M4S(Low Latency)
+//====================================================================================================
+bool SegmentStream::GetChunkedSegment(SegmentType type, const ov::String &file_name,
+                                      std::shared_ptr<ChunkedSegment> &segment, int &part_index)
 {
     if (_stream_packetyzer != nullptr)
     {
-        return _stream_packetyzer->GetSegment(type, file_name, data);
+        return _stream_packetyzer->GetChunkedSegment(type, file_name, segment, part_index);
     }
 
     return false;
@@ -41,9 +41,17 @@ public :
 
     bool Stop() override;
 
-    bool GetPlayList(PlayListType play_list_type, ov::String &play_list);
+    bool GetPlayList(PlayListType play_list_type, ov::String &play_list, SegmentCacheInfo &cache_info);
 
-    bool GetSegment(SegmentType type, const ov::String &file_name, std::shared_ptr<ov::Data> &data);
+    bool WaitPlayList(PlayListType play_list_type, int64_t media_sequence, int64_t part_index,
+                      PlayListWaitResult &wait_result);
+
+    bool GetSegment(SegmentType type,
+                    const ov::String &file_name,
+                    std::shared_ptr<const ov::Data> &data,
+                    SegmentCacheInfo &cache_info);
+
+    bool GetChunkedSegment(SegmentType type, const ov::String &file_name, std::shared_ptr<ChunkedSegment> &segment, int &part_index);
 
 private :
     std::unique_ptr<StreamPacketyzer> _stream_packetyzer;
@@ -14,9 +14,11 @@
 //====================================================================================================
 // Create
 //====================================================================================================
-std::shared_ptr<SegmentStreamApplication> SegmentStreamApplication::Create(const info::Application &application_info)
+std::shared_ptr<SegmentStreamApplication> SegmentStreamApplication::Create(const info::Application &application_info,
+																		   const std::shared_ptr<SegmentArena> &dash_segment_arena,
+																		   const std::shared_ptr<SegmentArena> &hls_segment_arena)
 {
-	auto application = std::make_shared<SegmentStreamApplication>(application_info);
+	auto application = std::make_shared<SegmentStreamApplication>(application_info, dash_segment_arena, hls_segment_arena);
 	application->Start();
 	return application;
 }
@@ -24,9 +26,12 @@ std::shared_ptr<SegmentStreamApplication> SegmentStreamApplication::Create(const
 //====================================================================================================
 // SegmentStreamApplication
 //====================================================================================================
-SegmentStreamApplication::SegmentStreamApplication(const info::Application &application_info) : Application(application_info)
+SegmentStreamApplication::SegmentStreamApplication(const info::Application &application_info,
+												   const std::shared_ptr<SegmentArena> &dash_segment_arena,
+												   const std::shared_ptr<SegmentArena> &hls_segment_arena) : Application(application_info)
 {
-
+	_dash_segment_arena = dash_segment_arena;
+	_hls_segment_arena = hls_segment_arena;
 }
 
 //====================================================================================================
@@ -18,10 +18,25 @@
 class SegmentStreamApplication : public Application
 {
 public:
-	static std::shared_ptr<SegmentStreamApplication> Create(const info::Application &application_info);
-	SegmentStreamApplication(const info::Application &application_info);
+	static std::shared_ptr<SegmentStreamApplication> Create(const info::Application &application_info,
+															const std::shared_ptr<SegmentArena> &dash_segment_arena,
+															const std::shared_ptr<SegmentArena> &hls_segment_arena);
+	SegmentStreamApplication(const info::Application &application_info,
+							 const std::shared_ptr<SegmentArena> &dash_segment_arena,
+							 const std::shared_ptr<SegmentArena> &hls_segment_arena);
 	virtual ~SegmentStreamApplication() final;
 
+	// Publisher 의 Segment 보관 Arena(전체 Stream 공유)
+	const std::shared_ptr<SegmentArena> &GetDashSegmentArena() const
+	{
+		return _dash_segment_arena;
+	}
+
+	const std::shared_ptr<SegmentArena> &GetHlsSegmentArena() const
+	{
+		return _hls_segment_arena;
+	}
+
 private:
 	bool Start() override;
 	bool Stop() override;
@@ -31,5 +46,6 @@ private:
 	bool DeleteStream(std::shared_ptr<StreamInfo> info) override;
 
 private :
-
+	std::shared_ptr<SegmentArena> _dash_segment_arena;
+	std::shared_ptr<SegmentArena> _hls_segment_arena;
 };
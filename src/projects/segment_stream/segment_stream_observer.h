@@ -21,9 +21,23 @@ public:
     // PlayList 요청
     virtual bool
     OnPlayListRequest(const ov::String &app_name, const ov::String &stream_name, const ov::String &file_name,
-                      PlayListType play_list_type, ov::String &play_list) = 0;
+                      PlayListType play_list_type, ov::String &play_list, SegmentCacheInfo &cache_info) = 0;
+
+    // Blocking PlayList Reload 요청(LL-HLS _HLS_msn/_HLS_part)
+    // - part_index : -1(Segment 완료 대기) or Partial Segment index
+    virtual bool OnPlayListWaitRequest(const ov::String &app_name, const ov::String &stream_name,
+                                       const ov::String &file_name, PlayListType play_list_type,
+                                       int64_t media_sequence, int64_t part_index,
+                                       PlayListWaitResult &wait_result) = 0;
 
     // Segment 요청
     virtual bool OnSegmentRequest(const ov::String &app_name, const ov::String &stream_name, SegmentType segment_type,
-                                  const ov::String &file_name, std::shared_ptr<ov::Data> &segment_data) = 0;
+                                  const ov::String &file_name, std::shared_ptr<const ov::Data> &segment_data,
+                                  SegmentCacheInfo &cache_info) = 0;
+
+    // 생성 중인 Segment/Partial Segment 요청(Low Latency)
+    // - part_index : -1(Segment 전체) or Partial Segment index
+    virtual bool OnChunkedSegmentRequest(const ov::String &app_name, const ov::String &stream_name, SegmentType segment_type,
+                                         const ov::String &file_name, std::shared_ptr<ChunkedSegment> &segment,
+                                         int &part_index) = 0;
 };
@@ -73,6 +73,13 @@ bool SegmentStreamPublisher::Start()
 
     _publisher_type = publisher_type;
 
+    // Segment 보관 Arena(MemoryBudget : MB)
+    _dash_segment_arena = std::make_shared<SegmentArena>("DASH", (size_t) std::max(dash_publisher_info->GetMemoryBudget(), 0) * 1024 * 1024);
+    _hls_segment_arena = std::make_shared<SegmentArena>("HLS", (size_t) std::max(hls_publisher_info->GetMemoryBudget(), 0) * 1024 * 1024);
+
+    logti("Segment memory budget - DASH(%dMB) HLS(%dMB) (0 : unlimited)",
+          dash_publisher_info->GetMemoryBudget(), hls_publisher_info->GetMemoryBudget());
+
     // DSH/HLS Server Start
     if (dash_publisher_info->GetPort() == hls_publisher_info->GetPort())
     {
@@ -158,6 +165,29 @@ bool SegmentStreamPublisher::GetMonitoringCollectionData(std::vector<std::shared
     for(auto server : _segment_stream_servers)
         server->GetMonitoringCollectionData(collections);
 
+    // Segment 보관 메모리
+    for(const auto &segment_arena : {_dash_segment_arena, _hls_segment_arena})
+    {
+        if(segment_arena == nullptr)
+            continue;
+
+        auto stats = segment_arena->GetStats();
+        auto collection = std::make_shared<MonitoringCollectionData>(MonitroingCollectionType::Segment,
+                                                                     _application_info.GetOrigin().GetAlias(),
+                                                                     _application_info.GetName(),
+                                                                     segment_arena->GetName().c_str());
+
+        collection->segment_memory_budget = stats.budget;
+        collection->segment_memory_reserved = stats.reserved;
+        collection->segment_memory_used = stats.used;
+        collection->segment_count = stats.segment_count;
+        collection->segment_eviction_count = stats.eviction_count;
+        collection->segment_drop_count = stats.drop_count;
+        collection->check_time = std::chrono::system_clock::now();
+
+        collections.push_back(collection);
+    }
+
     return true;
 }
 
@@ -166,7 +196,7 @@ bool SegmentStreamPublisher::GetMonitoringCollectionData(std::vector<std::shared
 //====================================================================================================
 std::shared_ptr<Application> SegmentStreamPublisher::OnCreateApplication(const info::Application &application_info)
 {
-    return SegmentStreamApplication::Create(application_info);
+    return SegmentStreamApplication::Create(application_info, _dash_segment_arena, _hls_segment_arena);
 }
 
 
@@ -178,7 +208,8 @@ bool SegmentStreamPublisher::OnPlayListRequest(const ov::String &app_name,
                                                const ov::String &stream_name,
                                                const ov::String &file_name,
                                                PlayListType play_list_type,
-                                               ov::String &play_list)
+                                               ov::String &play_list,
+                                               SegmentCacheInfo &cache_info)
 {
     auto stream = std::static_pointer_cast<SegmentStream>(GetStream(app_name, stream_name));
 
@@ -188,7 +219,30 @@ bool SegmentStreamPublisher::OnPlayListRequest(const ov::String &app_name,
         return false;
     }
 
-    return stream->GetPlayList(play_list_type, play_list);
+    return stream->GetPlayList(play_list_type, play_list, cache_info);
+}
+
+//====================================================================================================
+// OnPlayListWaitRequest
+//  - SegmentStreamObserver Implementation
+//====================================================================================================
+bool SegmentStreamPublisher::OnPlayListWaitRequest(const ov::String &app_name,
+                                                   const ov::String &stream_name,
+                                                   const ov::String &file_name,
+                                                   PlayListType play_list_type,
+                                                   int64_t media_sequence,
+                                                   int64_t part_index,
+                                                   PlayListWaitResult &wait_result)
+{
+    auto stream = std::static_pointer_cast<SegmentStream>(GetStream(app_name, stream_name));
+
+    if (!stream)
+    {
+        logte("Cannot find stream (%s/%s/%s)", app_name.CStr(), stream_name.CStr(), file_name.CStr());
+        return false;
+    }
+
+    return stream->WaitPlayList(play_list_type, media_sequence, part_index, wait_result);
 }
 
 //====================================================================================================
@@ -199,7 +253,30 @@ bool SegmentStreamPublisher::OnSegmentRequest(const ov::String &app_name,
                                               const ov::String &stream_name,
                                               SegmentType segmnet_type,
                                               const ov::String &file_name,
-                                              std::shared_ptr<ov::Data> &segment_data)
+                                              std::shared_ptr<const ov::Data> &segment_data,
+                                              SegmentCacheInfo &cache_info)
+{
+    auto stream = std::static_pointer_cast<SegmentStream>(GetStream(app_name, stream_name));
+
+    if (!stream)
+    {
+        logte("Cannot find stream (%s/%s/%s)", app_name.CStr(), stream_name.CStr(), file_name.CStr());
+        return false;
+    }
+
+    return stream->GetSegment(segmnet_type, file_name, segment_data, cache_info);
+}
+
+//====================================================================================================
+// OnChunkedSegmentRequest
+//  - SegmentStreamObserver Implementation
+//====================================================================================================
+bool SegmentStreamPublisher::OnChunkedSegmentRequest(const ov::String &app_name,
+                                                     const ov::String &stream_name,
+                                                     SegmentType segment_type,
+                                                     const ov::String &file_name,
+                                                     std::shared_ptr<ChunkedSegment> &segment,
+                                                     int &part_index)
 {
     auto stream = std::static_pointer_cast<SegmentStream>(GetStream(app_name, stream_name));
 
@@ -209,7 +286,7 @@ bool SegmentStreamPublisher::OnSegmentRequest(const ov::String &app_name,
         return false;
     }
 
-    return stream->GetSegment(segmnet_type, file_name, segment_data);
+    return stream->GetChunkedSegment(segment_type, file_name, segment, part_index);
 }
 
 std::shared_ptr<Certificate> SegmentStreamPublisher::GetCertificate(ov::String cert_path, ov::String key_path)
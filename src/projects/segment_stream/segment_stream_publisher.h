@@ -42,13 +42,30 @@ private :
                            const ov::String &stream_name,
                            const ov::String &file_name,
                            PlayListType play_list_type,
-                           ov::String &play_list) override;
+                           ov::String &play_list,
+                           SegmentCacheInfo &cache_info) override;
+
+    bool OnPlayListWaitRequest(const ov::String &app_name,
+                               const ov::String &stream_name,
+                               const ov::String &file_name,
+                               PlayListType play_list_type,
+                               int64_t media_sequence,
+                               int64_t part_index,
+                               PlayListWaitResult &wait_result) override;
 
     bool OnSegmentRequest(const ov::String &app_name,
                           const ov::String &stream_name,
                           SegmentType segment_type,
                           const ov::String &file_name,
-                          std::shared_ptr<ov::Data> &segment_data) override;
+                          std::shared_ptr<const ov::Data> &segment_data,
+                          SegmentCacheInfo &cache_info) override;
+
+    bool OnChunkedSegmentRequest(const ov::String &app_name,
+                                 const ov::String &stream_name,
+                                 SegmentType segment_type,
+                                 const ov::String &file_name,
+                                 std::shared_ptr<ChunkedSegment> &segment,
+                                 int &part_index) override;
 
     // Publisher Implementation
     cfg::PublisherType GetPublisherType() override { return _publisher_type; }
@@ -57,4 +74,8 @@ private :
 private :
     cfg::PublisherType _publisher_type;
     std::vector<std::shared_ptr<SegmentStreamServer>> _segment_stream_servers;
+
+    // 전체 Stream 의 Segment 보관(메모리 예산)
+    std::shared_ptr<SegmentArena> _dash_segment_arena;
+    std::shared_ptr<SegmentArena> _hls_segment_arena;
 };
@@ -10,10 +10,14 @@
 #include "segment_stream_server.h"
 #include "segment_stream_interceptor.h"
 #include <sstream>
+#include <strings.h>
 
 
 #define OV_LOG_TAG "SegmentStream"
 
+// 생성 중인 Segment 의 다음 Chunk 대기 시간
+#define SEGMENT_CHUNK_WAIT_TIMEOUT      (10000) // millisecond
+
 //====================================================================================================
 // Start
 //====================================================================================================
@@ -42,13 +46,15 @@ bool SegmentStreamServer::Start(const ov::SocketAddress &address, const std::sha
 
     auto segment_stream_interceptor = std::make_shared<SegmentStreamInterceptor>();
 
-    // 정규식 설정  app_name/stream_name/file_name.ext?param=value
-    ov::String regular_expression = "(([^ #?]*)/([^ #?]*)/)?([^ #?]*)[.](m3u8|mpd|ts|m4s|xml)[?]?([^ #]*)#?([^ ]*)?";
-
+    // 라우트 설정  ..../app_name/stream_name/file_name.ext?param=value
     auto process_func = std::bind(&SegmentStreamServer::ProcessRequest, this, std::placeholders::_1,
                                   std::placeholders::_2);
 
-    segment_stream_interceptor->Register(HttpMethod::Get, regular_expression, process_func);
+    auto crossdomain_func = std::bind(&SegmentStreamServer::CrossdomainRequest, this, std::placeholders::_1,
+                                      std::placeholders::_2);
+
+    segment_stream_interceptor->Register(HttpMethod::Get, "*/{app}/{stream}/{file}.{ext:m3u8|mpd|ts|m4s}", process_func);
+    segment_stream_interceptor->Register(HttpMethod::Get, "*/crossdomain.xml", crossdomain_func);
 
     _http_server->AddInterceptor(segment_stream_interceptor);
 
@@ -171,92 +177,22 @@ bool SegmentStreamServer::Disconnect(const ov::String &app_na, const ov::String
 }
 
 
-//====================================================================================================
-// RequestUrlParsing
-// - URL 분리
-//  ex) ..../app_name/stream_name/file_name.file_ext?param=param_value
-//====================================================================================================
-bool SegmentStreamServer::RequestUrlParsing(const ov::String &request_url,
-                                            ov::String &app_name,
-                                            ov::String &stream_name,
-                                            ov::String &file_name,
-                                            ov::String &file_ext)
-{
-    ov::String request_path;
-    ov::String request_param;
-
-    // 확장자 확인
-    // 파라메터 분리  directory/file.ext?param=test
-    auto tokens = request_url.Split("?");
-    if (tokens.size() == 0) {
-        return false;
-    }
-
-    request_path = tokens[0];
-    request_param = tokens.size() == 2 ? tokens[1] : "";
-
-    // ...../app_name/stream_name/file_name.ext_name 분리
-    tokens.clear();
-    tokens = request_path.Split("/");
-
-    if (tokens.size() < 3) {
-        return false;
-    }
-
-    app_name = tokens[tokens.size() - 3];
-    stream_name = tokens[tokens.size() - 2];
-    file_name = tokens[tokens.size() - 1];
-
-    // file_name.ext_name 분리
-    tokens.clear();
-    tokens = file_name.Split(".");
-
-    if (tokens.size() != 2) {
-        return false;
-    }
-
-    file_ext = tokens[1];
-
-    /*
-    logtd("request : %s\n"\
-         "request path : %s\n"\
-         "request param : %s\n"\
-         "app name : %s\n"\
-         "stream name : %s\n"\
-         "file name : %s\n"\
-         "file ext : %s\n",
-          request_url.CStr(), request_path.CStr(), request_param.CStr(),  app_name.CStr(), stream_name.CStr(), file_name.CStr(),file_ext.CStr());
-    */
-
-    return true;
-}
-
 //====================================================================================================
 // ProcessRequest
 //====================================================================================================
 void SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpRequest> &request,
                                          const std::shared_ptr<HttpResponse> &response)
 {
-    ov::String request_url = request->GetRequestTarget();
-    ov::String stream_name;
-    ov::String app_name;
-    ov::String file_name;
-    ov::String file_ext;
-
-    // Crossdomain 확인
-    if (request_url.IndexOf("crossdomain.xml") >= 0)
-    {
-        CrossdomainRequest(request, response);
-        return;
-    }
-
-    // URL 파싱
+    // Route 에서 분리된 값 (request target 참조)
     // app/strem/file.ext 기준
-    if (!RequestUrlParsing(request_url, app_name, stream_name, file_name, file_ext)) {
-        logtd("Request URL Parsing Fail : %s", request_url.CStr());
-        response->SetStatusCode(HttpStatusCode::NotFound);
-        return;
-    }
+    HttpRouteValue file = request->GetRouteValue("file");
+    HttpRouteValue ext = request->GetRouteValue("ext");
+
+    ov::String app_name = request->GetRouteValue("app").ToString();
+    ov::String stream_name = request->GetRouteValue("stream").ToString();
+    // file_name.ext_name (같은 segment 이므로 연속된 메모리)
+    ov::String file_name(file.GetData(), file.GetLength() + 1 + ext.GetLength());
+    ov::String file_ext = ext.ToString();
 
     ProtocolFlag protocol_flag = ProtocolFlag::NONE;
 
@@ -275,13 +211,13 @@ void SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpRequest> &req
 
     // 요청 파일 처리
     if (file_name == "playlist.m3u8")
-        PlayListRequest(app_name, stream_name, file_name, protocol_flag, PlayListType::M3u8, response);
+        PlayListRequest(app_name, stream_name, file_name, protocol_flag, PlayListType::M3u8, request, response);
     else if (file_name == "manifest.mpd")
-        PlayListRequest(app_name, stream_name, file_name, protocol_flag, PlayListType::Mpd, response);
+        PlayListRequest(app_name, stream_name, file_name, protocol_flag, PlayListType::Mpd, request, response);
     else if (file_ext == "ts")
-        SegmentRequest(app_name, stream_name, file_name, protocol_flag, SegmentType::MpegTs, response);
+        SegmentRequest(app_name, stream_name, file_name, protocol_flag, SegmentType::MpegTs, request, response);
     else if (file_ext == "m4s")
-        SegmentRequest(app_name, stream_name, file_name, protocol_flag, SegmentType::M4S, response);
+        SegmentRequest(app_name, stream_name, file_name, protocol_flag, SegmentType::M4S, request, response);
     else
     {
         response->SetStatusCode(HttpStatusCode::NotFound);// Error 응답
@@ -347,6 +283,7 @@ void SegmentStreamServer::PlayListRequest(ov::String &app_name,
                                           ov::String &file_name,
                                           ProtocolFlag protocol_flag,
                                           PlayListType play_list_type,
+                                          const std::shared_ptr<HttpRequest> &request,
                                           const std::shared_ptr<HttpResponse> &response)
 {
     if (!AllowAppCheck(app_name, protocol_flag))
@@ -356,13 +293,61 @@ void SegmentStreamServer::PlayListRequest(ov::String &app_name,
         return;
     }
 
+    // Blocking PlayList Reload(LL-HLS)
+    // - 요청 Segment/Part 가 PlayList 에 포함될 때 까지 대기(요청별 Thread 에서 처리되므로 대기 가능)
+    if (play_list_type == PlayListType::M3u8)
+    {
+        int64_t media_sequence = -1;
+        int64_t part_index = -1;
+
+        if (ParsePlayListWait(request, media_sequence, part_index) != HttpStatusCode::OK)
+        {
+            response->SetStatusCode(HttpStatusCode::BadRequest);
+            return;
+        }
+
+        if (media_sequence >= 0)
+        {
+            PlayListWaitResult wait_result = PlayListWaitResult::Ready;
+
+            auto item = std::find_if(_observers.begin(), _observers.end(),
+                                     [&app_name, &stream_name, &file_name, &play_list_type, media_sequence, part_index,
+                                             &wait_result](auto &observer) -> bool {
+                                         return observer->OnPlayListWaitRequest(app_name, stream_name, file_name,
+                                                                                play_list_type, media_sequence,
+                                                                                part_index, wait_result);
+                                     });
+
+            if (item == _observers.end())
+            {
+                logtd("PlayList Serarch Fail : %s/%s/%s", app_name.CStr(), stream_name.CStr(), file_name.CStr());
+                response->SetStatusCode(HttpStatusCode::NotFound);
+                return;
+            }
+
+            if (wait_result == PlayListWaitResult::InvalidRequest)
+            {
+                response->SetStatusCode(HttpStatusCode::BadRequest);
+                return;
+            }
+            else if (wait_result == PlayListWaitResult::Timeout)
+            {
+                logtd("PlayList Wait Timeout : %s/%s/%s - msn(%" PRId64 ") part(%" PRId64 ")", app_name.CStr(),
+                      stream_name.CStr(), file_name.CStr(), media_sequence, part_index);
+                response->SetStatusCode(HttpStatusCode::ServiceUnavailable);
+                return;
+            }
+        }
+    }
+
     ov::String play_list;
+    SegmentCacheInfo cache_info;
 
     auto item = std::find_if(_observers.begin(), _observers.end(),
-                             [&app_name, &stream_name, &file_name, &play_list_type, &play_list](
+                             [&app_name, &stream_name, &file_name, &play_list_type, &play_list, &cache_info](
                                      auto &observer) -> bool {
                                  return observer->OnPlayListRequest(app_name, stream_name, file_name, play_list_type,
-                                                                    play_list);
+                                                                    play_list, cache_info);
                              });
 
     if (item == _observers.end() || play_list.IsEmpty())
@@ -376,6 +361,8 @@ void SegmentStreamServer::PlayListRequest(ov::String &app_name,
     if (play_list_type == PlayListType::M3u8) response->SetHeader("Content-Type", "application/x-mpegURL");
     else if (play_list_type == PlayListType::Mpd) response->SetHeader("Content-Type", "application/dash+xml");
 
+    SetCacheHeader(cache_info, response);
+
     // logtd("PlayList Append : %s/%s/%s  - Size(%d)", app_name.CStr(), stream_name.CStr(), file_name.CStr(), play_list.GetLength());
     response->AppendString(play_list);
 
@@ -395,6 +382,7 @@ void SegmentStreamServer::SegmentRequest(ov::String &app_name,
                                          ov::String &file_name,
                                          ProtocolFlag protocol_flag,
                                          SegmentType segment_type,
+                                         const std::shared_ptr<HttpRequest> &request,
                                          const std::shared_ptr<HttpResponse> &response)
 {
     if (!AllowAppCheck(app_name, protocol_flag))
@@ -404,17 +392,24 @@ void SegmentStreamServer::SegmentRequest(ov::String &app_name,
         return;
     }
 
-    std::shared_ptr<ov::Data> segment_data = nullptr;
+    std::shared_ptr<const ov::Data> segment_data = nullptr;
+    SegmentCacheInfo cache_info;
 
     auto item = std::find_if(_observers.begin(), _observers.end(),
-                             [&app_name, &stream_name, &segment_type, &file_name, &segment_data](
+                             [&app_name, &stream_name, &segment_type, &file_name, &segment_data, &cache_info](
                                      auto &observer) -> bool {
                                  return observer->OnSegmentRequest(app_name, stream_name, segment_type, file_name,
-                                                                   segment_data);
+                                                                   segment_data, cache_info);
                              });
 
     if (item == _observers.end() || segment_data == nullptr)
     {
+        // 생성 중인 Segment 확인(Low Latency)
+        if (ChunkedSegmentRequest(app_name, stream_name, file_name, segment_type, response))
+        {
+            return;
+        }
+
         logtd("Segment Data Serarch Fail : %s/%s/%s", app_name.CStr(), stream_name.CStr(), file_name.CStr());
         response->SetStatusCode(HttpStatusCode::NotFound);
         return;
@@ -424,6 +419,43 @@ void SegmentStreamServer::SegmentRequest(ov::String &app_name,
     if (segment_type == SegmentType::MpegTs) response->SetHeader("Content-Type", "video/MP2T");
     else if (segment_type == SegmentType::M4S) response->SetHeader("Content-Type", "video/mp4");
 
+    response->SetHeader("Accept-Ranges", "bytes");
+    SetCacheHeader(cache_info, response);
+
+    if (IsNotModified(cache_info, request))
+    {
+        response->SetStatusCode(HttpStatusCode::NotModified);
+        return;
+    }
+
+    size_t start = 0;
+    size_t end = 0;
+    auto range_result = ParseRange(cache_info, request, segment_data->GetLength(), start, end);
+
+    if (range_result == HttpStatusCode::RangeNotSatisfiable)
+    {
+        response->SetStatusCode(HttpStatusCode::RangeNotSatisfiable);
+        response->SetHeader("Content-Range", ov::String::FormatString("bytes */%zu", segment_data->GetLength()));
+        return;
+    }
+    else if (range_result == HttpStatusCode::PartialContent)
+    {
+        // 보관 중인 Segment 의 일부를 참조(복사하지 않음, 응답 완료까지 Segment 참조 유지)
+        auto range_data = std::shared_ptr<const ov::Data>(
+                new ov::Data(segment_data->GetDataAs<uint8_t>() + start, end - start + 1, true),
+                [segment_data](const ov::Data *data) {
+                    delete data;
+                });
+
+        response->SetStatusCode(HttpStatusCode::PartialContent);
+        response->SetHeader("Content-Range",
+                            ov::String::FormatString("bytes %zu-%zu/%zu", start, end, segment_data->GetLength()));
+
+        segment_data = range_data;
+    }
+
+    response->SetHeader("Content-Length", ov::String::FormatString("%zu", segment_data->GetLength()));
+
     // logtd("SegmentData Append : %s/%s/%s  - Size(%d)", app_name.CStr(), stream_name.CStr(), file_name.CStr(), segment_data->GetLength());
     response->AppendData(segment_data);
 
@@ -435,6 +467,98 @@ void SegmentStreamServer::SegmentRequest(ov::String &app_name,
 
 }
 
+//====================================================================================================
+// ChunkedSegmentRequest
+// - 생성 중인 Segment(Low Latency)
+// - Partial Segment : Chunk 생성 대기 이후 응답(Preload Hint)
+// - Segment 전체 : Chunk 생성 마다 Chunked Transfer Encoding 으로 전송
+// - 요청별 Thread(SegmentStreamInterceptor) 에서 처리되므로 대기 가능
+//====================================================================================================
+bool SegmentStreamServer::ChunkedSegmentRequest(ov::String &app_name,
+                                                ov::String &stream_name,
+                                                ov::String &file_name,
+                                                SegmentType segment_type,
+                                                const std::shared_ptr<HttpResponse> &response)
+{
+    std::shared_ptr<ChunkedSegment> segment = nullptr;
+    int part_index = -1;
+
+    auto item = std::find_if(_observers.begin(), _observers.end(),
+                             [&app_name, &stream_name, &segment_type, &file_name, &segment, &part_index](
+                                     auto &observer) -> bool {
+                                 return observer->OnChunkedSegmentRequest(app_name, stream_name, segment_type,
+                                                                          file_name, segment, part_index);
+                             });
+
+    if (item == _observers.end() || segment == nullptr)
+    {
+        return false;
+    }
+
+    SegmentChunk chunk;
+
+    // Partial Segment
+    if (part_index >= 0)
+    {
+        if (!segment->WaitChunk(part_index, SEGMENT_CHUNK_WAIT_TIMEOUT, chunk))
+        {
+            logtd("Segment Part Wait Fail : %s/%s/%s", app_name.CStr(), stream_name.CStr(), file_name.CStr());
+            return false;
+        }
+
+        if (segment_type == SegmentType::MpegTs) response->SetHeader("Content-Type", "video/MP2T");
+        else if (segment_type == SegmentType::M4S) response->SetHeader("Content-Type", "video/mp4");
+
+        response->AppendData(std::make_shared<ov::Data>(chunk.data->data(), chunk.data->size()));
+
+        if (!response->Response())
+        {
+            logte("Segment Part Response Fail  : %s/%s/%s  - Size(%zu)", app_name.CStr(), stream_name.CStr(),
+                  file_name.CStr(), chunk.data->size());
+        }
+
+        return true;
+    }
+
+    // Segment 전체(Chunked Transfer Encoding)
+    size_t chunk_index = 0;
+
+    while (segment->WaitChunk(chunk_index, SEGMENT_CHUNK_WAIT_TIMEOUT, chunk))
+    {
+        if (chunk_index == 0)
+        {
+            if (segment_type == SegmentType::MpegTs) response->SetHeader("Content-Type", "video/MP2T");
+            else if (segment_type == SegmentType::M4S) response->SetHeader("Content-Type", "video/mp4");
+        }
+
+        if (!response->SendChunkedData(chunk.data->data(), chunk.data->size()))
+        {
+            logtd("Segment Chunk Send Fail : %s/%s/%s - Chunk(%zu)", app_name.CStr(), stream_name.CStr(),
+                  file_name.CStr(), chunk_index);
+            return true;
+        }
+
+        chunk_index++;
+    }
+
+    if (chunk_index == 0)
+    {
+        // 응답 전(Chunk 없음)
+        return false;
+    }
+
+    // Segment 완료 이전 timeout 발생시에도 종료 Chunk 전송(Chunked Transfer Encoding 응답 종료)
+    if (!segment->IsCompleted())
+    {
+        logtw("Segment Chunk Wait Timeout : %s/%s/%s - Chunk(%zu)", app_name.CStr(), stream_name.CStr(),
+              file_name.CStr(), chunk_index);
+    }
+
+    response->SendChunkedEnd();
+
+    return true;
+}
+
 //====================================================================================================
 // CrossdomainRequest
 // - corssdomain.xml
@@ -453,6 +577,271 @@ void SegmentStreamServer::CrossdomainRequest(const std::shared_ptr<HttpRequest>
     }
 }
 
+//====================================================================================================
+// 캐시 헤더 설정
+// - CDN 이 Segment 를 PlayList 에서 제외될 때 까지 캐시(ETag 로 스트림 재시작시 같은 파일 이름과 구분)
+//====================================================================================================
+void SegmentStreamServer::SetCacheHeader(const SegmentCacheInfo &cache_info, const std::shared_ptr<HttpResponse> &response)
+{
+    if (!cache_info.etag.empty())
+    {
+        response->SetHeader("ETag", cache_info.etag.c_str());
+    }
+
+    if (cache_info.last_modified > 0)
+    {
+        response->SetHeader("Last-Modified", MakeHttpDate(cache_info.last_modified));
+    }
+
+    if (cache_info.max_age > 0)
+        response->SetHeader("Cache-Control", ov::String::FormatString("max-age=%d", cache_info.max_age));
+    else
+        response->SetHeader("Cache-Control", "no-cache");
+}
+
+//====================================================================================================
+// 조건부 요청 확인(304 Not Modified)
+// - If-None-Match 가 있으면 If-Modified-Since 무시(RFC7232 - 6.)
+// - If-None-Match 는 Weak 비교
+//====================================================================================================
+bool SegmentStreamServer::IsNotModified(const SegmentCacheInfo &cache_info, const std::shared_ptr<HttpRequest> &request)
+{
+    if (request->IsHeaderExists("If-None-Match"))
+    {
+        if (cache_info.etag.empty())
+        {
+            return false;
+        }
+
+        std::string if_none_match = request->GetHeader("If-None-Match").CStr();
+        std::istringstream etags(if_none_match);
+        std::string etag;
+
+        while (std::getline(etags, etag, ','))
+        {
+            auto start = etag.find_first_not_of(" \t");
+
+            if (start == std::string::npos)
+            {
+                continue;
+            }
+
+            auto end = etag.find_last_not_of(" \t");
+
+            etag = etag.substr(start, end - start + 1);
+
+            if (etag == "*")
+            {
+                return true;
+            }
+
+            if (etag.compare(0, 2, "W/") == 0)
+            {
+                etag = etag.substr(2);
+            }
+
+            if (etag == cache_info.etag)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    if (request->IsHeaderExists("If-Modified-Since") && cache_info.last_modified > 0)
+    {
+        time_t if_modified_since = ParseHttpDate(request->GetHeader("If-Modified-Since"));
+
+        return (if_modified_since > 0 && cache_info.last_modified <= if_modified_since);
+    }
+
+    return false;
+}
+
+//====================================================================================================
+// Blocking PlayList Reload Query 확인
+// - _HLS_msn=<M>[&_HLS_part=<N>]
+// - 그 외 Query 는 무시
+//====================================================================================================
+HttpStatusCode SegmentStreamServer::ParsePlayListWait(const std::shared_ptr<HttpRequest> &request,
+                                                      int64_t &media_sequence,
+                                                      int64_t &part_index)
+{
+    media_sequence = -1;
+    part_index = -1;
+
+    std::string target = request->GetRequestTarget().CStr();
+    auto query_start = target.find('?');
+
+    if (query_start == std::string::npos)
+    {
+        return HttpStatusCode::OK;
+    }
+
+    std::string query = target.substr(query_start + 1, target.find('#', query_start) - query_start - 1);
+    size_t position = 0;
+
+    while (position <= query.size())
+    {
+        auto next = query.find('&', position);
+
+        if (next == std::string::npos)
+        {
+            next = query.size();
+        }
+
+        std::string param = query.substr(position, next - position);
+        auto equal = param.find('=');
+
+        if (equal != std::string::npos)
+        {
+            std::string key = param.substr(0, equal);
+            std::string value = param.substr(equal + 1);
+
+            if (key == "_HLS_msn" || key == "_HLS_part")
+            {
+                if (value.empty() || value.size() > 18 || value.find_first_not_of("0123456789") != std::string::npos)
+                {
+                    return HttpStatusCode::BadRequest;
+                }
+
+                (key == "_HLS_msn" ? media_sequence : part_index) = ::strtoll(value.c_str(), nullptr, 10);
+            }
+        }
+
+        position = next + 1;
+    }
+
+    // _HLS_msn 없이 _HLS_part 만 요청
+    if (media_sequence < 0 && part_index >= 0)
+    {
+        return HttpStatusCode::BadRequest;
+    }
+
+    return HttpStatusCode::OK;
+}
+
+//====================================================================================================
+// Range 확인
+// - bytes=start-end, bytes=start-, bytes=-suffix_length
+// - 여러 Range 요청 or 형식 오류는 Range 무시(전체 응답)
+// - If-Range 가 현재 Segment 와 다르면 Range 무시(Strong 비교)
+//====================================================================================================
+HttpStatusCode SegmentStreamServer::ParseRange(const SegmentCacheInfo &cache_info,
+                                               const std::shared_ptr<HttpRequest> &request,
+                                               size_t length,
+                                               size_t &start,
+                                               size_t &end)
+{
+    if (!request->IsHeaderExists("Range") || length == 0)
+    {
+        return HttpStatusCode::OK;
+    }
+
+    if (request->IsHeaderExists("If-Range"))
+    {
+        ov::String if_range = request->GetHeader("If-Range");
+
+        if (if_range.HasPrefix("\"") || if_range.HasPrefix("W/"))
+        {
+            if (cache_info.etag.empty() || cache_info.etag != if_range.CStr())
+            {
+                return HttpStatusCode::OK;
+            }
+        }
+        else if (cache_info.last_modified == 0 || ParseHttpDate(if_range) != cache_info.last_modified)
+        {
+            return HttpStatusCode::OK;
+        }
+    }
+
+    std::string range = request->GetHeader("Range").CStr();
+
+    if (range.size() <= 6 || ::strncasecmp(range.c_str(), "bytes=", 6) != 0 || range.find(',') != std::string::npos)
+    {
+        return HttpStatusCode::OK;
+    }
+
+    auto dash = range.find('-', 6);
+
+    if (dash == std::string::npos)
+    {
+        return HttpStatusCode::OK;
+    }
+
+    std::string first = range.substr(6, dash - 6);
+    std::string last = range.substr(dash + 1);
+
+    if (first.find_first_not_of("0123456789") != std::string::npos ||
+        last.find_first_not_of("0123456789") != std::string::npos ||
+        (first.empty() && last.empty()))
+    {
+        return HttpStatusCode::OK;
+    }
+
+    if (first.empty())
+    {
+        // 마지막 suffix_length byte
+        uint64_t suffix_length = ::strtoull(last.c_str(), nullptr, 10);
+
+        if (suffix_length == 0)
+        {
+            return HttpStatusCode::RangeNotSatisfiable;
+        }
+
+        start = length - std::min((uint64_t) length, suffix_length);
+        end = length - 1;
+
+        return HttpStatusCode::PartialContent;
+    }
+
+    uint64_t first_position = ::strtoull(first.c_str(), nullptr, 10);
+    uint64_t last_position = last.empty() ? length - 1 : ::strtoull(last.c_str(), nullptr, 10);
+
+    if (first_position >= length)
+    {
+        return HttpStatusCode::RangeNotSatisfiable;
+    }
+
+    if (last_position < first_position)
+    {
+        return HttpStatusCode::OK;
+    }
+
+    start = first_position;
+    end = std::min(last_position, (uint64_t) length - 1);
+
+    return HttpStatusCode::PartialContent;
+}
+
+//====================================================================================================
+// Http Date
+// - ex) Sun, 06 Nov 1994 08:49:37 GMT
+//====================================================================================================
+ov::String SegmentStreamServer::MakeHttpDate(time_t time)
+{
+    struct tm gmt_time;
+    char buffer[64];
+
+    ::gmtime_r(&time, &gmt_time);
+    ::strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", &gmt_time);
+
+    return buffer;
+}
+
+time_t SegmentStreamServer::ParseHttpDate(const ov::String &date)
+{
+    struct tm gmt_time = {};
+
+    if (::strptime(date.CStr(), "%a, %d %b %Y %H:%M:%S GMT", &gmt_time) == nullptr)
+    {
+        return 0;
+    }
+
+    return ::timegm(&gmt_time);
+}
+
 //====================================================================================================
 // AddCors
 // - 요청 파일 별 확장자/이름으로 프로토콜 구분 가능
@@ -57,12 +57,6 @@ public :
     bool GetMonitoringCollectionData(std::vector<std::shared_ptr<MonitoringCollectionData>> &collections);
 
 protected:
-    bool RequestUrlParsing(const ov::String &request_url,
-                           ov::String &app_name,
-                           ov::String &stream_name,
-                           ov::String &file_name,
-                           ov::String &file_ext);
-
     void ProcessRequest(const std::shared_ptr<HttpRequest> &request, const std::shared_ptr<HttpResponse> &response);
 
     bool CorsCheck(ov::String &app_name,
@@ -77,6 +71,7 @@ protected:
                          ov::String &file_name,
                          ProtocolFlag protocol_flag,
                          PlayListType play_list_type,
+                         const std::shared_ptr<HttpRequest> &request,
                          const std::shared_ptr<HttpResponse> &response);
 
     void SegmentRequest(ov::String &app_name,
@@ -84,10 +79,42 @@ protected:
                         ov::String &file_name,
                         ProtocolFlag protocol_flag,
                         SegmentType segment_type,
+                        const std::shared_ptr<HttpRequest> &request,
                         const std::shared_ptr<HttpResponse> &response);
 
+    bool ChunkedSegmentRequest(ov::String &app_name,
+                               ov::String &stream_name,
+                               ov::String &file_name,
+                               SegmentType segment_type,
+                               const std::shared_ptr<HttpResponse> &response);
+
     void CrossdomainRequest(const std::shared_ptr<HttpRequest> &request, const std::shared_ptr<HttpResponse> &response);
 
+    // ETag/Last-Modified/Cache-Control
+    static void SetCacheHeader(const SegmentCacheInfo &cache_info, const std::shared_ptr<HttpResponse> &response);
+
+    // If-None-Match/If-Modified-Since(RFC7232)
+    static bool IsNotModified(const SegmentCacheInfo &cache_info, const std::shared_ptr<HttpRequest> &request);
+
+    // Range(RFC7233, 단일 Range 만 지원)
+    // - OK : Range 무시(전체 응답), PartialContent : start~end 응답, RangeNotSatisfiable : 범위 오류
+    static HttpStatusCode ParseRange(const SegmentCacheInfo &cache_info,
+                                     const std::shared_ptr<HttpRequest> &request,
+                                     size_t length,
+                                     size_t &start,
+                                     size_t &end);
+
+    // Blocking PlayList Reload(LL-HLS _HLS_msn/_HLS_part Query)
+    // - OK : media_sequence(-1 : 대기 없음), part_index(-1 : Segment 완료 대기)
+    // - BadRequest : _HLS_msn 없이 _HLS_part 요청 or 숫자 아닌 값
+    static HttpStatusCode ParsePlayListWait(const std::shared_ptr<HttpRequest> &request,
+                                            int64_t &media_sequence,
+                                            int64_t &part_index);
+
+    // RFC7231 - 7.1.1.1. IMF-fixdate
+    static ov::String MakeHttpDate(time_t time);
+    static time_t ParseHttpDate(const ov::String &date);
+
 protected :
     std::shared_ptr<HttpServer> _http_server;
     std::vector<std::shared_ptr<SegmentStreamObserver>> _observers;
@@ -39,13 +39,34 @@ StreamPacketyzer::StreamPacketyzer(SegmentConfigInfo dash_segment_config_info,
                                                             stream_type,
                                                             dash_segment_config_info._count,
                                                             dash_segment_config_info._duration,
-                                                            media_info);
+                                                            media_info,
+                                                            dash_segment_config_info._chunk_duration,
+                                                            dash_segment_config_info._arena);
     if (hls_segment_config_info._enable)
         _hls_packetyzer = std::make_shared<HlsPacketyzer>(segment_prefix,
                                                           stream_type,
                                                           hls_segment_config_info._count,
                                                           hls_segment_config_info._duration,
-                                                          media_info);
+                                                          media_info,
+                                                          hls_segment_config_info._chunk_duration,
+                                                          hls_segment_config_info._arena);
+
+    // DVR(Time Shift)
+    if (_dash_packetyzer != nullptr && dash_segment_config_info._dvr_window > 0)
+    {
+        _dash_packetyzer->SetDvr(dash_segment_config_info._dvr_window, dash_segment_config_info._dvr_path);
+
+        logti("DASH DVR enabled(%s - window: %ds path: %s)", segment_prefix.c_str(),
+              dash_segment_config_info._dvr_window, dash_segment_config_info._dvr_path.c_str());
+    }
+
+    if (_hls_packetyzer != nullptr && hls_segment_config_info._dvr_window > 0)
+    {
+        _hls_packetyzer->SetDvr(hls_segment_config_info._dvr_window, hls_segment_config_info._dvr_path);
+
+        logti("HLS DVR enabled(%s - window: %ds path: %s)", segment_prefix.c_str(),
+              hls_segment_config_info._dvr_window, hls_segment_config_info._dvr_path.c_str());
+    }
 }
 
 //====================================================================================================
@@ -60,15 +81,17 @@ StreamPacketyzer::~StreamPacketyzer() {
 // Append Video Data
 //====================================================================================================
 bool StreamPacketyzer::AppendVideoData(uint64_t timestamp, uint32_t timescale, bool is_keyframe, uint64_t time_offset,
-                                       uint32_t data_size, const uint8_t *data)
+                                       const std::shared_ptr<const ov::Data> &data)
 {
+    size_t data_size = (data != nullptr) ? data->GetLength() : 0;
+
     // 임시
     timescale = 90000;
 
     // data valid check
     if (data_size <= 0 || data_size > MAX_INPUT_DATA_SIZE)
     {
-        logtw("Data Size Error(%d:%d)", data_size, MAX_INPUT_DATA_SIZE);
+        logtw("Data Size Error(%zu:%d)", data_size, MAX_INPUT_DATA_SIZE);
         return false;
     }
 
@@ -81,13 +104,13 @@ bool StreamPacketyzer::AppendVideoData(uint64_t timestamp, uint32_t timescale, b
         if (time_offset != 0) time_offset = Packetyzer::ConvertTimeScale(time_offset, timescale, _video_timescale);
     }
 
-    auto frame = std::make_shared<std::vector<uint8_t>>(data, data + data_size);
+    // Frame 데이터는 복사하지 않고 HLS/DASH Packetyzer 가 공유
     auto video_data = std::make_shared<PacketyzerFrameData>(
             is_keyframe ? PacketyzerFrameType::VideoIFrame : PacketyzerFrameType::VideoPFrame,
             timestamp,
             time_offset,
             _video_timescale,
-            frame);
+            data);
 
 
     // Video data save
@@ -184,12 +207,14 @@ bool StreamPacketyzer::VideoDataSampleWrite(uint64_t timestamp)
 //====================================================================================================
 // Append Audio Data
 //====================================================================================================
-bool StreamPacketyzer::AppendAudioData(uint64_t timestamp, uint32_t timescale, uint32_t data_size, const uint8_t *data)
+bool StreamPacketyzer::AppendAudioData(uint64_t timestamp, uint32_t timescale, const std::shared_ptr<const ov::Data> &data)
 {
+    size_t data_size = (data != nullptr) ? data->GetLength() : 0;
+
     // data valid check
     if (data_size <= 0 || data_size > MAX_INPUT_DATA_SIZE)
     {
-        logtw("Data Size Error(%d:%d)", data_size, MAX_INPUT_DATA_SIZE);
+        logtw("Data Size Error(%zu:%d)", data_size, MAX_INPUT_DATA_SIZE);
         return false;
     }
 
@@ -205,12 +230,11 @@ bool StreamPacketyzer::AppendAudioData(uint64_t timestamp, uint32_t timescale, u
         timestamp = Packetyzer::ConvertTimeScale(timestamp, timescale, _audio_timescale);
     }
 
-    auto frame = std::make_shared<std::vector<uint8_t>>(data, data + data_size);
     auto audio_data = std::make_shared<PacketyzerFrameData>(PacketyzerFrameType::AudioFrame,
                                                             timestamp,
                                                             0,
                                                             _audio_timescale,
-                                                            frame);
+                                                            data);
 
     // hls/dash Audio 데이터 삽입
     if (_dash_packetyzer != nullptr) _dash_packetyzer->AppendAudioFrame(audio_data);
@@ -225,15 +249,17 @@ bool StreamPacketyzer::AppendAudioData(uint64_t timestamp, uint32_t timescale, u
 // Get PlayList
 // - M3U8/MPD
 //====================================================================================================
-bool StreamPacketyzer::GetPlayList(PlayListType play_list_type, ov::String &segment_play_list)
+bool StreamPacketyzer::GetPlayList(PlayListType play_list_type,
+                                   ov::String &segment_play_list,
+                                   SegmentCacheInfo &cache_info)
 {
     bool result = false;
     std::string play_list;
 
     if (play_list_type == PlayListType::Mpd && _dash_packetyzer != nullptr)
-        result = _dash_packetyzer->GetPlayList(play_list);
+        result = _dash_packetyzer->GetPlayList(play_list, &cache_info);
     else if (play_list_type == PlayListType::M3u8 && _hls_packetyzer != nullptr)
-        result = _hls_packetyzer->GetPlayList(play_list);
+        result = _hls_packetyzer->GetPlayList(play_list, &cache_info);
 
     if (result)
         segment_play_list = play_list.c_str();
@@ -241,24 +267,54 @@ bool StreamPacketyzer::GetPlayList(PlayListType play_list_type, ov::String &segm
     return result;
 }
 
+//====================================================================================================
+// Wait PlayList
+// - Blocking PlayList Reload(LL-HLS _HLS_msn/_HLS_part)
+// - Low Latency 가 아니면 대기 없음
+//====================================================================================================
+PlayListWaitResult StreamPacketyzer::WaitPlayList(PlayListType play_list_type,
+                                                  int64_t media_sequence,
+                                                  int64_t part_index)
+{
+    if (play_list_type == PlayListType::M3u8 && _hls_packetyzer != nullptr && _hls_packetyzer->IsLowLatency())
+        return _hls_packetyzer->WaitPlayList(media_sequence, part_index);
+
+    return PlayListWaitResult::Ready;
+}
+
 //====================================================================================================
 // GetSegment
 // - TS/MP4
 //====================================================================================================
 bool StreamPacketyzer::GetSegment(SegmentType type, const ov::String &segment_file_name,
-                                  std::shared_ptr<ov::Data> &segment_data)
+                                  std::shared_ptr<const ov::Data> &segment_data,
+                                  SegmentCacheInfo &cache_info)
 {
-    bool result = false;
     std::string file_name = segment_file_name.CStr();
-    std::shared_ptr<std::vector<uint8_t>> data;
 
+    // 보관 중인 Segment 데이터 공유(복사하지 않음)
+    // - 응답 완료까지 참조 유지(Arena 에서 삭제되어도 Slab 반환 지연)
     if (type == SegmentType::M4S && _dash_packetyzer != nullptr)
-        result = _dash_packetyzer->GetSegmentData(file_name, data);
+        return _dash_packetyzer->GetSegmentData(file_name, segment_data, &cache_info);
     else if (type == SegmentType::MpegTs && _hls_packetyzer != nullptr)
-        result = _hls_packetyzer->GetSegmentData(file_name, data);
+        return _hls_packetyzer->GetSegmentData(file_name, segment_data, &cache_info);
 
-    if (result)
-        segment_data = std::make_shared<ov::Data>(data->data(), data->size());
+    return false;
+}
 
-    return result;
+//====================================================================================================
+// GetChunkedSegment
+// - 생성 중인 Segment/Partial Segment(Low Latency)
+//====================================================================================================
+bool StreamPacketyzer::GetChunkedSegment(SegmentType type, const ov::String &segment_file_name,
+                                         std::shared_ptr<ChunkedSegment> &segment, int &part_index)
+{
+    std::string file_name = segment_file_name.CStr();
+
+    if (type == SegmentType::M4S && _dash_packetyzer != nullptr)
+        return _dash_packetyzer->GetChunkedSegment(file_name, segment, part_index);
+    else if (type == SegmentType::MpegTs && _hls_packetyzer != nullptr)
+        return _hls_packetyzer->GetChunkedSegment(file_name, segment, part_index);
+
+    return false;
 }
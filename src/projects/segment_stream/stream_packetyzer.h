@@ -17,22 +17,30 @@
 
 #define DEFAULT_SEGMENT_COUNT        (5)
 #define DEFAULT_SEGMENT_DURATION    (5)
+#define DEFAULT_CHUNK_DURATION      (500) // millisecond
 
 //====================================================================================================
 // SegmentConfigInfo
 //====================================================================================================
 struct SegmentConfigInfo {
 public:
-    SegmentConfigInfo(bool enable, int count, int duration) {
+    SegmentConfigInfo(bool enable, int count, int duration, int chunk_duration = 0) {
         _enable = enable;
         _count = count;
         _duration = duration;
+        _chunk_duration = chunk_duration;
+        _arena = nullptr;
+        _dvr_window = 0;
     }
 
 public:
     bool _enable;
     int _count;
     int _duration;
+    int _chunk_duration; // Low Latency(millisecond, 0 : disable)
+    std::shared_ptr<SegmentArena> _arena; // Publisher 의 Segment 보관 Arena(nullptr : 예산 없음)
+    int _dvr_window; // DVR(second, 0 : disable)
+    std::string _dvr_path; // DVR 파일 경로
 };
 
 //====================================================================================================
@@ -49,15 +57,23 @@ public:
     virtual ~StreamPacketyzer();
 
 public :
+    // data : MediaRouter Frame 데이터(복사하지 않음, 수정 금지)
     bool
-    AppendVideoData(uint64_t timestamp, uint32_t timescale, bool is_keyframe, uint64_t time_offset, uint32_t data_size,
-                    const uint8_t *data);
+    AppendVideoData(uint64_t timestamp, uint32_t timescale, bool is_keyframe, uint64_t time_offset,
+                    const std::shared_ptr<const ov::Data> &data);
 
-    bool AppendAudioData(uint64_t timestamp, uint32_t timescale, uint32_t data_size, const uint8_t *data);
+    bool AppendAudioData(uint64_t timestamp, uint32_t timescale, const std::shared_ptr<const ov::Data> &data);
 
-    bool GetPlayList(PlayListType play_list_type, ov::String &segment_play_list);
+    bool GetPlayList(PlayListType play_list_type, ov::String &segment_play_list, SegmentCacheInfo &cache_info);
 
-    bool GetSegment(SegmentType type, const ov::String &file_name, std::shared_ptr<ov::Data> &data);
+    PlayListWaitResult WaitPlayList(PlayListType play_list_type, int64_t media_sequence, int64_t part_index);
+
+    bool GetSegment(SegmentType type,
+                    const ov::String &file_name,
+                    std::shared_ptr<const ov::Data> &data,
+                    SegmentCacheInfo &cache_info);
+
+    bool GetChunkedSegment(SegmentType type, const ov::String &file_name, std::shared_ptr<ChunkedSegment> &segment, int &part_index);
 
 private :
     bool VideoDataSampleWrite(uint64_t timestamp);
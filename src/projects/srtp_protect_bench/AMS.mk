@@ -0,0 +1,17 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Measures the SRTP protection throughput (packets/sec) of SrtpAdapter
+LOCAL_STATIC_LIBRARIES := \
+	dtls_srtp \
+	ovlibrary
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl \
+	`pkg-config --libs openssl` \
+	`pkg-config --libs libsrtp2`
+
+LOCAL_TARGET := SrtpProtectBench
+
+include $(BUILD_EXECUTABLE)
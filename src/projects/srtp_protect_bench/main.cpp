@@ -0,0 +1,130 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+
+#include "srtp_protect_bench.h"
+
+#include <openssl/srtp.h>
+
+#define OV_LOG_TAG                  "SrtpProtectBench"
+
+static void PrintUsage(const char *program)
+{
+	printf("Usage: %s [OPTION]...\n", program);
+	printf("    -f <count>    Frame count (default: 10000)\n");
+	printf("    -p <count>    RTP packets per frame (default: 8)\n");
+	printf("    -s <bytes>    RTP payload size (default: 1200)\n");
+	printf("    -l <count>    Iteration count (default: 5)\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], SrtpProtectBenchOptions *options)
+{
+	constexpr const char *opt_string = "hf:p:s:l:";
+
+	while(true)
+	{
+		int name = getopt(argc, argv, opt_string);
+
+		switch(name)
+		{
+			case -1:
+				return true;
+
+			case 'f':
+				options->frame_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'p':
+				options->packets_per_frame = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 's':
+				options->payload_size = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'l':
+				options->iteration_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'h':
+			default:
+				PrintUsage(argv[0]);
+				return false;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	SrtpProtectBenchOptions options;
+
+	if(TryParseOption(argc, argv, &options) == false)
+	{
+		return 1;
+	}
+
+	int err = srtp_init();
+
+	if(err != srtp_err_status_ok)
+	{
+		printf("Could not initialize SRTP (err: %d)\n", err);
+		return 1;
+	}
+
+	SrtpProtectBench bench(options);
+
+	bench.Prepare();
+
+	printf("source : %d frames, %d packets per frame, %d bytes payload, %d iterations\n",
+	       options.frame_count, options.packets_per_frame, options.payload_size, options.iteration_count);
+	printf("%-18s %-7s %12s %8s %10s %12s %14s %10s\n",
+	       "suite", "mode", "packets", "failed", "cpu ms", "ns/packet", "packets/s", "MB/s");
+
+	int exit_code = 0;
+
+	for(uint64_t crypto_suite : { SRTP_AES128_CM_SHA1_80, SRTP_AEAD_AES_128_GCM })
+	{
+		for(auto mode : { SrtpProtectBenchMode::PerPacket, SrtpProtectBenchMode::Batch })
+		{
+			SrtpProtectBenchResult result;
+			double seconds = 0.0;
+			bool is_valid = true;
+			int iteration_count = std::max(options.iteration_count, 1);
+
+			for(int iteration = 0; iteration < iteration_count; iteration++)
+			{
+				is_valid = bench.Run(crypto_suite, mode, &result) && is_valid;
+
+				seconds += result.seconds;
+			}
+
+			seconds /= iteration_count;
+			seconds = std::max(seconds, 0.000001);
+
+			printf("%-18s %-7s %12" PRIu64 " %8" PRIu64 " %10.2f %12.1f %14.0f %10.1f%s\n",
+			       SrtpProtectBench::GetSuiteName(crypto_suite),
+			       SrtpProtectBench::GetModeName(mode),
+			       result.packet_count, result.failed_count,
+			       seconds * 1000.0,
+			       seconds * 1000000000.0 / std::max<uint64_t>(result.packet_count, 1),
+			       result.packet_count / seconds,
+			       result.packet_bytes / seconds / 1000000.0,
+			       is_valid ? "" : " (INVALID)");
+
+			if(is_valid == false)
+			{
+				exit_code = 2;
+			}
+		}
+	}
+
+	srtp_shutdown();
+
+	return exit_code;
+}
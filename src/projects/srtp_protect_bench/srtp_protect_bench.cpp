@@ -0,0 +1,177 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "srtp_protect_bench.h"
+
+#include <time.h>
+
+#include <openssl/srtp.h>
+#include <base/ovlibrary/byte_io.h>
+
+#define OV_LOG_TAG                  "SrtpProtectBench"
+
+#define RTP_HEADER_SIZE             12
+// The longest authentication tag of the supported suites (AES-GCM)
+#define SRTP_MAX_TRAILER_SIZE       16
+
+static double GetCpuTime()
+{
+	timespec time {};
+
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+	return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+SrtpProtectBench::SrtpProtectBench(const SrtpProtectBenchOptions &options)
+	: _options(options)
+{
+}
+
+const char *SrtpProtectBench::GetModeName(SrtpProtectBenchMode mode)
+{
+	switch(mode)
+	{
+		case SrtpProtectBenchMode::PerPacket:
+			return "packet";
+
+		case SrtpProtectBenchMode::Batch:
+			return "batch";
+	}
+
+	return "?";
+}
+
+const char *SrtpProtectBench::GetSuiteName(uint64_t crypto_suite)
+{
+	switch(crypto_suite)
+	{
+		case SRTP_AES128_CM_SHA1_80:
+			return "AES128_CM_SHA1_80";
+
+		case SRTP_AES128_CM_SHA1_32:
+			return "AES128_CM_SHA1_32";
+
+		case SRTP_AEAD_AES_128_GCM:
+			return "AEAD_AES_128_GCM";
+
+		case SRTP_AEAD_AES_256_GCM:
+			return "AEAD_AES_256_GCM";
+	}
+
+	return "?";
+}
+
+void SrtpProtectBench::Prepare()
+{
+	_plain_packets.clear();
+	_packets.clear();
+
+	int packet_size = RTP_HEADER_SIZE + std::max(_options.payload_size, 1);
+
+	for(int index = 0; index < std::max(_options.packets_per_frame, 1); index++)
+	{
+		auto plain_packet = std::make_shared<ov::Data>(packet_size);
+		plain_packet->SetLength(packet_size);
+
+		auto buffer = plain_packet->GetWritableDataAs<uint8_t>();
+
+		// V=2, PT=96 (H.264), the marker bit is set on the last packet of the frame
+		buffer[0] = 0x80;
+		buffer[1] = static_cast<uint8_t>(96 | ((index == _options.packets_per_frame - 1) ? 0x80 : 0x00));
+		ByteWriter<uint32_t>::WriteBigEndian(&buffer[4], 90000);
+		ByteWriter<uint32_t>::WriteBigEndian(&buffer[8], 0x12345678);
+
+		for(int offset = RTP_HEADER_SIZE; offset < packet_size; offset++)
+		{
+			buffer[offset] = static_cast<uint8_t>(rand());
+		}
+
+		_plain_packets.push_back(plain_packet);
+		_packets.push_back(std::make_shared<ov::Data>(packet_size + SRTP_MAX_TRAILER_SIZE));
+	}
+}
+
+void SrtpProtectBench::ResetPackets(uint16_t sequence_number)
+{
+	for(size_t index = 0; index < _packets.size(); index++)
+	{
+		auto &plain_packet = _plain_packets[index];
+		auto &packet = _packets[index];
+
+		packet->SetLength(plain_packet->GetLength());
+
+		auto buffer = packet->GetWritableDataAs<uint8_t>();
+
+		::memcpy(buffer, plain_packet->GetData(), plain_packet->GetLength());
+		ByteWriter<uint16_t>::WriteBigEndian(&buffer[2], static_cast<uint16_t>(sequence_number + index));
+	}
+}
+
+bool SrtpProtectBench::Run(uint64_t crypto_suite, SrtpProtectBenchMode mode, SrtpProtectBenchResult *result)
+{
+	*result = SrtpProtectBenchResult();
+
+	// master key + master salt (the longest one is AES-256-GCM, 32 + 12 bytes)
+	auto key = std::make_shared<ov::Data>(64);
+	key->SetLength(64);
+
+	for(size_t index = 0; index < key->GetLength(); index++)
+	{
+		key->GetWritableDataAs<uint8_t>()[index] = static_cast<uint8_t>(index * 7 + 1);
+	}
+
+	SrtpAdapter adapter;
+
+	if(adapter.SetKey(ssrc_any_outbound, crypto_suite, key) == false)
+	{
+		return false;
+	}
+
+	uint16_t sequence_number = 0;
+
+	for(int frame = 0; frame < _options.frame_count; frame++)
+	{
+		// Restoring the packets is not a part of the measurement
+		ResetPackets(sequence_number);
+		sequence_number += static_cast<uint16_t>(_packets.size());
+
+		for(const auto &packet : _packets)
+		{
+			result->packet_bytes += packet->GetLength();
+		}
+
+		double start_time = GetCpuTime();
+
+		size_t protected_count = 0;
+
+		switch(mode)
+		{
+			case SrtpProtectBenchMode::PerPacket:
+				for(const auto &packet : _packets)
+				{
+					if(adapter.ProtectRtp(packet))
+					{
+						protected_count++;
+					}
+				}
+				break;
+
+			case SrtpProtectBenchMode::Batch:
+				protected_count = adapter.ProtectRtp(_packets);
+				break;
+		}
+
+		result->seconds += GetCpuTime() - start_time;
+
+		result->packet_count += protected_count;
+		result->failed_count += _packets.size() - protected_count;
+	}
+
+	return result->failed_count == 0;
+}
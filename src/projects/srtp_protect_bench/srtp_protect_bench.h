@@ -0,0 +1,66 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <dtls_srtp/srtp_adapter.h>
+
+struct SrtpProtectBenchOptions
+{
+	int frame_count = 10000;
+	// RTP packets per frame (packets of a frame are protected in one batch)
+	int packets_per_frame = 8;
+	// RTP payload bytes per packet
+	int payload_size = 1200;
+	int iteration_count = 5;
+};
+
+enum class SrtpProtectBenchMode
+{
+	// SrtpAdapter::ProtectRtp(data) for each packet, used before the batch
+	PerPacket,
+	// SrtpAdapter::ProtectRtp(data_list) for each frame (SrtpTransport::SendDataBatch())
+	Batch
+};
+
+struct SrtpProtectBenchResult
+{
+	uint64_t packet_count = 0;
+	uint64_t failed_count = 0;
+	// Bytes of the RTP packets (before protection)
+	uint64_t packet_bytes = 0;
+
+	// CPU time of SrtpAdapter
+	double seconds = 0.0;
+};
+
+class SrtpProtectBench
+{
+public:
+	explicit SrtpProtectBench(const SrtpProtectBenchOptions &options);
+
+	static const char *GetModeName(SrtpProtectBenchMode mode);
+	static const char *GetSuiteName(uint64_t crypto_suite);
+
+	// Creates the RTP packets of a frame
+	void Prepare();
+
+	bool Run(uint64_t crypto_suite, SrtpProtectBenchMode mode, SrtpProtectBenchResult *result);
+
+protected:
+	// Restores the plaintext RTP packets (protection is done in place)
+	void ResetPackets(uint16_t sequence_number);
+
+	SrtpProtectBenchOptions _options;
+
+	std::vector<std::shared_ptr<ov::Data>> _plain_packets;
+	std::vector<std::shared_ptr<ov::Data>> _packets;
+};
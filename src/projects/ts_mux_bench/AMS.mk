@@ -0,0 +1,15 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Measures the MPEG-TS muxing throughput of the HLS segment writer (TsWriter)
+LOCAL_STATIC_LIBRARIES := \
+	segment_stream \
+	ovlibrary
+
+LOCAL_LDFLAGS := \
+	-lpthread \
+	-ldl
+
+LOCAL_TARGET := TsMuxBench
+
+include $(BUILD_EXECUTABLE)
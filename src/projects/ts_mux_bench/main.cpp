@@ -0,0 +1,136 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <unistd.h>
+
+#include "ts_mux_bench.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG                  "TsMuxBench"
+
+static void PrintUsage(const char *program)
+{
+	printf("Usage: %s [OPTION]...\n", program);
+	printf("    -d <sec>      Synthetic media duration (default: 60)\n");
+	printf("    -s <sec>      Segment duration (default: 5)\n");
+	printf("    -b <kbps>     Video bitrate (default: 2500)\n");
+	printf("    -a <kbps>     Audio bitrate (default: 128)\n");
+	printf("    -F <fps>      Frame rate (default: 30)\n");
+	printf("    -g <frames>   GOP size (default: 60)\n");
+	printf("    -l <count>    Iteration count (default: 5)\n");
+}
+
+static bool TryParseOption(int argc, char *argv[], TsMuxBenchOptions *options)
+{
+	constexpr const char *opt_string = "hd:s:b:a:F:g:l:";
+
+	while(true)
+	{
+		int name = getopt(argc, argv, opt_string);
+
+		switch(name)
+		{
+			case -1:
+				return true;
+
+			case 'd':
+				options->duration = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 's':
+				options->segment_duration = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'b':
+				options->video_bitrate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'a':
+				options->audio_bitrate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'F':
+				options->frame_rate = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'g':
+				options->gop = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'l':
+				options->iteration_count = ov::Converter::ToInt32(optarg);
+				break;
+
+			case 'h':
+			default:
+				PrintUsage(argv[0]);
+				return false;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	TsMuxBenchOptions options;
+
+	if(TryParseOption(argc, argv, &options) == false)
+	{
+		return 1;
+	}
+
+	TsMuxBench bench(options);
+
+	bench.Synthesize();
+
+	printf("source : %d sec (%d sec segments), video %d kbps (%d fps, GOP %d), audio %d kbps, %d iterations\n",
+	       options.duration, options.segment_duration,
+	       options.video_bitrate, options.frame_rate, options.gop, options.audio_bitrate,
+	       options.iteration_count);
+	printf("%-8s %10s %10s %12s %12s %10s %10s %10s %10s\n",
+	       "mode", "segments", "frames", "media bytes", "ts bytes", "overhead", "mux ms", "ns/frame", "MB/s");
+
+	int exit_code = 0;
+
+	for(auto mode : { TsMuxBenchMode::Default, TsMuxBenchMode::Presized })
+	{
+		TsMuxBenchResult result;
+		double seconds = 0.0;
+		bool is_valid = true;
+		int iteration_count = std::max(options.iteration_count, 1);
+
+		for(int iteration = 0; iteration < iteration_count; iteration++)
+		{
+			is_valid = bench.Run(mode, &result) && is_valid;
+
+			seconds += result.seconds;
+		}
+
+		seconds /= iteration_count;
+
+		// Throughput of the media data (input of the muxer)
+		printf("%-8s %10" PRIu64 " %10" PRIu64 " %12" PRIu64 " %12" PRIu64 " %9.2f%% %10.2f %10.1f %10.1f%s\n",
+		       TsMuxBench::GetModeName(mode),
+		       result.segment_count,
+		       result.frame_count,
+		       result.payload_bytes,
+		       result.segment_bytes,
+		       (result.segment_bytes - result.payload_bytes) * 100.0 / std::max<uint64_t>(result.payload_bytes, 1),
+		       seconds * 1000.0,
+		       seconds * 1000000000.0 / std::max<uint64_t>(result.frame_count, 1),
+		       result.payload_bytes / std::max(seconds, 0.000001) / 1000000.0,
+		       is_valid ? "" : " (INVALID)");
+
+		if(is_valid == false)
+		{
+			exit_code = 2;
+		}
+	}
+
+	return exit_code;
+}
@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ts_mux_bench.h"
+
+#include <time.h>
+#include <algorithm>
+#include <map>
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG                  "TsMuxBench"
+
+#define TS_PACKET_SIZE              188
+#define TS_SYNC_BYTE                0x47
+
+static double GetCpuTime()
+{
+	timespec time {};
+
+	::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+	return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+TsMuxBench::TsMuxBench(const TsMuxBenchOptions &options)
+	: _options(options)
+{
+}
+
+const char *TsMuxBench::GetModeName(TsMuxBenchMode mode)
+{
+	switch(mode)
+	{
+		case TsMuxBenchMode::Default:
+			return "default";
+
+		case TsMuxBenchMode::Presized:
+			return "presized";
+	}
+
+	return "unknown";
+}
+
+void TsMuxBench::Synthesize()
+{
+	int frame_rate = std::max(_options.frame_rate, 1);
+	int gop = std::max(_options.gop, 1);
+	int segment_duration = std::max(_options.segment_duration, 1);
+
+	// A key frame is 8 times larger than the other frames
+	size_t video_frame_size = std::max<size_t>(static_cast<size_t>(_options.video_bitrate) * 1000 / 8 * gop / frame_rate / (gop - 1 + 8), 64);
+	size_t key_frame_size = video_frame_size * 8;
+	// AAC (1024 samples per frame, 48 kHz)
+	size_t audio_frame_size = std::max<size_t>(static_cast<size_t>(_options.audio_bitrate) * 1000 / 8 * 1024 / 48000, 8);
+
+	std::vector<Frame> frames;
+
+	int video_frame_count = _options.duration * frame_rate;
+	int audio_frame_count = _options.duration * 48000 / 1024;
+
+	for(int index = 0; index < video_frame_count; index++)
+	{
+		bool is_key_frame = ((index % gop) == 0);
+		// Sizes vary by +-25%, so the frames don't fill the packets in the same way
+		size_t size = (is_key_frame ? key_frame_size : video_frame_size) * (75 + (::rand() % 51)) / 100;
+		auto data = std::make_shared<std::vector<uint8_t>>(size);
+
+		for(auto &value : *data)
+		{
+			value = static_cast<uint8_t>(::rand());
+		}
+
+		// 90 kHz, B-frames are not used (time_offset is 0)
+		frames.push_back(Frame { true, is_key_frame, static_cast<uint64_t>(index) * 90000 / frame_rate, 0, data });
+	}
+
+	for(int index = 0; index < audio_frame_count; index++)
+	{
+		auto data = std::make_shared<std::vector<uint8_t>>(audio_frame_size * (90 + (::rand() % 21)) / 100);
+
+		for(auto &value : *data)
+		{
+			value = static_cast<uint8_t>(::rand());
+		}
+
+		// TsWriter uses the timestamp of the 90 kHz timescale
+		frames.push_back(Frame { false, true, static_cast<uint64_t>(index) * 1024 * 90000 / 48000, 0, data });
+	}
+
+	std::stable_sort(frames.begin(), frames.end(), [](const Frame &frame1, const Frame &frame2) -> bool
+	{
+		return frame1.timestamp < frame2.timestamp;
+	});
+
+	_segments.clear();
+
+	for(auto &frame : frames)
+	{
+		size_t segment_index = frame.timestamp / (static_cast<uint64_t>(segment_duration) * 90000);
+
+		if(_segments.size() <= segment_index)
+		{
+			_segments.resize(segment_index + 1);
+		}
+
+		_segments[segment_index].frames.push_back(frame);
+		_segments[segment_index].data_size += frame.data->size();
+	}
+}
+
+bool TsMuxBench::Verify(const std::vector<uint8_t> &data)
+{
+	if((data.size() % TS_PACKET_SIZE) != 0)
+	{
+		return false;
+	}
+
+	// PID => next continuity counter
+	std::map<int, int> continuity_counts;
+
+	for(size_t offset = 0; offset < data.size(); offset += TS_PACKET_SIZE)
+	{
+		const uint8_t *packet = data.data() + offset;
+
+		if(packet[0] != TS_SYNC_BYTE)
+		{
+			return false;
+		}
+
+		int pid = ((packet[1] & 0x1F) << 8) | packet[2];
+		int continuity_count = packet[3] & 0x0F;
+
+		auto item = continuity_counts.find(pid);
+
+		if((item != continuity_counts.end()) && (item->second != continuity_count))
+		{
+			return false;
+		}
+
+		continuity_counts[pid] = (continuity_count + 1) & 0x0F;
+	}
+
+	return true;
+}
+
+bool TsMuxBench::Run(TsMuxBenchMode mode, TsMuxBenchResult *result)
+{
+	*result = TsMuxBenchResult();
+
+	bool is_valid = true;
+
+	for(const auto &segment : _segments)
+	{
+		// The segment is released before the next one is muxed, so the buffers are reused by the allocator
+		// (page faults of a new buffer would hide the time of the muxer)
+		double start = GetCpuTime();
+
+		size_t data_init_size = (mode == TsMuxBenchMode::Presized) ? TsWriter::EstimateDataSize(segment.frames.size(), segment.data_size) : TS_WRITER_DEFAULT_DATA_SIZE;
+		TsWriter ts_writer(PacketyzerStreamType::Common, data_init_size);
+
+		for(const auto &frame : segment.frames)
+		{
+			ts_writer.WriteSample(frame.is_video, frame.is_keyframe, frame.timestamp, frame.time_offset, frame.data);
+		}
+
+		result->seconds += GetCpuTime() - start;
+
+		const auto &data_stream = ts_writer.GetDataStream();
+
+		result->segment_count++;
+		result->frame_count += segment.frames.size();
+		result->payload_bytes += segment.data_size;
+		result->segment_bytes += data_stream->size();
+
+		is_valid = Verify(*data_stream) && is_valid;
+	}
+
+	return is_valid;
+}
@@ -0,0 +1,83 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Jaejong Bong
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <segment_stream/packetyzer/ts_writer.h>
+
+struct TsMuxBenchOptions
+{
+	// Synthetic media duration (seconds)
+	int duration = 60;
+	int segment_duration = 5;
+	int video_bitrate = 2500;
+	int audio_bitrate = 128;
+	int frame_rate = 30;
+	int gop = 60;
+	int iteration_count = 5;
+};
+
+enum class TsMuxBenchMode
+{
+	// TsWriter with the default buffer size (the buffer grows while muxing)
+	Default,
+	// TsWriter with the buffer reserved by TsWriter::EstimateDataSize() (same as HlsPacketyzer)
+	Presized
+};
+
+struct TsMuxBenchResult
+{
+	uint64_t frame_count = 0;
+	uint64_t segment_count = 0;
+
+	// Bytes of the media data
+	uint64_t payload_bytes = 0;
+	// Bytes of the TS segments
+	uint64_t segment_bytes = 0;
+
+	// CPU time of TsWriter
+	double seconds = 0.0;
+};
+
+class TsMuxBench
+{
+public:
+	explicit TsMuxBench(const TsMuxBenchOptions &options);
+
+	static const char *GetModeName(TsMuxBenchMode mode);
+
+	// Creates the frames of each segment (video + audio, in the order of the timestamp)
+	void Synthesize();
+
+	// Muxes all segments, and checks the sync bytes and continuity counters of the packets
+	bool Run(TsMuxBenchMode mode, TsMuxBenchResult *result);
+
+protected:
+	struct Frame
+	{
+		bool is_video;
+		bool is_keyframe;
+		uint64_t timestamp;
+		uint64_t time_offset;
+		std::shared_ptr<std::vector<uint8_t>> data;
+	};
+
+	struct Segment
+	{
+		std::vector<Frame> frames;
+		size_t data_size = 0;
+	};
+
+	bool Verify(const std::vector<uint8_t> &data);
+
+	TsMuxBenchOptions _options;
+	std::vector<Segment> _segments;
+};
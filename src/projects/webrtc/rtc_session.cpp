@@ -189,7 +189,7 @@ void RtcSession::OnPacketReceived(std::shared_ptr<SessionInfo> session_info, std
 	_dtls_ice_transport->OnDataReceived(SessionNodeType::None, data);
 }
 
-bool RtcSession::SendOutgoingData(uint32_t packet_type, std::shared_ptr<ov::Data> packet)
+bool RtcSession::IsAcceptablePacket(uint32_t packet_type)
 {
 	auto rtp_payload_type = static_cast<uint8_t>(packet_type & 0xFF);
 	auto red_block_pt = static_cast<uint8_t>((packet_type & 0xFF00) >> 8);
@@ -212,5 +212,36 @@ bool RtcSession::SendOutgoingData(uint32_t packet_type, std::shared_ptr<ov::Data
 	//printf("pt:%d session v pt:%d red pt:%d session red pt : %d origin pt:%d  session a pt:%d\n",
 	//	   rtp_payload_type, _video_payload_type, red_block_pt, _red_block_pt, origin_pt_of_fec, _audio_payload_type);
 
+	return true;
+}
+
+bool RtcSession::SendOutgoingData(uint32_t packet_type, std::shared_ptr<ov::Data> packet)
+{
+	if(IsAcceptablePacket(packet_type) == false)
+	{
+		return false;
+	}
+
 	return _rtp_rtcp->SendOutgoingData(packet);
+}
+
+bool RtcSession::SendOutgoingDataBatch(const std::vector<std::pair<uint32_t, std::shared_ptr<ov::Data>>> &packets)
+{
+	std::vector<std::shared_ptr<ov::Data>> data_list;
+	data_list.reserve(packets.size());
+
+	for(const auto &packet : packets)
+	{
+		if(IsAcceptablePacket(packet.first))
+		{
+			data_list.push_back(packet.second);
+		}
+	}
+
+	if(data_list.empty())
+	{
+		return false;
+	}
+
+	return _rtp_rtcp->SendOutgoingData(data_list);
 }
\ No newline at end of file
@@ -18,8 +18,8 @@
  *   - Send -						  - Recv -
  * [MediaRouter]					[  ICEPort  ]
  * [ Publisher ]					[ Publisher ]
- * [Application][Stream Queue]		[Application][Packet Queue]
- * [  Stream   ]					      |
+ * [Application][Stream Queue]		[  Stream   ]
+ * [  Stream   ]					[StreamWorker][Packet Queue]
  * [  Session  ]					[  Session	]
  * -------------------------------------------------------
  * 					Session Node
@@ -29,7 +29,8 @@
  * [    DTLS   ]					[SRTP] [SCTP]
  * [  ICE/STUN ]					[  RTP_RTCP	]
  *
- * Application당 하나의 Thread를 돌리고, 외부 데이터 입력을 받은 Queue를 처리한다.
+ * Application당 하나의 Thread를 돌리고, Router에서 받은 Frame Queue를 처리한다.
+ * 하나의 Session은 송신/수신 모두 같은 StreamWorker thread(session id로 선택)에서 처리된다.
  * ICE/STUN 역할을 하는 IcePort는 하나만 존재한다.
  *
  * DtlsTransport는 다음과 같은 Layer에서 동작한다.
@@ -63,12 +64,16 @@ public:
 	std::shared_ptr<SessionDescription> GetPeerSDP();
 
 	bool SendOutgoingData(uint32_t packet_type, std::shared_ptr<ov::Data> packet) override;
+	bool SendOutgoingDataBatch(const std::vector<std::pair<uint32_t, std::shared_ptr<ov::Data>>> &packets) override;
 	void OnPacketReceived(std::shared_ptr<SessionInfo> session_info, std::shared_ptr<const ov::Data> data) override;
 
 	uint8_t GetVideoPayloadType();
 	uint8_t GetAudioPayloadType();
 
 private:
+	// packet_type에 해당하는 패킷을 이 Session으로 보내야 하는지 확인한다.
+	bool IsAcceptablePacket(uint32_t packet_type);
+
 	std::shared_ptr<RtpRtcp>            _rtp_rtcp;
 	std::shared_ptr<SrtpTransport>      _srtp_transport;
 	std::shared_ptr<DtlsTransport>      _dtls_transport;
@@ -120,12 +120,8 @@ std::shared_ptr<SessionDescription> WebRtcPublisher::OnRequestOffer(const ov::St
 
 	ice_candidates->push_back(RtcIceCandidate(GetCandidateProto(), ov::SocketAddress(GetCandidateIP(), GetCandidatePort()), 0, ""));
 
-	auto session_description = std::make_shared<SessionDescription>(*stream->GetSessionDescription());
-
-	session_description->SetIceUfrag(_ice_port->GenerateUfrag());
-	session_description->Update();
-
-	return session_description;
+	// Stream의 offer를 template으로 ice-ufrag만 바꿔서 만든다 (매번 전체 SDP를 serialize 하지 않음)
+	return stream->GetSessionDescription()->CreateOfferWithIceUfrag(_ice_port->GenerateUfrag());
 }
 
 // 클라이언트가 자신의 SDP를 보내면 다음 함수를 호출한다.
@@ -157,7 +153,7 @@ bool WebRtcPublisher::OnAddRemoteDescription(const ov::String &application_name,
 
 		// ice_port에 SessionInfo을 전달한다.
 		// 향후 해당 session에서 Ice를 통해 패킷이 들어오면 SessionInfo와 함께 Callback을 준다.
-		_ice_port->AddSession(session, offer_sdp, peer_sdp);
+		_ice_port->AddSession(IcePortObserver::GetSharedPtr(), session, offer_sdp, peer_sdp);
 	}
 	else
 	{